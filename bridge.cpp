@@ -1,11 +1,26 @@
 // bridge.cpp - include per compatibilità Arduino IDE
 #include "lib/core/Core.cpp"
 #include "lib/core/EventBus.cpp"
+#include "lib/core/EventChannel.cpp"
+#include "lib/core/EventMetrics.cpp"
+#include "lib/core/EventPayloadPool.cpp"
+#include "lib/core/EventQueue.cpp"
 #include "lib/hardware/DisplayManager.cpp"
 #include "lib/hardware/EncoderManager.cpp"
+#include "lib/hardware/LEDAnimator.cpp"
 #include "lib/hardware/LEDManager.cpp"
+#include "lib/hardware/LvglAllocator.cpp"
+#include "lib/hardware/NeoPixelRMT.cpp"
+#include "lib/hardware/SimpleBuzzer.cpp"
+#include "lib/hardware/UiStateStore.cpp"
 #include "lib/network/WebServerManager.cpp"
 #include "lib/network/WiFiManager.cpp"
+#include "lib/utils/AsyncLogger.cpp"
+#include "lib/utils/BootProfiler.cpp"
+#include "lib/utils/LatencyTracer.cpp"
+#include "lib/utils/JsonHelper.cpp"
+#include "lib/utils/MemoryBudget.cpp"
 #include "lib/utils/NTPManager.cpp"
 #include "lib/utils/QRCodeManager.cpp"
+#include "lib/utils/TaskProfiler.cpp"
 #include "lib/prefs/PreferencesManager.cpp"
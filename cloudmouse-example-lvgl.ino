@@ -19,6 +19,7 @@
 #include "lib/network/WebServerManager.h"
 #include "lib/hardware/LEDManager.h"
 #include "lib/utils/Logger.h"
+#include "lib/utils/BootProfiler.h"
 
 using namespace CloudMouse;
 
@@ -29,19 +30,9 @@ WiFiManager wifi;
 WebServerManager webServer(wifi);
 LEDManager ledManager;
 
-Ticker lvgl_ticker;
-
-/**
- * @brief Callback del Ticker per LVGL.
- * Questa funzione è un "Interrupt Service Routine" (ISR) leggero.
- * DEVE essere globale o statica.
- */
-void lv_tick_task(void) {
-    lv_tick_inc(5); // 3. Informa LVGL che sono passati 5ms
-}
-
 void setup() {
     Serial.begin(115200);
+    Utils::AsyncLogger::begin();   // Deferred log formatting on Core 0
     delay(1000);
 
     // Welcome message
@@ -49,11 +40,14 @@ void setup() {
     SDK_LOGGER("🚀 CloudMouse SDK Boilerplate v1.0");
     SDK_LOGGER("   Ready to build something amazing! 🎯");
     
-    // Initialize hardware components
+    // Initialize the fast hardware components
     SimpleBuzzer::init();
+    Utils::BootProfiler::begin("encoder.init");
     encoder.init();
-    display.init();
+    Utils::BootProfiler::end("encoder.init");
+    Utils::BootProfiler::begin("led.init");
     ledManager.init();
+    Utils::BootProfiler::end("led.init");
 
     // Register components with the Core event system
     Core::instance().setEncoder(&encoder);
@@ -62,18 +56,17 @@ void setup() {
     Core::instance().setWebServer(&webServer);
     Core::instance().setLEDManager(&ledManager);
 
-    // Start dual-core operation
-    Core::instance().startUITask();     // UI rendering on Core 1
-    Core::instance().initialize();      // Event system on Core 0
-    
-    lvgl_ticker.attach_ms(5, lv_tick_task);
+    // Start dual-core operation: WiFi associates on Core 0 while the display
+    // and LVGL come up here on Core 1
+    Core::instance().initialize();      // Event system and settings
+    Core::instance().startCoordinationTask(); // Event-driven coordination on Core 0, starts WiFi
+    display.init();                     // LGFX, LVGL buffers, UI
+    Core::instance().startUITask();     // UI rendering on Core 1, ends the boot screen
 
     SDK_LOGGER("✅ System ready!");
 }
 
 void loop() {
-    // Main coordination loop (20Hz on Core 0)
-    // Core 1 handles UI independently for smooth performance
-    Core::instance().coordinationLoop();
-    delay(50);
+    // Core and UI work runs in their own FreeRTOS tasks: free the loop task
+    vTaskDelete(NULL);
 }
\ No newline at end of file
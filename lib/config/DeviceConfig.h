@@ -200,6 +200,52 @@ namespace CloudMouse
  */
 #define GET_AP_PASSWORD() DeviceID::getAPPasswordSecure()
 
+/**
+ * Background WiFi scanning (lib/network/WiFiManager.cpp)
+ *
+ * Scans run asynchronously from WiFiManager::update() and fill a cached,
+ * de-duplicated network list that the provisioning portal reads, so entering
+ * AP mode never waits for a scan.
+ *
+ * - WIFI_SCAN_MAX_NETWORKS: networks kept in the cache (strongest first)
+ * - WIFI_SCAN_INTERVAL_MS: rescan period while in AP mode
+ * - WIFI_SCAN_RETRY_MS: rescan period while the cache is still empty
+ * - WIFI_SCAN_TIMEOUT_MS: a scan still running after this is abandoned
+ */
+#define WIFI_SCAN_MAX_NETWORKS 20
+#define WIFI_SCAN_INTERVAL_MS 30000
+#define WIFI_SCAN_RETRY_MS 5000
+#define WIFI_SCAN_TIMEOUT_MS 15000
+
+/**
+ * Fast reconnect (lib/network/WiFiManager.cpp)
+ *
+ * After each successful connection WiFiManager stores the access point BSSID,
+ * channel and DHCP lease in NVS. connectWithSavedCredentials() then first
+ * tries a directed connect to that BSSID on that channel (no channel scan),
+ * with the lease applied as static IP (no DHCP exchange). If it is not online
+ * within WIFI_FAST_CONNECT_TIMEOUT_MS, or the attempt is rejected, the record
+ * is dropped and the normal scan + DHCP connect runs.
+ *
+ * A reused lease is never handed to the app: when the link is up on it,
+ * update() switches the interface back to DHCP while the state stays
+ * CONNECTING. CONNECTED (and WIFI_CONNECTED) follow the DHCP GOT_IP; without
+ * an answer within WIFI_FAST_CONNECT_RENEW_TIMEOUT_MS the record is dropped
+ * and the full connect runs. Only addresses obtained through DHCP are
+ * stored, so an expired lease is not carried from boot to boot.
+ *
+ * - WIFI_FAST_CONNECT_ENABLED: 0 always uses the full procedure
+ * - WIFI_FAST_CONNECT_STATIC_IP: 0 keeps DHCP and only skips the scan
+ *   (for networks where the router may reassign the last address)
+ * - WIFI_FAST_CONNECT_TIMEOUT_MS: budget of the fast attempt up to GOT_IP
+ * - WIFI_FAST_CONNECT_RENEW_TIMEOUT_MS: budget of the DHCP confirmation of a
+ *   reused lease
+ */
+#define WIFI_FAST_CONNECT_ENABLED 1
+#define WIFI_FAST_CONNECT_STATIC_IP 1
+#define WIFI_FAST_CONNECT_TIMEOUT_MS 3000
+#define WIFI_FAST_CONNECT_RENEW_TIMEOUT_MS 5000
+
 // ============================================================================
 // WEB SERVICE CONFIGURATION
 // ============================================================================
@@ -228,6 +274,17 @@ namespace CloudMouse
  */
 #define WIFI_CONFIG_SERVICE "http://192.168.4.1/"
 
+/**
+ * Metrics endpoints while connected (lib/network/WebServerManager.cpp)
+ *
+ * The /api/metrics routes (see WebServerManager.h) are part of the setup
+ * portal; with WEB_METRICS_WHEN_CONNECTED the web server is also started on
+ * the station interface once WiFi is CONNECTED, serving only these routes
+ * (no configuration page, no /config). They are unauthenticated: disable on
+ * networks where task names and queue counters should not be readable.
+ */
+#define WEB_METRICS_WHEN_CONNECTED 1
+
 /**
  * Device manufacturer
  * 
@@ -236,6 +293,368 @@ namespace CloudMouse
  */
 #define DEVICE_MANUFACTURER "Cloudmouse"
 
+/**
+ * WebSocket client receive path (lib/network/WebSocketClient.cpp)
+ *
+ * - WS_TRANSPORT_BUFFER_SIZE: ESP-IDF client buffer; a message that fits in
+ *   one frame of this size reaches the callbacks without being copied
+ * - WS_RX_BUFFER_SIZE: initial size of the reassembly buffer (PSRAM) for
+ *   split frames and fragmented messages, doubled on demand
+ * - WS_RX_MAX_MESSAGE_SIZE: largest message accepted, bigger ones are dropped
+ */
+#define WS_TRANSPORT_BUFFER_SIZE 4096
+#define WS_RX_BUFFER_SIZE 8192
+#define WS_RX_MAX_MESSAGE_SIZE (256 * 1024)
+
+/**
+ * WebSocket client send path (WebSocketClient::sendText() / sendBinary())
+ *
+ * Messages are copied into a bounded queue and written by a sender task, so
+ * callers never wait on the network.
+ *
+ * - WS_SEND_QUEUE_DEPTH: queued outbound messages (max 255); when full the
+ *   client's WsSendPolicy applies
+ * - WS_SEND_TIMEOUT_MS: longest time the sender task waits for one frame
+ * - WS_SEND_BATCH_MAX_SIZE: frame size limit when batching is enabled
+ * - WS_SEND_TASK_PRIORITY / WS_SEND_TASK_CORE: sender task placement
+ */
+#define WS_SEND_QUEUE_DEPTH 16
+#define WS_SEND_TIMEOUT_MS 2000
+#define WS_SEND_BATCH_MAX_SIZE 1024
+#define WS_SEND_TASK_PRIORITY 1
+#define WS_SEND_TASK_CORE 0
+
+/**
+ * BLE HID report queue (lib/network/BleReportQueue.cpp)
+ *
+ * BleKeyboard reports are queued and notified by a task, one per BLE
+ * connection interval, instead of blocking the caller for each key.
+ *
+ * - BLE_HID_QUEUE_DEPTH: queued reports (typing one character needs 1-2)
+ * - BLE_HID_QUEUE_TIMEOUT_MS: longest a caller waits on a full queue
+ * - BLE_HID_DEFAULT_INTERVAL_US: pacing while the connection interval is unknown
+ * - BLE_HID_MIN_INTERVAL_US: pacing floor (7.5 ms is the BLE minimum)
+ * - BLE_HID_TASK_PRIORITY / BLE_HID_TASK_CORE: delivery task placement
+ */
+#define BLE_HID_QUEUE_DEPTH 64
+#define BLE_HID_QUEUE_TIMEOUT_MS 1000
+#define BLE_HID_DEFAULT_INTERVAL_US 15000
+#define BLE_HID_MIN_INTERVAL_US 7500
+#define BLE_HID_TASK_PRIORITY 2
+#define BLE_HID_TASK_CORE 0
+
+/**
+ * JSON parsing (lib/utils/JsonHelper.cpp)
+ *
+ * - JSON_ARENA_SIZE: PSRAM block of each JsonParser; a parsed document
+ *   larger than this spills to regular PSRAM allocations (counted)
+ * - JSON_NESTING_LIMIT: maximum nesting depth accepted by the parsers
+ */
+#define JSON_ARENA_SIZE (16 * 1024)
+#define JSON_NESTING_LIMIT 10
+
+// ============================================================================
+// DISPLAY RENDERING CONFIGURATION
+// ============================================================================
+
+/**
+ * Asynchronous DMA flush
+ *
+ * If true the LVGL flush callback starts a DMA transfer of the rendered stripe
+ * and returns immediately, so LVGL can render the next stripe into the second
+ * buffer while the SPI bus is still busy. LVGL waits for the transfer to
+ * complete (through the flush wait callback) only before reusing a buffer.
+ *
+ * The SPI transaction is kept open for the whole display lifetime, so the
+ * display bus must not be shared with other SPI peripherals in this mode.
+ *
+ * if `false` every stripe is pushed synchronously (CPU blocked until done).
+ */
+#define DISPLAY_DMA_FLUSH true
+
+/**
+ * LVGL draw buffer placement
+ *
+ * Memory region used for the two LVGL draw buffers:
+ * - DISPLAY_BUFFER_INTERNAL: internal DMA-capable SRAM (fastest rasterizer and DMA,
+ *   costs main heap)
+ * - DISPLAY_BUFFER_PSRAM: external PSRAM (preserves main heap, slower access)
+ * - DISPLAY_BUFFER_MIXED: first buffer in internal SRAM, second in PSRAM
+ *
+ * Falls back to PSRAM when internal SRAM cannot satisfy the request
+ * (always the case for DIRECT and FULL render modes).
+ */
+#define DISPLAY_BUFFER_INTERNAL 0
+#define DISPLAY_BUFFER_PSRAM 1
+#define DISPLAY_BUFFER_MIXED 2
+
+#define DISPLAY_BUFFER_MEMORY DISPLAY_BUFFER_PSRAM
+
+/**
+ * LVGL draw buffer height
+ *
+ * Number of display lines held by each draw buffer in PARTIAL render mode
+ * (each buffer is 480 x lines x bytes-per-pixel). Taller stripes mean fewer
+ * flushes per frame but more RAM. Ignored by DIRECT and FULL modes.
+ */
+#define DISPLAY_BUFFER_LINES 32
+
+/**
+ * LVGL render mode
+ *
+ * - DISPLAY_RENDER_PARTIAL: render invalidated areas into small stripes
+ * - DISPLAY_RENDER_DIRECT: two screen-sized buffers, only dirty areas are redrawn
+ * - DISPLAY_RENDER_FULL: two screen-sized buffers, whole screen redrawn every frame
+ *
+ * Use the `bench display` serial command to compare configurations on the device.
+ */
+#define DISPLAY_RENDER_PARTIAL 0
+#define DISPLAY_RENDER_DIRECT 1
+#define DISPLAY_RENDER_FULL 2
+
+#define DISPLAY_RENDER_MODE DISPLAY_RENDER_PARTIAL
+
+/**
+ * UI task scheduling
+ *
+ * The UI task sleeps until the next LVGL timer deadline, an EventBus
+ * notification (sendToUI) or an encoder interrupt, whichever comes first.
+ *
+ * - UI_TASK_MAX_SLEEP_MS: upper bound for a single sleep when nothing is scheduled
+ * - UI_TASK_INPUT_POLL_MS: polling period while the encoder button is held or a
+ *   double-click window is open (press timing is still time-based)
+ */
+#define UI_TASK_MAX_SLEEP_MS 1000
+#define UI_TASK_INPUT_POLL_MS 10
+
+/**
+ * Encoder input capture (lib/hardware/EncoderManager.cpp)
+ *
+ * Detents (PCNT limit interrupt) and button edges (GPIO interrupt) are
+ * timestamped in the ISR and queued in a small ring that the UI task drains,
+ * so gesture timing does not depend on how late the task runs.
+ *
+ * - ENCODER_INPUT_RING_SIZE: records buffered between two UI task passes
+ * - ENCODER_BUTTON_DEBOUNCE_US: edges closer than this to the last accepted
+ *   button transition are treated as contact bounce
+ */
+#define ENCODER_INPUT_RING_SIZE 32
+#define ENCODER_BUTTON_DEBOUNCE_US 5000
+
+/**
+ * Encoder rotation velocity and acceleration (EncoderManager::setAcceleration())
+ *
+ * Velocity is the sum of the detents timestamped within the last
+ * ENCODER_VELOCITY_WINDOW_MS, scaled to detents per second. With acceleration,
+ * each detent counts as 1 step below ENCODER_ACCEL_START_DPS, rising linearly
+ * to ENCODER_ACCEL_MAX_MULTIPLIER steps at ENCODER_ACCEL_FULL_DPS.
+ *
+ * - ENCODER_VELOCITY_SAMPLES: timestamped detents kept (bounds the measurable
+ *   speed to SAMPLES per window)
+ * - ENCODER_ACCEL_MAX_MULTIPLIER: 1 = acceleration off (default)
+ */
+#define ENCODER_VELOCITY_SAMPLES 32
+#define ENCODER_VELOCITY_WINDOW_MS 100
+#define ENCODER_ACCEL_START_DPS 15
+#define ENCODER_ACCEL_FULL_DPS 80
+#define ENCODER_ACCEL_MAX_MULTIPLIER 1
+
+/**
+ * LED ring animation engine (lib/hardware/LEDAnimator.cpp)
+ *
+ * Effects are keyframe tracks on composited layers; the animation task sleeps
+ * until the next keyframe deadline or an LED event, so a static ring costs no
+ * wakeups.
+ *
+ * - LED_LAYER_COUNT: composited layers (LEDManager uses 5)
+ * - LED_TRACK_MAX_KEYFRAMES: keyframes per brightness / parameter track
+ *   (LEDManager effects use up to 6)
+ * - LED_FRAME_MS: minimum interval between frames during a transition
+ * - LED_GAMMA_X10: gamma applied to keyframe brightness (22 = 2.2)
+ */
+#define LED_LAYER_COUNT 5
+#define LED_TRACK_MAX_KEYFRAMES 8
+#define LED_FRAME_MS 20
+#define LED_GAMMA_X10 22
+
+/**
+ * Core coordination task (lib/core/Core.cpp)
+ *
+ * Blocks on its task notification, which every event queued for Core sets, so
+ * events are handled as soon as they arrive. Periodic work runs in service
+ * slots; the task sleeps until the nearest slot deadline.
+ *
+ * - CORE_TASK_STACK_SIZE / CORE_TASK_PRIORITY / CORE_TASK_CORE: task parameters
+ * - CORE_WIFI_SERVICE_MS: boot sequence, wifi->update() and state transitions
+ * - CORE_WEBSERVER_SERVICE_MS: webServer->update(), which only applies submitted
+ *   credentials (AP mode only; requests are served by the AsyncTCP task)
+ * - CORE_APP_UPDATE_MS: IAppOrchestrator::update()
+ * - CORE_SERIAL_POLL_MS: serial command polling
+ * - CORE_PREFS_SERVICE_MS: PreferencesManager::update(), commits due writes
+ * - CORE_HEALTH_CHECK_MS: checkHealth() report, also the longest single sleep
+ */
+#define CORE_TASK_STACK_SIZE 8192
+#define CORE_TASK_PRIORITY 2
+#define CORE_TASK_CORE 0
+#define CORE_WIFI_SERVICE_MS 50
+#define CORE_WEBSERVER_SERVICE_MS 100
+#define CORE_APP_UPDATE_MS 50
+#define CORE_SERIAL_POLL_MS 50
+#define CORE_PREFS_SERVICE_MS 250
+#define CORE_HEALTH_CHECK_MS 5000
+
+/**
+ * Preferences write-back cache (lib/prefs/PreferencesManager.cpp)
+ *
+ * Writes go to a RAM mirror of the NVS namespace and are committed together.
+ *
+ * - PREFS_COMMIT_DELAY_MS: quiet period after the last write before committing,
+ *   so a burst (e.g. a setting changed step by step with the knob) is one commit
+ * - PREFS_COMMIT_MAX_DELAY_MS: commit at the latest this long after the first
+ *   pending write, even if writes keep coming
+ */
+#define PREFS_COMMIT_DELAY_MS 2000
+#define PREFS_COMMIT_MAX_DELAY_MS 10000
+
+/**
+ * Task profiler (lib/utils/TaskProfiler.cpp)
+ *
+ * Sampled by Core::checkHealth(); report via the "tasks" serial command and
+ * GET /api/metrics/tasks.
+ *
+ * - TASK_PROFILER_MAX_TASKS: tasks captured per sample (a sample is skipped
+ *   when more tasks exist)
+ * - TASK_PROFILER_HISTORY: per-core summaries kept (one per health check)
+ */
+#define TASK_PROFILER_MAX_TASKS 32
+#define TASK_PROFILER_HISTORY 12
+
+/**
+ * Boot sequence (lib/core/Core.cpp) and boot profiler (lib/utils/BootProfiler.cpp)
+ *
+ * WiFi association starts on Core 0 as soon as the coordination task runs,
+ * while the display and LVGL come up on Core 1; the boot screen ends when the
+ * UI task has drawn its first frame.
+ *
+ * - BOOT_UI_TIMEOUT_MS: leave the boot state without a UI after this long
+ *   (no display, or the display failed to initialize)
+ * - BOOT_PROFILER_MAX_PHASES: phases kept for the "boot" timeline
+ */
+#define BOOT_UI_TIMEOUT_MS 10000
+#define BOOT_PROFILER_MAX_PHASES 24
+
+/**
+ * Input-to-photon latency tracer (lib/utils/LatencyTracer.cpp)
+ *
+ * Follows each encoder snapshot from the interrupt to the flush of the frame
+ * that shows it (publish, UI queue, DisplayManager handling, render start,
+ * flush) and reports per-stage distributions via the "latency" serial
+ * command. Off by default: the hooks are compiled out.
+ *
+ * - INPUT_LATENCY_TRACE: 1 to enable
+ * - LATENCY_TRACE_PENDING: traces in flight at once (more are dropped)
+ * - LATENCY_TRACE_WINDOW: samples kept per stage
+ * - LATENCY_TRACE_TIMEOUT_MS: a handled trace with no frame drawn within this
+ *   time is counted as "no redraw" (the input changed nothing on screen)
+ */
+#define INPUT_LATENCY_TRACE 0
+#define LATENCY_TRACE_PENDING 8
+#define LATENCY_TRACE_WINDOW 64
+#define LATENCY_TRACE_TIMEOUT_MS 500
+
+/**
+ * Idle render mode
+ *
+ * What LVGL does once the backlight has faded to BRIGHTNESS_IDLE_TARGET, until
+ * the next wake-up (encoder input or display event):
+ * - DISPLAY_IDLE_RENDER_NORMAL: keep rendering at the normal refresh rate
+ * - DISPLAY_IDLE_RENDER_STRETCH: refresh and animations run every
+ *   DISPLAY_IDLE_REFR_PERIOD_MS (slow-changing content like clocks stays live)
+ * - DISPLAY_IDLE_RENDER_PAUSE: LVGL timers are not run at all, only screen changes
+ *   are drawn; the UI task sleeps until the next event
+ */
+#define DISPLAY_IDLE_RENDER_NORMAL 0
+#define DISPLAY_IDLE_RENDER_STRETCH 1
+#define DISPLAY_IDLE_RENDER_PAUSE 2
+
+#define DISPLAY_IDLE_RENDER DISPLAY_IDLE_RENDER_PAUSE
+#define DISPLAY_IDLE_REFR_PERIOD_MS 1000
+
+/**
+ * Screen cache
+ *
+ * Screens are built on first display and kept in an LRU cache afterwards.
+ *
+ * - SCREEN_CACHE_MAX: maximum number of screens kept alive at the same time
+ *   (the active screen is never evicted)
+ * - SCREEN_CACHE_MIN_FREE_PCT: evict least recently used screens while the LVGL
+ *   heap has less than this percentage free
+ *
+ * Setup screens (WiFi connecting, AP mode, AP connected) and the benchmark screen
+ * are transient: they are deleted as soon as a regular screen is shown.
+ */
+#define SCREEN_CACHE_MAX 3
+#define SCREEN_CACHE_MIN_FREE_PCT 20
+
+/**
+ * UI state store (lib/hardware/UiStateStore.cpp)
+ *
+ * Labels bound to state values are formatted and redrawn at most once per
+ * DisplayManager::update(), and only when their text changed.
+ *
+ * - UI_STATE_MAX_BINDINGS: labels bound at the same time (all cached screens)
+ * - UI_STATE_TEXT_MAX: longest formatted text in bytes, terminator included
+ */
+#define UI_STATE_MAX_BINDINGS 16
+#define UI_STATE_TEXT_MAX 64
+
+/**
+ * LVGL memory allocator (lib/hardware/LvglAllocator.cpp)
+ *
+ * Used when lv_conf.h selects LV_USE_STDLIB_MALLOC LV_STDLIB_CUSTOM.
+ *
+ * - LVGL_SLAB_BLOCKS_*: blocks per slab size class, allocated in internal SRAM
+ *   (16/32/64/128/256 byte classes, ~38 KB with the defaults)
+ * - LVGL_PSRAM_POOL_SIZE: TLSF region in PSRAM for blocks above 256 bytes and
+ *   for slab overflow
+ *
+ * Use the `display stats` serial command to check peaks and overflows per class.
+ */
+#define LVGL_SLAB_BLOCKS_16 384
+#define LVGL_SLAB_BLOCKS_32 256
+#define LVGL_SLAB_BLOCKS_64 128
+#define LVGL_SLAB_BLOCKS_128 64
+#define LVGL_SLAB_BLOCKS_256 32
+#define LVGL_PSRAM_POOL_SIZE (256U * 1024U)
+
+/**
+ * Event payload pool (lib/core/EventPayloadPool.cpp)
+ *
+ * Events carry a handle into this pool instead of an embedded text buffer.
+ *
+ * - EVENT_PAYLOAD_BLOCK_SIZE: bytes per payload (strings keep one byte for the
+ *   terminator; longer payloads are truncated and flagged)
+ * - EVENT_PAYLOAD_BLOCK_COUNT: payloads alive at the same time across both
+ *   EventBus queues and their consumers (max 255)
+ */
+#define EVENT_PAYLOAD_BLOCK_SIZE 128
+#define EVENT_PAYLOAD_BLOCK_COUNT 16
+
+/**
+ * EventBus priority lanes (lib/core/EventChannel.cpp)
+ *
+ * Each direction (UI -> Core, Core -> UI) has one queue per EventLane, drained
+ * in priority order. Lane of an event type: eventLane() in Events.h.
+ *
+ * - EVENT_LANE_INTERACTIVE_SIZE: encoder input (bursts are coalesced, so a
+ *   small lane is enough)
+ * - EVENT_LANE_NORMAL_SIZE: display commands (all screen changes) and app events
+ * - EVENT_LANE_BACKGROUND_SIZE: WiFi state
+ */
+#define EVENT_LANE_INTERACTIVE_SIZE 16
+#define EVENT_LANE_NORMAL_SIZE 32
+#define EVENT_LANE_BACKGROUND_SIZE 16
+
 // ============================================================================
 // DEBUGGING CONFIGURATION
 // ============================================================================
@@ -267,6 +686,69 @@ namespace CloudMouse
  */
 #define SDK_DEBUGGER_ACTIVE true
 
+/**
+ * Log level and module filtering (compile time)
+ *
+ * Messages above LOG_LEVEL, or from a module whose bit is clear in
+ * LOG_MODULE_MASK, are removed from the build together with their arguments.
+ * SDK_LOGGER / APP_LOGGER log at info level; per-event traces on hot paths
+ * (EventBus sends, encoder actions, WebSocket frames) use SDK_LOGD.
+ *
+ * Module bits (Logger.h): 0 general, 1 core, 2 eventbus, 3 display, 4 input,
+ * 5 led, 6 network, 7 websocket, 8 prefs, 9 app
+ */
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DEBUG 4
+
+#define LOG_LEVEL LOG_LEVEL_INFO
+#define LOG_MODULE_MASK 0xFFFFFFFFu
+
+/**
+ * Asynchronous logging backend (lib/utils/AsyncLogger.cpp)
+ *
+ * - LOG_ASYNC: capture messages into a ring buffer and print them from a
+ *   low-priority task; false prints synchronously in the caller (useful when
+ *   chasing a crash, since buffered lines are lost on reset)
+ * - LOG_BUFFER_SIZE: ring size in bytes (power of two, max 65536)
+ * - LOG_RECORD_MAX_SIZE: maximum captured size of one message (arguments and
+ *   copied strings beyond it are cut)
+ * - LOG_TASK_PRIORITY / LOG_TASK_CORE: logger task placement
+ * - LOG_FLUSH_INTERVAL_MS: how often the logger task drains the ring
+ */
+#define LOG_ASYNC true
+#define LOG_BUFFER_SIZE 8192
+#define LOG_RECORD_MAX_SIZE 256
+#define LOG_TASK_PRIORITY 1
+#define LOG_TASK_CORE 0
+#define LOG_FLUSH_INTERVAL_MS 20
+
+/**
+ * Static allocation build mode (lib/utils/MemoryBudget.h)
+ *
+ * - SDK_STATIC_ALLOCATION: 1 reserves the fixed SDK resources at link time
+ *   instead of allocating them from the heap at runtime: EventBus lanes, the
+ *   LED event queue, the UI, Core, LED and logger tasks
+ *   (xQueueCreateStatic / xTaskCreateStaticPinnedToCore, internal SRAM), the
+ *   LVGL slab pools and the draw buffers of the configured render mode
+ *   (DISPLAY_BUFFER_MEMORY placement). PSRAM storage (LVGL TLSF region, PSRAM
+ *   draw buffers) goes to .ext_ram.bss when the core enables
+ *   CONFIG_SPIRAM_ALLOW_BSS_SEG_EXTERNAL_MEMORY, otherwise it is allocated
+ *   once at init and never freed. 0 allocates everything from the heap.
+ * - UI_TASK_STACK_SIZE / LED_TASK_STACK_SIZE / LOG_TASK_STACK_SIZE: stack
+ *   bytes of the UI, LED animation and logger tasks
+ * - MEMORY_BUDGET_MAX_ENTRIES: rows of the memory budget report (boot and
+ *   `memory` serial command), which lists the cost of each subsystem in
+ *   either mode
+ */
+#define SDK_STATIC_ALLOCATION 0
+#define UI_TASK_STACK_SIZE 8192
+#define LED_TASK_STACK_SIZE 8192
+#define LOG_TASK_STACK_SIZE 3072
+#define MEMORY_BUDGET_MAX_ENTRIES 24
+
 // ============================================================================
 // CONFIGURATION VALIDATION
 // ============================================================================
@@ -287,6 +769,143 @@ namespace CloudMouse
 #error "PCB_VERSION must be defined as either 4 or 5. Check your hardware version!"
 #endif
 
+// Validate display buffer configuration
+#if DISPLAY_BUFFER_MEMORY < DISPLAY_BUFFER_INTERNAL || DISPLAY_BUFFER_MEMORY > DISPLAY_BUFFER_MIXED
+#error "DISPLAY_BUFFER_MEMORY must be DISPLAY_BUFFER_INTERNAL, DISPLAY_BUFFER_PSRAM or DISPLAY_BUFFER_MIXED"
+#endif
+
+#if DISPLAY_RENDER_MODE < DISPLAY_RENDER_PARTIAL || DISPLAY_RENDER_MODE > DISPLAY_RENDER_FULL
+#error "DISPLAY_RENDER_MODE must be DISPLAY_RENDER_PARTIAL, DISPLAY_RENDER_DIRECT or DISPLAY_RENDER_FULL"
+#endif
+
+#if DISPLAY_BUFFER_LINES < 1 || DISPLAY_BUFFER_LINES > 320
+#error "DISPLAY_BUFFER_LINES must be between 1 and 320"
+#endif
+
+#if DISPLAY_IDLE_RENDER < DISPLAY_IDLE_RENDER_NORMAL || DISPLAY_IDLE_RENDER > DISPLAY_IDLE_RENDER_PAUSE
+#error "DISPLAY_IDLE_RENDER must be DISPLAY_IDLE_RENDER_NORMAL, DISPLAY_IDLE_RENDER_STRETCH or DISPLAY_IDLE_RENDER_PAUSE"
+#endif
+
+#if SCREEN_CACHE_MAX < 1
+#error "SCREEN_CACHE_MAX must keep at least the active screen"
+#endif
+
+#if UI_STATE_MAX_BINDINGS < 1 || UI_STATE_MAX_BINDINGS >= 255 || UI_STATE_TEXT_MAX < 16
+#error "UI_STATE_MAX_BINDINGS must be between 1 and 254 and UI_STATE_TEXT_MAX at least 16"
+#endif
+
+#if EVENT_PAYLOAD_BLOCK_SIZE < 8 || EVENT_PAYLOAD_BLOCK_SIZE > 65535
+#error "EVENT_PAYLOAD_BLOCK_SIZE must be between 8 and 65535 bytes"
+#endif
+
+#if EVENT_PAYLOAD_BLOCK_COUNT < 1 || EVENT_PAYLOAD_BLOCK_COUNT > 255
+#error "EVENT_PAYLOAD_BLOCK_COUNT must be between 1 and 255"
+#endif
+
+#if EVENT_LANE_INTERACTIVE_SIZE < 1 || EVENT_LANE_NORMAL_SIZE < 1 || EVENT_LANE_BACKGROUND_SIZE < 1
+#error "EVENT_LANE_*_SIZE must hold at least one event"
+#endif
+
+#if CORE_TASK_CORE < 0 || CORE_TASK_CORE > 1
+#error "CORE_TASK_CORE must be 0 or 1"
+#endif
+
+#if CORE_WIFI_SERVICE_MS < 1 || CORE_WEBSERVER_SERVICE_MS < 1 || CORE_APP_UPDATE_MS < 1 || CORE_SERIAL_POLL_MS < 1 || CORE_PREFS_SERVICE_MS < 1
+#error "CORE_*_MS service periods must be at least 1 ms"
+#endif
+
+#if CORE_HEALTH_CHECK_MS < CORE_WIFI_SERVICE_MS
+#error "CORE_HEALTH_CHECK_MS must not be shorter than CORE_WIFI_SERVICE_MS"
+#endif
+
+#if PREFS_COMMIT_MAX_DELAY_MS < PREFS_COMMIT_DELAY_MS
+#error "PREFS_COMMIT_MAX_DELAY_MS must not be shorter than PREFS_COMMIT_DELAY_MS"
+#endif
+
+#if TASK_PROFILER_MAX_TASKS < 8 || TASK_PROFILER_HISTORY < 1
+#error "TASK_PROFILER_MAX_TASKS must be at least 8 and TASK_PROFILER_HISTORY at least 1"
+#endif
+
+#if BOOT_PROFILER_MAX_PHASES < 8
+#error "BOOT_PROFILER_MAX_PHASES must be at least 8"
+#endif
+
+#if LATENCY_TRACE_PENDING < 2 || LATENCY_TRACE_WINDOW < 8 || LATENCY_TRACE_TIMEOUT_MS < 50
+#error "LATENCY_TRACE_PENDING must be at least 2, LATENCY_TRACE_WINDOW at least 8 and LATENCY_TRACE_TIMEOUT_MS at least 50"
+#endif
+
+#if UI_TASK_STACK_SIZE < 2048 || LED_TASK_STACK_SIZE < 2048 || LOG_TASK_STACK_SIZE < 2048
+#error "UI_TASK_STACK_SIZE, LED_TASK_STACK_SIZE and LOG_TASK_STACK_SIZE must be at least 2048 bytes"
+#endif
+
+#if MEMORY_BUDGET_MAX_ENTRIES < 8
+#error "MEMORY_BUDGET_MAX_ENTRIES must be at least 8"
+#endif
+
+#if ENCODER_INPUT_RING_SIZE < 4 || ENCODER_INPUT_RING_SIZE > 255
+#error "ENCODER_INPUT_RING_SIZE must be between 4 and 255"
+#endif
+
+#if ENCODER_VELOCITY_SAMPLES < 2 || ENCODER_VELOCITY_SAMPLES > 255 || ENCODER_VELOCITY_WINDOW_MS < 10
+#error "ENCODER_VELOCITY_SAMPLES must be between 2 and 255 and ENCODER_VELOCITY_WINDOW_MS at least 10"
+#endif
+
+#if ENCODER_ACCEL_MAX_MULTIPLIER < 1 || ENCODER_ACCEL_FULL_DPS <= ENCODER_ACCEL_START_DPS
+#error "ENCODER_ACCEL_MAX_MULTIPLIER must be at least 1 and ENCODER_ACCEL_FULL_DPS above ENCODER_ACCEL_START_DPS"
+#endif
+
+#if LED_LAYER_COUNT < 5 || LED_TRACK_MAX_KEYFRAMES < 6 || LED_FRAME_MS < 1
+#error "LED_LAYER_COUNT must be at least 5 and LED_TRACK_MAX_KEYFRAMES at least 6 (LEDManager effects), LED_FRAME_MS at least 1 ms"
+#endif
+
+#if LED_GAMMA_X10 < 10 || LED_GAMMA_X10 > 30
+#error "LED_GAMMA_X10 must be between 10 (linear) and 30"
+#endif
+
+#if WS_TRANSPORT_BUFFER_SIZE < 512 || WS_RX_BUFFER_SIZE < 256 || WS_RX_MAX_MESSAGE_SIZE < WS_RX_BUFFER_SIZE
+#error "WS_TRANSPORT_BUFFER_SIZE must be at least 512, WS_RX_BUFFER_SIZE at least 256 and WS_RX_MAX_MESSAGE_SIZE not below WS_RX_BUFFER_SIZE"
+#endif
+
+#if WS_SEND_QUEUE_DEPTH < 1 || WS_SEND_QUEUE_DEPTH > 255 || WS_SEND_BATCH_MAX_SIZE < 64
+#error "WS_SEND_QUEUE_DEPTH must be between 1 and 255 and WS_SEND_BATCH_MAX_SIZE at least 64"
+#endif
+
+#if WS_SEND_TASK_CORE < 0 || WS_SEND_TASK_CORE > 1
+#error "WS_SEND_TASK_CORE must be 0 or 1"
+#endif
+
+#if BLE_HID_QUEUE_DEPTH < 4 || BLE_HID_MIN_INTERVAL_US < 1000
+#error "BLE_HID_QUEUE_DEPTH must be at least 4 and BLE_HID_MIN_INTERVAL_US at least 1000"
+#endif
+
+#if BLE_HID_TASK_CORE < 0 || BLE_HID_TASK_CORE > 1
+#error "BLE_HID_TASK_CORE must be 0 or 1"
+#endif
+
+#if JSON_ARENA_SIZE < 1024 || JSON_NESTING_LIMIT < 1
+#error "JSON_ARENA_SIZE must be at least 1024 and JSON_NESTING_LIMIT at least 1"
+#endif
+
+#if WIFI_SCAN_MAX_NETWORKS < 1 || WIFI_SCAN_RETRY_MS > WIFI_SCAN_INTERVAL_MS
+#error "WIFI_SCAN_MAX_NETWORKS must be at least 1 and WIFI_SCAN_RETRY_MS not above WIFI_SCAN_INTERVAL_MS"
+#endif
+
+#if WIFI_FAST_CONNECT_ENABLED && (WIFI_FAST_CONNECT_TIMEOUT_MS < 500 || WIFI_FAST_CONNECT_RENEW_TIMEOUT_MS < 1000)
+#error "WIFI_FAST_CONNECT_TIMEOUT_MS must be at least 500 and WIFI_FAST_CONNECT_RENEW_TIMEOUT_MS at least 1000"
+#endif
+
+#if LOG_LEVEL < LOG_LEVEL_NONE || LOG_LEVEL > LOG_LEVEL_DEBUG
+#error "LOG_LEVEL must be LOG_LEVEL_NONE, LOG_LEVEL_ERROR, LOG_LEVEL_WARN, LOG_LEVEL_INFO or LOG_LEVEL_DEBUG"
+#endif
+
+#if (LOG_BUFFER_SIZE & (LOG_BUFFER_SIZE - 1)) != 0 || LOG_BUFFER_SIZE < 1024 || LOG_BUFFER_SIZE > 65536
+#error "LOG_BUFFER_SIZE must be a power of two between 1024 and 65536"
+#endif
+
+#if LOG_RECORD_MAX_SIZE < 64 || LOG_RECORD_MAX_SIZE > LOG_BUFFER_SIZE / 4
+#error "LOG_RECORD_MAX_SIZE must be at least 64 bytes and at most a quarter of LOG_BUFFER_SIZE"
+#endif
+
 // Validate firmware version is defined
 #ifndef FIRMWARE_VERSION
 #error "FIRMWARE_VERSION must be defined as a valid version string"
@@ -0,0 +1,49 @@
+/**
+ * CloudMouse SDK - UI Font Selection
+ *
+ * CM_FONT_<size> macros used by the UI instead of referencing lv_font_montserrat_*
+ * directly, so the build can swap built-in fonts for generated subsets.
+ *
+ * - PlatformIO: tools/font_subset.py scans the sources for CM_FONT_* usages and
+ *   string literals, generates subset fonts into src/fonts_generated/ and defines
+ *   CM_USE_SUBSET_FONTS (built-in Montserrat fonts are then disabled in lv_conf.h)
+ * - Arduino IDE or missing lv_font_conv: built-in LVGL Montserrat fonts
+ *
+ * CM_FONT_<size>_NUM selects the numeric-only 8 bpp variant for large numeric
+ * labels (digits and separators only, see custom_font_numeric_chars), falling
+ * back to the full font when no numeric variant was generated.
+ */
+
+#ifndef FONT_CONFIG_H
+#define FONT_CONFIG_H
+
+#include <lvgl.h>
+
+#ifdef CM_USE_SUBSET_FONTS
+
+#include "cm_fonts_generated.h"
+
+#else
+
+#define CM_FONT_12 (&lv_font_montserrat_12)
+#define CM_FONT_14 (&lv_font_montserrat_14)
+#define CM_FONT_16 (&lv_font_montserrat_16)
+#define CM_FONT_18 (&lv_font_montserrat_18)
+#define CM_FONT_20 (&lv_font_montserrat_20)
+#define CM_FONT_24 (&lv_font_montserrat_24)
+#define CM_FONT_28 (&lv_font_montserrat_28)
+#define CM_FONT_32 (&lv_font_montserrat_32)
+#define CM_FONT_36 (&lv_font_montserrat_36)
+#define CM_FONT_48 (&lv_font_montserrat_48)
+
+#endif
+
+#ifndef CM_FONT_36_NUM
+#define CM_FONT_36_NUM CM_FONT_36
+#endif
+
+#ifndef CM_FONT_48_NUM
+#define CM_FONT_48_NUM CM_FONT_48
+#endif
+
+#endif
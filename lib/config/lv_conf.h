@@ -4,10 +4,34 @@
 #define LV_USE_PERF_MONITOR 1
 #define LV_USE_MEM_MONITOR 1
 
+// 16 = RGB565 (expanded to RGB666 by LovyanGFX on every flush)
+// 24 = RGB888 rendered in the panel's native 3-byte format, pushed without conversion
+#ifndef LV_COLOR_DEPTH
 #define LV_COLOR_DEPTH 16
+#endif
 #define LV_COLOR_16_SWAP 1
+
+// Size-class allocator (lib/hardware/LvglAllocator.cpp): slab pools in internal
+// SRAM for small objects, TLSF region in PSRAM for large blocks.
+// Set to LV_STDLIB_BUILTIN to go back to the single LV_MEM_SIZE pool.
+// The host simulator (env:native) has no PSRAM split: one builtin pool sized
+// for the device's slabs plus PSRAM region.
+#if CLOUDMOUSE_SIM
+#define LV_USE_STDLIB_MALLOC LV_STDLIB_BUILTIN
+#define LV_MEM_SIZE (512U * 1024U)
+#else
+#define LV_USE_STDLIB_MALLOC LV_STDLIB_CUSTOM
 #define LV_MEM_SIZE (48U * 1024U)
+#endif
 
+// Fonts: UI code uses the CM_FONT_* macros from FontConfig.h.
+// CM_USE_SUBSET_FONTS is defined by tools/font_subset.py (PlatformIO) when the
+// subset fonts were generated: the full built-in fonts are then left out.
+#ifdef CM_USE_SUBSET_FONTS
+#define LV_FONT_MONTSERRAT_14 0
+#define LV_FONT_CUSTOM_DECLARE LV_FONT_DECLARE(cm_font_montserrat_14)
+#define LV_FONT_DEFAULT &cm_font_montserrat_14
+#else
 #define LV_FONT_MONTSERRAT_12 1
 #define LV_FONT_MONTSERRAT_14 1
 #define LV_FONT_MONTSERRAT_16 1
@@ -20,6 +44,7 @@
 #define LV_FONT_MONTSERRAT_48 1
 
 #define LV_FONT_DEFAULT &lv_font_montserrat_14
+#endif
 #define LV_TXT_ENC LV_TXT_ENC_UTF8
 
 #define LV_TICK_CUSTOM 1
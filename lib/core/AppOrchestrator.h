@@ -0,0 +1,54 @@
+/**
+ * CloudMouse SDK - App Orchestrator Interface
+ *
+ * Contract between the SDK and an application: Core initializes the app,
+ * calls update() from the coordination task and forwards the SDK events the
+ * app subscribed to.
+ *
+ * Kept apart from Core.h so the app layer only depends on the event types
+ * and can also be built by the host simulator (src/sim/), which stands in
+ * for Core.
+ */
+
+#pragma once
+
+#include "Events.h"
+
+namespace CloudMouse
+{
+
+  /**
+   * Interface for custom App orchestrators
+   * Any app that wants to receive SDK events must implement this
+   */
+  class IAppOrchestrator
+  {
+  public:
+    virtual ~IAppOrchestrator() = default;
+
+    /**
+     * App orchestrator initialization
+     */
+    virtual bool initialize() = 0;
+
+    /**
+     * App Orchestrator update loop
+     */
+    virtual void update() = 0;
+
+    /**
+     * Process SDK events
+     * Used by Core when we need to forward events to App Orchestrator
+     */
+    virtual void processSDKEvent(const CloudMouse::Event &event) = 0;
+
+    /**
+     * Event types delivered to processSDKEvent()
+     * Override to receive only what the app handles (default: everything)
+     * ENCODER_INPUT snapshots are delivered as they are and also expanded into
+     * the legacy ENCODER_* events, so either kind of subscription works.
+     */
+    virtual EventMask getSubscribedEvents() const { return EVENT_MASK_ALL; }
+  };
+
+} // namespace CloudMouse
@@ -16,6 +16,7 @@ namespace CloudMouse
   void Core::initialize()
   {
     SDK_LOGGER("🚀 Core initialization starting...");
+    Utils::BootProfiler::begin("core.init");
 
     // Output device identification
     DeviceID::printDeviceInfo();
@@ -23,14 +24,24 @@ namespace CloudMouse
     // Initialize event communication system
     EventBus::instance().initialize();
 
+    // Load settings into the preferences RAM mirror
+    prefs.init();
+
     // Initialize app orchestrator
     if (appOrchestrator) {
       appOrchestrator->initialize();
     }
 
+    // Published input goes straight to the display (UI queue) and, for the
+    // LED/buzzer feedback and app subscriptions, to the Core queue
+    EventBus::instance().subscribeUI(EVENT_MASK_ENCODER);
+    mainSubscription = EventBus::instance().subscribeMain(CORE_EVENT_MASK);
+    updateSubscriptions();
+
     // Start system in booting state (shows LED animation)
     setState(SystemState::BOOTING);
 
+    Utils::BootProfiler::end("core.init");
     SDK_LOGGER("🎬 Boot sequence started - LED animation active");
     SDK_LOGGER("✅ Core initialized successfully");
   }
@@ -43,20 +54,18 @@ namespace CloudMouse
       return;
     }
 
-    // Create UI task on Core 1 for smooth 30Hz rendering
-    xTaskCreatePinnedToCore(
+    // Create UI task on Core 1, woken by LVGL deadlines, events and encoder interrupts
+    uiTaskHandle = uiTaskStorage.create(
         uiTaskFunction,
         "UI_Task",
-        8192, // 8KB stack
         this, // Pass Core instance
         1,    // High priority for UI responsiveness
-        &uiTaskHandle,
-        1 // Pin to Core 1
+        1     // Pin to Core 1
     );
 
     if (uiTaskHandle)
     {
-      SDK_LOGGER("✅ UI Task running on Core 1 (30Hz)");
+      SDK_LOGGER("✅ UI Task running on Core 1 (deadline driven)");
 
       // Start LED animation system
       if (ledManager)
@@ -83,6 +92,7 @@ namespace CloudMouse
 
     setState(SystemState::RUNNING);
     SDK_LOGGER("✅ System started - CloudMouse RUNNING");
+    markBootReady();
   }
 
   // ============================================================================
@@ -100,52 +110,143 @@ namespace CloudMouse
   }
 
   // ============================================================================
-  // MAIN COORDINATION LOOP (Core 0 - 20Hz)
+  // COORDINATION TASK (Core 0 - event driven)
   // ============================================================================
 
-  void Core::coordinationLoop()
+  void Core::startCoordinationTask()
   {
-    // Handle boot sequence timing
-    if (currentState == SystemState::BOOTING)
+    if (coordinationTaskHandle != nullptr)
     {
-      handleBootingState();
+      SDK_LOGGER("🧭 Coordination Task already running");
+      return;
     }
 
-    // WiFi management and state handling
-    if (wifi)
+    coordinationTaskHandle = coordinationTaskStorage.create(
+        coordinationTaskFunction,
+        "Core_Task",
+        this, // Pass Core instance
+        CORE_TASK_PRIORITY,
+        CORE_TASK_CORE);
+
+    if (coordinationTaskHandle)
     {
-      wifi->update();
-      handleWiFiConnection();
+      SDK_LOGGER("✅ Coordination Task running on Core %d (event driven)\n", CORE_TASK_CORE);
     }
-
-    // Web server updates when in AP mode
-    if (wifi && wifi->getState() == WiFiManager::WiFiState::AP_MODE && webServer)
+    else
     {
-      webServer->update();
+      setState(SystemState::ERROR);
+      SDK_LOGGER("❌ Failed to start Coordination Task!");
     }
+  }
 
-    // Auto-transition to running state when ready
-    if (currentState == SystemState::READY)
+  void Core::coordinationLoop()
+  {
+    // Kept for sketches that still drive Core from loop(): the task does the work
+    startCoordinationTask();
+  }
+
+  void Core::coordinationTaskFunction(void *param)
+  {
+    Core *core = static_cast<Core *>(param);
+    core->runCoordinationTask();
+  }
+
+  bool Core::serviceDue(ServiceSlot &slot, uint32_t now, uint32_t &sleepMs)
+  {
+    uint32_t elapsed = now - slot.lastRunMs;
+    bool due = elapsed >= slot.periodMs;
+    if (due)
     {
-      start();
+      slot.lastRunMs = now;
+      elapsed = 0;
     }
 
-    // update loop for app orchestrator
-    if (appOrchestrator) {
-      appOrchestrator->update();
+    // Shorten the next sleep to this slot's deadline
+    uint32_t remaining = slot.periodMs - elapsed;
+    if (remaining < sleepMs)
+    {
+      sleepMs = remaining;
     }
+    return due;
+  }
 
-    // Process user commands and system events
-    processSerialCommands();
-    processEvents();
+  void Core::runCoordinationTask()
+  {
+    SDK_LOGGER("🧭 Coordination Task started on Core %d\n", xPortGetCoreID());
 
-    coordinationCycles++;
+    // Wake source: every event queued for Core (sendToMain / publish)
+    EventBus::instance().setMainTaskHandle(xTaskGetCurrentTaskHandle());
 
-    // System health monitoring (every 5 seconds)
-    if (millis() - lastHealthCheck > 5000)
+    while (true)
     {
-      checkHealth();
-      lastHealthCheck = millis();
+      // Events first: this is what the notification usually woke us for
+      processEvents();
+
+      uint32_t now = millis();
+      uint32_t sleepMs = CORE_HEALTH_CHECK_MS;
+
+      // Boot sequence, WiFi management and state transitions
+      if (serviceDue(wifiSlot, now, sleepMs))
+      {
+        if (currentState == SystemState::BOOTING)
+        {
+          handleBootingState();
+        }
+
+        if (wifi)
+        {
+          wifi->update();
+
+          // State changes during boot are picked up once the boot screen is gone
+          if (currentState != SystemState::BOOTING)
+          {
+            handleWiFiConnection();
+          }
+        }
+
+        // Auto-transition to running state when ready
+        if (currentState == SystemState::READY)
+        {
+          start();
+        }
+      }
+
+      // Web server only has a slot while the configuration portal is up
+      if (wifi && wifi->getState() == WiFiManager::WiFiState::AP_MODE && webServer &&
+          serviceDue(webServerSlot, now, sleepMs))
+      {
+        webServer->update();
+      }
+
+      // update loop for app orchestrator
+      if (appOrchestrator && serviceDue(appSlot, now, sleepMs))
+      {
+        appOrchestrator->update();
+      }
+
+      // Process user commands
+      if (serviceDue(serialSlot, now, sleepMs))
+      {
+        processSerialCommands();
+      }
+
+      // Commit settings changed since the last quiet period
+      if (serviceDue(prefsSlot, now, sleepMs))
+      {
+        prefs.update();
+      }
+
+      // System health monitoring
+      if (serviceDue(healthSlot, now, sleepMs))
+      {
+        checkHealth();
+      }
+
+      coordinationCycles++;
+
+      // Events queued while the services ran left the notification set: no sleep then
+      TickType_t ticks = (sleepMs + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS;
+      ulTaskNotifyTake(pdTRUE, ticks > 0 ? ticks : 1);
     }
   }
 
@@ -155,30 +256,48 @@ namespace CloudMouse
 
   void Core::handleBootingState()
   {
-    // Wait for 4 second boot animation to complete
-    if (millis() >= 4000)
+    // WiFi association does not depend on the display: start it right away
+    // on this core while the UI task brings up LVGL on the other one
+    if (!bootWorkStarted)
     {
-      setState(SystemState::INITIALIZING);
+      bootWorkStarted = true;
 
 #if WIFI_REQUIRED
       SDK_LOGGER("📡 WiFi required - starting connection process");
 
       if (wifi)
       {
-        EventBus::instance().sendToUI(Event(EventType::DISPLAY_WIFI_CONNECTING));
         wifi->init();
       }
-#else
-      SDK_LOGGER("📡 WiFi optional - ready for operation");
-      EventBus::instance().sendToUI(Event(EventType::DISPLAY_WAKE_UP));
-      setState(SystemState::READY);
 #endif
+    }
 
-      if (appOrchestrator) {
-        Event bootingCompleted(EventType::BOOTING_COMPLETE);
-        appOrchestrator->processSDKEvent(bootingCompleted);
-      }
+    // The boot screen stays until the UI drew its first frame
+    if (!uiReady && millis() - stateStartTime < BOOT_UI_TIMEOUT_MS)
+    {
+      return;
+    }
+
+    if (!uiReady)
+    {
+      SDK_LOGGER("⚠️ UI not ready after %d ms - continuing boot without it\n", BOOT_UI_TIMEOUT_MS);
+    }
+
+    setState(SystemState::INITIALIZING);
+
+#if WIFI_REQUIRED
+    // Connecting screen only if the association is still running
+    if (wifi && wifi->getState() == WiFiManager::WiFiState::CONNECTING)
+    {
+      EventBus::instance().sendToUI(Event(EventType::DISPLAY_WIFI_CONNECTING));
     }
+#else
+    SDK_LOGGER("📡 WiFi optional - ready for operation");
+    EventBus::instance().sendToUI(Event(EventType::DISPLAY_WAKE_UP));
+    setState(SystemState::READY);
+#endif
+
+    notifyApp(Event(EventType::BOOTING_COMPLETE));
   }
 
   // ============================================================================
@@ -207,10 +326,7 @@ namespace CloudMouse
         }
 
         // Sending wifi connecting event to the app orchestrator
-        if (appOrchestrator) {
-          Event wifiConnected(EventType::WIFI_CONNECTING);
-          appOrchestrator->processSDKEvent(wifiConnected);
-        }
+        notifyApp(Event(EventType::WIFI_CONNECTING));
         break;
 
       case WiFiManager::WiFiState::CONNECTED:
@@ -231,12 +347,15 @@ namespace CloudMouse
         Event helloEvent(EventType::DISPLAY_WAKE_UP);
         EventBus::instance().sendToUI(helloEvent);
 
-        // Sending wifi connected event to the app orchestrator
-        if (appOrchestrator) {
-          Event wifiConnected(EventType::WIFI_CONNECTED);
-          appOrchestrator->processSDKEvent(wifiConnected);
+        // Metrics endpoints on the station address
+        if (webServer)
+        {
+          webServer->startMetrics();
         }
 
+        // Sending wifi connected event to the app orchestrator
+        notifyApp(Event(EventType::WIFI_CONNECTED));
+
         setState(SystemState::READY);
       }
       break;
@@ -247,10 +366,7 @@ namespace CloudMouse
         SDK_LOGGER("❌ WiFi: Connection failed - starting setup mode");
 
         // Sending wifi disconnected event to the app orchestrator
-        if (appOrchestrator) {
-          Event wifiConnected(EventType::WIFI_DISCONNECTED);
-          appOrchestrator->processSDKEvent(wifiConnected);
-        }
+        notifyApp(Event(EventType::WIFI_DISCONNECTED));
 
         if (wifi)
         {
@@ -261,6 +377,7 @@ namespace CloudMouse
       case WiFiManager::WiFiState::AP_MODE:
         SDK_LOGGER("📱 WiFi: Access Point mode active");
         setState(SystemState::WIFI_AP_MODE);
+        markBootReady(); // Usable: the setup portal is up
 
         if (webServer)
         {
@@ -325,17 +442,26 @@ namespace CloudMouse
   {
     Event event;
 
-    // Process all pending events from UI task
+    // Process all pending events published to the Core queue (Core and app subscriptions)
     while (EventBus::instance().receiveFromUI(event, 0))
     {
       eventsProcessed++;
 
-      if (appOrchestrator) {
-        appOrchestrator->processSDKEvent(event);
-      }
+      notifyApp(event);
 
       switch (event.type)
       {
+      case EventType::ENCODER_INPUT:
+#if INPUT_LATENCY_TRACE
+      {
+        InputSnapshot snapshot;
+        if (event.getInputSnapshot(snapshot))
+          Utils::LatencyTracer::coreReceived(snapshot.traceId, event.timestamp);
+      }
+#endif
+        handleEncoderInput(event);
+        break;
+
       case EventType::ENCODER_ROTATION:
         handleEncoderRotation(event);
         break;
@@ -349,7 +475,57 @@ namespace CloudMouse
         break;
 
       default:
-        EventBus::instance().sendToUI(event);
+        // Only here because the app subscribed to it; the display got its
+        // own copy straight from publish()
+        break;
+      }
+    }
+  }
+
+  void Core::notifyApp(const Event &event)
+  {
+    if (appOrchestrator && (appEventMask & eventBit(event.type)))
+    {
+      appOrchestrator->processSDKEvent(event);
+    }
+  }
+
+  void Core::updateSubscriptions()
+  {
+    appEventMask = appOrchestrator ? appOrchestrator->getSubscribedEvents() : EVENT_MASK_NONE;
+
+    if (mainSubscription != EventBus::INVALID_SUBSCRIPTION)
+    {
+      EventBus::instance().setSubscriptionMask(mainSubscription, CORE_EVENT_MASK | appEventMask);
+    }
+  }
+
+  void Core::handleEncoderInput(const Event &event)
+  {
+    // Legacy per-gesture events for the handlers below and for apps that
+    // subscribed to them; none of them travel over the bus
+    Event expanded[INPUT_SNAPSHOT_MAX_EVENTS];
+    int count = expandInputSnapshot(event, expanded);
+
+    for (int i = 0; i < count; i++)
+    {
+      notifyApp(expanded[i]);
+
+      switch (expanded[i].type)
+      {
+      case EventType::ENCODER_ROTATION:
+        handleEncoderRotation(expanded[i]);
+        break;
+
+      case EventType::ENCODER_CLICK:
+        handleEncoderClick(expanded[i]);
+        break;
+
+      case EventType::ENCODER_LONG_PRESS:
+        handleEncoderLongPress(expanded[i]);
+        break;
+
+      default:
         break;
       }
     }
@@ -357,21 +533,18 @@ namespace CloudMouse
 
   void Core::handleEncoderRotation(const Event &event)
   {
-    SDK_LOGGER("🔄 Encoder rotation: %d steps\n", event.value);
+    SDK_LOGD(CORE, "🔄 Encoder rotation: %d steps", (int)event.value);
 
     // Activate LED feedback
     if (ledManager)
     {
       ledManager->activate();
     }
-
-    // Forward to UI system
-    EventBus::instance().sendToUI(event);
   }
 
   void Core::handleEncoderClick(const Event &event)
   {
-    SDK_LOGGER("🖱️ Encoder clicked!");
+    SDK_LOGD(CORE, "🖱️ Encoder clicked!");
 
     // Visual feedback: green LED flash
     if (ledManager)
@@ -379,16 +552,13 @@ namespace CloudMouse
       ledManager->flashColor(0, 255, 0, 255, 200);
     }
 
-    // Audio feedback
+    // Audio feedback (queued, plays in the background)
     SimpleBuzzer::buzz();
-
-    // Forward to UI system
-    EventBus::instance().sendToUI(event);
   }
 
   void Core::handleEncoderLongPress(const Event &event)
   {
-    SDK_LOGGER("⏱️ Encoder long press detected!");
+    SDK_LOGD(CORE, "⏱️ Encoder long press detected!");
 
     // Visual feedback: orange LED flash
     if (ledManager)
@@ -398,13 +568,10 @@ namespace CloudMouse
 
     // Audio feedback: error pattern
     SimpleBuzzer::error();
-
-    // Forward to UI system
-    EventBus::instance().sendToUI(event);
   }
 
   // ============================================================================
-  // UI TASK (Core 1 - 30Hz)
+  // UI TASK (Core 1 - deadline driven)
   // ============================================================================
 
   void Core::uiTaskFunction(void *param)
@@ -415,76 +582,65 @@ namespace CloudMouse
 
   void Core::runUITask()
   {
-    TickType_t lastWake = xTaskGetTickCount();
-
     SDK_LOGGER("🎮 UI Task started on Core 1");
 
+    // Wake sources: events queued for the UI and encoder pin interrupts
+    TaskHandle_t self = xTaskGetCurrentTaskHandle();
+    EventBus::instance().setUITaskHandle(self);
+    if (encoder)
+    {
+      encoder->setWakeTask(self);
+    }
+
     while (true)
     {
-      // Read encoder input
+      // Read encoder input: one snapshot event per cycle carries every gesture
       if (encoder)
       {
         encoder->update();
 
-        // Handle rotation
-        int movement = encoder->getMovement();
-        if (movement != 0)
-        {
-          Event rotationEvent(EventType::ENCODER_ROTATION, movement);
-          EventBus::instance().sendToMain(rotationEvent);
-        }
-
-        // Handle click
-        if (encoder->getClicked())
+        InputSnapshot snapshot;
+        if (encoder->takeSnapshot(snapshot))
         {
-          Event clickEvent(EventType::ENCODER_CLICK);
-          EventBus::instance().sendToMain(clickEvent);
-        }
-
-        // Handle long press
-        if (encoder->getLongPressed())
-        {
-          Event longPressEvent(EventType::ENCODER_LONG_PRESS);
-          EventBus::instance().sendToMain(longPressEvent);
-        }
-
-        int pressTime = encoder->getPressTime();
-        if (pressTime != 0)
-        {
-          Event pressTimeEvent(EventType::ENCODER_PRESS_TIME, pressTime);
-          EventBus::instance().sendToMain(pressTimeEvent);
-        }
-
-        int pressDuration = encoder->getLastPressDuration();
-        if (pressDuration != 0)
-        {
-          encoder->resetLastPressDuration();
-          Event buttonReleasedEvent(EventType::ENCODER_BUTTON_RELEASED, pressDuration);
-          EventBus::instance().sendToMain(buttonReleasedEvent);
+          Event inputEvent(EventType::ENCODER_INPUT);
+          inputEvent.setInputSnapshot(snapshot);
+          EventBus::instance().publish(inputEvent);
         }
+      }
 
-        if (encoder->getPressAndRotate())
+      // Update display rendering and collect the next LVGL deadline
+      uint32_t sleepMs = UI_TASK_MAX_SLEEP_MS;
+      if (display)
+      {
+        uint32_t deadline = display->update();
+        if (deadline < sleepMs)
         {
-          int delta = encoder->getPressAndRotateMovement();
-          Event pressAndRotate(EventType::ENCODER_PRESS_AND_ROTATE, delta);
-          EventBus::instance().sendToMain(pressAndRotate);
+          sleepMs = deadline;
         }
+      }
 
-        if (encoder->getDoubleClicked())
+      // First frame flushed to the panel: the boot sequence may end
+      if (!uiReady && (!display || display->hasFlushedFrame()))
+      {
+        uiReady = true;
+        if (coordinationTaskHandle)
         {
-          Event doubleClickEvent(EventType::ENCODER_DOUBLE_CLICK);
-          EventBus::instance().sendToMain(doubleClickEvent);
+          xTaskNotifyGive(coordinationTaskHandle);
         }
       }
 
-      // Update display rendering
-      if (display)
+      // Press thresholds and double-click windows are time-based
+      if (encoder && encoder->needsPolling() && sleepMs > UI_TASK_INPUT_POLL_MS)
       {
-        display->update();
+        sleepMs = UI_TASK_INPUT_POLL_MS;
       }
 
-      // Maintain 30Hz update rate (33ms intervals)
-      vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(33));
+      // Sleep until the deadline, a sendToUI() notification or an encoder interrupt
+      if (sleepMs > 0)
+      {
+        TickType_t ticks = (sleepMs + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS;
+        ulTaskNotifyTake(pdTRUE, ticks);
+      }
     }
   }
 
@@ -492,6 +648,18 @@ namespace CloudMouse
   // SYSTEM HEALTH MONITORING
   // ============================================================================
 
+  void Core::markBootReady()
+  {
+    if (Utils::BootProfiler::isReady())
+    {
+      return;
+    }
+
+    // Every SDK queue, task and buffer exists by now: what is left is the app's
+    Utils::BootProfiler::setReady();
+    Utils::MemoryBudget::print();
+  }
+
   void Core::checkHealth()
   {
     uint32_t freeHeap = ESP.getFreeHeap();
@@ -508,6 +676,13 @@ namespace CloudMouse
       SDK_LOGGER("🎮 UI Task stack remaining: %d bytes\n", uiStack * sizeof(StackType_t));
     }
 
+    // Monitor coordination task stack usage
+    if (coordinationTaskHandle)
+    {
+      UBaseType_t coreStack = uxTaskGetStackHighWaterMark(coordinationTaskHandle);
+      SDK_LOGGER("🧭 Coordination Task stack remaining: %d bytes\n", (int)(coreStack * sizeof(StackType_t)));
+    }
+
     // Monitor LED task stack usage
     if (ledManager && ledManager->getAnimationTaskHandle())
     {
@@ -522,6 +697,16 @@ namespace CloudMouse
       }
     }
 
+    // Per-task CPU load since the previous health check
+    if (Utils::TaskProfiler::sample())
+    {
+      const Utils::TaskProfiler::Sample *load = Utils::TaskProfiler::getSample(0);
+      SDK_LOGGER("📊 CPU: core0 %.1f%% tasks / %.1f%% other, core1 %.1f%% tasks / %.1f%% other, unpinned %.1f%%\n",
+                    load->cores[0].taskPermille / 10.0f, load->cores[0].otherPermille / 10.0f,
+                    load->cores[1].taskPermille / 10.0f, load->cores[1].otherPermille / 10.0f,
+                    load->unpinnedPermille / 10.0f);
+    }
+
     // Log event bus performance
     EventBus::instance().logStatus();
 
@@ -597,6 +782,57 @@ namespace CloudMouse
 
             // Help system
           }
+          else if (commandBuffer == "bench display")
+          {
+            SDK_LOGGER("⏱️ Opening render benchmark screen (rotate: next config, click: exit)");
+            EventBus::instance().sendToUI(Event(EventType::DISPLAY_BENCHMARK));
+
+            // Frame profiler report (printed by the UI task that owns the data)
+          }
+          else if (commandBuffer == "display stats")
+          {
+            EventBus::instance().sendToUI(Event(EventType::DISPLAY_PROFILER_REPORT));
+
+            // Event bus metrics (per-type counters, queue latency, high-water marks)
+          }
+          else if (commandBuffer == "bus stats")
+          {
+            EventBus::instance().logMetrics();
+          }
+          else if (commandBuffer == "bus reset")
+          {
+            EventBus::instance().resetMetrics();
+
+            // Task CPU/stack profiler (sampled by the health check)
+          }
+          else if (commandBuffer == "tasks")
+          {
+            Utils::TaskProfiler::printReport();
+
+            // Boot timeline (phases stamped from power-on to usable)
+          }
+          else if (commandBuffer == "boot")
+          {
+            Utils::BootProfiler::print();
+
+            // Fixed RAM cost of each SDK subsystem and heap state
+          }
+          else if (commandBuffer == "memory")
+          {
+            Utils::MemoryBudget::print();
+
+            // Input-to-photon latency per stage (INPUT_LATENCY_TRACE)
+          }
+          else if (commandBuffer == "latency")
+          {
+            Utils::LatencyTracer::print();
+          }
+          else if (commandBuffer == "latency reset")
+          {
+            Utils::LatencyTracer::reset();
+
+            // Help system
+          }
           else if (commandBuffer == "help")
           {
             SDK_LOGGER("\n📋 CloudMouse Commands:");
@@ -604,6 +840,14 @@ namespace CloudMouse
             SDK_LOGGER("  hard reset  - Factory reset (clear all settings)");
             SDK_LOGGER("  status      - Show system information");
             SDK_LOGGER("  get uuid    - Get device identification");
+            SDK_LOGGER("  bench display - Render buffer/mode benchmark screen");
+            SDK_LOGGER("  display stats - Frame profiler report (render/flush/drain)");
+            SDK_LOGGER("  bus stats   - EventBus per-type counters and queue latency");
+            SDK_LOGGER("  bus reset   - Clear EventBus metrics");
+            SDK_LOGGER("  tasks       - Per-task CPU load, stack and core history");
+            SDK_LOGGER("  boot        - Boot timeline (init phases, WiFi, NTP)");
+            SDK_LOGGER("  memory      - SDK memory budget per subsystem and heap state");
+            SDK_LOGGER("  latency     - Input-to-photon latency per stage (latency reset: clear)");
             SDK_LOGGER("  help        - Show this help\n");
 
             // System status
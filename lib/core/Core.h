@@ -8,8 +8,11 @@
  * - Component registration and coordination
  *
  * Architecture:
- * - Core 0: Main coordination, WiFi, event processing, system health
- * - Core 1: UI rendering, encoder input, display updates (30Hz)
+ * - Core 0: Coordination task (event processing, WiFi, web server, system health),
+ *   woken by Core queue events and timed service slots
+ * - Core 1: UI rendering, encoder input, display updates, woken by the next
+ *   LVGL timer deadline, sendToUI() notifications and encoder interrupts
+ *   (see UI_TASK_MAX_SLEEP_MS)
  */
 
 #pragma once
@@ -18,12 +21,17 @@
 #include <freertos/task.h>
 #include "EventBus.h"
 #include "Events.h"
+#include "AppOrchestrator.h"
 #include "../prefs/PreferencesManager.h"
 #include "../hardware/LEDManager.h"
 #include "../hardware/EncoderManager.h"
 #include "../hardware/DisplayManager.h"
 #include "../hardware/SimpleBuzzer.h"
 #include "../network/WebServerManager.h"
+#include "../utils/TaskProfiler.h"
+#include "../utils/BootProfiler.h"
+#include "../utils/LatencyTracer.h"
+#include "../utils/MemoryBudget.h"
 
 namespace CloudMouse
 {
@@ -31,38 +39,12 @@ namespace CloudMouse
   using namespace Hardware;
   using namespace Network;
 
-  /**
-   * Interface for custom App orchestrators
-   * Any app that wants to receive SDK events must implement this
-   */
-  class IAppOrchestrator
-  {
-  public:
-    virtual ~IAppOrchestrator() = default;
-
-    /**
-     * App orchestrator initialization
-     */
-    virtual bool initialize() = 0;
-
-    /**
-     * App Orchestrator update loop
-     */
-    virtual void update() = 0;
-
-    /**
-     * Process SDK events
-     * Used by Core when we need to forward events to App Orchestrator
-     */
-    virtual void processSDKEvent(const CloudMouse::Event &event) = 0;
-  };
-
   /**
    * System state machine for CloudMouse lifecycle management
    */
   enum class SystemState
   {
-    BOOTING,      // Initial boot animation (3.5s)
+    BOOTING,      // Boot screen until the UI drew its first frame (WiFi already associating)
     INITIALIZING, // Hardware initialization
 
     // WiFi connection states
@@ -101,7 +83,18 @@ namespace CloudMouse
     void start();       // Start normal operation
     void startUITask(); // Launch UI task on Core 1
 
-    // Main coordination loop (runs on Core 0 at 20Hz)
+    /**
+     * Launch the coordination task on CORE_TASK_CORE
+     * Blocks until an event reaches the Core queue or the next service slot
+     * (WiFi, web server, app update, serial, health) is due. Call after initialize();
+     * Arduino loop() is no longer needed and can delete itself.
+     */
+    void startCoordinationTask();
+
+    /**
+     * Legacy entry point for loop()-driven sketches
+     * Starts the coordination task if it is not running yet; does no work itself.
+     */
     void coordinationLoop();
 
     // Hardware component registration
@@ -129,6 +122,7 @@ namespace CloudMouse
     void setAppOrchestrator(IAppOrchestrator *orchestrator)
     {
       appOrchestrator = orchestrator;
+      updateSubscriptions();
     }
 
   private:
@@ -142,6 +136,10 @@ namespace CloudMouse
     SystemState currentState = SystemState::BOOTING;
     uint32_t stateStartTime = 0;
 
+    // Boot sequence: WiFi started from the coordination task, UI first frame drawn
+    bool bootWorkStarted = false;
+    volatile bool uiReady = false;
+
     // Configuration
     bool wifiRequired = true;
 
@@ -155,18 +153,47 @@ namespace CloudMouse
     // App orchestrator reference
     IAppOrchestrator *appOrchestrator = nullptr;
 
+    // EventBus subscriptions: the Core queue receives the input types Core
+    // reacts to plus whatever the app orchestrator subscribed to. Encoder input
+    // arrives as ENCODER_INPUT and is expanded locally (handleEncoderInput)
+    static const EventMask CORE_EVENT_MASK =
+        (1u << (uint8_t)EventType::ENCODER_INPUT);
+    int mainSubscription = EventBus::INVALID_SUBSCRIPTION;
+    EventMask appEventMask = EVENT_MASK_NONE;
+
     // System services
     PreferencesManager prefs;
     TaskHandle_t uiTaskHandle = nullptr;
+    TaskHandle_t coordinationTaskHandle = nullptr;
+    Utils::TaskStorage<UI_TASK_STACK_SIZE> uiTaskStorage;
+    Utils::TaskStorage<CORE_TASK_STACK_SIZE> coordinationTaskStorage;
+
+    /**
+     * Periodic work inside the coordination task
+     */
+    struct ServiceSlot
+    {
+      uint32_t periodMs;
+      uint32_t lastRunMs;
+    };
+
+    ServiceSlot wifiSlot = {CORE_WIFI_SERVICE_MS, 0};
+    ServiceSlot webServerSlot = {CORE_WEBSERVER_SERVICE_MS, 0};
+    ServiceSlot appSlot = {CORE_APP_UPDATE_MS, 0};
+    ServiceSlot serialSlot = {CORE_SERIAL_POLL_MS, 0};
+    ServiceSlot prefsSlot = {CORE_PREFS_SERVICE_MS, 0};
+    ServiceSlot healthSlot = {CORE_HEALTH_CHECK_MS, 0};
 
     // Performance monitoring
     uint32_t coordinationCycles = 0;
     uint32_t eventsProcessed = 0;
-    uint32_t lastHealthCheck = 0;
 
     // FreeRTOS task functions
     static void uiTaskFunction(void *param);
     void runUITask();
+    static void coordinationTaskFunction(void *param);
+    void runCoordinationTask();
+    static bool serviceDue(ServiceSlot &slot, uint32_t now, uint32_t &sleepMs);
 
     // State machine handlers
     void handleBootingState();
@@ -175,12 +202,16 @@ namespace CloudMouse
     // Event processing system
     void processEvents();
     void processSerialCommands();
+    void handleEncoderInput(const Event &event);
     void handleEncoderRotation(const Event &event);
     void handleEncoderClick(const Event &event);
     void handleEncoderLongPress(const Event &event);
+    void notifyApp(const Event &event);
+    void updateSubscriptions();
 
     // System health monitoring
     void checkHealth();
+    void markBootReady(); // Boot timeline and memory budget, printed once
   };
 
 } // namespace CloudMouse
\ No newline at end of file
@@ -5,15 +5,23 @@
  * Implements bidirectional communication channels with comprehensive error handling and monitoring.
  * 
  * Implementation Details:
- * - Uses FreeRTOS xQueueCreate for queue allocation with fixed event size
+ * - Uses EventQueue rings (fixed event size) that coalesce bursts of input
+ *   into the pending tail entry instead of dropping when full
+ * - One ring per priority lane in each direction (EventChannel); receivers
+ *   drain the interactive lane first
  * - Copy semantics for events ensure thread safety without pointer sharing
+ * - Queued events own a payload reference: retained on send, adopted on receive
+ * - External subscriber queues are plain FreeRTOS queues (no coalescing)
  * - Non-blocking operations with configurable timeout support
  * - Comprehensive error checking and status reporting
  * - Memory-efficient fixed-size allocation strategy
+ * - Lane storage is reserved at link time in the SDK_STATIC_ALLOCATION build
+ * - publish() walks a fixed subscriber table; entries are snapshotted under a
+ *   spinlock so callbacks and queue sends never run inside the critical section
  * 
  * Performance Characteristics:
  * - Queue operations: O(1) constant time complexity
- * - Memory usage: ~5.3KB for both queues (predictable footprint)
+ * - Memory usage: ~2 KB for both directions plus the payload pool
  * - Latency: < 1ms for queue operations on ESP32 @ 240MHz
  * - Throughput: > 10,000 events/second sustainable rate
  * 
@@ -25,9 +33,29 @@
 
 #include "./EventBus.h"
 #include "../utils/Logger.h"
+#include "../utils/MemoryBudget.h"
+#include <ArduinoJson.h>
 
 namespace CloudMouse {
 
+namespace {
+    // Slots per EventLane, same for both directions
+    const uint32_t busLaneSizes[EventChannel::LANE_COUNT] = {
+        EVENT_LANE_INTERACTIVE_SIZE,
+        EVENT_LANE_NORMAL_SIZE,
+        EVENT_LANE_BACKGROUND_SIZE,
+    };
+
+    const uint32_t busSlotCount =
+        EVENT_LANE_INTERACTIVE_SIZE + EVENT_LANE_NORMAL_SIZE + EVENT_LANE_BACKGROUND_SIZE;
+
+#if SDK_STATIC_ALLOCATION
+    // Lane storage for both directions, reserved at link time
+    Event busSlots[2][busSlotCount];
+    uint32_t busStamps[2][busSlotCount];
+#endif
+}
+
 // ============================================================================
 // INITIALIZATION AND LIFECYCLE MANAGEMENT
 // ============================================================================
@@ -41,7 +69,7 @@ void EventBus::initialize() {
     
     SDK_LOGGER("🚌 Initializing EventBus communication system...");
     
-    // Create bidirectional FreeRTOS queues for inter-task communication
+    // Create bidirectional prioritized, coalescing channels for inter-task communication
     // Each queue stores complete Event structures (copy semantics for thread safety)
     
     /**
@@ -49,8 +77,12 @@ void EventBus::initialize() {
      * Handles events flowing from UI task to Core task
      * Examples: user input, configuration changes, UI requests
      */
-    uiToMainQueue = xQueueCreate(QUEUE_SIZE, sizeof(Event));
-    if (!uiToMainQueue) {
+#if SDK_STATIC_ALLOCATION
+    bool uiToMainCreated = uiToMain.create(busLaneSizes, busSlots[0], busStamps[0]);
+#else
+    bool uiToMainCreated = uiToMain.create(busLaneSizes);
+#endif
+    if (!uiToMainCreated) {
         SDK_LOGGER("❌ Failed to create UI→Core queue - insufficient memory");
         return;
     }
@@ -60,23 +92,34 @@ void EventBus::initialize() {
      * Handles events flowing from Core task to UI task
      * Examples: display updates, status changes, error notifications
      */
-    mainToUIQueue = xQueueCreate(QUEUE_SIZE, sizeof(Event));
-    if (!mainToUIQueue) {
+#if SDK_STATIC_ALLOCATION
+    bool mainToUICreated = mainToUI.create(busLaneSizes, busSlots[1], busStamps[1]);
+#else
+    bool mainToUICreated = mainToUI.create(busLaneSizes);
+#endif
+    if (!mainToUICreated) {
         SDK_LOGGER("❌ Failed to create Core→UI queue - insufficient memory");
         
         // Cleanup partial initialization
-        vQueueDelete(uiToMainQueue);
-        uiToMainQueue = nullptr;
+        uiToMain.destroy();
         return;
     }
     
     // Mark as successfully initialized
     initialized = true;
+
+    // Lane slots and stamps of both directions; the payload pool is always static
+    Utils::MemoryBudget::add("eventbus.lanes", 2 * busSlotCount * (sizeof(Event) + sizeof(uint32_t)),
+                             Utils::MemoryBudget::Region::INTERNAL, Utils::MemoryBudget::ALLOCATION);
+    Utils::MemoryBudget::add("eventbus.payloads", EVENT_PAYLOAD_BLOCK_COUNT * EVENT_PAYLOAD_BLOCK_SIZE,
+                             Utils::MemoryBudget::Region::INTERNAL, Utils::MemoryBudget::Source::STATIC);
     
     SDK_LOGGER("✅ EventBus initialized successfully\n");
-    SDK_LOGGER("🚌 Queue capacity: %d events each direction\n", QUEUE_SIZE);
-    SDK_LOGGER("🚌 Event size: %d bytes per event\n", sizeof(Event));
-    SDK_LOGGER("🚌 Total memory allocated: %d bytes\n", 2 * QUEUE_SIZE * sizeof(Event));
+    SDK_LOGGER("🚌 Queue capacity: %d events each direction (lanes %d/%d/%d)\n", (int)QUEUE_SIZE,
+                  EVENT_LANE_INTERACTIVE_SIZE, EVENT_LANE_NORMAL_SIZE, EVENT_LANE_BACKGROUND_SIZE);
+    SDK_LOGGER("🚌 Event size: %d bytes per event\n", (int)sizeof(Event));
+    SDK_LOGGER("🚌 Total memory allocated: %d bytes\n", (int)(2 * QUEUE_SIZE * (sizeof(Event) + sizeof(uint32_t))));
+    SDK_LOGGER("🚌 Payload pool: %d blocks x %d bytes\n", EVENT_PAYLOAD_BLOCK_COUNT, EVENT_PAYLOAD_BLOCK_SIZE);
 }
 
 // ============================================================================
@@ -91,12 +134,18 @@ bool EventBus::sendToUI(const Event& event, TickType_t timeout) {
     }
     
     // Attempt to queue event with specified timeout behavior
-    BaseType_t result = xQueueSend(mainToUIQueue, &event, timeout);
-    
-    if (result == pdPASS) {
-        // Event successfully queued
-        SDK_LOGGER("📤 Event sent to UI: type=%d, value=%d\n", 
+    EventQueue::PushResult pushed = mainToUI.push(event, timeout);
+    metrics.recordPush(event.type, pushed);
+    if (pushed != EventQueue::PushResult::FULL) {
+        // Event queued, or folded into the pending entry of the same type
+        SDK_LOGD(EVENTBUS, "📤 Event %s UI: type=%d, value=%d\n",
+                     pushed == EventQueue::PushResult::MERGED ? "merged into" : "sent to",
                      (int)event.type, event.value);
+
+        // Wake the UI task so the event is handled without waiting for its next deadline
+        if (uiTask) {
+            xTaskNotifyGive(uiTask);
+        }
         return true;
     } else {
         // Queue full or timeout occurred
@@ -118,11 +167,11 @@ bool EventBus::receiveFromMain(Event& event, TickType_t timeout) {
     }
     
     // Attempt to retrieve event with specified timeout behavior
-    BaseType_t result = xQueueReceive(mainToUIQueue, &event, timeout);
-    
-    if (result == pdPASS) {
+    uint32_t queuedUs = 0;
+    if (mainToUI.pop(event, timeout, &queuedUs)) {
+        metrics.recordPop(event.type, queuedUs);
         // Event successfully retrieved
-        SDK_LOGGER("📥 Event received from Core: type=%d, value=%d\n", 
+        SDK_LOGD(EVENTBUS, "📥 Event received from Core: type=%d, value=%d\n", 
                      (int)event.type, event.value);
         return true;
     } else {
@@ -149,12 +198,18 @@ bool EventBus::sendToMain(const Event& event, TickType_t timeout) {
     }
     
     // Attempt to queue event with specified timeout behavior
-    BaseType_t result = xQueueSend(uiToMainQueue, &event, timeout);
-    
-    if (result == pdPASS) {
-        // Event successfully queued
-        SDK_LOGGER("📤 Event sent to Core: type=%d, value=%d\n", 
+    EventQueue::PushResult pushed = uiToMain.push(event, timeout);
+    metrics.recordPush(event.type, pushed);
+    if (pushed != EventQueue::PushResult::FULL) {
+        // Event queued, or folded into the pending entry of the same type
+        SDK_LOGD(EVENTBUS, "📤 Event %s Core: type=%d, value=%d\n",
+                     pushed == EventQueue::PushResult::MERGED ? "merged into" : "sent to",
                      (int)event.type, event.value);
+
+        // Wake the coordination task so the event is handled right away
+        if (mainTask) {
+            xTaskNotifyGive(mainTask);
+        }
         return true;
     } else {
         // Queue full or timeout occurred
@@ -176,11 +231,11 @@ bool EventBus::receiveFromUI(Event& event, TickType_t timeout) {
     }
     
     // Attempt to retrieve event with specified timeout behavior
-    BaseType_t result = xQueueReceive(uiToMainQueue, &event, timeout);
-    
-    if (result == pdPASS) {
+    uint32_t queuedUs = 0;
+    if (uiToMain.pop(event, timeout, &queuedUs)) {
+        metrics.recordPop(event.type, queuedUs);
         // Event successfully retrieved
-        SDK_LOGGER("📥 Event received from UI: type=%d, value=%d\n", 
+        SDK_LOGD(EVENTBUS, "📥 Event received from UI: type=%d, value=%d\n", 
                      (int)event.type, event.value);
         return true;
     } else {
@@ -195,6 +250,177 @@ bool EventBus::receiveFromUI(Event& event, TickType_t timeout) {
     }
 }
 
+bool EventBus::enqueue(QueueHandle_t queue, const Event& event, TickType_t timeout) {
+    // The copy parked in the queue owns one payload reference
+    EventPayloadPool::retain(event.payload);
+
+    if (xQueueSend(queue, &event, timeout) != pdPASS) {
+        EventPayloadPool::release(event.payload);
+        return false;
+    }
+    return true;
+}
+
+bool EventBus::receive(QueueHandle_t queue, Event& event, TickType_t timeout) {
+    // Received into raw storage: the queued copy's reference moves into event
+    alignas(Event) uint8_t parked[sizeof(Event)];
+    if (xQueueReceive(queue, parked, timeout) != pdPASS) {
+        return false;
+    }
+
+    EventPayloadPool::release(event.payload);
+    memcpy(static_cast<void*>(&event), parked, sizeof(Event));
+    return true;
+}
+
+// ============================================================================
+// PUBLISH / SUBSCRIBE IMPLEMENTATION
+// ============================================================================
+
+int EventBus::addSubscriber(const Subscriber& subscriber) {
+    int id = INVALID_SUBSCRIPTION;
+
+    portENTER_CRITICAL(&subscribersLock);
+    for (int i = 0; i < MAX_SUBSCRIBERS; i++) {
+        if (!subscribers[i].active) {
+            subscribers[i] = subscriber;
+            subscribers[i].active = true;
+            id = i;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&subscribersLock);
+
+    if (id == INVALID_SUBSCRIPTION) {
+        SDK_LOGGER("❌ EventBus subscriber table full (%d entries)\n", MAX_SUBSCRIBERS);
+    } else {
+        SDK_LOGGER("🚌 Subscriber %d registered (mask=0x%08lx, %s)\n", id,
+                     (unsigned long)subscriber.mask, subscriber.callback ? "callback" : "queue");
+    }
+    return id;
+}
+
+int EventBus::subscribe(EventMask mask, EventCallback callback, void* context) {
+    if (!callback) {
+        return INVALID_SUBSCRIPTION;
+    }
+
+    Subscriber subscriber;
+    subscriber.mask = mask;
+    subscriber.callback = callback;
+    subscriber.context = context;
+    return addSubscriber(subscriber);
+}
+
+int EventBus::subscribeQueue(EventMask mask, QueueHandle_t queue, TaskHandle_t notifyTask) {
+    if (!queue) {
+        return INVALID_SUBSCRIPTION;
+    }
+
+    Subscriber subscriber;
+    subscriber.mask = mask;
+    subscriber.queue = queue;
+    subscriber.notifyTask = notifyTask;
+    return addSubscriber(subscriber);
+}
+
+int EventBus::subscribeUI(EventMask mask) {
+    if (!initialized) {
+        SDK_LOGGER("❌ EventBus not initialized - cannot subscribe UI queue");
+        return INVALID_SUBSCRIPTION;
+    }
+
+    Subscriber subscriber;
+    subscriber.mask = mask;
+    subscriber.ring = &mainToUI;
+    subscriber.notifyUI = true;
+    return addSubscriber(subscriber);
+}
+
+int EventBus::subscribeMain(EventMask mask) {
+    if (!initialized) {
+        SDK_LOGGER("❌ EventBus not initialized - cannot subscribe Core queue");
+        return INVALID_SUBSCRIPTION;
+    }
+    Subscriber subscriber;
+    subscriber.mask = mask;
+    subscriber.ring = &uiToMain;
+    subscriber.notifyMain = true;
+    return addSubscriber(subscriber);
+}
+
+bool EventBus::setSubscriptionMask(int id, EventMask mask) {
+    if (id < 0 || id >= MAX_SUBSCRIBERS) {
+        return false;
+    }
+
+    portENTER_CRITICAL(&subscribersLock);
+    bool active = subscribers[id].active;
+    if (active) {
+        subscribers[id].mask = mask;
+    }
+    portEXIT_CRITICAL(&subscribersLock);
+    return active;
+}
+
+bool EventBus::unsubscribe(int id) {
+    if (id < 0 || id >= MAX_SUBSCRIBERS) {
+        return false;
+    }
+
+    portENTER_CRITICAL(&subscribersLock);
+    bool active = subscribers[id].active;
+    subscribers[id] = Subscriber();
+    portEXIT_CRITICAL(&subscribersLock);
+    return active;
+}
+
+uint32_t EventBus::publish(const Event& event) {
+    EventMask bit = eventBit(event.type);
+    uint32_t delivered = 0;
+
+    for (int i = 0; i < MAX_SUBSCRIBERS; i++) {
+        // Snapshot the entry: callbacks and queue sends run outside the lock
+        portENTER_CRITICAL(&subscribersLock);
+        Subscriber subscriber = subscribers[i];
+        portEXIT_CRITICAL(&subscribersLock);
+
+        if (!subscriber.active || !(subscriber.mask & bit)) {
+            continue;
+        }
+
+        if (subscriber.callback) {
+            subscriber.callback(event, subscriber.context);
+            delivered++;
+            continue;
+        }
+
+        bool queued;
+        if (subscriber.ring) {
+            EventQueue::PushResult pushed = subscriber.ring->push(event);
+            metrics.recordPush(event.type, pushed);
+            queued = pushed != EventQueue::PushResult::FULL;
+        } else {
+            queued = enqueue(subscriber.queue, event, 0);
+        }
+        if (!queued) {
+            SDK_LOGGER("⚠️ Subscriber %d queue full - event dropped (type=%d)\n", i, (int)event.type);
+            continue;
+        }
+        delivered++;
+
+        // Publishing task drains its own queue on this iteration, no wake needed
+        TaskHandle_t notify = subscriber.notifyUI ? uiTask
+                            : subscriber.notifyMain ? mainTask
+                            : subscriber.notifyTask;
+        if (notify && notify != xTaskGetCurrentTaskHandle()) {
+            xTaskNotifyGive(notify);
+        }
+    }
+
+    return delivered;
+}
+
 // ============================================================================
 // QUEUE MONITORING AND DIAGNOSTICS IMPLEMENTATION
 // ============================================================================
@@ -205,7 +431,7 @@ uint32_t EventBus::getUIQueueCount() const {
     }
     
     // Get number of events waiting in Core→UI queue
-    return uxQueueMessagesWaiting(mainToUIQueue);
+    return mainToUI.count();
 }
 
 uint32_t EventBus::getMainQueueCount() const {
@@ -214,7 +440,7 @@ uint32_t EventBus::getMainQueueCount() const {
     }
     
     // Get number of events waiting in UI→Core queue  
-    return uxQueueMessagesWaiting(uiToMainQueue);
+    return uiToMain.count();
 }
 
 void EventBus::logStatus() const {
@@ -227,7 +453,7 @@ void EventBus::logStatus() const {
     uint32_t mainCount = getMainQueueCount();
     
     SDK_LOGGER("[EventBus] Queue Status - UI: %d/%d, Core: %d/%d\n", 
-                  uiCount, QUEUE_SIZE, mainCount, QUEUE_SIZE);
+                  uiCount, (int)QUEUE_SIZE, mainCount, (int)QUEUE_SIZE);
     
     // Warn about queue congestion
     if (uiCount > QUEUE_SIZE * 0.8) {
@@ -244,6 +470,146 @@ void EventBus::logStatus() const {
     
     SDK_LOGGER("[EventBus] Utilization - UI: %.1f%%, Core: %.1f%%\n", 
                   uiUtilization, mainUtilization);
+
+    SDK_LOGGER("[EventBus] Coalesced - UI: %lu merged / %lu dropped, Core: %lu merged / %lu dropped\n",
+                  (unsigned long)mainToUI.getMergedCount(), (unsigned long)mainToUI.getDroppedCount(),
+                  (unsigned long)uiToMain.getMergedCount(), (unsigned long)uiToMain.getDroppedCount());
+
+    EventPayloadPool::Stats payloads;
+    EventPayloadPool::getStats(payloads);
+    SDK_LOGGER("[EventBus] Payloads - %d/%d blocks (peak %d), %lu rejected, %lu truncated\n",
+                  payloads.used, payloads.capacity, payloads.peak,
+                  (unsigned long)payloads.failures, (unsigned long)payloads.truncations);
+}
+
+// ============================================================================
+// METRICS REPORTING
+// ============================================================================
+
+void EventBus::logMetrics() const {
+    if (!initialized) {
+        SDK_LOGGER("[EventBus] Not initialized");
+        return;
+    }
+
+    uint32_t windowMs = metrics.getWindowMs();
+    float windowSeconds = windowMs > 0 ? windowMs / 1000.0f : 1.0f;
+
+    SDK_LOGGER("\n📈 EventBus Metrics (window %lu ms)", (unsigned long)windowMs);
+    const EventChannel* channels[] = { &mainToUI, &uiToMain };
+    const char* channelNames[] = { "UI", "Core" };
+    for (int c = 0; c < 2; c++) {
+        for (int l = 0; l < EventChannel::LANE_COUNT; l++) {
+            const EventQueue& lane = channels[c]->lane((EventLane)l);
+            SDK_LOGGER("  %-4s %-11s depth %lu/%lu, high-water %lu, merged %lu, dropped %lu",
+                          channelNames[c], EventChannel::laneName((EventLane)l),
+                          (unsigned long)lane.count(), (unsigned long)lane.capacity(),
+                          (unsigned long)lane.getHighWater(), (unsigned long)lane.getMergedCount(),
+                          (unsigned long)lane.getDroppedCount());
+        }
+    }
+    SDK_LOGGER("  %-26s %7s %6s %6s %7s %8s %7s %7s %7s %7s", "type", "queued", "merged", "drop",
+                  "recv", "recv/s", "avg us", "p50 us", "p99 us", "max us");
+
+    uint32_t shown = 0;
+    for (int i = 0; i < EventMetrics::TYPE_COUNT; i++) {
+        EventMetrics::TypeCounters counters;
+        metrics.getCounters((EventType)i, counters);
+        if (!counters.enqueued && !counters.merged && !counters.dropped && !counters.dequeued) {
+            continue;
+        }
+
+        uint32_t average = counters.dequeued ? (uint32_t)(counters.latencySumUs / counters.dequeued) : 0;
+        SDK_LOGGER("  %-26s %7lu %6lu %6lu %7lu %8.1f %7lu %7lu %7lu %7lu",
+                      EventMetrics::typeName((EventType)i),
+                      (unsigned long)counters.enqueued, (unsigned long)counters.merged,
+                      (unsigned long)counters.dropped, (unsigned long)counters.dequeued,
+                      counters.dequeued / windowSeconds, (unsigned long)average,
+                      (unsigned long)EventMetrics::percentileUs(counters, 50),
+                      (unsigned long)EventMetrics::percentileUs(counters, 99),
+                      (unsigned long)counters.latencyMaxUs);
+        shown++;
+    }
+
+    if (shown == 0) {
+        SDK_LOGGER("  (no events since the last reset)");
+    }
+    SDK_LOGGER("  Percentiles are histogram bucket bounds (log2, from 16 us)\n");
+}
+
+String EventBus::getMetricsJson() const {
+    JsonDocument doc;
+    uint32_t windowMs = metrics.getWindowMs();
+    float windowSeconds = windowMs > 0 ? windowMs / 1000.0f : 1.0f;
+
+    doc["uptime_ms"] = millis();
+    doc["window_ms"] = windowMs;
+
+    JsonObject queues = doc["queues"].to<JsonObject>();
+    const EventChannel* channels[] = { &mainToUI, &uiToMain };
+    const char* channelNames[] = { "ui", "core" };
+    for (int c = 0; c < 2; c++) {
+        JsonObject queue = queues[channelNames[c]].to<JsonObject>();
+        queue["depth"] = channels[c]->count();
+        queue["capacity"] = channels[c]->capacity();
+        queue["merged"] = channels[c]->getMergedCount();
+        queue["dropped"] = channels[c]->getDroppedCount();
+
+        JsonObject lanes = queue["lanes"].to<JsonObject>();
+        for (int l = 0; l < EventChannel::LANE_COUNT; l++) {
+            const EventQueue& ring = channels[c]->lane((EventLane)l);
+            JsonObject lane = lanes[EventChannel::laneName((EventLane)l)].to<JsonObject>();
+            lane["depth"] = ring.count();
+            lane["capacity"] = ring.capacity();
+            lane["high_water"] = ring.getHighWater();
+            lane["merged"] = ring.getMergedCount();
+            lane["dropped"] = ring.getDroppedCount();
+        }
+    }
+
+    // Exclusive upper bounds; the last bucket is open-ended
+    JsonArray bounds = doc["latency_bucket_us"].to<JsonArray>();
+    for (int b = 0; b < EventMetrics::LATENCY_BUCKETS - 1; b++) {
+        bounds.add(EventMetrics::bucketLimitUs(b));
+    }
+
+    JsonObject types = doc["types"].to<JsonObject>();
+    for (int i = 0; i < EventMetrics::TYPE_COUNT; i++) {
+        EventMetrics::TypeCounters counters;
+        metrics.getCounters((EventType)i, counters);
+        if (!counters.enqueued && !counters.merged && !counters.dropped && !counters.dequeued) {
+            continue;
+        }
+
+        JsonObject type = types[EventMetrics::typeName((EventType)i)].to<JsonObject>();
+        type["enqueued"] = counters.enqueued;
+        type["merged"] = counters.merged;
+        type["dropped"] = counters.dropped;
+        type["dequeued"] = counters.dequeued;
+        type["per_second"] = counters.dequeued / windowSeconds;
+
+        JsonObject latency = type["latency_us"].to<JsonObject>();
+        latency["avg"] = counters.dequeued ? (uint32_t)(counters.latencySumUs / counters.dequeued) : 0;
+        latency["max"] = counters.latencyMaxUs;
+        latency["p50"] = EventMetrics::percentileUs(counters, 50);
+        latency["p99"] = EventMetrics::percentileUs(counters, 99);
+
+        JsonArray histogram = latency["histogram"].to<JsonArray>();
+        for (int b = 0; b < EventMetrics::LATENCY_BUCKETS; b++) {
+            histogram.add(counters.latency[b]);
+        }
+    }
+
+    String json;
+    serializeJson(doc, json);
+    return json;
+}
+
+void EventBus::resetMetrics() {
+    metrics.reset();
+    mainToUI.resetStats();
+    uiToMain.resetStats();
+    SDK_LOGGER("📈 EventBus metrics reset");
 }
 
-} // namespace CloudMouse
\ No newline at end of file
+} // namespace CloudMouse
@@ -14,12 +14,23 @@
  * Communication Flow:
  * Core Task → sendToUI() → UI Queue → receiveFromMain() → UI Task
  * UI Task → sendToMain() → Main Queue → receiveFromUI() → Core Task
+ * Any Task → publish() → every subscriber whose EventMask matches
+ *            (direct callback in the publishing task, or a subscriber queue)
  * 
  * Queue Management:
- * - Each queue holds up to 10 events (configurable QUEUE_SIZE)
+ * - Each direction is an EventChannel with three priority lanes (EventLane:
+ *   interactive, normal, background), sized by EVENT_LANE_*_SIZE; receivers
+ *   always get encoder input before display, WiFi or app traffic
  * - Events are copied into queue (no pointer sharing for thread safety)
- * - FIFO ordering ensures event sequence preservation
+ * - Rotation deltas and state snapshots are coalesced into the pending entry
+ *   (EVENT_MASK_ACCUMULATE / EVENT_MASK_LATEST), so input is not lost when
+ *   the consumer falls behind
+ * - String/binary payloads stay in EventPayloadPool; the queued copy holds a
+ *   reference that the receiving Event takes over
+ * - FIFO ordering within a lane (so within an event type) preserves event sequence
  * - Automatic queue overflow detection and reporting
+ * - Per-EventType metrics (EventMetrics): push outcomes, queue latency
+ *   histograms, high-water marks and throughput of both built-in queues
  * 
  * Usage Patterns:
  * 1. Hardware → Core: Encoder events, system state changes
@@ -40,7 +51,7 @@
  * - Queue state monitoring for system diagnostics
  * 
  * Thread Safety:
- * - All operations are atomic at FreeRTOS queue level
+ * - All queue operations are atomic (spinlock-protected EventQueue lanes)
  * - No shared mutable state between tasks
  * - Safe for concurrent access from multiple cores
  * - Events are value-copied to eliminate pointer races
@@ -51,7 +62,10 @@
 
 #include <freertos/FreeRTOS.h>
 #include <freertos/queue.h>
+#include <freertos/task.h>
 #include "Events.h"
+#include "EventChannel.h"
+#include "EventMetrics.h"
 
 namespace CloudMouse {
 
@@ -69,7 +83,8 @@ namespace CloudMouse {
  * - Comprehensive monitoring for system health and debugging
  * 
  * Memory Usage:
- * - 2 queues × 10 events × ~264 bytes = ~5.3KB RAM
+ * - 2 directions × QUEUE_SIZE events (64 by default) × 16 bytes (event + enqueue stamp) = 2 KB RAM
+ * - Payloads: EVENT_PAYLOAD_BLOCK_COUNT × EVENT_PAYLOAD_BLOCK_SIZE, shared by both queues
  * - Fixed allocation prevents heap fragmentation
  * - Predictable memory footprint for system planning
  */
@@ -88,7 +103,7 @@ public:
     
     /**
      * Initialize EventBus queues and prepare for communication
-     * Creates FreeRTOS queues and validates successful allocation
+     * Creates the UI and Core event queues and validates successful allocation
      * Must be called once during system initialization before any event operations
      * 
      * @note Idempotent - safe to call multiple times
@@ -100,6 +115,15 @@ public:
     // CORE-TO-UI COMMUNICATION (Main → UI Task)
     // ========================================================================
     
+    /**
+     * Register the task to notify whenever an event is queued for the UI
+     * The UI task blocks on its notification value instead of polling, so
+     * sendToUI() wakes it immediately.
+     *
+     * @param task UI task handle (nullptr disables notifications)
+     */
+    void setUITaskHandle(TaskHandle_t task) { uiTask = task; }
+
     /**
      * Send event from Core task to UI task
      * Queues event for UI task processing with optional timeout
@@ -122,7 +146,7 @@ public:
      * Receive event from Core task in UI task
      * Retrieves next pending event from Core→UI queue
      * 
-     * @param event Reference to store received event data
+     * @param event Reference to store received event data (its previous payload is released)
      * @param timeout Maximum wait time if queue is empty (FreeRTOS ticks)
      *                0 = non-blocking (default)
      *                portMAX_DELAY = block until event available
@@ -140,6 +164,15 @@ public:
     // UI-TO-CORE COMMUNICATION (UI → Main Task)
     // ========================================================================
     
+    /**
+     * Register the task to notify whenever an event is queued for Core
+     * The coordination task blocks on its notification value, so sendToMain()
+     * and publish() to the Core queue wake it immediately.
+     *
+     * @param task Core task handle (nullptr disables notifications)
+     */
+    void setMainTaskHandle(TaskHandle_t task) { mainTask = task; }
+
     /**
      * Send event from UI task to Core task
      * Queues event for Core task processing with optional timeout
@@ -170,6 +203,79 @@ public:
      */
     bool receiveFromUI(Event& event, TickType_t timeout = 0);
     
+    // ========================================================================
+    // PUBLISH / SUBSCRIBE
+    // ========================================================================
+
+    /**
+     * Direct subscriber callback
+     * Runs synchronously in the publishing task: keep it short and only touch
+     * state that is safe to access from that task.
+     */
+    typedef void (*EventCallback)(const Event& event, void* context);
+
+    static const int MAX_SUBSCRIBERS = 8;
+    static const int INVALID_SUBSCRIPTION = -1;
+
+    /**
+     * Subscribe a callback to a set of event types
+     *
+     * @param mask Event types to receive (eventBit() / EVENT_MASK_*)
+     * @param callback Called from publish() for every matching event
+     * @param context Passed back to the callback
+     * @return Subscription id, INVALID_SUBSCRIPTION if the table is full
+     */
+    int subscribe(EventMask mask, EventCallback callback, void* context = nullptr);
+
+    /**
+     * Subscribe a FreeRTOS queue (item size sizeof(Event)) to a set of event types
+     * Matching events are copied into the queue without blocking.
+     *
+     * Each queued copy holds a payload reference. Drain the queue with
+     * EventBus::receive(), not xQueueReceive(): a raw receive writes over the
+     * Event without releasing the block it held, leaking one per payload event.
+     *
+     * @param mask Event types to receive
+     * @param queue Destination queue, owned by the subscriber
+     * @param notifyTask Optional task to notify (xTaskNotifyGive) after each delivery
+     * @return Subscription id, INVALID_SUBSCRIPTION if the table is full
+     */
+    int subscribeQueue(EventMask mask, QueueHandle_t queue, TaskHandle_t notifyTask = nullptr);
+
+    /**
+     * Take the next event from a subscribeQueue() queue
+     * Releases the payload event held and adopts the reference of the queued copy.
+     *
+     * @param queue Queue given to subscribeQueue()
+     * @param event Receives the event (left unchanged on timeout)
+     * @param timeout Ticks to wait, 0 = non-blocking
+     * @return true if an event was received
+     */
+    static bool receive(QueueHandle_t queue, Event& event, TickType_t timeout = 0);
+
+    /**
+     * Subscribe the built-in queues: the UI queue (drained by receiveFromMain(),
+     * wakes the task set with setUITaskHandle()) and the Core queue (drained by
+     * receiveFromUI(), wakes the task set with setMainTaskHandle())
+     */
+    int subscribeUI(EventMask mask);
+    int subscribeMain(EventMask mask);
+
+    /**
+     * Change the mask of an existing subscription
+     */
+    bool setSubscriptionMask(int id, EventMask mask);
+
+    bool unsubscribe(int id);
+
+    /**
+     * Deliver an event to every matching subscriber
+     *
+     * @param event Event to publish (copied into subscriber queues)
+     * @return Number of subscribers the event was delivered to
+     */
+    uint32_t publish(const Event& event);
+
     // ========================================================================
     // QUEUE MONITORING AND DIAGNOSTICS
     // ========================================================================
@@ -244,14 +350,66 @@ public:
         uiFull = isUIQueueFull();
         mainFull = isMainQueueFull();
     }
+
+    // ========================================================================
+    // METRICS
+    // ========================================================================
+
+    /**
+     * Per-EventType counters of the built-in UI and Core queues
+     * External subscriber queues and direct callbacks are not included.
+     */
+    const EventMetrics& getMetrics() const { return metrics; }
+
+    /**
+     * Print per-type counters, latency percentiles and queue high-water marks
+     * Serial command: "bus stats"
+     */
+    void logMetrics() const;
+
+    /**
+     * Same report as logMetrics() as a JSON object (served at /api/metrics/eventbus)
+     */
+    String getMetricsJson() const;
+
+    /**
+     * Clear the metrics and queue counters and restart the throughput window
+     * Serial command: "bus reset"
+     */
+    void resetMetrics();
     
 private:
-    // FreeRTOS queue handles for bidirectional communication
-    QueueHandle_t uiToMainQueue = nullptr;    // UI task → Core task communication
-    QueueHandle_t mainToUIQueue = nullptr;    // Core task → UI task communication
+    /**
+     * Subscription table entry (callback or queue)
+     */
+    struct Subscriber {
+        EventMask mask = EVENT_MASK_NONE;
+        EventCallback callback = nullptr;
+        void* context = nullptr;
+        QueueHandle_t queue = nullptr;
+        EventChannel* ring = nullptr;   // Built-in UI/Core channel
+        TaskHandle_t notifyTask = nullptr;
+        bool notifyUI = false;          // Notify uiTask (may be set after subscribing)
+        bool notifyMain = false;        // Notify mainTask (may be set after subscribing)
+        bool active = false;
+    };
+
+    Subscriber subscribers[MAX_SUBSCRIBERS];
+    portMUX_TYPE subscribersLock = portMUX_INITIALIZER_UNLOCKED;
+
+    int addSubscriber(const Subscriber& subscriber);
+    bool enqueue(QueueHandle_t queue, const Event& event, TickType_t timeout);
+
+    // Built-in event queues for bidirectional communication
+    EventChannel uiToMain;                    // UI task → Core task communication
+    EventChannel mainToUI;                    // Core task → UI task communication
+    TaskHandle_t uiTask = nullptr;            // Notified on every successful sendToUI()
+    TaskHandle_t mainTask = nullptr;          // Notified on every successful sendToMain()
+    EventMetrics metrics;                     // Shared by both built-in queues
     
     // Configuration constants
-    static const uint32_t QUEUE_SIZE = 10;   // Maximum events per queue
+    static const uint32_t QUEUE_SIZE =        // Maximum events per direction (all lanes)
+        EVENT_LANE_INTERACTIVE_SIZE + EVENT_LANE_NORMAL_SIZE + EVENT_LANE_BACKGROUND_SIZE;
     
     // Initialization state
     bool initialized = false;                 // Tracks successful initialization
@@ -0,0 +1,150 @@
+/**
+ * CloudMouse SDK - Prioritized Event Channel Implementation
+ *
+ * Lanes are polled without blocking in priority order; only the shared
+ * itemSignal is waited on. A push that lands between the scan and the wait
+ * leaves the (binary) signal given, so the consumer rescans immediately and
+ * no wake-up is lost.
+ */
+
+#include "./EventChannel.h"
+
+namespace CloudMouse
+{
+    // ============================================================================
+    // LIFECYCLE
+    // ============================================================================
+
+    bool EventChannel::create(const uint32_t (&capacities)[LANE_COUNT], Event *slotStorage, uint32_t *stampStorage)
+    {
+        if (itemSignal)
+            return true;
+
+#if SDK_STATIC_ALLOCATION
+        itemSignal = xSemaphoreCreateBinaryStatic(&itemSignalBuffer);
+#else
+        itemSignal = xSemaphoreCreateBinary();
+#endif
+        if (!itemSignal)
+            return false;
+
+        uint32_t offset = 0;
+        for (int i = 0; i < LANE_COUNT; i++)
+        {
+            bool created = slotStorage && stampStorage
+                               ? lanes[i].create(capacities[i], slotStorage + offset, stampStorage + offset)
+                               : lanes[i].create(capacities[i]);
+            if (!created)
+            {
+                destroy();
+                return false;
+            }
+            offset += capacities[i];
+        }
+        return true;
+    }
+
+    void EventChannel::destroy()
+    {
+        for (int i = 0; i < LANE_COUNT; i++)
+            lanes[i].destroy();
+
+        if (itemSignal)
+            vSemaphoreDelete(itemSignal);
+        itemSignal = nullptr;
+    }
+
+    // ============================================================================
+    // PUSH / POP
+    // ============================================================================
+
+    EventQueue::PushResult EventChannel::push(const Event &event, TickType_t timeout)
+    {
+        if (!itemSignal)
+            return EventQueue::PushResult::FULL;
+
+        EventQueue::PushResult result = lanes[(int)eventLane(event.type)].push(event, timeout);
+
+        // A merge updates an entry the consumer has already been told about
+        if (result == EventQueue::PushResult::QUEUED)
+            xSemaphoreGive(itemSignal);
+        return result;
+    }
+
+    bool EventChannel::pop(Event &event, TickType_t timeout, uint32_t *queuedUs)
+    {
+        if (!itemSignal)
+            return false;
+
+        TickType_t start = xTaskGetTickCount();
+        while (true)
+        {
+            for (int i = 0; i < LANE_COUNT; i++)
+            {
+                if (lanes[i].pop(event, 0, queuedUs))
+                    return true;
+            }
+
+            TickType_t elapsed = xTaskGetTickCount() - start;
+            if (timeout == 0 || elapsed >= timeout || xSemaphoreTake(itemSignal, timeout - elapsed) != pdTRUE)
+                return false;
+        }
+    }
+
+    // ============================================================================
+    // STATISTICS
+    // ============================================================================
+
+    uint32_t EventChannel::count() const
+    {
+        uint32_t total = 0;
+        for (int i = 0; i < LANE_COUNT; i++)
+            total += lanes[i].count();
+        return total;
+    }
+
+    uint32_t EventChannel::capacity() const
+    {
+        uint32_t total = 0;
+        for (int i = 0; i < LANE_COUNT; i++)
+            total += lanes[i].capacity();
+        return total;
+    }
+
+    uint32_t EventChannel::getMergedCount() const
+    {
+        uint32_t total = 0;
+        for (int i = 0; i < LANE_COUNT; i++)
+            total += lanes[i].getMergedCount();
+        return total;
+    }
+
+    uint32_t EventChannel::getDroppedCount() const
+    {
+        uint32_t total = 0;
+        for (int i = 0; i < LANE_COUNT; i++)
+            total += lanes[i].getDroppedCount();
+        return total;
+    }
+
+    void EventChannel::resetStats()
+    {
+        for (int i = 0; i < LANE_COUNT; i++)
+            lanes[i].resetStats();
+    }
+
+    const char *EventChannel::laneName(EventLane lane)
+    {
+        switch (lane)
+        {
+        case EventLane::INTERACTIVE:
+            return "interactive";
+        case EventLane::NORMAL:
+            return "normal";
+        case EventLane::BACKGROUND:
+            return "background";
+        default:
+            return "unknown";
+        }
+    }
+}
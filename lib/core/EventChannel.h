@@ -0,0 +1,93 @@
+/**
+ * CloudMouse SDK - Prioritized Event Channel
+ *
+ * One direction of the EventBus: an EventQueue per EventLane behind a single
+ * push/pop interface. pop() always returns the oldest event of the highest
+ * priority lane that has one, so encoder input is never queued behind WiFi
+ * or app traffic.
+ *
+ * Ordering:
+ * - FIFO within a lane (and therefore within an event type)
+ * - Across lanes, higher priority events overtake lower priority ones
+ * - Coalescing (EventQueue merge rules) applies inside each lane
+ *
+ * Blocking:
+ * - Every push signals one shared binary semaphore; a waiting consumer wakes
+ *   and rescans the lanes, the same way a FreeRTOS queue set reports whichever
+ *   member queue became ready
+ * - push() timeouts wait for space in the event's own lane only
+ *
+ * Thread Safety:
+ * - Same as EventQueue: safe for producers and consumers on both cores (not from ISRs)
+ */
+
+#ifndef EVENT_CHANNEL_H
+#define EVENT_CHANNEL_H
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include "Events.h"
+#include "EventQueue.h"
+
+namespace CloudMouse
+{
+    class EventChannel
+    {
+    public:
+        static const int LANE_COUNT = (int)EventLane::COUNT;
+
+        EventChannel() = default;
+        ~EventChannel() { destroy(); }
+
+        /**
+         * Allocate every lane and the shared wake-up signal
+         * @param capacities Slots per lane, indexed by EventLane
+         * @param slotStorage / stampStorage Optional caller-owned arrays holding
+         *        the sum of capacities, split between the lanes in order
+         * @return false if memory could not be allocated
+         */
+        bool create(const uint32_t (&capacities)[LANE_COUNT],
+                    Event *slotStorage = nullptr, uint32_t *stampStorage = nullptr);
+        void destroy();
+
+        /**
+         * Queue an event in the lane of its type (eventLane())
+         */
+        EventQueue::PushResult push(const Event &event, TickType_t timeout = 0);
+
+        /**
+         * Take the next event, highest priority lane first
+         * @param event Receives the entry (its previous payload is released)
+         * @param queuedUs Optional, receives the microseconds the entry spent queued
+         */
+        bool pop(Event &event, TickType_t timeout = 0, uint32_t *queuedUs = nullptr);
+
+        // Totals over every lane
+        uint32_t count() const;
+        uint32_t capacity() const;
+        uint32_t getMergedCount() const;
+        uint32_t getDroppedCount() const;
+        bool isCreated() const { return itemSignal != nullptr; }
+
+        /**
+         * Per-lane depth, capacity, high-water mark and counters
+         */
+        const EventQueue &lane(EventLane lane) const { return lanes[(int)lane]; }
+
+        void resetStats();
+
+        static const char *laneName(EventLane lane);
+
+    private:
+        EventQueue lanes[LANE_COUNT];
+        SemaphoreHandle_t itemSignal = nullptr;
+#if SDK_STATIC_ALLOCATION
+        StaticSemaphore_t itemSignalBuffer;
+#endif
+
+        EventChannel(const EventChannel &) = delete;
+        EventChannel &operator=(const EventChannel &) = delete;
+    };
+}
+
+#endif
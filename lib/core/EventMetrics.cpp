@@ -0,0 +1,156 @@
+/**
+ * CloudMouse SDK - Event Bus Metrics Implementation
+ */
+
+#include "./EventMetrics.h"
+#include <string.h>
+
+namespace CloudMouse {
+
+namespace {
+    // Same order as EventType
+    const char* const eventTypeNames[] = {
+        "BOOTING_COMPLETE",
+        "ENCODER_ROTATION",
+        "ENCODER_CLICK",
+        "ENCODER_LONG_PRESS",
+        "ENCODER_PRESS_TIME",
+        "ENCODER_BUTTON_RELEASED",
+        "ENCODER_PRESS_AND_ROTATE",
+        "ENCODER_DOUBLE_CLICK",
+        "ENCODER_INPUT",
+        "DISPLAY_WAKE_UP",
+        "DISPLAY_UPDATE",
+        "DISPLAY_CLEAR",
+        "DISPLAY_BENCHMARK",
+        "DISPLAY_PROFILER_REPORT",
+        "DISPLAY_WIFI_CONNECTING",
+        "DISPLAY_WIFI_CONNECTED",
+        "DISPLAY_WIFI_ERROR",
+        "DISPLAY_WIFI_AP_MODE",
+        "DISPLAY_WIFI_SETUP_URL",
+        "WIFI_CONNECTING",
+        "WIFI_CONNECTED",
+        "WIFI_DISCONNECTED",
+        "WIFI_ERROR",
+        "WIFI_AP_MODE",
+        "TIME_SYNCED",
+    };
+
+    static_assert(sizeof(eventTypeNames) / sizeof(eventTypeNames[0]) == (size_t)EventType::COUNT,
+                  "eventTypeNames must list every EventType");
+}
+
+// ============================================================================
+// RECORDING
+// ============================================================================
+
+void EventMetrics::recordPush(EventType type, EventQueue::PushResult result) {
+    int index = (int)type;
+    if (index < 0 || index >= TYPE_COUNT) {
+        return;
+    }
+
+    portENTER_CRITICAL(&lock);
+    TypeCounters& counters = types[index];
+    switch (result) {
+        case EventQueue::PushResult::QUEUED: counters.enqueued++; break;
+        case EventQueue::PushResult::MERGED: counters.merged++; break;
+        case EventQueue::PushResult::FULL:   counters.dropped++; break;
+    }
+    portEXIT_CRITICAL(&lock);
+}
+
+void EventMetrics::recordPop(EventType type, uint32_t queuedUs) {
+    int index = (int)type;
+    if (index < 0 || index >= TYPE_COUNT) {
+        return;
+    }
+
+    int bucket = bucketFor(queuedUs);
+
+    portENTER_CRITICAL(&lock);
+    TypeCounters& counters = types[index];
+    counters.dequeued++;
+    counters.latency[bucket]++;
+    counters.latencySumUs += queuedUs;
+    if (queuedUs > counters.latencyMaxUs) {
+        counters.latencyMaxUs = queuedUs;
+    }
+    portEXIT_CRITICAL(&lock);
+}
+
+// ============================================================================
+// SNAPSHOTS
+// ============================================================================
+
+bool EventMetrics::getCounters(EventType type, TypeCounters& counters) const {
+    int index = (int)type;
+    if (index < 0 || index >= TYPE_COUNT) {
+        return false;
+    }
+
+    portENTER_CRITICAL(&lock);
+    counters = types[index];
+    portEXIT_CRITICAL(&lock);
+    return true;
+}
+
+void EventMetrics::reset() {
+    portENTER_CRITICAL(&lock);
+    memset(types, 0, sizeof(types));
+    windowStart = millis();
+    portEXIT_CRITICAL(&lock);
+}
+
+// ============================================================================
+// HISTOGRAM HELPERS
+// ============================================================================
+
+int EventMetrics::bucketFor(uint32_t us) {
+    if (us < 16) {
+        return 0;
+    }
+
+    // floor(log2(us)) - 3: [16, 32) -> 1, [32, 64) -> 2, ...
+    int bucket = (31 - __builtin_clz(us)) - 3;
+    return bucket < LATENCY_BUCKETS ? bucket : LATENCY_BUCKETS - 1;
+}
+
+uint32_t EventMetrics::bucketLimitUs(int bucket) {
+    if (bucket < 0 || bucket >= LATENCY_BUCKETS - 1) {
+        return 0;
+    }
+    return 16u << bucket;
+}
+
+uint32_t EventMetrics::percentileUs(const TypeCounters& counters, uint8_t percent) {
+    if (counters.dequeued == 0) {
+        return 0;
+    }
+
+    // Rank of the sample that reaches the percentile (at least the first sample)
+    uint64_t rank = ((uint64_t)counters.dequeued * percent + 99) / 100;
+    if (rank == 0) {
+        rank = 1;
+    }
+
+    uint64_t seen = 0;
+    for (int i = 0; i < LATENCY_BUCKETS - 1; i++) {
+        seen += counters.latency[i];
+        if (seen >= rank) {
+            return bucketLimitUs(i);
+        }
+    }
+    return UINT32_MAX;
+}
+
+const char* EventMetrics::typeName(EventType type) {
+    int index = (int)type;
+    if (index < 0 || index >= TYPE_COUNT) {
+        return "UNKNOWN";
+    }
+    return eventTypeNames[index];
+}
+
+} // namespace CloudMouse
@@ -0,0 +1,106 @@
+/**
+ * CloudMouse SDK - Event Bus Metrics
+ *
+ * Per-EventType counters for the built-in EventBus queues, so queue pressure
+ * and input latency can be read on a running device instead of guessed from logs.
+ *
+ * Counters (per EventType):
+ * - enqueued / merged / dropped: outcome of every push into a bus queue
+ * - dequeued: events handed to the receiving task
+ * - Queue latency: time between the push and the pop, as a log2 histogram
+ *   (bucket 0 < 16 µs, each following bucket doubles, the last one is open)
+ *   plus the maximum and the sum for the average
+ *
+ * Reporting:
+ * - EventBus::logMetrics() (serial command "bus stats")
+ * - EventBus::getMetricsJson() (GET /api/metrics/eventbus)
+ * - Throughput is derived from the counters and the time since the last reset()
+ *
+ * Thread Safety:
+ * - Updates and snapshots are short spinlock sections; safe from both cores
+ */
+
+#ifndef EVENT_METRICS_H
+#define EVENT_METRICS_H
+
+#include <Arduino.h>
+#include "Events.h"
+#include "EventQueue.h"
+
+namespace CloudMouse {
+
+class EventMetrics {
+public:
+    static const int LATENCY_BUCKETS = 12;
+    static const int TYPE_COUNT = (int)EventType::COUNT;
+
+    /**
+     * Snapshot of one event type
+     */
+    struct TypeCounters {
+        uint32_t enqueued;
+        uint32_t merged;
+        uint32_t dropped;
+        uint32_t dequeued;
+        uint32_t latencyMaxUs;
+        uint64_t latencySumUs;
+        uint32_t latency[LATENCY_BUCKETS];
+    };
+
+    EventMetrics() { reset(); }
+
+    /**
+     * Record the outcome of a push into one of the bus queues
+     */
+    void recordPush(EventType type, EventQueue::PushResult result);
+
+    /**
+     * Record an event leaving a bus queue
+     * @param queuedUs Time the event spent queued (EventQueue::pop())
+     */
+    void recordPop(EventType type, uint32_t queuedUs);
+
+    /**
+     * Copy the counters of one type
+     * @return false for an invalid type
+     */
+    bool getCounters(EventType type, TypeCounters& counters) const;
+
+    /**
+     * Clear every counter and restart the throughput window
+     */
+    void reset();
+
+    /**
+     * Milliseconds since the last reset() (throughput window)
+     */
+    uint32_t getWindowMs() const { return millis() - windowStart; }
+
+    /**
+     * Exclusive upper bound of a latency bucket in microseconds (0 for the open last bucket)
+     */
+    static uint32_t bucketLimitUs(int bucket);
+
+    /**
+     * Approximate percentile from a histogram: upper bound of the bucket holding it
+     * @param percent 0-100
+     * @return Microseconds, 0 if there are no samples, UINT32_MAX beyond the last bound
+     */
+    static uint32_t percentileUs(const TypeCounters& counters, uint8_t percent);
+
+    /**
+     * Printable name of an event type ("ENCODER_ROTATION", ...)
+     */
+    static const char* typeName(EventType type);
+
+private:
+    TypeCounters types[TYPE_COUNT];
+    uint32_t windowStart = 0;
+    mutable portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+
+    static int bucketFor(uint32_t us);
+};
+
+} // namespace CloudMouse
+
+#endif
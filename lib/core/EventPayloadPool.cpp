@@ -0,0 +1,152 @@
+/**
+ * CloudMouse SDK - Event Payload Pool Implementation
+ *
+ * Blocks live in a static array (no heap use); free blocks are kept on an
+ * index stack so acquire/release are O(1). Handles are block index + 1 so
+ * that a zero-initialized Event carries no payload.
+ */
+
+#include "./EventPayloadPool.h"
+#include "../config/DeviceConfig.h"
+
+namespace CloudMouse
+{
+    namespace
+    {
+        uint8_t payloadBlocks[EVENT_PAYLOAD_BLOCK_COUNT][EVENT_PAYLOAD_BLOCK_SIZE];
+        uint16_t payloadLengths[EVENT_PAYLOAD_BLOCK_COUNT];
+        uint8_t payloadRefs[EVENT_PAYLOAD_BLOCK_COUNT];
+
+        uint16_t payloadFreeStack[EVENT_PAYLOAD_BLOCK_COUNT];
+        uint16_t payloadFreeCount = 0;
+        bool payloadPoolReady = false;
+
+        uint16_t payloadPeak = 0;
+        uint32_t payloadFailures = 0;
+        uint32_t payloadTruncations = 0;
+
+        portMUX_TYPE poolLock = portMUX_INITIALIZER_UNLOCKED;
+
+        // Called with poolLock held
+        void initFreeStack()
+        {
+            for (uint16_t i = 0; i < EVENT_PAYLOAD_BLOCK_COUNT; i++)
+                payloadFreeStack[i] = EVENT_PAYLOAD_BLOCK_COUNT - 1 - i;
+            payloadFreeCount = EVENT_PAYLOAD_BLOCK_COUNT;
+            payloadPoolReady = true;
+        }
+
+        bool validHandle(uint16_t handle)
+        {
+            return handle != EventPayloadPool::INVALID_HANDLE && handle <= EVENT_PAYLOAD_BLOCK_COUNT;
+        }
+
+        // Take a free block with one reference, INVALID_HANDLE if none
+        uint16_t takeBlock(bool cut)
+        {
+            uint16_t index;
+            portENTER_CRITICAL(&poolLock);
+            if (!payloadPoolReady)
+                initFreeStack();
+            if (payloadFreeCount == 0)
+            {
+                payloadFailures++;
+                portEXIT_CRITICAL(&poolLock);
+                return EventPayloadPool::INVALID_HANDLE;
+            }
+            index = payloadFreeStack[--payloadFreeCount];
+            payloadRefs[index] = 1;
+            uint16_t used = EVENT_PAYLOAD_BLOCK_COUNT - payloadFreeCount;
+            if (used > payloadPeak)
+                payloadPeak = used;
+            if (cut)
+                payloadTruncations++;
+            portEXIT_CRITICAL(&poolLock);
+            return index + 1;
+        }
+    }
+
+    uint16_t EventPayloadPool::acquire(const void *data, size_t length, bool *truncated)
+    {
+        bool cut = length > EVENT_PAYLOAD_BLOCK_SIZE;
+        if (cut)
+            length = EVENT_PAYLOAD_BLOCK_SIZE;
+        if (truncated)
+            *truncated = cut;
+
+        uint16_t handle = takeBlock(cut);
+        if (handle == INVALID_HANDLE)
+            return INVALID_HANDLE;
+
+        // Block is exclusively ours until the handle is published
+        memcpy(payloadBlocks[handle - 1], data, length);
+        payloadLengths[handle - 1] = length;
+        return handle;
+    }
+
+    uint16_t EventPayloadPool::acquireText(const char *text, bool *truncated)
+    {
+        size_t length = strlen(text);
+        bool cut = length > EVENT_PAYLOAD_BLOCK_SIZE - 1;
+        if (cut)
+            length = EVENT_PAYLOAD_BLOCK_SIZE - 1;
+        if (truncated)
+            *truncated = cut;
+
+        uint16_t handle = takeBlock(cut);
+        if (handle == INVALID_HANDLE)
+            return INVALID_HANDLE;
+
+        uint8_t *block = payloadBlocks[handle - 1];
+        memcpy(block, text, length);
+        block[length] = '\0';
+        payloadLengths[handle - 1] = length + 1;
+        return handle;
+    }
+
+    void EventPayloadPool::retain(uint16_t handle)
+    {
+        if (!validHandle(handle))
+            return;
+
+        portENTER_CRITICAL(&poolLock);
+        payloadRefs[handle - 1]++;
+        portEXIT_CRITICAL(&poolLock);
+    }
+
+    void EventPayloadPool::release(uint16_t handle)
+    {
+        if (!validHandle(handle))
+            return;
+
+        uint16_t index = handle - 1;
+        portENTER_CRITICAL(&poolLock);
+        if (payloadRefs[index] > 0 && --payloadRefs[index] == 0)
+            payloadFreeStack[payloadFreeCount++] = index;
+        portEXIT_CRITICAL(&poolLock);
+    }
+
+    const uint8_t *EventPayloadPool::data(uint16_t handle)
+    {
+        return validHandle(handle) ? payloadBlocks[handle - 1] : nullptr;
+    }
+
+    size_t EventPayloadPool::length(uint16_t handle)
+    {
+        return validHandle(handle) ? payloadLengths[handle - 1] : 0;
+    }
+
+    void EventPayloadPool::getStats(Stats &stats)
+    {
+        portENTER_CRITICAL(&poolLock);
+        if (!payloadPoolReady)
+            initFreeStack();
+        stats.blockSize = EVENT_PAYLOAD_BLOCK_SIZE;
+        stats.capacity = EVENT_PAYLOAD_BLOCK_COUNT;
+        stats.used = EVENT_PAYLOAD_BLOCK_COUNT - payloadFreeCount;
+        stats.peak = payloadPeak;
+        stats.failures = payloadFailures;
+        stats.truncations = payloadTruncations;
+        portEXIT_CRITICAL(&poolLock);
+    }
+}
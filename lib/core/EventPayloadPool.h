@@ -0,0 +1,79 @@
+/**
+ * CloudMouse SDK - Event Payload Pool
+ *
+ * Fixed-block storage for the string and binary payloads attached to events.
+ * Events only carry a 16-bit handle into this pool, so queue slots stay small
+ * and an event is copied in and out of a FreeRTOS queue as a few words instead
+ * of a full text buffer.
+ *
+ * Lifetime:
+ * - acquire() copies the payload into a free block with one reference
+ * - Every Event holding the handle owns one reference (copy = retain,
+ *   destruction = release); EventBus retains for the copy parked in a queue
+ *   and the receiving Event adopts it
+ * - The block returns to the free list when the last reference is released
+ *
+ * Configuration:
+ * - EVENT_PAYLOAD_BLOCK_SIZE and EVENT_PAYLOAD_BLOCK_COUNT in DeviceConfig.h
+ *
+ * Thread Safety:
+ * - All operations take a spinlock (critical sections only cover the free list
+ *   and reference counts; the copy into a freshly acquired block is outside it)
+ */
+
+#ifndef EVENT_PAYLOAD_POOL_H
+#define EVENT_PAYLOAD_POOL_H
+
+#include <Arduino.h>
+
+namespace CloudMouse
+{
+    class EventPayloadPool
+    {
+    public:
+        static const uint16_t INVALID_HANDLE = 0;
+
+        /**
+         * Pool usage counters
+         */
+        struct Stats
+        {
+            uint16_t blockSize;     // Bytes per payload block
+            uint16_t capacity;      // Blocks in the pool
+            uint16_t used;          // Blocks currently referenced
+            uint16_t peak;          // Highest 'used' since boot
+            uint32_t failures;      // acquire() calls rejected because the pool was full
+            uint32_t truncations;   // Payloads cut to the block size
+        };
+
+        /**
+         * Copy a payload into a free block
+         *
+         * @param data Bytes to store
+         * @param length Number of bytes (truncated to the block size)
+         * @param truncated Set to true if the payload did not fit
+         * @return Handle with one reference, INVALID_HANDLE if the pool is full
+         */
+        static uint16_t acquire(const void *data, size_t length, bool *truncated = nullptr);
+
+        /**
+         * Copy a null-terminated string (stored with its terminator, truncated
+         * to EVENT_PAYLOAD_BLOCK_SIZE - 1 characters)
+         */
+        static uint16_t acquireText(const char *text, bool *truncated = nullptr);
+
+        static void retain(uint16_t handle);
+        static void release(uint16_t handle);
+
+        /**
+         * Payload bytes, valid while the caller holds a reference
+         * @return nullptr for INVALID_HANDLE
+         */
+        static const uint8_t *data(uint16_t handle);
+        static size_t length(uint16_t handle);
+
+        static void getStats(Stats &stats);
+    };
+}
+
+#endif
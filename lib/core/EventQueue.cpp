@@ -0,0 +1,263 @@
+/**
+ * CloudMouse SDK - Coalescing Event Queue Implementation
+ *
+ * Slots are regular Event objects: copy assignment moves payload references
+ * in and out (retain on push, release when a popped slot is cleared).
+ */
+
+#include "./EventQueue.h"
+#include <new>
+
+namespace CloudMouse
+{
+    // ============================================================================
+    // LIFECYCLE
+    // ============================================================================
+
+    bool EventQueue::create(uint32_t capacity, Event *slotStorage, uint32_t *stampStorage)
+    {
+        if (slots || capacity == 0)
+            return slots != nullptr;
+
+        ownsStorage = !slotStorage || !stampStorage;
+        if (ownsStorage)
+        {
+            slots = new (std::nothrow) Event[capacity];
+            stamps = new (std::nothrow) uint32_t[capacity];
+        }
+        else
+        {
+            slots = slotStorage;
+            stamps = stampStorage;
+        }
+
+#if SDK_STATIC_ALLOCATION
+        itemSignal = xSemaphoreCreateBinaryStatic(&itemSignalBuffer);
+        spaceSignal = xSemaphoreCreateBinaryStatic(&spaceSignalBuffer);
+#else
+        itemSignal = xSemaphoreCreateBinary();
+        spaceSignal = xSemaphoreCreateBinary();
+#endif
+
+        if (!slots || !stamps || !itemSignal || !spaceSignal)
+        {
+            destroy();
+            return false;
+        }
+
+        slotCount = capacity;
+        head = 0;
+        used = 0;
+        return true;
+    }
+
+    void EventQueue::destroy()
+    {
+        if (ownsStorage)
+        {
+            delete[] slots;
+            delete[] stamps;
+        }
+        else if (slots)
+        {
+            // Caller-owned slots: drop the payload references they still hold
+            for (uint32_t i = 0; i < slotCount; i++)
+                slots[i] = Event();
+        }
+        slots = nullptr;
+        stamps = nullptr;
+        ownsStorage = false;
+        slotCount = 0;
+        used = 0;
+
+        if (itemSignal)
+            vSemaphoreDelete(itemSignal);
+        if (spaceSignal)
+            vSemaphoreDelete(spaceSignal);
+        itemSignal = nullptr;
+        spaceSignal = nullptr;
+    }
+
+    // ============================================================================
+    // MERGING
+    // ============================================================================
+
+    bool EventQueue::mergeInto(Event &pending, const Event &event, bool full)
+    {
+        if (pending.type != event.type)
+            return false;
+        if (EVENT_MASK_FOLD & eventBit(event.type))
+            return foldInto(pending, event, full);
+        if (pending.payload || event.payload)
+            return false;
+
+        EventMask bit = eventBit(event.type);
+        if (EVENT_MASK_ACCUMULATE & bit)
+            pending.value += event.value;
+        else if (EVENT_MASK_LATEST & bit)
+            pending.value = event.value;
+        else
+            return false;
+
+        // Keep the oldest timestamp: latency is measured from the first input
+        pending.flags |= EVENT_FLAG_MERGED;
+        return true;
+    }
+
+    bool EventQueue::foldInto(Event &pending, const Event &event, bool full)
+    {
+        InputSnapshot folded, next;
+        readInputSnapshot(pending, folded);
+        readInputSnapshot(event, next);
+
+        // Gestures and button changes keep their own entry while there is room
+        if (!full && !canFoldInputSnapshot(folded, next))
+            return false;
+        foldInputSnapshot(folded, next);
+
+        // The pending block is shared with the other queues holding this event: fold into a new one
+        uint16_t handle = EventPayloadPool::acquire(&folded, sizeof(folded));
+        if (handle == EventPayloadPool::INVALID_HANDLE)
+        {
+            // Pool full: steps-only entries still fold, a snapshot is never traded for its steps
+            if (pending.payload || event.payload)
+                return false;
+            pending.value = folded.steps;
+            pending.flags |= EVENT_FLAG_MERGED;
+            return true;
+        }
+
+        EventPayloadPool::release(pending.payload);
+        pending.payload = handle;
+        pending.value = folded.steps;
+        pending.flags = (uint8_t)((pending.flags & ~(EVENT_FLAG_TRUNCATED | EVENT_FLAG_PAYLOAD_LOST)) |
+                                  EVENT_FLAG_BINARY | EVENT_FLAG_MERGED);
+        return true;
+    }
+
+    bool EventQueue::tryMerge(const Event &event)
+    {
+        if (used == 0 || !((EVENT_MASK_ACCUMULATE | EVENT_MASK_LATEST | EVENT_MASK_FOLD) & eventBit(event.type)))
+            return false;
+
+        // Tail only while there is room: merging across other types would reorder input
+        uint32_t tail = (head + used - 1) % slotCount;
+        bool full = used == slotCount;
+        if (mergeInto(slots[tail], event, full))
+            return true;
+        if (!full)
+            return false;
+
+        // Full: fold into the most recent pending entry of the same type
+        for (uint32_t i = 1; i < used; i++)
+        {
+            uint32_t index = (head + used - 1 - i) % slotCount;
+            if (mergeInto(slots[index], event, true))
+                return true;
+        }
+        return false;
+    }
+
+    // ============================================================================
+    // PUSH / POP
+    // ============================================================================
+
+    EventQueue::PushResult EventQueue::push(const Event &event, TickType_t timeout)
+    {
+        if (!slots)
+            return PushResult::FULL;
+
+        TickType_t start = xTaskGetTickCount();
+        while (true)
+        {
+            PushResult result = PushResult::FULL;
+
+            portENTER_CRITICAL(&lock);
+            if (tryMerge(event))
+            {
+                merged++;
+                result = PushResult::MERGED;
+            }
+            else if (used < slotCount)
+            {
+                uint32_t tail = (head + used) % slotCount;
+                slots[tail] = event;
+                stamps[tail] = micros();
+                used++;
+                if (used > highWater)
+                    highWater = used;
+                result = PushResult::QUEUED;
+            }
+            portEXIT_CRITICAL(&lock);
+
+            if (result == PushResult::QUEUED)
+            {
+                xSemaphoreGive(itemSignal);
+                return result;
+            }
+            if (result == PushResult::MERGED)
+                return result;
+
+            TickType_t elapsed = xTaskGetTickCount() - start;
+            if (timeout == 0 || elapsed >= timeout || xSemaphoreTake(spaceSignal, timeout - elapsed) != pdTRUE)
+            {
+                portENTER_CRITICAL(&lock);
+                dropped++;
+                portEXIT_CRITICAL(&lock);
+                return PushResult::FULL;
+            }
+        }
+    }
+
+    bool EventQueue::pop(Event &event, TickType_t timeout, uint32_t *queuedUs)
+    {
+        if (!slots)
+            return false;
+
+        TickType_t start = xTaskGetTickCount();
+        while (true)
+        {
+            bool taken = false;
+
+            portENTER_CRITICAL(&lock);
+            if (used > 0)
+            {
+                event = slots[head];
+                slots[head].clearStringData();
+                if (queuedUs)
+                    *queuedUs = micros() - stamps[head];
+                head = (head + 1) % slotCount;
+                used--;
+                taken = true;
+            }
+            portEXIT_CRITICAL(&lock);
+
+            if (taken)
+            {
+                xSemaphoreGive(spaceSignal);
+                return true;
+            }
+
+            TickType_t elapsed = xTaskGetTickCount() - start;
+            if (timeout == 0 || elapsed >= timeout || xSemaphoreTake(itemSignal, timeout - elapsed) != pdTRUE)
+                return false;
+        }
+    }
+
+    uint32_t EventQueue::count() const
+    {
+        portENTER_CRITICAL(&lock);
+        uint32_t pending = used;
+        portEXIT_CRITICAL(&lock);
+        return pending;
+    }
+
+    void EventQueue::resetStats()
+    {
+        portENTER_CRITICAL(&lock);
+        merged = 0;
+        dropped = 0;
+        highWater = used;
+        portEXIT_CRITICAL(&lock);
+    }
+}
@@ -0,0 +1,127 @@
+/**
+ * CloudMouse SDK - Coalescing Event Queue
+ *
+ * Fixed-capacity FIFO of Events used for the EventBus UI and Core queues.
+ * Unlike a FreeRTOS queue, the pending tail can be updated in place, so bursts
+ * of input collapse into a single entry instead of overflowing the queue.
+ *
+ * Merge Rules (EventMask sets in Events.h):
+ * - EVENT_MASK_ACCUMULATE (rotation deltas): the value is added to the pending
+ *   entry of the same type
+ * - EVENT_MASK_LATEST (state snapshots such as press time): the new value
+ *   replaces the pending one
+ * - Only the tail entry is merged while there is space, so ordering between
+ *   different event types is preserved; once the queue is full the most
+ *   recent pending entry of the same type is merged instead of dropping
+ * - EVENT_MASK_FOLD (input snapshots): the payload snapshots are combined
+ *   with foldInputSnapshot() into a new payload block; while there is space
+ *   only pure movement folds (canFoldInputSnapshot()), an edge, gesture or
+ *   button change is queued as its own entry. A full queue folds any
+ *   snapshot rather than dropping it
+ * - Other events carrying a payload are never merged
+ *
+ * Metrics:
+ * - Each slot records when it was queued (merges keep the first stamp), and
+ *   pop() can report how long the entry waited; the depth high-water mark is
+ *   kept next to the merged/dropped counters
+ *
+ * Storage:
+ * - Slots are allocated by create() unless the caller passes its own arrays
+ *   (EventBus does in the SDK_STATIC_ALLOCATION build); the signals are
+ *   then created static as well
+ *
+ * Blocking:
+ * - push()/pop() accept a FreeRTOS timeout like xQueueSend()/xQueueReceive();
+ *   waiting uses binary semaphores signalled on every push and pop
+ *
+ * Thread Safety:
+ * - Ring state is protected by a spinlock; safe for multiple producers and
+ *   consumers on both cores (not from ISRs)
+ */
+
+#ifndef EVENT_QUEUE_H
+#define EVENT_QUEUE_H
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include "Events.h"
+#include "../config/DeviceConfig.h"
+
+namespace CloudMouse
+{
+    class EventQueue
+    {
+    public:
+        enum class PushResult
+        {
+            QUEUED, // Stored in a new slot
+            MERGED, // Folded into a pending entry
+            FULL    // No space and nothing to merge into (after timeout)
+        };
+
+        EventQueue() = default;
+        ~EventQueue() { destroy(); }
+
+        /**
+         * Allocate slots and synchronization primitives
+         * @param slotStorage / stampStorage Optional caller-owned arrays of
+         *        capacity entries (static allocation); allocated when null
+         * @return false if memory could not be allocated
+         */
+        bool create(uint32_t capacity, Event *slotStorage = nullptr, uint32_t *stampStorage = nullptr);
+        void destroy();
+
+        PushResult push(const Event &event, TickType_t timeout = 0);
+
+        /**
+         * Take the oldest entry
+         * @param event Receives the entry (its previous payload is released)
+         * @param queuedUs Optional, receives the microseconds the entry spent queued
+         */
+        bool pop(Event &event, TickType_t timeout = 0, uint32_t *queuedUs = nullptr);
+
+        uint32_t count() const;
+        uint32_t capacity() const { return slotCount; }
+        bool isCreated() const { return slots != nullptr; }
+
+        uint32_t getMergedCount() const { return merged; }
+        uint32_t getDroppedCount() const { return dropped; }
+        uint32_t getHighWater() const { return highWater; }
+
+        /**
+         * Clear merged/dropped counters and restart the high-water mark from the current depth
+         */
+        void resetStats();
+
+    private:
+        Event *slots = nullptr;
+        uint32_t *stamps = nullptr;     // micros() when each slot was queued
+        uint32_t slotCount = 0;
+        uint32_t head = 0;      // Oldest entry
+        uint32_t used = 0;
+
+        uint32_t merged = 0;
+        uint32_t dropped = 0;
+        uint32_t highWater = 0;
+
+        bool ownsStorage = false;
+
+        SemaphoreHandle_t itemSignal = nullptr;
+        SemaphoreHandle_t spaceSignal = nullptr;
+#if SDK_STATIC_ALLOCATION
+        StaticSemaphore_t itemSignalBuffer;
+        StaticSemaphore_t spaceSignalBuffer;
+#endif
+        mutable portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+
+        // Called with lock held
+        bool tryMerge(const Event &event);
+        static bool mergeInto(Event &pending, const Event &event, bool full);
+        static bool foldInto(Event &pending, const Event &event, bool full);
+
+        EventQueue(const EventQueue &) = delete;
+        EventQueue &operator=(const EventQueue &) = delete;
+    };
+}
+
+#endif
@@ -6,35 +6,36 @@
  * 
  * Architecture:
  * - Strongly-typed event enumeration for compile-time safety
- * - Fixed-size event structure optimized for FreeRTOS queue transmission
- * - Support for numeric data, string payloads, and specialized data formats
- * - Memory-efficient design with stack allocation and minimal heap usage
+ * - Compact fixed-size event structure optimized for FreeRTOS queue transmission
+ * - Support for numeric data, pooled string/binary payloads, and specialized data formats
+ * - Memory-efficient design: payloads in a static block pool, no heap usage
  * - Built-in helper methods for common data patterns (WiFi, encoder, display)
  * 
  * Event Flow:
  * Hardware/System → Event Creation → EventBus Queue → Target Task → Event Processing
  * 
  * Usage Patterns:
- * 1. Hardware events: ENCODER_ROTATION, ENCODER_CLICK, ENCODER_LONG_PRESS
+ * 1. Hardware events: ENCODER_INPUT (snapshot), expanded to ENCODER_ROTATION, ENCODER_CLICK, ...
  * 2. System events: BOOTING_COMPLETE, WIFI_CONNECTED, WIFI_DISCONNECTED
  * 3. Display events: DISPLAY_UPDATE, DISPLAY_CLEAR, DISPLAY_WAKE_UP
  * 4. UI events: DISPLAY_WIFI_CONNECTING, DISPLAY_WIFI_SETUP_URL
  * 
  * Memory Layout:
- * - Event: ~260 bytes total (4 + 4 + 252 bytes padding)
- * - Optimized for FreeRTOS queue efficiency
- * - String data uses fixed buffer to avoid heap fragmentation
- * - Safe for cross-task transmission without pointer issues
+ * - Event: 12 bytes (type, flags, payload handle, value, timestamp)
+ * - String/binary payloads: EventPayloadPool blocks (EVENT_PAYLOAD_BLOCK_SIZE)
+ * - Payloads are referenced by handle, never by pointer, so queue copies stay valid
  * 
  * Thread Safety:
- * - All Event operations are stack-based and thread-safe
- * - No shared mutable state or heap allocations
+ * - Events are value-copied; payload reference counts are updated under a spinlock
+ * - No heap allocations
  * - Safe for concurrent access from multiple FreeRTOS tasks
  * - Immutable after creation for predictable behavior
  */
 
 #pragma once
 #include <Arduino.h>
+#include "../config/DeviceConfig.h"
+#include "EventPayloadPool.h"
 
 namespace CloudMouse {
 
@@ -51,7 +52,7 @@ namespace CloudMouse {
  * - WiFi Display: UI feedback for WiFi connection states
  * - WiFi System: Network stack state changes and events
  */
-enum class EventType {
+enum class EventType : uint8_t {
     // ========================================================================
     // SYSTEM LIFECYCLE EVENTS
     // ========================================================================
@@ -90,7 +91,9 @@ enum class EventType {
 
     /**
      * Rotary encoder button is holding down
-     * value: Press duration in milliseconds
+     * value: Press duration in milliseconds (0 at the press edge)
+     * Sent with each input snapshot taken while the button is down, not
+     * repeated every UI cycle of a hold
      * Usage: Context menus, settings access, power functions
      */
     ENCODER_PRESS_TIME,
@@ -115,6 +118,15 @@ enum class EventType {
      * Usage: Context menus, item detail access, confirm action
      */
     ENCODER_DOUBLE_CLICK,
+
+    /**
+     * One UI cycle of encoder input, published instead of the individual events above
+     * binary payload: InputSnapshot (use getInputSnapshot())
+     * value: Rotation steps after acceleration (same as InputSnapshot::steps)
+     * Usage: High-rate scrolling with velocity; expandInputSnapshot() recreates
+     *        the legacy ENCODER_* events for existing handlers
+     */
+    ENCODER_INPUT,
     
     // ========================================================================
     // DISPLAY CONTROL EVENTS
@@ -138,6 +150,18 @@ enum class EventType {
      * Usage: Mode transitions, error recovery, screen cleaning
      */
     DISPLAY_CLEAR,
+
+    /**
+     * Display should open the render benchmark screen
+     * Usage: Compare draw buffer placement, stripe height and render mode on device
+     */
+    DISPLAY_BENCHMARK,
+
+    /**
+     * Display should print its frame profiler report over serial
+     * Usage: Per-frame render/flush breakdown, invalidation and event drain cost
+     */
+    DISPLAY_PROFILER_REPORT,
     
     // ========================================================================
     // WIFI UI FEEDBACK EVENTS
@@ -223,31 +247,174 @@ enum class EventType {
      * Usage: Start web server, enable configuration, LED indicators
      */
     WIFI_AP_MODE,
+
+    // ========================================================================
+    // TIME EVENTS
+    // ========================================================================
+
+    /**
+     * System clock synchronized by SNTP (first sync and periodic resyncs)
+     * value: Unix time in seconds
+     * Usage: Refresh clock labels, schedule time-based work, timestamp data
+     */
+    TIME_SYNCED,
+
+    COUNT   // Number of event types (not an event)
+};
+
+// ============================================================================
+// EVENT MASKS - Subscription filters for EventBus::subscribe()
+// ============================================================================
+
+typedef uint32_t EventMask;
+
+static_assert((int)EventType::COUNT <= 32, "EventMask has one bit per EventType");
+
+/**
+ * Mask bit of a single event type
+ * Combine with |, e.g. eventBit(EventType::ENCODER_CLICK) | eventBit(EventType::ENCODER_LONG_PRESS)
+ */
+inline EventMask eventBit(EventType type) {
+    return (EventMask)1 << (uint8_t)type;
+}
+
+static const EventMask EVENT_MASK_NONE = 0;
+static const EventMask EVENT_MASK_ALL = 0xFFFFFFFFu;
+
+static const EventMask EVENT_MASK_ENCODER =
+    (1u << (uint8_t)EventType::ENCODER_ROTATION) |
+    (1u << (uint8_t)EventType::ENCODER_CLICK) |
+    (1u << (uint8_t)EventType::ENCODER_LONG_PRESS) |
+    (1u << (uint8_t)EventType::ENCODER_PRESS_TIME) |
+    (1u << (uint8_t)EventType::ENCODER_BUTTON_RELEASED) |
+    (1u << (uint8_t)EventType::ENCODER_PRESS_AND_ROTATE) |
+    (1u << (uint8_t)EventType::ENCODER_DOUBLE_CLICK) |
+    (1u << (uint8_t)EventType::ENCODER_INPUT);
+
+// Contiguous ranges in the enumeration (DISPLAY_WAKE_UP ... DISPLAY_WIFI_SETUP_URL, WIFI_CONNECTING ... WIFI_AP_MODE)
+static const EventMask EVENT_MASK_DISPLAY =
+    ((1u << ((uint8_t)EventType::DISPLAY_WIFI_SETUP_URL + 1)) - 1) & ~((1u << (uint8_t)EventType::DISPLAY_WAKE_UP) - 1);
+
+static const EventMask EVENT_MASK_WIFI =
+    ((1u << ((uint8_t)EventType::WIFI_AP_MODE + 1)) - 1) & ~((1u << (uint8_t)EventType::WIFI_CONNECTING) - 1);
+
+/**
+ * Coalescing rules for queued events (EventQueue)
+ * - ACCUMULATE: deltas, summed into the pending entry of the same type
+ * - LATEST: state snapshots, the newest value replaces the pending one
+ * - FOLD: input snapshots (payload), combined with foldInputSnapshot()
+ */
+static const EventMask EVENT_MASK_ACCUMULATE =
+    (1u << (uint8_t)EventType::ENCODER_ROTATION) |
+    (1u << (uint8_t)EventType::ENCODER_PRESS_AND_ROTATE);
+
+static const EventMask EVENT_MASK_LATEST =
+    (1u << (uint8_t)EventType::ENCODER_PRESS_TIME) |
+    (1u << (uint8_t)EventType::DISPLAY_WAKE_UP) |
+    (1u << (uint8_t)EventType::DISPLAY_UPDATE);
+
+static const EventMask EVENT_MASK_FOLD =
+    (1u << (uint8_t)EventType::ENCODER_INPUT);
+
+/**
+ * EventBus priority lanes (EventChannel)
+ * Consumers always drain INTERACTIVE first, then NORMAL, then BACKGROUND, so
+ * knob input never waits behind network or app traffic.
+ *
+ * Order is only kept inside a lane: every DISPLAY_* command (screen changes,
+ * wake-up, clear) stays in NORMAL so e.g. DISPLAY_WIFI_CONNECTING followed by
+ * DISPLAY_WAKE_UP after a fast connect is shown in that order. Input wakes the
+ * display by itself, so DISPLAY_WAKE_UP gains nothing from the interactive lane.
+ */
+enum class EventLane : uint8_t {
+    INTERACTIVE,    // Encoder input
+    NORMAL,         // Everything not listed in the masks below (all DISPLAY_* commands)
+    BACKGROUND,     // WiFi state
+    COUNT
+};
+
+static const EventMask EVENT_MASK_LANE_INTERACTIVE =
+    EVENT_MASK_ENCODER;
+
+static const EventMask EVENT_MASK_LANE_BACKGROUND =
+    EVENT_MASK_WIFI;
+
+static_assert((EVENT_MASK_DISPLAY & (EVENT_MASK_LANE_INTERACTIVE | EVENT_MASK_LANE_BACKGROUND)) == 0,
+              "DISPLAY_* commands must share one lane to keep their order");
+
+inline EventLane eventLane(EventType type) {
+    EventMask bit = eventBit(type);
+    if (EVENT_MASK_LANE_INTERACTIVE & bit) {
+        return EventLane::INTERACTIVE;
+    }
+    if (EVENT_MASK_LANE_BACKGROUND & bit) {
+        return EventLane::BACKGROUND;
+    }
+    return EventLane::NORMAL;
+}
+
+/**
+ * Event flags
+ */
+static const uint8_t EVENT_FLAG_BINARY = 0x01;      // Payload is raw bytes, not a string
+static const uint8_t EVENT_FLAG_TRUNCATED = 0x02;   // Payload was cut to EVENT_PAYLOAD_BLOCK_SIZE
+static const uint8_t EVENT_FLAG_PAYLOAD_LOST = 0x04; // Payload pool was full, payload dropped
+static const uint8_t EVENT_FLAG_MERGED = 0x08;      // Several queued events were coalesced into this one
+
+/**
+ * Encoder input of one UI cycle (ENCODER_INPUT payload)
+ *
+ * Carries everything EncoderManager reports per cycle, so input costs one
+ * EventBus message instead of one per gesture.
+ */
+static const uint8_t INPUT_FLAG_CLICK = 0x01;
+static const uint8_t INPUT_FLAG_LONG_PRESS = 0x02;
+static const uint8_t INPUT_FLAG_ULTRA_LONG_PRESS = 0x04;
+static const uint8_t INPUT_FLAG_DOUBLE_CLICK = 0x08;
+static const uint8_t INPUT_FLAG_PRESS_AND_ROTATE = 0x10; // Gesture started in this cycle
+static const uint8_t INPUT_FLAG_BUTTON_DOWN = 0x20;
+static const uint8_t INPUT_FLAG_BUTTON_RELEASED = 0x40; // lastPressDurationMs is valid
+
+struct InputSnapshot {
+    uint32_t timestampUs;          // esp_timer time the snapshot was taken
+    uint32_t pressTimeMs;          // Current hold duration, 0 if the button is up
+    uint32_t lastPressDurationMs;  // Duration of the press released in this cycle
+    uint32_t inputUs;              // esp_timer time of the oldest interrupt folded in, 0 if timer-driven
+    int16_t rotation;              // Detents turned with the button up
+    int16_t steps;                 // rotation after the acceleration curve
+    int16_t pressRotation;         // Detents turned with the button held
+    int16_t velocity;              // Detents per second (signed, recent window)
+    uint16_t traceId;              // LatencyTracer id, 0 when not traced (INPUT_LATENCY_TRACE)
+    uint8_t flags;                 // INPUT_FLAG_*
 };
 
 /**
  * Event Data Structure
  * 
- * Unified data container for all event types with optimized memory layout.
- * Designed for efficient FreeRTOS queue transmission and minimal memory usage.
+ * Compact container for all event types, copied by value through FreeRTOS queues.
+ * String and binary payloads live in EventPayloadPool; the event only carries
+ * a handle to them.
  * 
- * Memory Layout:
- * - type: 4 bytes (EventType enumeration)
+ * Memory Layout (12 bytes):
+ * - type: 1 byte (EventType enumeration)
+ * - flags: 1 byte (EVENT_FLAG_*)
+ * - payload: 2 bytes (EventPayloadPool handle, 0 = none)
  * - value: 4 bytes (signed 32-bit integer for counters, timing, codes)
- * - stringData: 256 bytes (null-terminated string buffer)
- * - Total: 264 bytes (aligned for efficient queue operations)
+ * - timestamp: 4 bytes (micros() at creation)
  * 
  * Design Principles:
- * - Fixed size for predictable memory usage
- * - No pointers to avoid cross-task memory issues
- * - Embedded string buffer to prevent heap fragmentation
+ * - Fixed size for predictable queue memory
+ * - Payloads are reference counted: copying an event shares its payload,
+ *   the block is released when the last holder is destroyed
  * - Helper methods for common data patterns
  * - Safe defaults and automatic null termination
  */
 struct Event {
     EventType type;        // Event classification and routing information
+    uint8_t flags;         // EVENT_FLAG_* bits
+    uint16_t payload;      // EventPayloadPool handle (string or binary data)
     int32_t value;         // Numeric payload: counters, timing, error codes, measurements
-    char stringData[256];  // String payload: messages, identifiers, formatted data
+    uint32_t timestamp;    // Creation time in microseconds (latency tracing)
     
     // ========================================================================
     // CONSTRUCTORS - Safe initialization with proper defaults
@@ -257,9 +424,7 @@ struct Event {
      * Default constructor - creates safe empty event
      * Initializes with ENCODER_ROTATION type and zero values
      */
-    Event() : type(EventType::ENCODER_ROTATION), value(0) {
-        memset(stringData, 0, sizeof(stringData));
-    }
+    Event() : Event(EventType::ENCODER_ROTATION, 0) {}
     
     /**
      * Type-only constructor
@@ -267,9 +432,7 @@ struct Event {
      * 
      * @param t Event type from EventType enumeration
      */
-    Event(EventType t) : type(t), value(0) {
-        memset(stringData, 0, sizeof(stringData));
-    }
+    Event(EventType t) : Event(t, 0) {}
     
     /**
      * Type and value constructor
@@ -278,23 +441,67 @@ struct Event {
      * @param t Event type from EventType enumeration
      * @param v Numeric value (counter, timing, error code, etc.)
      */
-    Event(EventType t, int32_t v) : type(t), value(v) {
-        memset(stringData, 0, sizeof(stringData));
+    Event(EventType t, int32_t v)
+        : type(t), flags(0), payload(EventPayloadPool::INVALID_HANDLE), value(v), timestamp(micros()) {}
+    
+    /**
+     * Copies share the payload block (one more reference)
+     */
+    Event(const Event& other)
+        : type(other.type), flags(other.flags), payload(other.payload), value(other.value), timestamp(other.timestamp) {
+        EventPayloadPool::retain(payload);
+    }
+    
+    Event& operator=(const Event& other) {
+        if (this != &other) {
+            EventPayloadPool::retain(other.payload);
+            EventPayloadPool::release(payload);
+            type = other.type;
+            flags = other.flags;
+            payload = other.payload;
+            value = other.value;
+            timestamp = other.timestamp;
+        }
+        return *this;
+    }
+    
+    ~Event() {
+        EventPayloadPool::release(payload);
     }
     
     // ========================================================================
-    // STRING DATA MANAGEMENT - Safe string operations with bounds checking
+    // STRING DATA MANAGEMENT - Pooled payload with bounds checking
     // ========================================================================
     
     /**
      * Set string payload with automatic truncation and null termination
-     * Safely copies string data with bounds checking to prevent buffer overflow
+     * Copies the string into a payload block (replacing any previous payload)
      * 
-     * @param str String data to store (will be truncated if > 255 characters)
+     * @param str String data to store (truncated to EVENT_PAYLOAD_BLOCK_SIZE - 1 characters)
      */
+    void setStringData(const char* str) {
+        clearStringData();
+        bool truncated = false;
+        payload = EventPayloadPool::acquireText(str ? str : "", &truncated);
+        setPayloadFlags(truncated);
+    }
+    
     void setStringData(const String& str) {
-        strncpy(stringData, str.c_str(), sizeof(stringData) - 1);
-        stringData[sizeof(stringData) - 1] = '\0';  // Ensure null termination
+        setStringData(str.c_str());
+    }
+    
+    /**
+     * Set binary payload (replacing any previous payload)
+     * 
+     * @param data Bytes to store
+     * @param length Number of bytes (truncated to EVENT_PAYLOAD_BLOCK_SIZE)
+     */
+    void setBinaryData(const void* data, size_t length) {
+        clearStringData();
+        bool truncated = false;
+        payload = EventPayloadPool::acquire(data, length, &truncated);
+        setPayloadFlags(truncated);
+        flags |= EVENT_FLAG_BINARY;
     }
     
     /**
@@ -304,24 +511,44 @@ struct Event {
      * @return String object containing current string data
      */
     String getStringData() const { 
-        return String(stringData); 
+        return String(getStringPtr()); 
     }
     
+    /**
+     * Get string payload without copying
+     * Valid while this event (or a copy of it) is alive
+     * 
+     * @return Null-terminated string, "" if no string payload is set
+     */
+    const char* getStringPtr() const {
+        const uint8_t* data = EventPayloadPool::data(payload);
+        return (data && !(flags & EVENT_FLAG_BINARY)) ? (const char*)data : "";
+    }
+    
+    /**
+     * Raw payload access (string payloads include the terminator)
+     */
+    const uint8_t* getPayloadData() const { return EventPayloadPool::data(payload); }
+    size_t getPayloadLength() const { return EventPayloadPool::length(payload); }
+    bool hasBinaryData() const { return payload && (flags & EVENT_FLAG_BINARY); }
+    
     /**
      * Check if string data is present and non-empty
      * 
      * @return true if string data contains at least one character
      */
     bool hasStringData() const {
-        return stringData[0] != '\0';
+        return getStringPtr()[0] != '\0';
     }
     
     /**
      * Clear string data buffer
-     * Resets string buffer to empty state
+     * Releases the payload block
      */
     void clearStringData() {
-        memset(stringData, 0, sizeof(stringData));
+        EventPayloadPool::release(payload);
+        payload = EventPayloadPool::INVALID_HANDLE;
+        flags &= ~(EVENT_FLAG_BINARY | EVENT_FLAG_TRUNCATED | EVENT_FLAG_PAYLOAD_LOST);
     }
     
     // ========================================================================
@@ -333,13 +560,15 @@ struct Event {
      * Stores SSID, IP address, and connection timing in standardized format
      * Format: "SSID|IP_ADDRESS" with connection time in value field
      * 
-     * @param ssid Network SSID (max ~120 characters)
+     * @param ssid Network SSID (max 32 characters)
      * @param ip IP address string (typically "192.168.1.100" format)
      * @param connectionTime Connection duration in milliseconds (stored in value)
      */
     void setWiFiData(const char* ssid, const char* ip = "", int32_t connectionTime = 0) {
+        char buffer[EVENT_PAYLOAD_BLOCK_SIZE];
         value = connectionTime;
-        snprintf(stringData, sizeof(stringData), "%s|%s", ssid, ip);
+        snprintf(buffer, sizeof(buffer), "%s|%s", ssid, ip);
+        setStringData(buffer);
     }
     
     /**
@@ -349,7 +578,7 @@ struct Event {
      * @return SSID string, or complete string if no separator found
      */
     String getSSID() const {
-        String data(stringData);
+        String data(getStringPtr());
         int separatorIndex = data.indexOf('|');
         return separatorIndex >= 0 ? data.substring(0, separatorIndex) : data;
     }
@@ -361,11 +590,10 @@ struct Event {
      * @return IP address string, or empty string if no separator found
      */
     String getIP() const {
-        String data(stringData);
+        String data(getStringPtr());
         int separatorIndex = data.indexOf('|');
         return separatorIndex >= 0 ? data.substring(separatorIndex + 1) : "";
     }
-    
     /**
      * Get WiFi connection time from value field
      * Convenience accessor for connection timing data
@@ -419,6 +647,150 @@ struct Event {
     bool isLongPress(int32_t threshold = 1000) const {
         return value >= threshold;
     }
+    
+    /**
+     * Store an input snapshot as binary payload (ENCODER_INPUT)
+     * value is set to the accelerated steps so rotation survives a full payload pool
+     */
+    void setInputSnapshot(const InputSnapshot& snapshot) {
+        value = snapshot.steps;
+        setBinaryData(&snapshot, sizeof(snapshot));
+    }
+    
+    /**
+     * Read the input snapshot of an ENCODER_INPUT event
+     * 
+     * @return false if the event carries no (or a lost) snapshot payload
+     */
+    bool getInputSnapshot(InputSnapshot& snapshot) const {
+        if (!hasBinaryData() || getPayloadLength() < sizeof(snapshot)) {
+            return false;
+        }
+        memcpy(&snapshot, getPayloadData(), sizeof(snapshot));
+        return true;
+    }
+
+private:
+    void setPayloadFlags(bool truncated) {
+        if (truncated) {
+            flags |= EVENT_FLAG_TRUNCATED;
+        }
+        if (payload == EventPayloadPool::INVALID_HANDLE) {
+            flags |= EVENT_FLAG_PAYLOAD_LOST;
+        }
+    }
 };
 
-}  // namespace CloudMouse
\ No newline at end of file
+static_assert(sizeof(Event) == 12, "Event must stay compact for queue transmission");
+
+static_assert(sizeof(InputSnapshot) <= EVENT_PAYLOAD_BLOCK_SIZE, "InputSnapshot must fit one payload block");
+
+/**
+ * Read the snapshot of an ENCODER_INPUT event, or rebuild what survives
+ * without one (the accelerated steps kept in the event value)
+ */
+inline void readInputSnapshot(const Event& event, InputSnapshot& snapshot) {
+    if (!event.getInputSnapshot(snapshot)) {
+        memset(&snapshot, 0, sizeof(snapshot));
+        snapshot.steps = (int16_t)event.value;
+    }
+}
+
+/**
+ * Button edges and gestures of a snapshot (everything but the held state)
+ */
+static const uint8_t INPUT_FLAG_EDGES = INPUT_FLAG_CLICK | INPUT_FLAG_LONG_PRESS | INPUT_FLAG_ULTRA_LONG_PRESS |
+                                        INPUT_FLAG_DOUBLE_CLICK | INPUT_FLAG_PRESS_AND_ROTATE |
+                                        INPUT_FLAG_BUTTON_RELEASED;
+
+/**
+ * Whether folding next into into keeps every gesture and its order
+ * Only movement with the button held (or not) the same way in both folds:
+ * an edge or gesture on either side, or a button change, stays a separate
+ * entry, so two clicks remain two and rotation is not moved across a press.
+ */
+inline bool canFoldInputSnapshot(const InputSnapshot& into, const InputSnapshot& next) {
+    if ((into.flags | next.flags) & INPUT_FLAG_EDGES) {
+        return false;
+    }
+    return ((into.flags ^ next.flags) & INPUT_FLAG_BUTTON_DOWN) == 0;
+}
+
+/**
+ * Fold a newer snapshot into a pending one (EventQueue, EVENT_MASK_FOLD)
+ * Movement is summed, gesture flags are ORed, button state, press time and
+ * velocity come from the newer snapshot; input time and trace ID stay the
+ * oldest so latency is measured from the first input.
+ * Lossless only when canFoldInputSnapshot() holds; otherwise two equal
+ * gestures read as one (EventQueue only does that when full, instead of
+ * dropping the snapshot).
+ */
+inline void foldInputSnapshot(InputSnapshot& into, const InputSnapshot& next) {
+    auto sum16 = [](int32_t a, int32_t b) -> int16_t {
+        int32_t total = a + b;
+        return (int16_t)(total > INT16_MAX ? INT16_MAX : (total < INT16_MIN ? INT16_MIN : total));
+    };
+
+    into.rotation = sum16(into.rotation, next.rotation);
+    into.steps = sum16(into.steps, next.steps);
+    into.pressRotation = sum16(into.pressRotation, next.pressRotation);
+    into.velocity = next.velocity;
+    into.timestampUs = next.timestampUs;
+    into.pressTimeMs = next.pressTimeMs;
+    if (next.flags & INPUT_FLAG_BUTTON_RELEASED) {
+        into.lastPressDurationMs = next.lastPressDurationMs;
+    }
+    if (into.inputUs == 0) {
+        into.inputUs = next.inputUs;
+    }
+    if (into.traceId == 0) {
+        into.traceId = next.traceId;
+    }
+    into.flags = (uint8_t)(((into.flags | next.flags) & ~INPUT_FLAG_BUTTON_DOWN) | (next.flags & INPUT_FLAG_BUTTON_DOWN));
+}
+
+/**
+ * Legacy per-gesture events contained in an ENCODER_INPUT event
+ * Order matches the historical publish order of the UI task. Without a
+ * snapshot payload only the rotation (event value) can be recovered.
+ * 
+ * @param event ENCODER_INPUT event
+ * @param out Receives up to INPUT_SNAPSHOT_MAX_EVENTS events (timestamps copied from event)
+ * @return Number of events written
+ */
+static const int INPUT_SNAPSHOT_MAX_EVENTS = 7;
+
+inline int expandInputSnapshot(const Event& event, Event (&out)[INPUT_SNAPSHOT_MAX_EVENTS]) {
+    InputSnapshot snapshot;
+    readInputSnapshot(event, snapshot);
+    
+    int count = 0;
+    if (snapshot.steps != 0) {
+        out[count++] = Event(EventType::ENCODER_ROTATION, snapshot.steps);
+    }
+    if (snapshot.flags & INPUT_FLAG_CLICK) {
+        out[count++] = Event(EventType::ENCODER_CLICK);
+    }
+    if (snapshot.flags & INPUT_FLAG_LONG_PRESS) {
+        out[count++] = Event(EventType::ENCODER_LONG_PRESS);
+    }
+    if ((snapshot.flags & INPUT_FLAG_BUTTON_DOWN) || snapshot.pressTimeMs != 0) {
+        out[count++] = Event(EventType::ENCODER_PRESS_TIME, (int32_t)snapshot.pressTimeMs);
+    }
+    if (snapshot.flags & INPUT_FLAG_BUTTON_RELEASED) {
+        out[count++] = Event(EventType::ENCODER_BUTTON_RELEASED, (int32_t)snapshot.lastPressDurationMs);
+    }
+    if ((snapshot.flags & INPUT_FLAG_PRESS_AND_ROTATE) || snapshot.pressRotation != 0) {
+        out[count++] = Event(EventType::ENCODER_PRESS_AND_ROTATE, snapshot.pressRotation);
+    }
+    if (snapshot.flags & INPUT_FLAG_DOUBLE_CLICK) {
+        out[count++] = Event(EventType::ENCODER_DOUBLE_CLICK);
+    }
+    
+    for (int i = 0; i < count; i++) {
+        out[i].timestamp = event.timestamp;
+    }
+    return count;
+}
+
+}  // namespace CloudMouse
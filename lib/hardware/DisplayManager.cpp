@@ -1,5 +1,11 @@
 #include "./DisplayManager.h"
 #include "../core/EventBus.h"
+#include "./LvglAllocator.h"
+#include "../utils/Hash.h"
+#include "../utils/BootProfiler.h"
+#include "../utils/LatencyTracer.h"
+#include "../utils/MemoryBudget.h"
+#include <esp_heap_caps.h>
 
 namespace CloudMouse::Hardware
 {
@@ -9,8 +15,101 @@ namespace CloudMouse::Hardware
     // LVGL: static variables definition for double buffer
     // ============================================================================
 
-    lv_color_t *DisplayManager::buf1 = nullptr;
-    lv_color_t *DisplayManager::buf2 = nullptr;
+    uint8_t *DisplayManager::buf1 = nullptr;
+    uint8_t *DisplayManager::buf2 = nullptr;
+
+#if SDK_STATIC_ALLOCATION
+    // Draw buffers sized for the configured render mode (480x320 panel) and
+    // placed per DISPLAY_BUFFER_MEMORY: first buffer internal unless PSRAM,
+    // second internal only with DISPLAY_BUFFER_INTERNAL
+    static const size_t DISPLAY_RESERVED_BYTES =
+        (size_t)480 * (DISPLAY_RENDER_MODE == DISPLAY_RENDER_PARTIAL ? DISPLAY_BUFFER_LINES : 320) * (LV_COLOR_DEPTH / 8);
+    static const bool DISPLAY_RESERVED_INTERNAL[2] = {
+        DISPLAY_BUFFER_MEMORY != DISPLAY_BUFFER_PSRAM,
+        DISPLAY_BUFFER_MEMORY == DISPLAY_BUFFER_INTERNAL};
+
+#if DISPLAY_BUFFER_MEMORY != DISPLAY_BUFFER_PSRAM
+    DMA_ATTR static uint8_t displayReserved1[DISPLAY_RESERVED_BYTES];
+#elif SDK_STATIC_PSRAM
+    SDK_PSRAM_BSS static uint8_t displayReserved1[DISPLAY_RESERVED_BYTES] __attribute__((aligned(16)));
+#endif
+#if DISPLAY_BUFFER_MEMORY == DISPLAY_BUFFER_INTERNAL
+    DMA_ATTR static uint8_t displayReserved2[DISPLAY_RESERVED_BYTES];
+#elif SDK_STATIC_PSRAM
+    SDK_PSRAM_BSS static uint8_t displayReserved2[DISPLAY_RESERVED_BYTES] __attribute__((aligned(16)));
+#endif
+
+    // PSRAM buffers without .ext_ram.bss stay null until reserved at the first allocation
+    static uint8_t *displayReserved[2] = {
+#if DISPLAY_BUFFER_MEMORY != DISPLAY_BUFFER_PSRAM || SDK_STATIC_PSRAM
+        displayReserved1,
+#else
+        nullptr,
+#endif
+#if DISPLAY_BUFFER_MEMORY == DISPLAY_BUFFER_INTERNAL || SDK_STATIC_PSRAM
+        displayReserved2,
+#else
+        nullptr,
+#endif
+    };
+    static Utils::MemoryBudget::Source displayReservedSource[2] = {
+        Utils::MemoryBudget::Source::STATIC, Utils::MemoryBudget::Source::STATIC};
+#endif
+
+    // Hello screen status line (UiStateStore value of hello.status)
+    enum HelloStatus : int32_t
+    {
+        HELLO_READY,
+        HELLO_ROTATE_LEFT,
+        HELLO_ROTATE_RIGHT,
+        HELLO_CLICK,
+        HELLO_DOUBLE_CLICK,
+        HELLO_PRESS_ROTATE_LEFT,
+        HELLO_PRESS_ROTATE_RIGHT,
+        HELLO_LONG_PRESS,
+        HELLO_STATUS_COUNT
+    };
+
+    static const char *const HELLO_STATUS_TEXT[HELLO_STATUS_COUNT] = {
+        "Ready!",
+        "Encoder rotation: LEFT",
+        "Encoder rotation: RIGHT",
+        "Click!",
+        "Double Click!",
+        "Encoder press and rotate: LEFT",
+        "Encoder press and rotate: RIGHT",
+        "Long Press!"};
+
+    static void formatHelloStatus(char *buffer, size_t size, int32_t value, const void *)
+    {
+        strncpy(buffer, value >= 0 && value < HELLO_STATUS_COUNT ? HELLO_STATUS_TEXT[value] : "", size - 1);
+        buffer[size - 1] = '\0';
+    }
+
+    // Configurations cycled by the render benchmark screen
+    static const DisplayManager::RenderConfig BENCHMARK_CONFIGS[] = {
+        {16, DISPLAY_BUFFER_INTERNAL, DISPLAY_RENDER_PARTIAL},
+        {32, DISPLAY_BUFFER_INTERNAL, DISPLAY_RENDER_PARTIAL},
+        {64, DISPLAY_BUFFER_INTERNAL, DISPLAY_RENDER_PARTIAL},
+        {16, DISPLAY_BUFFER_PSRAM, DISPLAY_RENDER_PARTIAL},
+        {32, DISPLAY_BUFFER_PSRAM, DISPLAY_RENDER_PARTIAL},
+        {64, DISPLAY_BUFFER_PSRAM, DISPLAY_RENDER_PARTIAL},
+        {107, DISPLAY_BUFFER_PSRAM, DISPLAY_RENDER_PARTIAL},
+        {32, DISPLAY_BUFFER_MIXED, DISPLAY_RENDER_PARTIAL},
+        {64, DISPLAY_BUFFER_MIXED, DISPLAY_RENDER_PARTIAL},
+        {320, DISPLAY_BUFFER_PSRAM, DISPLAY_RENDER_DIRECT},
+        {320, DISPLAY_BUFFER_PSRAM, DISPLAY_RENDER_FULL},
+    };
+    static const int BENCHMARK_CONFIG_COUNT = sizeof(BENCHMARK_CONFIGS) / sizeof(BENCHMARK_CONFIGS[0]);
+
+    // Screen registry, indexed by Screen
+    const DisplayManager::ScreenDescriptor DisplayManager::SCREENS[] = {
+        {"hello world", &DisplayManager::createHelloWorldScreen, false},
+        {"wifi connecting", &DisplayManager::createWifiConnectingScreen, true},
+        {"ap mode", &DisplayManager::createApModeScreen, true},
+        {"ap connected", &DisplayManager::createApConnectedScreen, true},
+        {"benchmark", &DisplayManager::createBenchmarkScreen, true},
+    };
 
     // ============================================================================
     // CONSTRUCTOR AND DESTRUCTOR IMPLEMENTATION
@@ -20,23 +119,17 @@ namespace CloudMouse::Hardware
 
     DisplayManager::~DisplayManager()
     {
-        if (buf1)
-        {
-            free(buf1);
-            buf1 = nullptr;
-        }
-        if (buf2)
-        {
-            free(buf2);
-            buf2 = nullptr;
-        }
+        freeBuffers();
 
         if (indev)
             lv_indev_delete(indev);
         if (disp)
             lv_display_delete(disp);
 
-        lvgl_ticker.detach();
+        #if DISPLAY_DMA_FLUSH
+        display.waitDMA();
+        display.endWrite();
+        #endif
 
         lv_deinit();
     }
@@ -49,30 +142,26 @@ namespace CloudMouse::Hardware
     {
         SDK_LOGGER("🖥️ Initializing DisplayManager con LVGL v9...");
 
-        display.init();
-        display.setBrightness(200);
-
-        lv_init();
-        lvgl_ticker.attach_ms(4, lv_tick_task);
-
-        const size_t bufSize = 480 * 32;
-        buf1 = (lv_color_t *)ps_malloc(sizeof(lv_color_t) * bufSize);
-        buf2 = (lv_color_t *)ps_malloc(sizeof(lv_color_t) * bufSize);
-
-        if (!buf1 || !buf2)
-        {
-            SDK_LOGGER("❌ LVGL in PSRAM buffer failed!");
-            return;
-        }
-        SDK_LOGGER("✅ Buffer LVGL allocated in PSRAM (2x %d bytes)\n", sizeof(lv_color_t) * bufSize);
+        #if LV_COLOR_DEPTH == 24
+        // LVGL renders RGB888 straight into the panel's 3-byte format
+        display.setNativeRGB666(true);
+        #endif
 
-        // Flushing PSRAM buffers to prevent residual corrupted data on power disconnection
-        const size_t totalBufBytes = sizeof(lv_color_t) * bufSize;
+        Utils::BootProfiler::begin("lgfx.init");
+        display.init();
+        display.fadeBrightness(BRIGHTNESS_UP_TARGET, 0);
+        Utils::BootProfiler::end("lgfx.init");
+        lastInteractionTime = millis();
 
-        memset(buf1, 0, totalBufBytes);
-        memset(buf2, 0, totalBufBytes);
+        #if DISPLAY_DMA_FLUSH
+        // Keep the SPI transaction open: closing it after every stripe would
+        // block until the DMA transfer ends and defeat the async pipeline
+        display.startWrite();
+        #endif
 
-        SDK_LOGGER("✅ PSRAM Buffers flushed.");
+        Utils::BootProfiler::begin("lvgl.init");
+        lv_init();
+        lv_tick_set_cb(lv_tick_source);
 
         // LVGL display driver init (v9)
         disp = lv_display_create(getWidth(), getHeight());
@@ -82,9 +171,25 @@ namespace CloudMouse::Hardware
             return;
         }
         lv_display_set_flush_cb(disp, lvgl_flush_cb);
-        lv_display_set_buffers(disp, buf1, buf2, bufSize * sizeof(lv_color_t), LV_DISPLAY_RENDER_MODE_PARTIAL);
+        #if DISPLAY_DMA_FLUSH
+        lv_display_set_flush_wait_cb(disp, lvgl_flush_wait_cb);
+        #endif
         lv_display_set_user_data(disp, this);
-        lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_PARTIAL);
+        lv_display_add_event_cb(disp, lvgl_refr_event_cb, LV_EVENT_REFR_START, this);
+        lv_display_add_event_cb(disp, lvgl_refr_event_cb, LV_EVENT_REFR_READY, this);
+        lv_display_add_event_cb(disp, lvgl_refr_event_cb, LV_EVENT_INVALIDATE_AREA, this);
+
+        Utils::BootProfiler::end("lvgl.init");
+
+        // Draw buffers from DeviceConfig.h (placement, stripe height, render mode)
+        Utils::BootProfiler::begin("lvgl.buffers");
+        bool buffersReady = applyRenderConfig(renderConfig);
+        Utils::BootProfiler::end("lvgl.buffers");
+        if (!buffersReady)
+        {
+            SDK_LOGGER("❌ LVGL draw buffer allocation failed!");
+            return;
+        }
 
         // LVGL input (Encoder) driver init (v9)
         indev = lv_indev_create();
@@ -97,6 +202,9 @@ namespace CloudMouse::Hardware
         lv_indev_set_read_cb(indev, lvgl_encoder_read_cb);
         lv_indev_set_user_data(indev, this);
 
+        // Input arrives as EventBus events: read on demand instead of a 33ms polling timer
+        lv_indev_set_mode(indev, LV_INDEV_MODE_EVENT);
+
         // Create a group and assing it to the encoder
         encoder_group = lv_group_create();
         lv_group_set_default(encoder_group);
@@ -104,94 +212,306 @@ namespace CloudMouse::Hardware
 
         // Create LVGL UI
         SDK_LOGGER("🎨 Creating UI LVGL...");
+        Utils::BootProfiler::begin("ui.create");
         createUi();
+        Utils::BootProfiler::end("ui.create");
 
         #if SHOW_LVGL_PERFORMANCE_MONITOR
         createPerformanceLabel();
         #endif 
 
+        Utils::BootProfiler::begin("display.measure");
+        uint32_t fullRefreshUs = measureFullRefresh();
+        Utils::BootProfiler::end("display.measure");
+        SDK_LOGGER("⏱️ Full-screen refresh: %lu us (%s)", fullRefreshUs,
+                   LV_COLOR_DEPTH == 24 ? "native RGB666" : "RGB565 -> RGB666 conversion");
+
         initialized = true;
         SDK_LOGGER("✅ DisplayManager with LVGL v9 succesfully initialized!\n");
     }
 
-    void DisplayManager::update()
+    uint32_t DisplayManager::update()
     {
         Event event;
+        uint32_t drainStart = micros();
+        uint32_t drained = 0;
         while (EventBus::instance().receiveFromMain(event, 0))
         {
+#if INPUT_LATENCY_TRACE
+            uint16_t traceId = beginTrace(event);
+            processEvent(event);
+            Utils::LatencyTracer::handled(traceId);
+#else
             processEvent(event);
+#endif
+            drained++;
         }
-        lv_timer_handler();
-        handleDimmer();
+        profiler.onEventDrain(micros() - drainStart, drained);
+
+        // Labels follow their state once per update, however many events changed it
+        stateStore.flush();
 
         #if SHOW_LVGL_PERFORMANCE_MONITOR
         updatePerformanceLabel();
         #endif
+
+        // LVGL pauses its refresh and animation timers when nothing is invalidated,
+        // so an idle screen reports no deadline at all
+        uint32_t nextDeadline = LV_NO_TIMER_READY;
+        if (isRenderPaused())
+        {
+            // Dimmed: LVGL timers stay stopped, only screen changes get drawn
+            if (idleRefreshPending)
+            {
+                lv_refr_now(disp);
+                idleRefreshPending = false;
+            }
+        }
+        else
+        {
+            nextDeadline = lv_timer_handler();
+        }
+        handleDimmer();
+        updateBenchmark();
+
+        uint32_t dimmerDeadline = getDimmerDeadline();
+        if (dimmerDeadline < nextDeadline)
+            nextDeadline = dimmerDeadline;
+
+        #if SHOW_LVGL_PERFORMANCE_MONITOR
+        if (nextDeadline > 1000)
+            nextDeadline = 1000;
+        #endif
+
+        return nextDeadline;
     }
 
-    void DisplayManager::printPerformanceStats()
+    // ============================================================================
+    // LVGL DRAW BUFFER MANAGEMENT
+    // ============================================================================
+
+    uint8_t *DisplayManager::allocateBuffer(size_t bytes, bool internal, int slot)
     {
-        // Get memory info
-        lv_mem_monitor_t mon;
-        lv_mem_monitor(&mon);
+        #if SDK_STATIC_ALLOCATION
+        // The reserved buffer of this slot serves every config that fits it in the same memory
+        if (bytes <= DISPLAY_RESERVED_BYTES && internal == DISPLAY_RESERVED_INTERNAL[slot])
+        {
+            if (!displayReserved[slot])
+            {
+                displayReserved[slot] = (uint8_t *)heap_caps_malloc(DISPLAY_RESERVED_BYTES, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+                displayReservedSource[slot] = Utils::MemoryBudget::Source::BOOT;
+            }
+            if (displayReserved[slot])
+            {
+                Utils::MemoryBudget::add(slot == 0 ? "display.buffer1" : "display.buffer2", DISPLAY_RESERVED_BYTES,
+                                         internal ? Utils::MemoryBudget::Region::INTERNAL : Utils::MemoryBudget::Region::PSRAM,
+                                         displayReservedSource[slot]);
+                return displayReserved[slot];
+            }
+        }
+        #endif
 
-        // Calculate CPU usage from idle percentage
-        uint32_t cpu_usage = 100 - lv_timer_get_idle();
+        uint8_t *buffer = nullptr;
+        if (internal)
+        {
+            buffer = (uint8_t *)heap_caps_malloc(bytes, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+            if (!buffer)
+            {
+                SDK_LOGGER("⚠️ Not enough internal SRAM for a %d bytes draw buffer, using PSRAM", bytes);
+                internal = false;
+            }
+        }
+        if (!buffer)
+            buffer = (uint8_t *)heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+
+        if (buffer)
+            Utils::MemoryBudget::add(slot == 0 ? "display.buffer1" : "display.buffer2", bytes,
+                                     internal ? Utils::MemoryBudget::Region::INTERNAL : Utils::MemoryBudget::Region::PSRAM,
+                                     Utils::MemoryBudget::Source::HEAP);
+        return buffer;
+    }
 
-        // Calculate approximate FPS from last timer period
-        static uint32_t lastFrameTime = millis();
-        uint32_t now = millis();
-        uint32_t frameTime = now - lastFrameTime;
-        uint32_t fps = frameTime > 0 ? 1000 / frameTime : 0;
-        lastFrameTime = now;
+    bool DisplayManager::isReservedBuffer(const uint8_t *buffer)
+    {
+        #if SDK_STATIC_ALLOCATION
+        return buffer && (buffer == displayReserved[0] || buffer == displayReserved[1]);
+        #else
+        return false;
+        #endif
+    }
 
-        SDK_LOGGER("\n📊 LVGL Performance Stats:");
-        SDK_LOGGER("   FPS: ~%d (frame time: %dms)\n", fps, frameTime);
-        SDK_LOGGER("   CPU: %d%%\n", cpu_usage);
-        SDK_LOGGER("   Memory: %d%% used (%d/%d bytes)\n",
-                      mon.used_pct, mon.total_size - mon.free_size, mon.total_size);
-        SDK_LOGGER("   Fragmentation: %d%%\n\n", mon.frag_pct);
+    void DisplayManager::freeBuffers()
+    {
+        if (buf1)
+        {
+            if (!isReservedBuffer(buf1))
+                heap_caps_free(buf1);
+            buf1 = nullptr;
+        }
+        if (buf2)
+        {
+            if (!isReservedBuffer(buf2))
+                heap_caps_free(buf2);
+            buf2 = nullptr;
+        }
     }
 
-    void DisplayManager::handleDimmer()
+    bool DisplayManager::applyRenderConfig(const RenderConfig &config)
     {
-        const unsigned long IDLE_TIMEOUT_MS = 10000; // 10 secondi di inattività
+        // DIRECT and FULL modes always need two screen-sized buffers
+        const bool fullFrame = config.mode != DISPLAY_RENDER_PARTIAL;
+        const uint16_t lines = fullFrame ? getHeight() : config.lines;
+        const size_t bufBytes = (size_t)getWidth() * lines * (LV_COLOR_DEPTH / 8);
+
+        // Make sure no transfer is still reading from the buffers being replaced
+        #if DISPLAY_DMA_FLUSH
+        display.waitDMA();
+        #endif
+        freeBuffers();
+
+        buf1 = allocateBuffer(bufBytes, config.memory != DISPLAY_BUFFER_PSRAM, 0);
+        buf2 = allocateBuffer(bufBytes, config.memory == DISPLAY_BUFFER_INTERNAL, 1);
 
-        // Verify IDLE mode
-        if (millis() - lastInteractionTime > IDLE_TIMEOUT_MS)
+        if (!buf1 || !buf2)
         {
+            SDK_LOGGER("❌ LVGL draw buffers allocation failed (2x %d bytes)", bufBytes);
+            freeBuffers();
+            return false;
+        }
 
-            // check for next step delay
-            if (millis() - lastFadeTime > FADE_OUT_STEP_DELAY_MS)
-            {
+        // Flushing buffers to prevent residual corrupted data on power disconnection
+        memset(buf1, 0, bufBytes);
+        memset(buf2, 0, bufBytes);
 
-                // check if target is reached out
-                if (currentBrightness > BRIGHTNESS_IDLE_TARGET)
-                {
+        lv_display_render_mode_t lvMode = LV_DISPLAY_RENDER_MODE_PARTIAL;
+        if (config.mode == DISPLAY_RENDER_DIRECT)
+            lvMode = LV_DISPLAY_RENDER_MODE_DIRECT;
+        else if (config.mode == DISPLAY_RENDER_FULL)
+            lvMode = LV_DISPLAY_RENDER_MODE_FULL;
 
-                    // calculate new brightness using fade out step
-                    currentBrightness = currentBrightness - FADE_OUT_STEP_VALUE;
+        lv_display_set_buffers(disp, buf1, buf2, bufBytes, lvMode);
 
-                    if (currentBrightness < BRIGHTNESS_IDLE_TARGET)
-                    {
-                        currentBrightness = BRIGHTNESS_IDLE_TARGET;
-                    }
+        renderConfig = config;
+        renderConfig.lines = lines;
 
-                    // set new brightness
-                    display.setBrightness(currentBrightness);
+        SDK_LOGGER("✅ LVGL draw buffers: 2x %d bytes, %s, %d lines, %s",
+                   bufBytes, modeName(config.mode), lines, memoryName(config.memory));
 
-                    // and update fading timer
-                    lastFadeTime = millis();
-                }
-            }
+        lv_obj_invalidate(lv_screen_active());
+        return true;
+    }
+
+    void DisplayManager::printProfilerReport()
+    {
+        profiler.print();
+
+        lv_mem_monitor_t mon;
+        lv_mem_monitor(&mon);
+
+        SDK_LOGGER("   CPU: %d%%", 100 - lv_timer_get_idle());
+        SDK_LOGGER("   Screens cached: %d/%d", builtScreenCount(), SCREEN_CACHE_MAX);
+        stateStore.printStats();
+
+        #if LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM
+        LvglAllocator::printStats();
+        #endif
+        SDK_LOGGER("   LVGL memory: %d%% used (%d/%d bytes), fragmentation %d%%\n",
+                   mon.used_pct, mon.total_size - mon.free_size, mon.total_size, mon.frag_pct);
+    }
+
+    uint32_t DisplayManager::measureFullRefresh()
+    {
+        // Invalidate the whole active screen and render it synchronously,
+        // including the wait for the last stripe to leave the SPI bus
+        uint32_t start = micros();
+        lv_obj_invalidate(lv_screen_active());
+        lv_refr_now(disp);
+        return micros() - start;
+    }
+
+    uint32_t DisplayManager::measureAreaRefresh(int x, int y, int width, int height)
+    {
+        lv_area_t area;
+        area.x1 = x;
+        area.y1 = y;
+        area.x2 = x + width - 1;
+        area.y2 = y + height - 1;
+
+        uint32_t start = micros();
+        lv_obj_invalidate_area(lv_screen_active(), &area);
+        lv_refr_now(disp);
+        return micros() - start;
+    }
+
+    void DisplayManager::handleDimmer()
+    {
+        if (!dimmed)
+        {
+            if (millis() - lastInteractionTime <= DISPLAY_IDLE_TIMEOUT_MS)
+                return;
+
+            // Hand the fade out to the LEDC hardware: nothing to step in software
+            dimmed = true;
+            currentBrightness = BRIGHTNESS_IDLE_TARGET;
+            display.fadeBrightness(BRIGHTNESS_IDLE_TARGET, FADE_OUT_DURATION_MS);
+            return;
         }
+
+        if (!renderSuspended && !display.isFading())
+            enterIdleRender();
+    }
+
+    uint32_t DisplayManager::getDimmerDeadline() const
+    {
+        if (!dimmed)
+        {
+            unsigned long idleTime = millis() - lastInteractionTime;
+            return idleTime <= DISPLAY_IDLE_TIMEOUT_MS ? DISPLAY_IDLE_TIMEOUT_MS - idleTime + 1 : 0;
+        }
+
+        if (!renderSuspended)
+            return display.fadeRemainingMs();
+
+        return LV_NO_TIMER_READY;
     }
 
     void DisplayManager::wakeUp()
     {
         lastInteractionTime = millis();
+        if (!dimmed)
+            return;
+
+        dimmed = false;
+        exitIdleRender();
         currentBrightness = BRIGHTNESS_UP_TARGET;
-        display.setBrightness(BRIGHTNESS_UP_TARGET);
+        display.fadeBrightness(BRIGHTNESS_UP_TARGET, FADE_IN_DURATION_MS);
+    }
+
+    void DisplayManager::enterIdleRender()
+    {
+        renderSuspended = true;
+        idleRefreshPending = false;
+
+        #if DISPLAY_IDLE_RENDER == DISPLAY_IDLE_RENDER_STRETCH
+        lv_timer_set_period(lv_display_get_refr_timer(disp), DISPLAY_IDLE_REFR_PERIOD_MS);
+        lv_timer_set_period(lv_anim_get_timer(), DISPLAY_IDLE_REFR_PERIOD_MS);
+        SDK_LOGGER("💤 Display dimmed - LVGL refresh stretched to %d ms", DISPLAY_IDLE_REFR_PERIOD_MS);
+        #elif DISPLAY_IDLE_RENDER == DISPLAY_IDLE_RENDER_PAUSE
+        SDK_LOGGER("💤 Display dimmed - LVGL rendering paused");
+        #endif
+    }
+
+    void DisplayManager::exitIdleRender()
+    {
+        if (!renderSuspended)
+            return;
+        renderSuspended = false;
+        idleRefreshPending = false;
+
+        #if DISPLAY_IDLE_RENDER == DISPLAY_IDLE_RENDER_STRETCH
+        lv_timer_set_period(lv_display_get_refr_timer(disp), LV_DEF_REFR_PERIOD);
+        lv_timer_set_period(lv_anim_get_timer(), LV_DEF_REFR_PERIOD);
+        #endif
     }
 
     // ============================================================================
@@ -204,13 +524,127 @@ namespace CloudMouse::Hardware
         if (!self)
             return;
 
+        uint32_t start = micros();
         uint32_t w = lv_area_get_width(area);
         uint32_t h = lv_area_get_height(area);
 
-        self->display.pushImage(area->x1, area->y1, w, h, (uint16_t *)px_map);
+        // DIRECT and FULL modes hand over the whole frame buffer: area is a window into it
+        const bool fullFrame = self->renderConfig.mode != DISPLAY_RENDER_PARTIAL;
+
+        #if LV_COLOR_DEPTH == 24
+        // Native path: bytes go to the panel as rendered, no per-pixel expansion
+        const uint8_t *src = px_map;
+        int32_t stride = 0;
+        if (fullFrame)
+        {
+            stride = self->getWidth();
+            src += (area->y1 * stride + area->x1) * 3;
+        }
+
+        #if DISPLAY_DMA_FLUSH
+        self->display.writeNativeRGB666(area->x1, area->y1, w, h, src, true, stride);
+        #else
+        self->display.startWrite();
+        self->display.writeNativeRGB666(area->x1, area->y1, w, h, src, false, stride);
+        self->display.endWrite();
+        #endif
+        #else
+        // Full-frame buffers are pushed whole and clipped to the dirty area,
+        // letting LovyanGFX handle the source stride
+        int32_t x = area->x1;
+        int32_t y = area->y1;
+        int32_t pushW = w;
+        int32_t pushH = h;
+        if (fullFrame)
+        {
+            self->display.setClipRect(area->x1, area->y1, w, h);
+            x = 0;
+            y = 0;
+            pushW = self->getWidth();
+            pushH = self->getHeight();
+        }
+
+        #if DISPLAY_DMA_FLUSH
+        // Start the transfer and return: LVGL keeps rendering into the other
+        // buffer and calls lvgl_flush_wait_cb() before touching this one again
+        self->display.pushImageDMA(x, y, pushW, pushH, (uint16_t *)px_map);
+        #else
+        self->display.pushImage(x, y, pushW, pushH, (uint16_t *)px_map);
+        #endif
+
+        if (fullFrame)
+            self->display.clearClipRect();
+        #endif
+
+        self->framePixels += w * h;
+        self->frameFlushUs += micros() - start;
 
+        #if !DISPLAY_DMA_FLUSH
         lv_display_flush_ready(disp);
+        #endif
+    }
+
+    void DisplayManager::lvgl_flush_wait_cb(lv_display_t *disp)
+    {
+        DisplayManager *self = (DisplayManager *)lv_display_get_user_data(disp);
+        if (!self)
+            return;
+
+        // Block only until the pending DMA transfer is complete, then release the buffer
+        uint32_t start = micros();
+        self->display.waitDMA();
+        self->frameFlushUs += micros() - start;
+
+        lv_display_flush_ready(disp);
+    }
+
+    void DisplayManager::lvgl_refr_event_cb(lv_event_t *e)
+    {
+        DisplayManager *self = (DisplayManager *)lv_event_get_user_data(e);
+        if (!self)
+            return;
+
+        lv_event_code_t code = lv_event_get_code(e);
+        if (code == LV_EVENT_INVALIDATE_AREA)
+        {
+            self->profiler.onInvalidate((const lv_area_t *)lv_event_get_param(e));
+            return;
+        }
+
+        if (code == LV_EVENT_REFR_START)
+        {
+            self->frameStartUs = micros();
+            self->frameFlushUs = 0;
+            self->framePixels = 0;
+#if INPUT_LATENCY_TRACE
+            Utils::LatencyTracer::frameStarted();
+#endif
+            return;
+        }
+
+        // Refresh cycles with nothing invalidated are not frames
+        if (self->framePixels == 0)
+            return;
+
+#if INPUT_LATENCY_TRACE
+        Utils::LatencyTracer::frameFlushed();
+#endif
+
+        self->onFrameRendered(micros() - self->frameStartUs, self->frameFlushUs, self->framePixels);
+    }
+
+#if INPUT_LATENCY_TRACE
+    uint16_t DisplayManager::beginTrace(const Event &event)
+    {
+        InputSnapshot snapshot;
+        if (event.type != EventType::ENCODER_INPUT || !event.getInputSnapshot(snapshot) || snapshot.traceId == 0)
+            return 0;
+
+        Utils::LatencyTracer::received(snapshot.traceId, snapshot.inputUs ? snapshot.inputUs : snapshot.timestampUs,
+                                       event.timestamp);
+        return snapshot.traceId;
     }
+#endif
 
     void DisplayManager::lvgl_encoder_read_cb(lv_indev_t *indev, lv_indev_data_t *data)
     {
@@ -228,6 +662,17 @@ namespace CloudMouse::Hardware
         }
     }
 
+    void DisplayManager::feedEncoderInput()
+    {
+        if (!indev)
+            return;
+
+        // Event-mode indev: the first read reports the press, the second the
+        // release that lvgl_encoder_read_cb() queues right after it
+        lv_indev_read(indev);
+        lv_indev_read(indev);
+    }
+
     // ============================================================================
     // EVENT PROCESSING IMPLEMENTATION
     // ============================================================================
@@ -247,18 +692,30 @@ namespace CloudMouse::Hardware
         {
         case EventType::DISPLAY_WAKE_UP:
             wakeUp();
+            exitBenchmark();
             // Display activation - show default interactive screen
             SDK_LOGGER("📺 Display wake up - switching to HELLO_WORLD");
-            currentScreen = Screen::HELLO_WORLD;
-            lv_disp_load_scr(screen_hello_world);
+            showScreen(Screen::HELLO_WORLD);
             break;
 
         case EventType::DISPLAY_WIFI_CONNECTING:
             // WiFi connection attempt - show animated progress screen
             SDK_LOGGER("📡 Display: Showing WiFi connecting screen with animation");
-            currentScreen = Screen::WIFI_CONNECTING;
-            lv_disp_load_scr(screen_wifi_connecting);
+            exitBenchmark();
+            showScreen(Screen::WIFI_CONNECTING);
+            break;
+
+        case EventType::ENCODER_INPUT:
+        {
+            // One snapshot per UI cycle: replay it as the individual gestures
+            Event expanded[INPUT_SNAPSHOT_MAX_EVENTS];
+            int count = expandInputSnapshot(event, expanded);
+            for (int i = 0; i < count; i++)
+            {
+                processEvent(expanded[i]);
+            }
             break;
+        }
 
         case EventType::ENCODER_PRESS_TIME:
             wakeUp();
@@ -267,9 +724,14 @@ namespace CloudMouse::Hardware
         case EventType::ENCODER_ROTATION:
         {
             wakeUp();
+            if (currentScreen == Screen::BENCHMARK && bench.config)
+            {
+                selectBenchmarkConfig(benchIndex + (event.value > 0 ? 1 : -1));
+                break;
+            }
             if (currentScreen == Screen::HELLO_WORLD && millis() - lastPushAndRotateTime >= 500)
             {
-                lv_label_set_text_fmt(label_hello_status, "Encoder rotation: %s", event.value > 0 ? "RIGHT" : "LEFT");
+                stateStore.set(hello.status, event.value > 0 ? HELLO_ROTATE_RIGHT : HELLO_ROTATE_LEFT);
             }
             break;
         }
@@ -277,11 +739,17 @@ namespace CloudMouse::Hardware
         case EventType::ENCODER_CLICK:
             wakeUp();
             encoder_state = LV_INDEV_STATE_PRESSED;
+            feedEncoderInput();
             // Button click - record interaction and update display if on interactive screen
             SDK_LOGGER("🖱️ Display received encoder click");
-            if (currentScreen == Screen::HELLO_WORLD)
+            if (currentScreen == Screen::BENCHMARK)
             {
-                lv_label_set_text(label_hello_status, "Click!");
+                exitBenchmark();
+                showScreen(Screen::HELLO_WORLD);
+            }
+            else if (currentScreen == Screen::HELLO_WORLD)
+            {
+                stateStore.set(hello.status, HELLO_CLICK);
             }
             break;
 
@@ -291,7 +759,7 @@ namespace CloudMouse::Hardware
             SDK_LOGGER("🖱️🖱️ Display received encoder double click");
             if (currentScreen == Screen::HELLO_WORLD)
             {
-                lv_label_set_text(label_hello_status, "Double Click!"); // Update to show long press feedback
+                stateStore.set(hello.status, HELLO_DOUBLE_CLICK);
             }
             break;
 
@@ -302,17 +770,18 @@ namespace CloudMouse::Hardware
             lastPushAndRotateTime = millis();
             if (currentScreen == Screen::HELLO_WORLD)
             {
-                lv_label_set_text_fmt(label_hello_status, "Encoder press and rotate: %s", event.value > 0 ? "RIGHT" : "LEFT");
+                stateStore.set(hello.status, event.value > 0 ? HELLO_PRESS_ROTATE_RIGHT : HELLO_PRESS_ROTATE_LEFT);
             }
             break;
 
         case EventType::ENCODER_LONG_PRESS:
             wakeUp();
             encoder_state = LV_INDEV_STATE_PRESSED;
+            feedEncoderInput();
             // Long press - record interaction and update display if on interactive screen
             if (currentScreen == Screen::HELLO_WORLD)
             {
-                lv_label_set_text(label_hello_status, "Long Press!");
+                stateStore.set(hello.status, HELLO_LONG_PRESS);
             }
             break;
 
@@ -320,32 +789,50 @@ namespace CloudMouse::Hardware
             wakeUp();
             // Access Point mode - show WiFi connection QR code
             SDK_LOGGER("📱 Switching to AP Mode screen - WiFi setup required");
-            currentScreen = Screen::WIFI_AP_MODE;
+            exitBenchmark();
+            if (showScreen(Screen::WIFI_AP_MODE))
             {
                 String apSSID = GET_AP_SSID();
                 String apPassword = GET_AP_PASSWORD();
                 String qrData = String("WIFI:T:WPA;S:") + apSSID + ";P:" + apPassword + ";;";
 
-                lv_label_set_text(label_ap_mode_ssid, apSSID.c_str());
-                lv_label_set_text(label_ap_mode_pass, apPassword.c_str());
-                lv_qrcode_set_data(qr_ap_mode, qrData.c_str());
+                lv_label_set_text(apMode.ssid, apSSID.c_str());
+                lv_label_set_text(apMode.pass, apPassword.c_str());
+                setQrData(apMode.qr, apMode.qrHash, qrData.c_str());
             }
-            lv_disp_load_scr(screen_ap_mode);
             break;
 
         case EventType::DISPLAY_WIFI_SETUP_URL:
             wakeUp();
             // Client connected to AP - show web configuration QR code
             SDK_LOGGER("🌐 Switching to AP Connected screen - web setup available");
-            currentScreen = Screen::WIFI_AP_CONNECTED;
-
-            lv_qrcode_set_data(qr_ap_connected, WIFI_CONFIG_SERVICE);
-            lv_label_set_text(label_ap_connected_url, WIFI_CONFIG_SERVICE);
-            lv_disp_load_scr(screen_ap_connected);
+            exitBenchmark();
+            if (showScreen(Screen::WIFI_AP_CONNECTED))
+            {
+                setQrData(apConnected.qr, apConnected.qrHash, WIFI_CONFIG_SERVICE);
+                lv_label_set_text(apConnected.url, WIFI_CONFIG_SERVICE);
+            }
             break;
 
         case EventType::DISPLAY_CLEAR:
+            exitBenchmark();
             lv_obj_clean(lv_screen_active());
+            // Cached widgets of the active screen are gone: rebuild it on next show
+            if (screenSlots[(int)currentScreen].root == lv_screen_active())
+            {
+                resetScreenState(currentScreen);
+                screenSlots[(int)currentScreen].stale = true;
+            }
+            break;
+
+        case EventType::DISPLAY_BENCHMARK:
+            wakeUp();
+            SDK_LOGGER("⏱️ Switching to render benchmark screen");
+            enterBenchmark();
+            break;
+
+        case EventType::DISPLAY_PROFILER_REPORT:
+            printProfilerReport();
             break;
 
         default:
@@ -379,118 +866,140 @@ namespace CloudMouse::Hardware
     {
         lv_obj_set_style_bg_color(lv_screen_active(), lv_color_hex(COLOR_BG), 0);
 
-        createHelloWorldScreen();
-        createWifiConnectingScreen();
-        createApModeScreen();
-        createApConnectedScreen();
+        // Screens are built on first show (see showScreen), nothing else to do at boot
+        SDK_LOGGER("🎨 %d screens registered, cache limit %d", (int)Screen::COUNT, SCREEN_CACHE_MAX);
     }
 
-    void DisplayManager::createHelloWorldScreen()
+    void DisplayManager::createHelloWorldScreen(lv_obj_t *root)
     {
-        screen_hello_world = lv_obj_create(NULL);
-        lv_obj_set_style_bg_color(screen_hello_world, lv_color_hex(COLOR_BG), 0);
-        createHeader(screen_hello_world, "CloudMouse SDK");
+        lv_obj_set_style_bg_color(root, lv_color_hex(COLOR_BG), 0);
+        createHeader(root, "CloudMouse SDK");
 
-        lv_obj_t *title = lv_label_create(screen_hello_world);
+        lv_obj_t *title = lv_label_create(root);
         lv_label_set_text(title, "Hello CloudMouse!");
         lv_obj_set_style_text_color(title, lv_color_hex(COLOR_ACCENT), 0);
-        lv_obj_set_style_text_font(title, &lv_font_montserrat_28, 0);
+        lv_obj_set_style_text_font(title, CM_FONT_28, 0);
         lv_obj_align(title, LV_ALIGN_CENTER, 0, -40);
 
-        label_hello_status = lv_label_create(screen_hello_world);
-        lv_label_set_text(label_hello_status, "Ready!");
-        lv_obj_set_style_text_color(label_hello_status, lv_color_hex(COLOR_TEXT), 0);
-        lv_obj_set_style_text_font(label_hello_status, &lv_font_montserrat_20, 0);
-        lv_obj_align(label_hello_status, LV_ALIGN_CENTER, 0, 20);
+        lv_obj_t *status = lv_label_create(root);
+        lv_obj_set_style_text_color(status, lv_color_hex(COLOR_TEXT), 0);
+        lv_obj_set_style_text_font(status, CM_FONT_20, 0);
+        lv_obj_align(status, LV_ALIGN_CENTER, 0, 20);
+        hello.status = stateStore.bind(status, formatHelloStatus, nullptr, HELLO_READY);
 
-        lv_obj_t *instructions = lv_label_create(screen_hello_world);
+        lv_obj_t *instructions = lv_label_create(root);
         lv_label_set_text(instructions, "Rotate the knob or push the button");
         lv_obj_set_style_text_color(instructions, lv_color_hex(0x888888), 0);
         lv_obj_align(instructions, LV_ALIGN_BOTTOM_MID, 0, -20);
     }
 
-    void DisplayManager::createWifiConnectingScreen()
+    void DisplayManager::createWifiConnectingScreen(lv_obj_t *root)
     {
-        screen_wifi_connecting = lv_obj_create(NULL);
-        lv_obj_set_style_bg_color(screen_wifi_connecting, lv_color_hex(COLOR_BG), 0);
-        createHeader(screen_wifi_connecting, "CloudMouse Boilerplate");
+        lv_obj_set_style_bg_color(root, lv_color_hex(COLOR_BG), 0);
+        createHeader(root, "CloudMouse Boilerplate");
 
-        lv_obj_t *title = lv_label_create(screen_wifi_connecting);
+        lv_obj_t *title = lv_label_create(root);
         lv_label_set_text(title, "Connecting to WiFi");
         lv_obj_set_style_text_color(title, lv_color_hex(COLOR_ACCENT), 0);
-        lv_obj_set_style_text_font(title, &lv_font_montserrat_28, 0);
+        lv_obj_set_style_text_font(title, CM_FONT_28, 0);
         lv_obj_align(title, LV_ALIGN_CENTER, 0, -40);
 
-        label_wifi_status = lv_label_create(screen_wifi_connecting);
-        lv_label_set_text(label_wifi_status, "Please wait...");
-        lv_obj_set_style_text_color(label_wifi_status, lv_color_hex(COLOR_TEXT), 0);
-        lv_obj_set_style_text_font(label_wifi_status, &lv_font_montserrat_20, 0);
-        lv_obj_align(label_wifi_status, LV_ALIGN_CENTER, 0, 20);
+        wifiConnecting.status = lv_label_create(root);
+        lv_label_set_text(wifiConnecting.status, "Please wait...");
+        lv_obj_set_style_text_color(wifiConnecting.status, lv_color_hex(COLOR_TEXT), 0);
+        lv_obj_set_style_text_font(wifiConnecting.status, CM_FONT_20, 0);
+        lv_obj_align(wifiConnecting.status, LV_ALIGN_CENTER, 0, 20);
 
-        spinner_wifi = lv_spinner_create(screen_wifi_connecting);
-        lv_obj_set_size(spinner_wifi, 64, 64);
-        lv_obj_align(spinner_wifi, LV_ALIGN_CENTER, 0, 80);
-        lv_obj_set_style_arc_color(spinner_wifi, lv_color_hex(COLOR_ACCENT), LV_PART_INDICATOR);
+        wifiConnecting.spinner = lv_spinner_create(root);
+        lv_obj_set_size(wifiConnecting.spinner, 64, 64);
+        lv_obj_align(wifiConnecting.spinner, LV_ALIGN_CENTER, 0, 80);
+        lv_obj_set_style_arc_color(wifiConnecting.spinner, lv_color_hex(COLOR_ACCENT), LV_PART_INDICATOR);
     }
 
-    void DisplayManager::createApModeScreen()
+    void DisplayManager::createApModeScreen(lv_obj_t *root)
     {
-        screen_ap_mode = lv_obj_create(NULL);
-        lv_obj_set_style_bg_color(screen_ap_mode, lv_color_hex(TFT_DARKGRAY), 0);
-        createHeader(screen_ap_mode, "WiFi Setup Required");
+        lv_obj_set_style_bg_color(root, lv_color_hex(TFT_DARKGRAY), 0);
+        createHeader(root, "WiFi Setup Required");
 
-        lv_obj_t *title = lv_label_create(screen_ap_mode);
+        lv_obj_t *title = lv_label_create(root);
         lv_label_set_text(title, "Connect to CloudMouse");
         lv_obj_set_style_text_color(title, lv_color_hex(COLOR_ACCENT), 0);
         lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 60);
 
-        label_ap_mode_ssid = lv_label_create(screen_ap_mode);
-        lv_label_set_text(label_ap_mode_ssid, "SSID: ...");
-        lv_obj_set_style_text_color(label_ap_mode_ssid, lv_color_hex(COLOR_TEXT), 0);
-        lv_obj_align(label_ap_mode_ssid, LV_ALIGN_TOP_MID, 0, 90);
-
-        label_ap_mode_pass = lv_label_create(screen_ap_mode);
-        lv_label_set_text(label_ap_mode_pass, "Pass: ...");
-        lv_obj_set_style_text_color(label_ap_mode_pass, lv_color_hex(COLOR_TEXT), 0);
-        lv_obj_align(label_ap_mode_pass, LV_ALIGN_TOP_MID, 0, 110);
-
-        qr_ap_mode = lv_qrcode_create(screen_ap_mode);
-        lv_obj_set_size(qr_ap_mode, 180, 180);
-        lv_qrcode_set_dark_color(qr_ap_mode, lv_color_hex(0x000000));
-        lv_qrcode_set_light_color(qr_ap_mode, lv_color_hex(0xFFFFFF));
-
-        lv_qrcode_set_data(qr_ap_mode, "WIFI:T:WPA;S:...;P:...;;");
-        lv_obj_align(qr_ap_mode, LV_ALIGN_CENTER, 0, 40);
+        apMode.ssid = lv_label_create(root);
+        lv_label_set_text(apMode.ssid, "SSID: ...");
+        lv_obj_set_style_text_color(apMode.ssid, lv_color_hex(COLOR_TEXT), 0);
+        lv_obj_align(apMode.ssid, LV_ALIGN_TOP_MID, 0, 90);
+
+        apMode.pass = lv_label_create(root);
+        lv_label_set_text(apMode.pass, "Pass: ...");
+        lv_obj_set_style_text_color(apMode.pass, lv_color_hex(COLOR_TEXT), 0);
+        lv_obj_align(apMode.pass, LV_ALIGN_TOP_MID, 0, 110);
+
+        apMode.qr = lv_qrcode_create(root);
+        lv_obj_set_size(apMode.qr, 180, 180);
+        lv_qrcode_set_dark_color(apMode.qr, lv_color_hex(0x000000));
+        lv_qrcode_set_light_color(apMode.qr, lv_color_hex(0xFFFFFF));
+        lv_obj_align(apMode.qr, LV_ALIGN_CENTER, 0, 40);
     }
 
-    void DisplayManager::createApConnectedScreen()
+    void DisplayManager::createApConnectedScreen(lv_obj_t *root)
     {
-        screen_ap_connected = lv_obj_create(NULL);
-        lv_obj_set_style_bg_color(screen_ap_connected, lv_color_hex(TFT_DARKGREEN), 0);
-        createHeader(screen_ap_connected, "WiFi Configuration");
+        lv_obj_set_style_bg_color(root, lv_color_hex(TFT_DARKGREEN), 0);
+        createHeader(root, "WiFi Configuration");
 
-        lv_obj_t *title = lv_label_create(screen_ap_connected);
+        lv_obj_t *title = lv_label_create(root);
         lv_label_set_text(title, "✅ Connected!");
         lv_obj_set_style_text_color(title, lv_color_hex(COLOR_SUCCESS), 0);
         lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 60);
 
-        lv_obj_t *subtitle = lv_label_create(screen_ap_connected);
+        lv_obj_t *subtitle = lv_label_create(root);
         lv_label_set_text(subtitle, "Scan QR to setup WiFi");
         lv_obj_set_style_text_color(subtitle, lv_color_hex(COLOR_TEXT), 0);
         lv_obj_align(subtitle, LV_ALIGN_TOP_MID, 0, 90);
 
-        qr_ap_connected = lv_qrcode_create(screen_ap_connected);
-        lv_obj_set_size(qr_ap_connected, 180, 180);
-        lv_qrcode_set_dark_color(qr_ap_connected, lv_color_hex(0x000000));
-        lv_qrcode_set_light_color(qr_ap_connected, lv_color_hex(0xFFFFFF));
+        apConnected.qr = lv_qrcode_create(root);
+        lv_obj_set_size(apConnected.qr, 180, 180);
+        lv_qrcode_set_dark_color(apConnected.qr, lv_color_hex(0x000000));
+        lv_qrcode_set_light_color(apConnected.qr, lv_color_hex(0xFFFFFF));
+        lv_obj_align(apConnected.qr, LV_ALIGN_CENTER, 0, 30);
 
-        lv_qrcode_set_data(qr_ap_connected, "http://...");
-        lv_obj_align(qr_ap_connected, LV_ALIGN_CENTER, 0, 30);
+        apConnected.url = lv_label_create(root);
+        lv_label_set_text(apConnected.url, "http://...");
+        lv_obj_set_style_text_color(apConnected.url, lv_color_hex(COLOR_TEXT), 0);
+        lv_obj_align(apConnected.url, LV_ALIGN_BOTTOM_MID, 0, -20);
+    }
 
-        label_ap_connected_url = lv_label_create(screen_ap_connected);
-        lv_label_set_text(label_ap_connected_url, "http://...");
-        lv_obj_set_style_text_color(label_ap_connected_url, lv_color_hex(COLOR_TEXT), 0);
-        lv_obj_align(label_ap_connected_url, LV_ALIGN_BOTTOM_MID, 0, -20);
+    void DisplayManager::createBenchmarkScreen(lv_obj_t *root)
+    {
+        lv_obj_set_style_bg_color(root, lv_color_hex(COLOR_BG), 0);
+        createHeader(root, "Render Benchmark");
+
+        bench.config = lv_label_create(root);
+        lv_label_set_text(bench.config, "...");
+        lv_obj_set_style_text_color(bench.config, lv_color_hex(COLOR_ACCENT), 0);
+        lv_obj_set_style_text_font(bench.config, CM_FONT_20, 0);
+        lv_obj_align(bench.config, LV_ALIGN_TOP_MID, 0, 55);
+
+        bench.result = lv_label_create(root);
+        lv_label_set_text(bench.result, "Measuring...");
+        lv_obj_set_style_text_color(bench.result, lv_color_hex(COLOR_TEXT), 0);
+        lv_obj_set_style_text_align(bench.result, LV_TEXT_ALIGN_CENTER, 0);
+        lv_obj_align(bench.result, LV_ALIGN_TOP_MID, 0, 90);
+
+        // Moving box keeps LVGL rendering on every refresh cycle
+        bench.box = lv_obj_create(root);
+        lv_obj_set_size(bench.box, 120, 120);
+        lv_obj_set_style_bg_color(bench.box, lv_color_hex(COLOR_ACCENT), 0);
+        lv_obj_set_style_border_width(bench.box, 0, 0);
+        lv_obj_set_style_radius(bench.box, 16, 0);
+        lv_obj_clear_flag(bench.box, LV_OBJ_FLAG_SCROLLABLE);
+        lv_obj_align(bench.box, LV_ALIGN_BOTTOM_LEFT, 0, -10);
+
+        lv_obj_t *instructions = lv_label_create(root);
+        lv_label_set_text(instructions, "Rotate: next configuration - Click: exit");
+        lv_obj_set_style_text_color(instructions, lv_color_hex(0x888888), 0);
+        lv_obj_align(instructions, LV_ALIGN_TOP_MID, 0, 160);
     }
 
     void DisplayManager::createPerformanceLabel()
@@ -498,8 +1007,9 @@ namespace CloudMouse::Hardware
         // Create on the top layer instead of screen_active
         lv_obj_t* label = lv_label_create(lv_layer_top());
         lv_obj_set_style_text_color(label, lv_color_hex(0x00FF00), 0);
-        lv_obj_set_style_text_font(label, &lv_font_montserrat_12, 0);
+        lv_obj_set_style_text_font(label, CM_FONT_12, 0);
         lv_obj_align(label, LV_ALIGN_TOP_RIGHT, -5, 5);
+        lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_RIGHT, 0);
         lv_label_set_text(label, "FPS: -- CPU: --%");
         
         // Make it stay on top
@@ -516,21 +1026,346 @@ namespace CloudMouse::Hardware
         // Calculate CPU usage
         uint32_t cpu_usage = 100 - lv_timer_get_idle();
 
-        // Calculate FPS
+        // Calculate FPS from frames actually rendered, once per second so the
+        // label itself does not keep an idle screen refreshing
         static uint32_t lastFrameTime = millis();
-        static uint32_t frameCount = 0;
-        static uint32_t fps = 0;
 
-        frameCount++;
         uint32_t now = millis();
-        if (now - lastFrameTime >= 1000)
+        if (now - lastFrameTime < 1000)
+            return;
+
+        uint32_t fps = perfFrames * 1000 / (now - lastFrameTime);
+        perfFrames = 0;
+        lastFrameTime = now;
+
+        // Update label: FPS/CPU plus rolling render and flush avg/p99
+        char stats[64];
+        profiler.formatOverlay(stats, sizeof(stats), fps);
+        lv_label_set_text_fmt(perfLabel, "%s\nCPU: %d%%", stats, cpu_usage);
+    }
+    // ============================================================================
+    // SCREEN REGISTRY IMPLEMENTATION
+    // ============================================================================
+
+    lv_obj_t *DisplayManager::showScreen(Screen screen)
+    {
+        if (!ensureScreen(screen))
+            return nullptr;
+
+        ScreenSlot &slot = screenSlots[(int)screen];
+        slot.lastUsed = millis();
+        currentScreen = screen;
+        lv_disp_load_scr(slot.root);
+        idleRefreshPending = true;
+
+        // Leaving setup for a regular screen: drop every transient screen
+        if (!SCREENS[(int)screen].transient)
+        {
+            for (int i = 0; i < (int)Screen::COUNT; i++)
+            {
+                if (i != (int)screen && SCREENS[i].transient && screenSlots[i].root)
+                    evictScreen((Screen)i);
+            }
+        }
+
+        trimScreenCache();
+        return slot.root;
+    }
+
+    bool DisplayManager::ensureScreen(Screen screen)
+    {
+        ScreenSlot &slot = screenSlots[(int)screen];
+        const ScreenDescriptor &desc = SCREENS[(int)screen];
+
+        if (slot.root && !slot.stale)
+            return true;
+
+        // Make room before allocating a new widget tree
+        if (!slot.root)
+            trimScreenCache();
+
+        uint32_t start = micros();
+
+        if (!slot.root)
+        {
+            slot.root = lv_obj_create(NULL);
+            if (!slot.root)
+            {
+                SDK_LOGGER("❌ Screen '%s' creation failed (LVGL heap exhausted)", desc.name);
+                return false;
+            }
+        }
+
+        (this->*desc.build)(slot.root);
+        slot.stale = false;
+
+        SDK_LOGGER("🎨 Screen '%s' built in %lu us (%d cached)", desc.name, micros() - start, builtScreenCount());
+        return true;
+    }
+
+    void DisplayManager::evictScreen(Screen screen)
+    {
+        ScreenSlot &slot = screenSlots[(int)screen];
+        if (!slot.root || slot.root == lv_screen_active())
+            return;
+
+        lv_obj_delete(slot.root);
+        slot.root = nullptr;
+        slot.stale = false;
+        resetScreenState(screen);
+
+        SDK_LOGGER("🧹 Screen '%s' evicted (%d cached)", SCREENS[(int)screen].name, builtScreenCount());
+    }
+
+    void DisplayManager::resetScreenState(Screen screen)
+    {
+        switch (screen)
+        {
+        case Screen::HELLO_WORLD:
+            hello = HelloWorldState();
+            break;
+        case Screen::WIFI_CONNECTING:
+            wifiConnecting = WifiConnectingState();
+            break;
+        case Screen::WIFI_AP_MODE:
+            apMode = ApModeState();
+            break;
+        case Screen::WIFI_AP_CONNECTED:
+            apConnected = ApConnectedState();
+            break;
+        case Screen::BENCHMARK:
+            bench = BenchmarkState();
+            break;
+        default:
+            break;
+        }
+    }
+
+    void DisplayManager::trimScreenCache()
+    {
+        // Evict least recently used screens (never the active one) while over
+        // the count limit or while the LVGL heap is under pressure
+        while (builtScreenCount() > SCREEN_CACHE_MAX || (builtScreenCount() > 1 && isMemoryLow()))
+        {
+            int victim = -1;
+            for (int i = 0; i < (int)Screen::COUNT; i++)
+            {
+                const ScreenSlot &slot = screenSlots[i];
+                if (!slot.root || slot.root == lv_screen_active())
+                    continue;
+                if (victim < 0 || slot.lastUsed < screenSlots[victim].lastUsed)
+                    victim = i;
+            }
+
+            if (victim < 0)
+                break;
+            evictScreen((Screen)victim);
+        }
+    }
+
+    int DisplayManager::builtScreenCount() const
+    {
+        int count = 0;
+        for (int i = 0; i < (int)Screen::COUNT; i++)
+        {
+            if (screenSlots[i].root)
+                count++;
+        }
+        return count;
+    }
+
+    bool DisplayManager::isMemoryLow()
+    {
+        lv_mem_monitor_t mon;
+        lv_mem_monitor(&mon);
+        return mon.total_size > 0 && (100 - mon.used_pct) < SCREEN_CACHE_MIN_FREE_PCT;
+    }
+
+    // ============================================================================
+    // QR CODE CACHE IMPLEMENTATION
+    // ============================================================================
+
+    void DisplayManager::setQrData(lv_obj_t *qr, uint32_t &shownHash, const char *text)
+    {
+        uint32_t hash = Utils::fnv1aText(text);
+        if (hash == 0)
+            hash = 1; // 0 marks an empty widget
+
+        // Widget already shows this content (SSID/password unchanged)
+        if (shownHash == hash)
+            return;
+
+        lv_draw_buf_t *buf = lv_canvas_get_draw_buf(qr);
+        QrCacheEntry *victim = &qrCache[0];
+
+        for (int i = 0; i < QR_CACHE_ENTRIES; i++)
         {
-            fps = frameCount;
-            frameCount = 0;
-            lastFrameTime = now;
+            QrCacheEntry &entry = qrCache[i];
+            if (buf && entry.data && entry.hash == hash && entry.size == buf->data_size && entry.content == text)
+            {
+                // Cache hit: copy the finished canvas, no encode, no module drawing
+                memcpy(buf->data, entry.data, entry.size);
+                lv_obj_invalidate(qr);
+                entry.lastUsed = millis();
+                shownHash = hash;
+                return;
+            }
+            if (!entry.data || (victim->data && entry.lastUsed < victim->lastUsed))
+                victim = &entry;
+        }
+
+        unsigned long start = micros();
+        lv_qrcode_set_data(qr, text);
+        shownHash = hash;
+
+        buf = lv_canvas_get_draw_buf(qr);
+        if (!buf)
+            return;
+
+        if (victim->size != buf->data_size)
+        {
+            heap_caps_free(victim->data);
+            victim->data = (uint8_t *)heap_caps_malloc(buf->data_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+            victim->size = victim->data ? buf->data_size : 0;
+        }
+        if (!victim->data)
+            return;
+
+        memcpy(victim->data, buf->data, victim->size);
+        victim->hash = hash;
+        victim->content = text;
+        victim->lastUsed = millis();
+
+        SDK_LOGGER("🔳 QR encoded in %lu us and cached (%lu bytes)", micros() - start, (unsigned long)victim->size);
+    }
+
+    // ============================================================================
+    // RENDER BENCHMARK IMPLEMENTATION
+    // ============================================================================
+
+    void DisplayManager::onFrameRendered(uint32_t frameUs, uint32_t flushUs, uint32_t pixels)
+    {
+        perfFrames++;
+        if (!firstFrameFlushed)
+        {
+            firstFrameFlushed = true;
+            Utils::BootProfiler::mark("ui.first_frame");
         }
+        if (frameCallback)
+            frameCallback(frameUs, flushUs, pixels, profiler.getPendingAreas());
+        profiler.onFrame(frameUs, flushUs, pixels);
 
-        // Update label
-        lv_label_set_text_fmt(perfLabel, "FPS: %d CPU: %d%%", fps, cpu_usage);
+        if (currentScreen != Screen::BENCHMARK)
+            return;
+
+        benchFrames++;
+        benchFlushUs += flushUs;
+        benchRenderUs += frameUs > flushUs ? frameUs - flushUs : 0;
+    }
+
+    void DisplayManager::enterBenchmark()
+    {
+        if (currentScreen == Screen::BENCHMARK)
+            return;
+
+        if (!showScreen(Screen::BENCHMARK))
+            return;
+
+        benchRestoreConfig = renderConfig;
+
+        lv_anim_t anim;
+        lv_anim_init(&anim);
+        lv_anim_set_var(&anim, bench.box);
+        lv_anim_set_exec_cb(&anim, [](void *obj, int32_t x) { lv_obj_set_x((lv_obj_t *)obj, x); });
+        lv_anim_set_values(&anim, 0, getWidth() - 120);
+        lv_anim_set_duration(&anim, 1500);
+        lv_anim_set_playback_duration(&anim, 1500);
+        lv_anim_set_repeat_count(&anim, LV_ANIM_REPEAT_INFINITE);
+        lv_anim_start(&anim);
+
+        selectBenchmarkConfig(0);
+    }
+
+    void DisplayManager::exitBenchmark()
+    {
+        // bench.box is null once the screen content was cleared (already restored)
+        if (currentScreen != Screen::BENCHMARK || !bench.box)
+            return;
+
+        lv_anim_delete(bench.box, NULL);
+        applyRenderConfig(benchRestoreConfig);
+        SDK_LOGGER("⏱️ Render benchmark closed, configuration restored");
+    }
+
+    void DisplayManager::selectBenchmarkConfig(int index)
+    {
+        benchIndex = (index + BENCHMARK_CONFIG_COUNT) % BENCHMARK_CONFIG_COUNT;
+        const RenderConfig &config = BENCHMARK_CONFIGS[benchIndex];
+
+        if (!applyRenderConfig(config))
+        {
+            // Never leave LVGL without buffers
+            applyRenderConfig(benchRestoreConfig);
+        }
+
+        lv_label_set_text_fmt(bench.config, "[%d/%d] %s, %d lines, %s",
+                              benchIndex + 1, BENCHMARK_CONFIG_COUNT,
+                              modeName(renderConfig.mode), renderConfig.lines, memoryName(renderConfig.memory));
+        lv_label_set_text(bench.result, "Measuring...");
+
+        benchFrames = 0;
+        benchRenderUs = 0;
+        benchFlushUs = 0;
+        benchWindowStart = millis();
+    }
+
+    void DisplayManager::updateBenchmark()
+    {
+        if (currentScreen != Screen::BENCHMARK || !bench.result || millis() - benchWindowStart < 1000)
+            return;
+
+        if (benchFrames > 0)
+        {
+            uint32_t renderAvg = benchRenderUs / benchFrames;
+            uint32_t flushAvg = benchFlushUs / benchFrames;
+
+            lv_label_set_text_fmt(bench.result, "%lu frames/s\nRender: %lu us/frame\nFlush: %lu us/frame",
+                                  (unsigned long)benchFrames, (unsigned long)renderAvg, (unsigned long)flushAvg);
+
+            SDK_LOGGER("⏱️ BENCH mode=%s lines=%d mem=%s frames=%lu render_us=%lu flush_us=%lu",
+                       modeName(renderConfig.mode), renderConfig.lines, memoryName(renderConfig.memory),
+                       (unsigned long)benchFrames, (unsigned long)renderAvg, (unsigned long)flushAvg);
+        }
+
+        benchFrames = 0;
+        benchRenderUs = 0;
+        benchFlushUs = 0;
+        benchWindowStart = millis();
+    }
+
+    const char *DisplayManager::memoryName(uint8_t memory)
+    {
+        switch (memory)
+        {
+        case DISPLAY_BUFFER_INTERNAL:
+            return "INTERNAL";
+        case DISPLAY_BUFFER_MIXED:
+            return "MIXED";
+        default:
+            return "PSRAM";
+        }
+    }
+
+    const char *DisplayManager::modeName(uint8_t mode)
+    {
+        switch (mode)
+        {
+        case DISPLAY_RENDER_DIRECT:
+            return "DIRECT";
+        case DISPLAY_RENDER_FULL:
+            return "FULL";
+        default:
+            return "PARTIAL";
+        }
     }
 } // namespace CloudMouse::Hardware
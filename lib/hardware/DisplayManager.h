@@ -1,19 +1,23 @@
 #pragma once
 
 #include <Arduino.h>
-#include <Ticker.h>
 #include <lvgl.h>
 #include "LGFX_ILI9488.h"
+#include "FrameProfiler.h"
+#include "UiStateStore.h"
 #include "../core/Events.h"
 #include "../config/DeviceConfig.h"
+#include "../config/FontConfig.h"
 
 /**
  * Operational and idle brightness targets with dimmer fade out
+ * Fades run on the LEDC hardware fade engine (LGFX_ILI9488::fadeBrightness)
  */
 #define BRIGHTNESS_UP_TARGET 180
 #define BRIGHTNESS_IDLE_TARGET 10
-#define FADE_OUT_STEP_DELAY_MS 20
-#define FADE_OUT_STEP_VALUE 2
+#define DISPLAY_IDLE_TIMEOUT_MS 10000
+#define FADE_OUT_DURATION_MS 1700
+#define FADE_IN_DURATION_MS 150
 
 /**
  * Display Management Controller
@@ -31,6 +35,8 @@
  * - Uses PSRAM for large sprite buffer to preserve main RAM
  * - Automatic sprite allocation and cleanup in constructor/destructor
  * - Efficient color palette with predefined UI theme colors
+ * - Screens built on first show and kept in a bounded LRU cache (SCREEN_CACHE_MAX),
+ *   setup-only screens released as soon as a regular screen is shown
  * - Memory-conscious rendering with selective update regions
  *
  * Thread Safety:
@@ -49,6 +55,12 @@ namespace CloudMouse::Hardware
      */
     typedef void (*AppDisplayCallback)(const CloudMouse::Event& event);
 
+    /**
+     * Per-frame observer: refresh cycle, blocking flush time, pixels and
+     * invalidated areas of every rendered frame (UI task)
+     */
+    typedef void (*FrameCallback)(uint32_t frameUs, uint32_t flushUs, uint32_t pixels, uint32_t areas);
+
     class DisplayManager
     {
     public:
@@ -56,7 +68,14 @@ namespace CloudMouse::Hardware
         ~DisplayManager();
 
         void init();
-        void update();
+
+        /**
+         * Process pending UI events and run LVGL timers
+         *
+         * @return Milliseconds until the next call is needed (next LVGL timer,
+         *         dimmer step or idle timeout), LV_NO_TIMER_READY if nothing is scheduled
+         */
+        uint32_t update();
         void processEvent(const CloudMouse::Event &event);
 
         /**
@@ -68,6 +87,21 @@ namespace CloudMouse::Hardware
             appCallback = callback;
         }
 
+        /**
+         * Register a per-frame observer (host simulator frame trace)
+         *
+         * @param callback Called once per rendered frame, nullptr to remove
+         */
+        void registerFrameCallback(FrameCallback callback) {
+            frameCallback = callback;
+        }
+
+        /**
+         * Labels bound to state values, redrawn once per update() (see UiStateStore.h)
+         * UI task only: bind from screen builders, set() from the app callback
+         */
+        UiStateStore &getStateStore() { return stateStore; }
+
         // ========================================================================
         // STATUS QUERY INTERFACE
         // ========================================================================
@@ -83,6 +117,54 @@ namespace CloudMouse::Hardware
         int getHeight() const { return 320; }
         bool isAnimating() const { return initialized; }
 
+        /**
+         * Whether a frame has been drawn and flushed to the panel since init
+         * (LV_EVENT_REFR_READY with pixels; the "ui.first_frame" boot mark)
+         */
+        bool hasFlushedFrame() const { return firstFrameFlushed; }
+
+        // ========================================================================
+        // RENDER CONFIGURATION INTERFACE
+        // ========================================================================
+
+        /**
+         * LVGL draw buffer and render mode configuration
+         * Defaults come from DeviceConfig.h (DISPLAY_BUFFER_* / DISPLAY_RENDER_*)
+         */
+        struct RenderConfig
+        {
+            uint16_t lines;     // Stripe height in lines (PARTIAL mode only)
+            uint8_t memory;     // DISPLAY_BUFFER_INTERNAL, _PSRAM or _MIXED
+            uint8_t mode;       // DISPLAY_RENDER_PARTIAL, _DIRECT or _FULL
+        };
+
+        /**
+         * Reallocate LVGL draw buffers and switch render mode at runtime
+         * Must be called from the UI task, between two LVGL refresh cycles.
+         * Internal SRAM requests that cannot be satisfied fall back to PSRAM.
+         *
+         * @param config Buffer placement, stripe height and render mode
+         * @return true if buffers were allocated and assigned to LVGL
+         */
+        bool applyRenderConfig(const RenderConfig &config);
+        const RenderConfig &getRenderConfig() const { return renderConfig; }
+
+        // ========================================================================
+        // MEASUREMENT INTERFACE (UI task / benchmark firmware)
+        // ========================================================================
+
+        /**
+         * Time a full-screen invalidate + render + flush
+         * @return Elapsed time in microseconds
+         */
+        uint32_t measureFullRefresh();
+
+        /**
+         * Time invalidate + render + flush of one screen area
+         * @return Elapsed time in microseconds
+         */
+        uint32_t measureAreaRefresh(int x, int y, int width, int height);
+
     private:
 
         enum class Screen
@@ -90,7 +172,9 @@ namespace CloudMouse::Hardware
             HELLO_WORLD,
             WIFI_CONNECTING,
             WIFI_AP_MODE,
-            WIFI_AP_CONNECTED
+            WIFI_AP_CONNECTED,
+            BENCHMARK,
+            COUNT
         };
 
         LGFX_ILI9488 display; 
@@ -102,15 +186,24 @@ namespace CloudMouse::Hardware
         lv_display_t * disp;      
         lv_indev_t * indev;
 
-        static lv_color_t *buf1;
-        static lv_color_t *buf2;
+        static uint8_t *buf1;
+        static uint8_t *buf2;
+        RenderConfig renderConfig = {DISPLAY_BUFFER_LINES, DISPLAY_BUFFER_MEMORY, DISPLAY_RENDER_MODE};
+
+        // slot 0/1: buf1/buf2; reuses the SDK_STATIC_ALLOCATION buffer of the slot when it fits
+        static uint8_t *allocateBuffer(size_t bytes, bool internal, int slot);
+        static bool isReservedBuffer(const uint8_t *buffer);
+        static void freeBuffers();
 
         // Signature callbacks
         static void lvgl_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map);
+        static void lvgl_flush_wait_cb(lv_display_t *disp);
+        static void lvgl_refr_event_cb(lv_event_t *e);
         static void lvgl_encoder_read_cb(lv_indev_t *indev, lv_indev_data_t *data);
+        void feedEncoderInput();
 
-        Ticker lvgl_ticker;
-        static void lv_tick_task() { lv_tick_inc(5); }
+        // LVGL time base read on demand: no periodic tick interrupt
+        static uint32_t lv_tick_source() { return millis(); }
 
         // ========================================================================
         // LVGL UI OBJECTS
@@ -118,20 +211,41 @@ namespace CloudMouse::Hardware
 
         lv_group_t *encoder_group; 
         
-        lv_obj_t *screen_hello_world;
-        lv_obj_t *screen_wifi_connecting;
-        lv_obj_t *screen_ap_mode;
-        lv_obj_t *screen_ap_connected;
-
-        lv_obj_t *label_hello_status;
-        lv_obj_t *spinner_wifi;
-        lv_obj_t *label_wifi_status;
-        lv_obj_t *qr_ap_mode;
-        lv_obj_t *qr_ap_connected;
-        lv_obj_t *label_ap_connected_url;
-        lv_obj_t *label_ap_mode_ssid;
-        lv_obj_t *label_ap_mode_pass;
+        // Widgets each screen updates after construction (null while not built)
+        struct HelloWorldState
+        {
+            UiStateStore::Handle status = UiStateStore::INVALID_HANDLE; // HelloStatus value
+        } hello;
+
+        struct WifiConnectingState
+        {
+            lv_obj_t *spinner = nullptr;
+            lv_obj_t *status = nullptr;
+        } wifiConnecting;
+
+        struct ApModeState
+        {
+            lv_obj_t *qr = nullptr;
+            uint32_t qrHash = 0;        // Content currently drawn in 'qr' (0 = none)
+            lv_obj_t *ssid = nullptr;
+            lv_obj_t *pass = nullptr;
+        } apMode;
+
+        struct ApConnectedState
+        {
+            lv_obj_t *qr = nullptr;
+            uint32_t qrHash = 0;
+            lv_obj_t *url = nullptr;
+        } apConnected;
+
+        struct BenchmarkState
+        {
+            lv_obj_t *config = nullptr;
+            lv_obj_t *result = nullptr;
+            lv_obj_t *box = nullptr;
+        } bench;
 
+        FrameCallback frameCallback = nullptr;
         AppDisplayCallback appCallback = nullptr;   // Custom DisplayManager callback for SDK event forwarding
 
         // ========================================================================
@@ -147,7 +261,30 @@ namespace CloudMouse::Hardware
         // Brightness management variables
         int currentBrightness = BRIGHTNESS_UP_TARGET;
         unsigned long lastInteractionTime = 0;
-        unsigned long lastFadeTime = 0;
+        bool dimmed = false;                // Fade out to BRIGHTNESS_IDLE_TARGET started
+        bool renderSuspended = false;       // Idle render mode active (DISPLAY_IDLE_RENDER)
+        bool idleRefreshPending = false;    // Screen changed while rendering is paused
+
+        // Per-frame timing (filled by flush callbacks and display refresh events)
+        uint32_t frameStartUs = 0;
+        uint32_t frameFlushUs = 0;
+        uint32_t framePixels = 0;
+        uint32_t perfFrames = 0;
+        bool firstFrameFlushed = false;     // Set by the first onFrameRendered()
+
+        // Rolling per-frame breakdown (serial report and performance overlay)
+        FrameProfiler profiler;
+
+        // Label values coalesced per frame
+        UiStateStore stateStore;
+
+        // Render benchmark accumulators
+        int benchIndex = 0;
+        RenderConfig benchRestoreConfig = {DISPLAY_BUFFER_LINES, DISPLAY_BUFFER_MEMORY, DISPLAY_RENDER_MODE};
+        uint32_t benchFrames = 0;
+        uint32_t benchRenderUs = 0;
+        uint32_t benchFlushUs = 0;
+        unsigned long benchWindowStart = 0;
 
         // ========================================================================
         // UI COLOR SCHEME DEFINITIONS
@@ -164,20 +301,123 @@ namespace CloudMouse::Hardware
         // ========================================================================
 
         void createUi();
-        void createHelloWorldScreen();
-        void createWifiConnectingScreen();
-        void createApModeScreen();
-        void createApConnectedScreen();
+        void createHelloWorldScreen(lv_obj_t *root);
+        void createWifiConnectingScreen(lv_obj_t *root);
+        void createApModeScreen(lv_obj_t *root);
+        void createApConnectedScreen(lv_obj_t *root);
+        void createBenchmarkScreen(lv_obj_t *root);
         lv_obj_t* createHeader(lv_obj_t* parent, const char* title);
 
+        // ========================================================================
+        // SCREEN REGISTRY (lazy construction + bounded LRU cache)
+        // ========================================================================
+
+        typedef void (DisplayManager::*ScreenBuilder)(lv_obj_t *root);
+
+        /**
+         * Static screen description: builder populating an empty root object,
+         * and whether the screen only matters during setup (evicted as soon as
+         * a regular screen is shown)
+         */
+        struct ScreenDescriptor
+        {
+            const char *name;
+            ScreenBuilder build;
+            bool transient;
+        };
+
+        /**
+         * Runtime cache entry for a screen
+         */
+        struct ScreenSlot
+        {
+            lv_obj_t *root = nullptr;
+            unsigned long lastUsed = 0;
+            bool stale = false;     // Children removed by DISPLAY_CLEAR, rebuild on next show
+        };
+
+        static const ScreenDescriptor SCREENS[];
+        ScreenSlot screenSlots[(int)Screen::COUNT];
+
+        /**
+         * Build the screen if needed, load it and trim the cache
+         * @return Screen root, nullptr if it could not be built
+         */
+        lv_obj_t *showScreen(Screen screen);
+        bool ensureScreen(Screen screen);
+        void evictScreen(Screen screen);
+        void resetScreenState(Screen screen);
+        void trimScreenCache();
+        int builtScreenCount() const;
+        static bool isMemoryLow();
+
+        // ========================================================================
+        // QR CODE CACHE
+        // ========================================================================
+
+        static const int QR_CACHE_ENTRIES = 2;
+
+        /**
+         * Finished QR canvas (I1 draw buffer incl. palette) keyed by content hash,
+         * kept across screen eviction so re-entering setup skips the encode
+         */
+        struct QrCacheEntry
+        {
+            uint32_t hash = 0;
+            String content;             // Verified on hash match
+            uint8_t *data = nullptr;    // Copy of the draw buffer (PSRAM)
+            uint32_t size = 0;
+            unsigned long lastUsed = 0;
+        };
+
+        QrCacheEntry qrCache[QR_CACHE_ENTRIES];
+
+        /**
+         * Show 'text' in a QR widget: no-op if already shown, buffer copy on
+         * cache hit, full encode (then cached) otherwise
+         */
+        void setQrData(lv_obj_t *qr, uint32_t &shownHash, const char *text);
+
+#if INPUT_LATENCY_TRACE
+        /**
+         * Start the latency trace of a received ENCODER_INPUT event
+         * @return Trace ID to complete after processEvent(), 0 if not traced
+         */
+        uint16_t beginTrace(const Event &event);
+#endif
+
+        // ========================================================================
+        // RENDER BENCHMARK
+        // ========================================================================
+
+        void onFrameRendered(uint32_t frameUs, uint32_t flushUs, uint32_t pixels);
+        void enterBenchmark();
+        void exitBenchmark();
+        void selectBenchmarkConfig(int index);
+        void updateBenchmark();
+        static const char *memoryName(uint8_t memory);
+        static const char *modeName(uint8_t mode);
+
         // ========================================================================
         // SCREEN BRIGHTNESS MANAGEMENT
         // ========================================================================
         
         void wakeUp();
         void handleDimmer();
+        uint32_t getDimmerDeadline() const;
 
-        void printPerformanceStats();
+        /**
+         * Switch LVGL to the idle render mode once the backlight is dimmed
+         * (stretched refresh period or no rendering at all, see DISPLAY_IDLE_RENDER)
+         */
+        void enterIdleRender();
+        void exitIdleRender();
+        bool isRenderPaused() const { return DISPLAY_IDLE_RENDER == DISPLAY_IDLE_RENDER_PAUSE && renderSuspended; }
+
+        /**
+         * Print the frame profiler report and LVGL heap usage over serial
+         */
+        void printProfilerReport();
 
         lv_obj_t* perfLabel = nullptr;
     
@@ -5,15 +5,16 @@
  * button press detection and event-driven architecture for reliable user interaction handling.
  *
  * Implementation Details:
- * - PCNT hardware integration for rotation tracking without CPU interrupts
- * - State machine approach for button press detection with precise timing
+ * - PCNT limit interrupt per detent and GPIO edge interrupt on the button,
+ *   both queued with esp_timer timestamps in an ISR-safe ring
+ * - State machine replaying the ring, so press timing uses edge timestamps
  * - Event accumulation strategy for smooth movement reporting across update cycles
  * - Multi-threshold press detection for rich interaction vocabulary
  * - Consumption-based event model preventing duplicate processing
  *
  * Performance Characteristics:
  * - Rotation tracking: Hardware PCNT with 0.25° resolution
- * - Button sampling: 50-100Hz recommended for responsive feel
+ * - Button sampling: edge interrupts, no fixed polling rate
  * - Memory usage: ~100 bytes RAM for state management
  * - CPU overhead: Minimal due to hardware acceleration
  *
@@ -21,11 +22,14 @@
  * - Click detection: < 500ms press duration
  * - Long press: 1000-2999ms with optional buzzer feedback
  * - Ultra-long press: >= 3000ms with immediate event trigger
- * - Debouncing: Handled by hardware pull-ups and state machine logic
+ * - Debouncing: edges within ENCODER_BUTTON_DEBOUNCE_US of a transition are ignored
  */
 
 #include "./EncoderManager.h"
 #include "../utils/Logger.h"
+#include "../utils/LatencyTracer.h"
+#include <esp_timer.h>
+#include <driver/gpio.h>
 
 namespace CloudMouse::Hardware
 {
@@ -49,184 +53,420 @@ namespace CloudMouse::Hardware
         pinMode(ENCODER_SW_PIN, INPUT_PULLUP);
 
         // Initialize PCNT-based encoder hardware
-        // Sets up quadrature decoder with glitch filtering
+        // Counter wraps at ±4 (one physical detent) and reports each detent from its ISR
+        encoder.setDetentCallback(detentISR, this, 4);
         encoder.init();
 
-        // Read initial encoder position and normalize to detent resolution
-        // Divide by 4 because PCNT counts 4 edges per physical detent
-        lastValue = encoder.position() / 4;
-
         // Initialize button state by reading current pin level
         // Ensures proper state tracking from startup
-        lastButtonState = digitalRead(ENCODER_SW_PIN);
+        buttonPressed = digitalRead(ENCODER_SW_PIN) == LOW;
+        lastTransitionUs = (uint32_t)esp_timer_get_time();
+        lastEdgeUs = lastTransitionUs;
+        pressStartUs = lastTransitionUs;
+
+        // Every button edge is timestamped in the ISR
+        attachInterruptArg(ENCODER_SW_PIN, buttonISR, this, CHANGE);
 
         SDK_LOGGER("✅ EncoderManager initialized successfully\n");
         SDK_LOGGER("🎮 Pin configuration: CLK=%d, DT=%d, SW=%d\n",
                    ENCODER_CLK_PIN, ENCODER_DT_PIN, ENCODER_SW_PIN);
-        SDK_LOGGER("🎮 Initial encoder position: %d\n", lastValue);
     }
 
     // ============================================================================
-    // MAIN UPDATE LOOP
+    // INPUT INTERRUPTS AND RING
     // ============================================================================
 
-    void EncoderManager::update()
+    void EncoderManager::setWakeTask(TaskHandle_t task)
+    {
+        // The ISRs are always attached; they only skip the notification without a task
+        wakeTask = task;
+        if (task)
+            SDK_LOGGER("🎮 Encoder wake task registered");
+    }
+
+    void IRAM_ATTR EncoderManager::pushFromISR(uint8_t kind, int8_t value)
+    {
+        InputRecord record;
+        record.timeUs = (uint32_t)esp_timer_get_time();
+        record.kind = kind;
+        record.value = value;
+
+        // PCNT and GPIO interrupts may run on either core: spinlock, not just ordering
+        portENTER_CRITICAL_ISR(&ringLock);
+        if (ringCount < ENCODER_INPUT_RING_SIZE)
+        {
+            ring[(ringHead + ringCount) % ENCODER_INPUT_RING_SIZE] = record;
+            ringCount = ringCount + 1;
+        }
+        else
+        {
+            ringOverflows++;
+        }
+        portEXIT_CRITICAL_ISR(&ringLock);
+
+        TaskHandle_t task = wakeTask;
+        if (!task)
+            return;
+
+        BaseType_t higherPriorityWoken = pdFALSE;
+        vTaskNotifyGiveFromISR(task, &higherPriorityWoken);
+        if (higherPriorityWoken)
+            portYIELD_FROM_ISR();
+    }
+
+    bool EncoderManager::popRecord(InputRecord &record)
+    {
+        bool available = false;
+
+        portENTER_CRITICAL(&ringLock);
+        if (ringCount > 0)
+        {
+            record = ring[ringHead];
+            ringHead = (ringHead + 1) % ENCODER_INPUT_RING_SIZE;
+            ringCount = ringCount - 1;
+            available = true;
+        }
+        portEXIT_CRITICAL(&ringLock);
+
+        return available;
+    }
+
+    void IRAM_ATTR EncoderManager::detentISR(int8_t direction, void *arg)
     {
-        // Process encoder rotation and button state changes
-        // Call both processors to ensure comprehensive input handling
-        processEncoder();
-        processButton();
+        static_cast<EncoderManager *>(arg)->pushFromISR(INPUT_DETENT, direction);
+    }
+
+    void IRAM_ATTR EncoderManager::buttonISR(void *arg)
+    {
+        int level = gpio_get_level((gpio_num_t)ENCODER_SW_PIN);
+        static_cast<EncoderManager *>(arg)->pushFromISR(INPUT_BUTTON, (int8_t)level);
+    }
+
+    bool EncoderManager::needsPolling() const
+    {
+        return isButtonDown() || waitingForDoubleClick;
     }
 
     // ============================================================================
-    // ENCODER ROTATION PROCESSING
+    // MAIN UPDATE LOOP
     // ============================================================================
 
-    void EncoderManager::processEncoder()
+    void EncoderManager::update()
     {
-        // Read current encoder position from PCNT hardware
-        // Normalize to physical detent resolution (4 counts per detent)
-        int newValue = encoder.position() / 4;
-
-        // Check for position change since last update
-        if (newValue != lastValue)
+        // Replay interrupt records in arrival order
+        InputRecord record;
+        while (popRecord(record))
         {
-            // Calculate movement delta and accumulate for consumption
-            // Positive delta = clockwise, negative delta = counter-clockwise
-            int delta = newValue - lastValue;
-            movement += delta;
-            lastValue = newValue;
-            movementPending = true;
-
-            // Detect press-and-rotate gesture
-            if (isButtonDown() && !pressAndRotateActive)
+            if (!inputPending)
             {
-                SDK_LOGGER("🎮 Press-and-rotate gesture detected!");
-                pressAndRotatePending = true;
-                pressAndRotateActive = true;
-
-                // Clear all button press tracking - this becomes a different gesture
-                clickPending = false;
-                longPressPending = false;
-                ultraLongPressPending = false;
-                waitingForDoubleClick = false;
-                longPressBuzzed = false;
-                ultraLongPressNotified = false;
+                pendingInputUs = record.timeUs;
+                inputPending = true;
             }
+
+            if (record.kind == INPUT_DETENT)
+                processDetent(record.value, record.timeUs);
+            else
+                processButtonEdge(record.value == LOW, record.timeUs);
+        }
+
+        if (ringOverflows)
+        {
+            SDK_LOGW(INPUT, "⚠️ Encoder input ring overflow - %lu records dropped", (unsigned long)ringOverflows);
+            ringOverflows = 0;
         }
+
+        uint32_t nowUs = (uint32_t)esp_timer_get_time();
+        resyncButton(nowUs);
+        processTimers(nowUs);
     }
 
     // ============================================================================
-    // BUTTON PRESS PROCESSING
+    // ENCODER ROTATION PROCESSING
     // ============================================================================
 
-    // In EncoderManager.cpp - Update processButton():
-
-    void EncoderManager::processButton()
+    void EncoderManager::processDetent(int8_t direction, uint32_t timeUs)
     {
-        bool currentButtonState = digitalRead(ENCODER_SW_PIN);
-        unsigned long currentTime = millis();
-
-        // PRESS DETECTION
-        if (currentButtonState != lastButtonState && currentButtonState == LOW)
+        velocitySamples[velocityHead].timeUs = timeUs;
+        velocitySamples[velocityHead].direction = direction;
+        velocityHead = (velocityHead + 1) % ENCODER_VELOCITY_SAMPLES;
+        if (velocityCount < ENCODER_VELOCITY_SAMPLES)
+            velocityCount++;
+
+        // Positive = clockwise, negative = counter-clockwise
+        int speed = velocityAt(timeUs);
+        movement += direction;
+        steps += direction * accelerationMultiplier(speed < 0 ? -speed : speed);
+        movementPending = true;
+
+        // Detect press-and-rotate gesture (button state as of this detent)
+        if (buttonPressed && !pressAndRotateActive)
         {
-            pressStartTime = currentTime;
+            SDK_LOGD(INPUT, "🎮 Press-and-rotate gesture detected!");
+            pressAndRotatePending = true;
+            pressAndRotateActive = true;
+
+            // Clear all button press tracking - this becomes a different gesture
+            clickPending = false;
+            longPressPending = false;
+            ultraLongPressPending = false;
+            waitingForDoubleClick = false;
             longPressBuzzed = false;
             ultraLongPressNotified = false;
-            pressAndRotateActive = false; // Reset press-and-rotate for new press
+        }
+    }
 
-            SDK_LOGGER("👆 Button press detected");
+    int EncoderManager::velocityAt(uint32_t nowUs) const
+    {
+        const uint32_t windowUs = (uint32_t)ENCODER_VELOCITY_WINDOW_MS * 1000;
+        int sum = 0;
+
+        // Newest first, stop at the first sample outside the window
+        for (int i = 0; i < velocityCount; i++)
+        {
+            const DetentSample &sample = velocitySamples[(velocityHead - 1 - i + ENCODER_VELOCITY_SAMPLES) % ENCODER_VELOCITY_SAMPLES];
+            if (nowUs - sample.timeUs > windowUs)
+                break;
+            sum += sample.direction;
         }
 
-        // RELEASE DETECTION
-        if (currentButtonState != lastButtonState && currentButtonState == HIGH)
+        return sum * 1000 / ENCODER_VELOCITY_WINDOW_MS;
+    }
+
+    int EncoderManager::getVelocity() const
+    {
+        return velocityAt((uint32_t)esp_timer_get_time());
+    }
+
+    int EncoderManager::accelerationMultiplier(int speedDps) const
+    {
+        if (accelMaxMultiplier <= 1 || speedDps <= accelStartDps)
+            return 1;
+        if (speedDps >= accelFullDps)
+            return accelMaxMultiplier;
+
+        return 1 + (accelMaxMultiplier - 1) * (speedDps - accelStartDps) / (accelFullDps - accelStartDps);
+    }
+
+    void EncoderManager::setAcceleration(uint16_t startDps, uint16_t fullDps, uint8_t maxMultiplier)
+    {
+        if (fullDps <= startDps || maxMultiplier < 1)
         {
-            unsigned long pressDuration = currentTime - pressStartTime;
-            lastPressDuration = pressDuration;
+            SDK_LOGW(INPUT, "⚠️ Invalid acceleration curve (%u..%u dps, x%u) ignored", startDps, fullDps, maxMultiplier);
+            return;
+        }
+
+        accelStartDps = startDps;
+        accelFullDps = fullDps;
+        accelMaxMultiplier = maxMultiplier;
+        SDK_LOGGER("🎮 Encoder acceleration: %u..%u dps -> x1..x%u", startDps, fullDps, maxMultiplier);
+    }
+
+    // ============================================================================
+    // BUTTON PRESS PROCESSING
+    // ============================================================================
+
+    void EncoderManager::processButtonEdge(bool pressed, uint32_t timeUs)
+    {
+        lastEdgeUs = timeUs;
+
+        // Contact bounce around the last transition
+        if (timeUs - lastTransitionUs < ENCODER_BUTTON_DEBOUNCE_US)
+            return;
+
+        if (pressed && !buttonPressed)
+            onPress(timeUs);
+        else if (!pressed && buttonPressed)
+            onRelease(timeUs);
+    }
+
+    void EncoderManager::resyncButton(uint32_t nowUs)
+    {
+        // A fast tap can end inside the debounce window of its own press edge;
+        // once the pin is stable the missed transition is applied at its edge time
+        if (nowUs - lastTransitionUs < ENCODER_BUTTON_DEBOUNCE_US ||
+            nowUs - lastEdgeUs < ENCODER_BUTTON_DEBOUNCE_US)
+            return;
+
+        bool pressed = digitalRead(ENCODER_SW_PIN) == LOW;
+        if (pressed == buttonPressed)
+            return;
+
+        // The last edge is the one that left the pin at its current level
+        if (pressed)
+            onPress(lastEdgeUs);
+        else
+            onRelease(lastEdgeUs);
+    }
+
+    void EncoderManager::onPress(uint32_t timeUs)
+    {
+        buttonPressed = true;
+        lastTransitionUs = timeUs;
+        pressStartUs = timeUs;
+        longPressBuzzed = false;
+        ultraLongPressNotified = false;
+        pressAndRotateActive = false; // Reset press-and-rotate for new press
+
+        SDK_LOGD(INPUT, "👆 Button press detected");
+    }
+
+    void EncoderManager::onRelease(uint32_t timeUs)
+    {
+        buttonPressed = false;
+        lastTransitionUs = timeUs;
+
+        unsigned long pressDuration = (timeUs - pressStartUs) / 1000;
+        lastPressDuration = pressDuration;
 
-            SDK_LOGGER("👆 Button released after %lu ms", pressDuration);
+        SDK_LOGD(INPUT, "👆 Button released after %lu ms", pressDuration);
 
-            // If press-and-rotate was active, ignore all other button events
-            if (pressAndRotateActive)
+        // If press-and-rotate was active, ignore all other button events
+        if (pressAndRotateActive)
+        {
+            SDK_LOGD(INPUT, "👆 Release ignored (was press-and-rotate gesture)");
+            pressAndRotateActive = false;
+            return;
+        }
+
+        // Classify press event based on duration
+        if (pressDuration >= ULTRA_LONG_PRESS_DURATION)
+        {
+            if (!ultraLongPressNotified)
             {
-                SDK_LOGGER("👆 Release ignored (was press-and-rotate gesture)");
-                pressAndRotateActive = false;
+                ultraLongPressPending = true;
+                ultraLongPressNotified = true;
+                SDK_LOGD(INPUT, "👆🔒🔒 Ultra-long press event (on release)");
+            }
+        }
+        else if (pressDuration >= LONG_PRESS_DURATION)
+        {
+            longPressPending = true;
+            SDK_LOGD(INPUT, "👆🔒 Long press event");
+        }
+        else if (pressDuration < CLICK_TIMEOUT)
+        {
+            // Double click: second release within the window of the first one
+            if (waitingForDoubleClick && (timeUs - lastClickUs) / 1000 <= DOUBLE_CLICK_WINDOW)
+            {
+                doubleClickPending = true;
+                waitingForDoubleClick = false;
+                clickPending = false; // Cancel single click
+                SDK_LOGD(INPUT, "👆👆 Double click detected!");
             }
             else
             {
-                // Classify press event based on duration
-                if (pressDuration >= ULTRA_LONG_PRESS_DURATION)
-                {
-                    if (!ultraLongPressNotified)
-                    {
-                        ultraLongPressPending = true;
-                        ultraLongPressNotified = true;
-                        SDK_LOGGER("👆🔒🔒 Ultra-long press event (on release)");
-                    }
-                }
-                else if (pressDuration >= LONG_PRESS_DURATION)
-                {
-                    longPressPending = true;
-                    SDK_LOGGER("👆🔒 Long press event");
-                }
-                else if (pressDuration < CLICK_TIMEOUT)
-                {
-                    // Double click detection logic
-                    if (waitingForDoubleClick)
-                    {
-                        // Second click arrived in time!
-                        doubleClickPending = true;
-                        waitingForDoubleClick = false;
-                        clickPending = false; // Cancel single click
-                        SDK_LOGGER("👆👆 Double click detected!");
-                    }
-                    else
-                    {
-                        // First click - start waiting for potential second click
-                        waitingForDoubleClick = true;
-                        lastClickTime = currentTime;
-                        SDK_LOGGER("👆 Click detected, waiting for potential double click...");
-                    }
-                }
+                // A first click whose window already passed (update() ran late) still counts
+                if (waitingForDoubleClick)
+                    clickPending = true;
+
+                // First click - start waiting for potential second click
+                waitingForDoubleClick = true;
+                lastClickUs = timeUs;
+                SDK_LOGD(INPUT, "👆 Click detected, waiting for potential double click...");
             }
         }
 
+        if (ultraLongPressNotified && lastPressDuration < ULTRA_LONG_PRESS_DURATION)
+        {
+            ultraLongPressNotified = false;
+        }
+    }
+
+    void EncoderManager::processTimers(uint32_t nowUs)
+    {
         // ONGOING PRESS FEEDBACK
-        if (currentButtonState == LOW && !pressAndRotateActive)
+        if (buttonPressed && !pressAndRotateActive)
         {
             unsigned long pressTime = getCurrentPressTime();
 
             if (pressTime >= LONG_PRESS_DURATION && !longPressBuzzed)
             {
                 longPressBuzzed = true;
-                SDK_LOGGER("🔊 Long press threshold reached");
+                SDK_LOGD(INPUT, "🔊 Long press threshold reached");
             }
 
             if (pressTime >= ULTRA_LONG_PRESS_DURATION && !ultraLongPressNotified)
             {
                 ultraLongPressPending = true;
                 ultraLongPressNotified = true;
-                SDK_LOGGER("👆🔒🔒 Ultra-long press triggered immediately!");
-            }
-        }
-        else
-        {
-            if (ultraLongPressNotified && lastPressDuration < ULTRA_LONG_PRESS_DURATION)
-            {
-                ultraLongPressNotified = false;
+                SDK_LOGD(INPUT, "👆🔒🔒 Ultra-long press triggered immediately!");
             }
         }
 
         // Check double click timeout
-        if (waitingForDoubleClick && (currentTime - lastClickTime) > DOUBLE_CLICK_WINDOW)
+        if (waitingForDoubleClick && (nowUs - lastClickUs) / 1000 > DOUBLE_CLICK_WINDOW)
         {
             // Timeout expired - fire single click
             clickPending = true;
             waitingForDoubleClick = false;
-            SDK_LOGGER("👆 Single click confirmed (timeout)");
+            SDK_LOGD(INPUT, "👆 Single click confirmed (timeout)");
         }
+    }
+
+    // ============================================================================
+    // SNAPSHOT
+    // ============================================================================
+
+    bool EncoderManager::takeSnapshot(InputSnapshot &snapshot)
+    {
+        memset(&snapshot, 0, sizeof(snapshot));
+        snapshot.timestampUs = (uint32_t)esp_timer_get_time();
+
+        int acceleratedSteps = steps;
+        snapshot.rotation = (int16_t)getMovement();
+        if (snapshot.rotation != 0)
+            snapshot.steps = (int16_t)acceleratedSteps;
+
+        if (getClicked())
+            snapshot.flags |= INPUT_FLAG_CLICK;
+        if (getLongPressed())
+            snapshot.flags |= INPUT_FLAG_LONG_PRESS;
+        if (getUltraLongPressed())
+            snapshot.flags |= INPUT_FLAG_ULTRA_LONG_PRESS;
+        if (getDoubleClicked())
+            snapshot.flags |= INPUT_FLAG_DOUBLE_CLICK;
+        if (getPressAndRotate())
+            snapshot.flags |= INPUT_FLAG_PRESS_AND_ROTATE;
+
+        // Rotation while held goes to pressRotation for as long as the gesture lasts
+        snapshot.pressRotation = (int16_t)getPressAndRotateMovement();
+
+        if (isButtonDown())
+        {
+            snapshot.flags |= INPUT_FLAG_BUTTON_DOWN;
+            snapshot.pressTimeMs = getPressTime();
+        }
+
+        if (lastPressDuration > 0)
+        {
+            snapshot.flags |= INPUT_FLAG_BUTTON_RELEASED;
+            snapshot.lastPressDurationMs = lastPressDuration;
+            resetLastPressDuration();
+        }
+
+        snapshot.velocity = (int16_t)velocityAt(snapshot.timestampUs);
+
+        if (inputPending)
+        {
+            snapshot.inputUs = pendingInputUs;
+            inputPending = false;
+        }
+
+        bool hasInput = snapshot.rotation != 0 || snapshot.pressRotation != 0 || snapshot.flags != 0;
+
+        // A hold is reported by its press edge: later cycles with nothing but BUTTON_DOWN are not published
+        bool repeatedHold = snapshot.flags == INPUT_FLAG_BUTTON_DOWN && snapshot.rotation == 0 &&
+                            snapshot.pressRotation == 0 && snapshot.inputUs == 0 && snapshotButtonDown;
+        if (repeatedHold)
+            return false;
+        snapshotButtonDown = (snapshot.flags & INPUT_FLAG_BUTTON_DOWN) != 0;
+
+#if INPUT_LATENCY_TRACE
+        if (hasInput)
+            snapshot.traceId = Utils::LatencyTracer::nextId();
+#endif
 
-        lastButtonState = currentButtonState;
+        return hasInput;
     }
 
     // ============================================================================
@@ -247,9 +487,10 @@ namespace CloudMouse::Hardware
         {
             int result = movement;   // Capture current movement total
             movement = 0;            // Reset accumulator for next cycle
+            steps = 0;
             movementPending = false; // Clear pending flag
 
-            SDK_LOGGER("📊 Movement consumed: %d clicks\n", result);
+            SDK_LOGD(INPUT, "📊 Movement consumed: %d clicks", result);
             return result;
         }
 
@@ -263,7 +504,7 @@ namespace CloudMouse::Hardware
         if (clickPending)
         {
             clickPending = false; // Reset flag after consumption
-            SDK_LOGGER("📊 Click event consumed");
+            SDK_LOGD(INPUT, "📊 Click event consumed");
             return true;
         }
 
@@ -277,7 +518,7 @@ namespace CloudMouse::Hardware
         if (longPressPending)
         {
             longPressPending = false; // Reset flag after consumption
-            SDK_LOGGER("📊 Long press event consumed");
+            SDK_LOGD(INPUT, "📊 Long press event consumed");
             return true;
         }
 
@@ -291,7 +532,7 @@ namespace CloudMouse::Hardware
         if (ultraLongPressPending)
         {
             ultraLongPressPending = false; // Reset flag after consumption
-            SDK_LOGGER("📊 Ultra-long press event consumed");
+            SDK_LOGD(INPUT, "📊 Ultra-long press event consumed");
             return true;
         }
 
@@ -304,7 +545,7 @@ namespace CloudMouse::Hardware
         if (doubleClickPending)
         {
             doubleClickPending = false;
-            SDK_LOGGER("📊 Double click event consumed");
+            SDK_LOGD(INPUT, "📊 Double click event consumed");
             return true;
         }
         return false;
@@ -320,7 +561,7 @@ namespace CloudMouse::Hardware
             // The app should call getMovement() separately if it wants the delta
             // but we signal that press-and-rotate happened
             
-            SDK_LOGGER("📊 Press-and-rotate event consumed");
+            SDK_LOGD(INPUT, "📊 Press-and-rotate event consumed");
             return true;
         }
         return false;
@@ -333,9 +574,10 @@ namespace CloudMouse::Hardware
         {
             int result = movement;
             movement = 0;
+            steps = 0;
             movementPending = false;
             
-            SDK_LOGGER("📊 Press-and-rotate movement: %d clicks", result);
+            SDK_LOGD(INPUT, "📊 Press-and-rotate movement: %d clicks", result);
             return result;
         }
         
@@ -348,8 +590,8 @@ namespace CloudMouse::Hardware
 
     bool EncoderManager::isButtonDown() const
     {
-        // Real-time button state query (LOW = pressed)
-        return digitalRead(ENCODER_SW_PIN) == LOW;
+        // Debounced state maintained from the edge interrupt records
+        return buttonPressed;
     }
 
     int EncoderManager::getPressTime() const
@@ -382,10 +624,10 @@ namespace CloudMouse::Hardware
     unsigned long EncoderManager::getCurrentPressTime() const
     {
         // Calculate elapsed time since press started, or zero if not pressed
-        if (digitalRead(ENCODER_SW_PIN) == LOW)
+        if (buttonPressed)
         {
-            // Button currently pressed - calculate elapsed time
-            return millis() - pressStartTime;
+            // Button currently pressed - elapsed time since the press edge
+            return ((uint32_t)esp_timer_get_time() - pressStartUs) / 1000;
         }
 
         // Button not pressed - return zero
@@ -44,12 +44,26 @@
  * Performance Characteristics:
  * - Rotation resolution: 0.25° precision (4 counts per physical detent)
  * - Update frequency: 50-100Hz recommended for responsive feel
- * - Button debouncing: Hardware pull-up + software state machine
- * - Memory usage: ~100 bytes RAM for state variables
+ * - Button debouncing: Hardware pull-up + timestamped edge filter (ENCODER_BUTTON_DEBOUNCE_US)
+ * - Memory usage: ~100 bytes RAM for state variables + input ring
+ *
+ * Interrupt-Driven Capture:
+ * - PCNT limit interrupt once per detent (±4 counts), GPIO interrupt on each
+ *   button edge; both stamp esp_timer time and push a record to an ISR-safe ring
+ * - update() replays the ring in order, so click/double-click/long-press
+ *   durations come from edge timestamps rather than from when update() ran
+ *
+ * Snapshots and Velocity:
+ * - takeSnapshot() consumes everything pending into one InputSnapshot, sent by
+ *   the UI task as a single ENCODER_INPUT event per cycle
+ * - The last ENCODER_VELOCITY_SAMPLES detent timestamps give the rotation
+ *   velocity; setAcceleration() turns fast spins into larger steps
  */
 
 #pragma once
 #include <Arduino.h>
+#include "../config/DeviceConfig.h"
+#include "../core/Events.h"
 
 // Hardware pin definitions
 #define ENCODER_CLK_PIN 16 // Encoder Clock/A signal (quadrature phase A)
@@ -57,7 +71,9 @@
 #define ENCODER_SW_PIN 17  // Encoder Switch/Button (active LOW)
 
 // Platform-specific encoder library inclusion
-#ifdef PLATFORMIO
+#if CLOUDMOUSE_SIM
+#include <RotaryEncoderSim.h> // Host simulator: detents injected by src/sim/SimInput
+#elif defined(PLATFORMIO)
 #include "./RotaryEncoderPCNT.h" // Local implementation for ESP-IDF 4.4
 #else
 #include <RotaryEncoderPCNT.h> // Library implementation for ESP-IDF 5.x
@@ -72,7 +88,8 @@
  * Provides event-driven interface with automatic state reset for reliable interaction handling.
  *
  * Architecture:
- * - Hardware PCNT for precise rotation counting without CPU interrupts
+ * - Hardware PCNT for precise rotation counting, one interrupt per detent
+ * - ISR-filled input ring with microsecond timestamps, drained by update()
  * - State machine for button press detection with timing analysis
  * - Event accumulation for smooth movement reporting across update cycles
  * - Multi-level press detection for rich interaction vocabulary
@@ -83,9 +100,9 @@
  * - Event consumption is atomic at method call level
  *
  * Update Frequency:
- * - Call update() every 10-20ms for responsive feel
- * - Higher frequencies improve button responsiveness
- * - Lower frequencies may miss rapid encoder movements
+ * - With setWakeTask() the consumer only needs to run after a notification,
+ *   plus every UI_TASK_INPUT_POLL_MS while needsPolling() is true
+ * - Gesture timing is taken from the ring timestamps, not from the update rate
  */
 
 namespace CloudMouse::Hardware
@@ -125,16 +142,68 @@ namespace CloudMouse::Hardware
          * Must be called regularly (10-20ms intervals) for responsive input handling
          *
          * Processing Steps:
-         * 1. Read current encoder position from PCNT hardware
-         * 2. Calculate movement delta and accumulate for consumption
-         * 3. Sample button state and detect press/release transitions
-         * 4. Analyze press duration and set appropriate event flags
-         * 5. Handle ongoing press feedback (buzzer, ultra-long detection)
+         * 1. Drain the input ring in arrival order
+         * 2. Detent records: accumulate movement, detect press-and-rotate
+         * 3. Button records: debounce, classify press duration from edge timestamps
+         * 4. Handle ongoing press feedback (long/ultra-long thresholds) and the
+         *    double-click window against the current time
          *
-         * @note Call frequency affects responsiveness - 50-100Hz recommended
+         * @note Safe to call at any rate; input between calls is not lost
          */
         void update();
 
+        /**
+         * Register a task to wake on encoder activity
+         * The detent and button interrupts give this task a notification after
+         * queuing their record, so the consumer can block instead of polling.
+         *
+         * @param task Task to notify (typically the UI task), nullptr for none
+         */
+        void setWakeTask(TaskHandle_t task);
+
+        /**
+         * Check if time-based gesture detection is in progress
+         * While the button is held (long/ultra-long press thresholds) or a
+         * double-click window is open, update() must keep being called even
+         * without new interrupts.
+         *
+         * @return true if the consumer should poll at UI_TASK_INPUT_POLL_MS
+         */
+        bool needsPolling() const;
+
+        /**
+         * Consume all pending input into one snapshot
+         * Equivalent to calling every get*() method once (plus the press time
+         * and velocity), so callers send a single ENCODER_INPUT event per cycle.
+         *
+         * @param snapshot Filled with this cycle's input (timestamp = now)
+         * @return true if there is anything to report (rotation, gesture, button
+         *         press edge); a hold with nothing new is not reported again
+         */
+        bool takeSnapshot(InputSnapshot &snapshot);
+
+        // ========================================================================
+        // VELOCITY AND ACCELERATION
+        // ========================================================================
+
+        /**
+         * Rotation velocity over the last ENCODER_VELOCITY_WINDOW_MS
+         *
+         * @return Detents per second, positive = clockwise, 0 when idle
+         */
+        int getVelocity() const;
+
+        /**
+         * Configure the acceleration curve applied to rotation steps
+         * Below startDps each detent is one step; the multiplier rises linearly
+         * to maxMultiplier at fullDps and stays there.
+         *
+         * @param startDps Velocity where acceleration begins (detents/s)
+         * @param fullDps Velocity of the full multiplier, must be above startDps
+         * @param maxMultiplier Steps per detent at full speed, 1 = acceleration off
+         */
+        void setAcceleration(uint16_t startDps, uint16_t fullDps, uint8_t maxMultiplier);
+
         // ========================================================================
         // EVENT CONSUMPTION INTERFACE (Auto-Reset After Reading)
         // ========================================================================
@@ -221,7 +290,7 @@ namespace CloudMouse::Hardware
          * Check if button is currently pressed down
          * Real-time status query that does not affect event flags
          *
-         * @return true if button is currently pressed (SW pin LOW), false if released
+         * @return true if button is pressed (debounced state from the edge interrupt)
          *
          * Usage Examples:
          * - Visual feedback: if (isButtonDown()) highlightButton();
@@ -311,20 +380,71 @@ namespace CloudMouse::Hardware
 
         RotaryEncoderPCNT encoder; // PCNT-based encoder hardware interface
 
+        volatile TaskHandle_t wakeTask = nullptr; // Task notified from the input interrupts
+
+        // ========================================================================
+        // ISR INPUT RING
+        // ========================================================================
+
+        enum InputKind : uint8_t
+        {
+            INPUT_DETENT, // value: +1 / -1
+            INPUT_BUTTON  // value: pin level after the edge (LOW = pressed)
+        };
+
+        struct InputRecord
+        {
+            uint32_t timeUs; // esp_timer time of the interrupt (wraps after ~71 min)
+            uint8_t kind;
+            int8_t value;
+        };
+
+        InputRecord ring[ENCODER_INPUT_RING_SIZE];
+        volatile uint8_t ringHead = 0;  // Next record to read (UI task)
+        volatile uint8_t ringCount = 0;
+        uint32_t ringOverflows = 0;     // Records dropped because the ring was full
+        uint32_t pendingInputUs = 0;    // Oldest record replayed since the last snapshot
+        bool inputPending = false;
+        bool snapshotButtonDown = false; // Last returned snapshot had BUTTON_DOWN
+        portMUX_TYPE ringLock = portMUX_INITIALIZER_UNLOCKED;
+
+        void IRAM_ATTR pushFromISR(uint8_t kind, int8_t value);
+        bool popRecord(InputRecord &record);
+
+        static void IRAM_ATTR detentISR(int8_t direction, void *arg);
+        static void IRAM_ATTR buttonISR(void *arg);
+
         // ========================================================================
         // ENCODER STATE MANAGEMENT
         // ========================================================================
 
-        int lastValue = 0;            // Last read encoder position
         int movement = 0;             // Accumulated movement since last consumption
+        int steps = 0;                // movement after the acceleration curve
         bool movementPending = false; // Flag indicating movement available for consumption
 
+        // Timestamped detents for velocity (ring, newest at velocityHead - 1)
+        struct DetentSample
+        {
+            uint32_t timeUs;
+            int8_t direction;
+        };
+
+        DetentSample velocitySamples[ENCODER_VELOCITY_SAMPLES];
+        uint8_t velocityHead = 0;
+        uint8_t velocityCount = 0;
+
+        uint16_t accelStartDps = ENCODER_ACCEL_START_DPS;
+        uint16_t accelFullDps = ENCODER_ACCEL_FULL_DPS;
+        uint8_t accelMaxMultiplier = ENCODER_ACCEL_MAX_MULTIPLIER;
+
         // ========================================================================
         // BUTTON STATE MANAGEMENT
         // ========================================================================
 
-        bool lastButtonState = HIGH;      // Previous button state (HIGH = released)
-        unsigned long pressStartTime = 0; // Timestamp when current press began
+        bool buttonPressed = false;       // Debounced button state
+        uint32_t pressStartUs = 0;        // Edge timestamp when current press began
+        uint32_t lastTransitionUs = 0;    // Edge timestamp of the last accepted transition
+        uint32_t lastEdgeUs = 0;          // Edge timestamp of the last button record
         int lastPressDuration = 0;        // Duration of most recent completed press
 
         // Event flags for consumption-based interface
@@ -339,7 +459,7 @@ namespace CloudMouse::Hardware
         bool ultraLongPressNotified = false; // Prevents multiple ultra-long press events
 
         // Double click detection
-        unsigned long lastClickTime = 0;     // Timestamp when a click occured
+        uint32_t lastClickUs = 0;            // Release timestamp of the pending click
         bool waitingForDoubleClick = false;  // Flag to check if a click occurs in a double click time window
         
         // Press and rotate detection
@@ -359,18 +479,43 @@ namespace CloudMouse::Hardware
         // ========================================================================
 
         /**
-         * Process encoder rotation and accumulate movement
-         * Reads PCNT position, calculates delta, and updates movement accumulator
-         * Called internally by update() method
+         * Apply one detent record: accumulate movement, detect press-and-rotate
+         */
+        void processDetent(int8_t direction, uint32_t timeUs);
+
+        /**
+         * Signed detents per second in the window ending at nowUs
+         */
+        int velocityAt(uint32_t nowUs) const;
+
+        /**
+         * Steps per detent at the given speed (acceleration curve)
+         */
+        int accelerationMultiplier(int speedDps) const;
+
+        /**
+         * Apply one button edge record
+         * Edges within ENCODER_BUTTON_DEBOUNCE_US of the last accepted transition
+         * are bounce; a real transition hidden that way is recovered by
+         * resyncButton() once the pin has been stable long enough.
+         */
+        void processButtonEdge(bool pressed, uint32_t timeUs);
+
+        /**
+         * Press/release transition at an edge timestamp
+         */
+        void onPress(uint32_t timeUs);
+        void onRelease(uint32_t timeUs);
+
+        /**
+         * Reconcile the debounced state with the pin after the debounce window
          */
-        void processEncoder();
+        void resyncButton(uint32_t nowUs);
 
         /**
-         * Process button state changes and detect press events
-         * Handles press/release detection, timing analysis, and event flag setting
-         * Called internally by update() method
+         * Time-based checks: long/ultra-long thresholds, double-click timeout
          */
-        void processButton();
+        void processTimers(uint32_t nowUs);
 
         /**
          * Get current press duration for ongoing press
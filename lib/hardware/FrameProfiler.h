@@ -0,0 +1,196 @@
+/**
+ * CloudMouse SDK - LVGL Frame Profiler
+ *
+ * Per-frame breakdown of where DisplayManager spends its time, fed by the LVGL
+ * display events and the flush callbacks.
+ *
+ * Recorded per frame:
+ * - Invalidated areas reported by LVGL since the previous frame
+ * - Pixels rendered and flushed
+ * - Render time (refresh cycle minus blocking flush time)
+ * - Flush time (CPU time spent pushing stripes or waiting for the SPI DMA)
+ * - Total refresh cycle time
+ *
+ * Recorded per update():
+ * - Event drain time (EventBus receive + processEvent), when events were drained
+ *
+ * All metrics keep a rolling window of the last PROFILER_WINDOW samples and
+ * expose min/avg/p99 through print() (serial) and formatOverlay() (on-screen).
+ * The worst frame of the window is kept with its largest invalidated area to
+ * point at the widget causing expensive redraws.
+ *
+ * Thread Safety:
+ * - UI task only (LVGL callbacks and DisplayManager::update())
+ */
+
+#ifndef FRAME_PROFILER_H
+#define FRAME_PROFILER_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include "../utils/RollingStats.h"
+#include "../utils/Logger.h"
+
+namespace CloudMouse::Hardware
+{
+    using CloudMouse::Utils::RollingStats;
+
+    class FrameProfiler
+    {
+    public:
+        static const size_t PROFILER_WINDOW = 128;
+
+        // ========================================================================
+        // FEEDING INTERFACE (called from LVGL callbacks)
+        // ========================================================================
+
+        /**
+         * Record an invalidated area (LV_EVENT_INVALIDATE_AREA)
+         * Areas accumulate until the next rendered frame.
+         */
+        void onInvalidate(const lv_area_t *area)
+        {
+            pendingAreas++;
+            if (!area)
+                return;
+
+            uint32_t size = lv_area_get_size(area);
+            if (size > pendingLargestSize)
+            {
+                pendingLargestSize = size;
+                lv_area_copy(&pendingLargestArea, area);
+            }
+        }
+
+        /**
+         * Record a completed frame (LV_EVENT_REFR_READY with pixels flushed)
+         *
+         * @param frameUs Whole refresh cycle duration
+         * @param flushUs Blocking flush time within the cycle
+         * @param pixels Pixels rendered and flushed
+         */
+        void onFrame(uint32_t frameUs, uint32_t flushUs, uint32_t pixels)
+        {
+            uint32_t renderUs = frameUs > flushUs ? frameUs - flushUs : 0;
+
+            areas.add(pendingAreas);
+            this->pixels.add(pixels);
+            render.add(renderUs);
+            flush.add(flushUs);
+            frame.add(frameUs);
+            frames++;
+
+            if (frameUs >= worstFrameUs)
+            {
+                worstFrameUs = frameUs;
+                worstFramePixels = pixels;
+                worstFrameAreas = pendingAreas;
+                lv_area_copy(&worstFrameArea, &pendingLargestArea);
+            }
+
+            pendingAreas = 0;
+            pendingLargestSize = 0;
+        }
+
+        /**
+         * Invalidated areas collected since the last rendered frame
+         */
+        uint32_t getPendingAreas() const { return pendingAreas; }
+
+        /**
+         * Record the duration of an event drain in DisplayManager::update()
+         */
+        void onEventDrain(uint32_t drainUs, uint32_t eventCount)
+        {
+            if (eventCount == 0)
+                return;
+            drain.add(drainUs);
+        }
+
+        // ========================================================================
+        // REPORTING INTERFACE
+        // ========================================================================
+
+        uint32_t getFrameCount() const { return frames; }
+
+        /**
+         * Print rolling statistics over serial
+         */
+        void print() const
+        {
+            SDK_LOGGER("\n📊 Frame Profiler (last %d samples, %lu frames total):", (int)PROFILER_WINDOW, (unsigned long)frames);
+            SDK_LOGGER("   %-12s %10s %10s %10s", "metric", "min", "avg", "p99");
+            printRow("areas", areas);
+            printRow("pixels", pixels);
+            printRow("render us", render);
+            printRow("flush us", flush);
+            printRow("frame us", frame);
+            printRow("drain us", drain);
+
+            if (worstFrameUs > 0)
+            {
+                SDK_LOGGER("   Worst frame: %lu us, %lu px, %lu areas, largest area (%d,%d)-(%d,%d)\n",
+                           (unsigned long)worstFrameUs, (unsigned long)worstFramePixels, (unsigned long)worstFrameAreas,
+                           (int)worstFrameArea.x1, (int)worstFrameArea.y1, (int)worstFrameArea.x2, (int)worstFrameArea.y2);
+            }
+        }
+
+        /**
+         * Format a compact summary for the performance overlay
+         *
+         * @param buffer Destination buffer
+         * @param size Destination buffer size
+         * @param fps Frames rendered during the last second
+         */
+        void formatOverlay(char *buffer, size_t size, uint32_t fps) const
+        {
+            snprintf(buffer, size, "FPS %lu  px %lu\nR %lu/%lu us  F %lu/%lu us",
+                     (unsigned long)fps, (unsigned long)pixels.avg(),
+                     (unsigned long)render.avg(), (unsigned long)render.percentile(99),
+                     (unsigned long)flush.avg(), (unsigned long)flush.percentile(99));
+        }
+
+        /**
+         * Clear all windows and the worst-frame record
+         */
+        void reset()
+        {
+            areas.reset();
+            pixels.reset();
+            render.reset();
+            flush.reset();
+            frame.reset();
+            drain.reset();
+            worstFrameUs = 0;
+        }
+
+    private:
+        RollingStats<PROFILER_WINDOW> areas;
+        RollingStats<PROFILER_WINDOW> pixels;
+        RollingStats<PROFILER_WINDOW> render;
+        RollingStats<PROFILER_WINDOW> flush;
+        RollingStats<PROFILER_WINDOW> frame;
+        RollingStats<PROFILER_WINDOW> drain;
+
+        uint32_t frames = 0;
+
+        // Invalidations collected since the last rendered frame
+        uint32_t pendingAreas = 0;
+        uint32_t pendingLargestSize = 0;
+        lv_area_t pendingLargestArea = {0, 0, 0, 0};
+
+        // Most expensive frame since the last reset
+        uint32_t worstFrameUs = 0;
+        uint32_t worstFramePixels = 0;
+        uint32_t worstFrameAreas = 0;
+        lv_area_t worstFrameArea = {0, 0, 0, 0};
+
+        static void printRow(const char *name, const RollingStats<PROFILER_WINDOW> &stats)
+        {
+            SDK_LOGGER("   %-12s %10lu %10lu %10lu", name,
+                       (unsigned long)stats.min(), (unsigned long)stats.avg(), (unsigned long)stats.percentile(99));
+        }
+    };
+}
+
+#endif
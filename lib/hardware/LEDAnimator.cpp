@@ -0,0 +1,347 @@
+/**
+ * CloudMouse SDK - LED Keyframe Animation Engine Implementation
+ *
+ * The LUTs are built once with floating point; everything evaluated per
+ * frame is integer math on 8-bit values.
+ */
+
+#include "./LEDAnimator.h"
+#include <math.h>
+#include <string.h>
+
+namespace CloudMouse::Hardware
+{
+    uint8_t LEDAnimator::easingLut[(int)LEDEasing::COUNT][256];
+    uint8_t LEDAnimator::gammaLut[256];
+    bool LEDAnimator::tablesReady = false;
+
+    LEDAnimator::LEDAnimator()
+    {
+        memset(layers, 0, sizeof(layers));
+        for (int i = 0; i < LED_LAYER_COUNT; i++)
+            layers[i].opacity = 255;
+
+        if (!tablesReady)
+            buildTables();
+    }
+
+    void LEDAnimator::buildTables()
+    {
+        const float gamma = LED_GAMMA_X10 / 10.0f;
+
+        for (int i = 0; i < 256; i++)
+        {
+            float x = i / 255.0f;
+            easingLut[(int)LEDEasing::LINEAR][i] = (uint8_t)i;
+            easingLut[(int)LEDEasing::EASE_IN][i] = (uint8_t)lroundf(x * x * 255.0f);
+            easingLut[(int)LEDEasing::EASE_OUT][i] = (uint8_t)lroundf((1.0f - (1.0f - x) * (1.0f - x)) * 255.0f);
+            easingLut[(int)LEDEasing::EASE_IN_OUT][i] = (uint8_t)lroundf(x * x * (3.0f - 2.0f * x) * 255.0f);
+            easingLut[(int)LEDEasing::STEP][i] = 0;
+
+            // Non-zero input never rounds to off
+            long level = lroundf(powf(x, gamma) * 255.0f);
+            gammaLut[i] = (uint8_t)(i > 0 && level == 0 ? 1 : level);
+        }
+
+        tablesReady = true;
+    }
+
+    // ============================================================================
+    // LAYER CONTROL
+    // ============================================================================
+
+    void LEDAnimator::copyTrack(Track &track, const LEDKeyframe *frames, uint8_t count)
+    {
+        if (count > LED_TRACK_MAX_KEYFRAMES)
+            count = LED_TRACK_MAX_KEYFRAMES;
+        track.count = frames ? count : 0;
+        if (track.count)
+            memcpy(track.frames, frames, sizeof(LEDKeyframe) * track.count);
+    }
+
+    void LEDAnimator::play(uint8_t index, const LEDEffect &effect, uint8_t r, uint8_t g, uint8_t b, uint32_t nowMs)
+    {
+        if (index >= LED_LAYER_COUNT)
+            return;
+
+        Layer &layer = layers[index];
+        layer.pattern = effect.pattern;
+        layer.r = r;
+        layer.g = g;
+        layer.b = b;
+        layer.loop = effect.loop;
+        layer.loopFromMs = effect.loopFromMs;
+        layer.end = effect.end;
+        layer.startMs = nowMs;
+        copyTrack(layer.brightness, effect.brightness, effect.brightnessCount);
+        copyTrack(layer.param, effect.param, effect.paramCount);
+        layer.active = true;
+    }
+
+    void LEDAnimator::stop(uint8_t index)
+    {
+        if (index < LED_LAYER_COUNT)
+            layers[index].active = false;
+    }
+
+    void LEDAnimator::setColor(uint8_t index, uint8_t r, uint8_t g, uint8_t b)
+    {
+        if (index >= LED_LAYER_COUNT)
+            return;
+        layers[index].r = r;
+        layers[index].g = g;
+        layers[index].b = b;
+    }
+
+    void LEDAnimator::setOpacity(uint8_t index, uint8_t opacity)
+    {
+        if (index < LED_LAYER_COUNT)
+            layers[index].opacity = opacity;
+    }
+
+    bool LEDAnimator::isActive(uint8_t index) const
+    {
+        return index < LED_LAYER_COUNT && layers[index].active;
+    }
+
+    uint8_t LEDAnimator::getBrightness(uint8_t index, uint32_t nowMs) const
+    {
+        if (!isActive(index))
+            return 0;
+
+        bool finished = false;
+        uint32_t untilChange = 0;
+        uint32_t t = effectTime(layers[index], nowMs, finished);
+        return evaluate(layers[index].brightness, 255, t, untilChange);
+    }
+
+    // ============================================================================
+    // TRACK EVALUATION
+    // ============================================================================
+
+    uint16_t LEDAnimator::effectLength(const Layer &layer) const
+    {
+        uint16_t length = 0;
+        if (layer.brightness.count)
+            length = layer.brightness.frames[layer.brightness.count - 1].timeMs;
+        if (layer.param.count && layer.param.frames[layer.param.count - 1].timeMs > length)
+            length = layer.param.frames[layer.param.count - 1].timeMs;
+        return length;
+    }
+
+    uint32_t LEDAnimator::effectTime(const Layer &layer, uint32_t nowMs, bool &finished) const
+    {
+        uint32_t elapsed = nowMs - layer.startMs;
+        uint32_t length = effectLength(layer);
+        finished = false;
+
+        if (elapsed < length)
+            return elapsed;
+
+        if (layer.loop && length > layer.loopFromMs)
+            return layer.loopFromMs + (elapsed - layer.loopFromMs) % (length - layer.loopFromMs);
+
+        finished = !layer.loop;
+        return length;
+    }
+
+    uint8_t LEDAnimator::evaluate(const Track &track, uint8_t fallback, uint32_t t, uint32_t &untilChangeMs)
+    {
+        if (track.count == 0)
+        {
+            untilChangeMs = NO_DEADLINE;
+            return fallback;
+        }
+
+        const LEDKeyframe *frames = track.frames;
+        if (t < frames[0].timeMs)
+        {
+            untilChangeMs = frames[0].timeMs - t;
+            return frames[0].value;
+        }
+
+        for (uint8_t i = 1; i < track.count; i++)
+        {
+            if (t >= frames[i].timeMs)
+                continue;
+
+            const LEDKeyframe &from = frames[i - 1];
+            const LEDKeyframe &to = frames[i];
+            uint32_t duration = to.timeMs - from.timeMs;
+            uint32_t remaining = to.timeMs - t;
+            int delta = (int)to.value - (int)from.value;
+
+            if (delta == 0 || to.easing == LEDEasing::STEP)
+            {
+                untilChangeMs = remaining;
+                return from.value;
+            }
+
+            uint32_t progress = ((t - from.timeMs) << 8) / duration; // 0..255
+            int eased = easingLut[(int)to.easing][progress];
+
+            // One output step takes duration / |delta| on average
+            uint32_t step = duration / (uint32_t)(delta < 0 ? -delta : delta);
+            untilChangeMs = step == 0 ? 1 : (step < remaining ? step : remaining);
+
+            return (uint8_t)(from.value + (delta * eased) / 255);
+        }
+
+        untilChangeMs = NO_DEADLINE;
+        return frames[track.count - 1].value;
+    }
+
+    // ============================================================================
+    // COMPOSITING
+    // ============================================================================
+
+    void LEDAnimator::wheel(uint8_t position, uint8_t &r, uint8_t &g, uint8_t &b)
+    {
+        position = 255 - position;
+        if (position < 85)
+        {
+            r = 255 - position * 3;
+            g = 0;
+            b = position * 3;
+        }
+        else if (position < 170)
+        {
+            position -= 85;
+            r = 0;
+            g = position * 3;
+            b = 255 - position * 3;
+        }
+        else
+        {
+            position -= 170;
+            r = position * 3;
+            g = 255 - position * 3;
+            b = 0;
+        }
+    }
+
+    void LEDAnimator::render(uint32_t nowMs, NeoPixelRMT &strip)
+    {
+        uint16_t level[LED_LAYER_COUNT]; // Gamma-corrected brightness + 1 (scale factor)
+        uint8_t param[LED_LAYER_COUNT];
+
+        for (int l = 0; l < LED_LAYER_COUNT; l++)
+        {
+            Layer &layer = layers[l];
+            if (!layer.active)
+                continue;
+
+            bool finished = false;
+            uint32_t untilChange = 0;
+            uint32_t t = effectTime(layer, nowMs, finished);
+            if (finished && layer.end == LEDTrackEnd::REMOVE)
+            {
+                layer.active = false;
+                continue;
+            }
+
+            level[l] = (uint16_t)gammaLut[evaluate(layer.brightness, 255, t, untilChange)] + 1;
+            param[l] = evaluate(layer.param, 0, t, untilChange);
+        }
+
+        // Layers under the topmost opaque one are not visible
+        int bottom = 0;
+        for (int l = LED_LAYER_COUNT - 1; l > 0; l--)
+        {
+            if (layers[l].active && layers[l].opacity == 255)
+            {
+                bottom = l;
+                break;
+            }
+        }
+
+        uint16_t pixelCount = strip.numPixels();
+        for (uint16_t i = 0; i < pixelCount; i++)
+        {
+            int r = 0, g = 0, b = 0;
+
+            for (int l = bottom; l < LED_LAYER_COUNT; l++)
+            {
+                const Layer &layer = layers[l];
+                if (!layer.active)
+                    continue;
+
+                uint8_t lr = layer.r, lg = layer.g, lb = layer.b;
+                switch (layer.pattern)
+                {
+                case LEDPattern::RAINBOW:
+                    wheel((uint8_t)((i * 256 / pixelCount) + param[l]), lr, lg, lb);
+                    break;
+
+                case LEDPattern::CURSOR:
+                    if (param[l] < pixelCount && param[l] != i)
+                        lr = lg = lb = 0;
+                    break;
+
+                default:
+                    break;
+                }
+
+                int sr = (lr * level[l]) >> 8;
+                int sg = (lg * level[l]) >> 8;
+                int sb = (lb * level[l]) >> 8;
+
+                // Blend over the layers below
+                r += ((sr - r) * (layer.opacity + 1)) >> 8;
+                g += ((sg - g) * (layer.opacity + 1)) >> 8;
+                b += ((sb - b) * (layer.opacity + 1)) >> 8;
+            }
+
+            strip.setPixelColor(i, (uint8_t)r, (uint8_t)g, (uint8_t)b);
+        }
+    }
+
+    // ============================================================================
+    // SCHEDULING
+    // ============================================================================
+
+    uint32_t LEDAnimator::nextDeadlineMs(uint32_t nowMs) const
+    {
+        uint32_t deadline = NO_DEADLINE;
+
+        // Top down: changes under an opaque layer are not visible
+        for (int l = LED_LAYER_COUNT - 1; l >= 0; l--)
+        {
+            const Layer &layer = layers[l];
+            if (!layer.active)
+                continue;
+
+            bool finished = false;
+            uint32_t t = effectTime(layer, nowMs, finished);
+            if (finished)
+            {
+                // REMOVE takes effect in the next render
+                if (layer.end == LEDTrackEnd::REMOVE)
+                    deadline = 0;
+                continue;
+            }
+
+            uint32_t untilBrightness = NO_DEADLINE;
+            uint32_t untilParam = NO_DEADLINE;
+            evaluate(layer.brightness, 255, t, untilBrightness);
+            evaluate(layer.param, 0, t, untilParam);
+
+            uint32_t untilLayer = untilBrightness < untilParam ? untilBrightness : untilParam;
+
+            // Loop wrap or effect end (REMOVE) is a change as well
+            uint32_t length = effectLength(layer);
+            if ((layer.loop || layer.end == LEDTrackEnd::REMOVE) && length > t && length - t < untilLayer)
+                untilLayer = length - t;
+
+            if (untilLayer < deadline)
+                deadline = untilLayer;
+
+            if (layer.opacity == 255)
+                break;
+        }
+
+        if (deadline != NO_DEADLINE && deadline < LED_FRAME_MS)
+            deadline = deadline == 0 ? 0 : LED_FRAME_MS;
+        return deadline;
+    }
+}
@@ -0,0 +1,166 @@
+/**
+ * CloudMouse SDK - LED Keyframe Animation Engine
+ *
+ * Compositing engine behind LEDManager. Effects are data: each layer plays
+ * two keyframe tracks, brightness and a pattern parameter (rainbow hue offset
+ * or cursor position), and the layers are blended bottom to top by opacity.
+ *
+ * Evaluation:
+ * - Fixed point only: segment progress is 0..255, shaped by a precomputed
+ *   easing LUT, and the final brightness goes through a gamma LUT, so keyframe
+ *   brightness values are perceptual
+ * - Tracks can loop from loopFromMs to their last keyframe, or hold the last
+ *   value / remove the layer when they end
+ *
+ * Scheduling:
+ * - nextDeadlineMs() reports how long the output stays unchanged: the time
+ *   until the next keyframe on holds, the time for one brightness step on
+ *   slow fades (at least LED_FRAME_MS), NO_DEADLINE when everything is static
+ * - Layers below the topmost opaque layer are neither composited nor
+ *   scheduled, so a hidden pulse does not keep the task awake
+ * - LEDManager sleeps on its event queue for exactly that long
+ *
+ * Thread Safety:
+ * - Not synchronized: owned by the LED animation task
+ */
+
+#ifndef LED_ANIMATOR_H
+#define LED_ANIMATOR_H
+
+#include <Arduino.h>
+#include "../config/DeviceConfig.h"
+#include "./NeoPixelRMT.h"
+
+namespace CloudMouse::Hardware
+{
+    enum class LEDEasing : uint8_t
+    {
+        LINEAR,
+        EASE_IN,      // Quadratic
+        EASE_OUT,     // Quadratic
+        EASE_IN_OUT,  // Smoothstep
+        STEP,         // Jump at the end of the segment
+        COUNT
+    };
+
+    enum class LEDPattern : uint8_t
+    {
+        SOLID,    // Layer color on every pixel
+        RAINBOW,  // Color wheel across the ring, param = hue offset
+        CURSOR    // Layer color on pixel 'param', others off; param >= pixel count lights all
+    };
+
+    enum class LEDTrackEnd : uint8_t
+    {
+        HOLD,     // Keep the last keyframe value
+        REMOVE    // Deactivate the layer
+    };
+
+    /**
+     * Keyframe: value reached at timeMs (from the effect start), easing applies
+     * to the segment that ends at this keyframe
+     */
+    struct LEDKeyframe
+    {
+        uint16_t timeMs;
+        uint8_t value;
+        LEDEasing easing;
+    };
+
+    /**
+     * Effect description, usually a static const table
+     * Empty tracks mean brightness 255 and param 0.
+     */
+    struct LEDEffect
+    {
+        LEDPattern pattern;
+        const LEDKeyframe *brightness;
+        uint8_t brightnessCount;
+        const LEDKeyframe *param;
+        uint8_t paramCount;
+        bool loop;              // Loop both tracks from loopFromMs to their last keyframe
+        uint16_t loopFromMs;
+        LEDTrackEnd end;        // Without loop: what happens after the last keyframe
+    };
+
+    class LEDAnimator
+    {
+    public:
+        static const uint32_t NO_DEADLINE = 0xFFFFFFFFu;
+
+        LEDAnimator();
+
+        /**
+         * Start an effect on a layer, replacing what it played
+         * Keyframes are copied, so effects may be built on the stack.
+         */
+        void play(uint8_t layer, const LEDEffect &effect, uint8_t r, uint8_t g, uint8_t b, uint32_t nowMs);
+        void stop(uint8_t layer);
+        void setColor(uint8_t layer, uint8_t r, uint8_t g, uint8_t b);
+        void setOpacity(uint8_t layer, uint8_t opacity);
+
+        bool isActive(uint8_t layer) const;
+
+        /**
+         * Current brightness track value of a layer (perceptual, before gamma)
+         * Used as the start keyframe when an effect continues from the current look.
+         */
+        uint8_t getBrightness(uint8_t layer, uint32_t nowMs) const;
+
+        /**
+         * Composite all layers into the strip back buffer
+         * Layers whose REMOVE track ended are deactivated here.
+         */
+        void render(uint32_t nowMs, NeoPixelRMT &strip);
+
+        /**
+         * Milliseconds until the rendered output can change, NO_DEADLINE if static
+         */
+        uint32_t nextDeadlineMs(uint32_t nowMs) const;
+
+    private:
+        struct Track
+        {
+            LEDKeyframe frames[LED_TRACK_MAX_KEYFRAMES];
+            uint8_t count;
+        };
+
+        struct Layer
+        {
+            bool active;
+            LEDPattern pattern;
+            uint8_t r, g, b;
+            uint8_t opacity;
+            bool loop;
+            uint16_t loopFromMs;
+            LEDTrackEnd end;
+            uint32_t startMs;
+            Track brightness;
+            Track param;
+        };
+
+        Layer layers[LED_LAYER_COUNT];
+
+        static uint8_t easingLut[(int)LEDEasing::COUNT][256];
+        static uint8_t gammaLut[256];
+        static bool tablesReady;
+        static void buildTables();
+
+        static void copyTrack(Track &track, const LEDKeyframe *frames, uint8_t count);
+
+        /**
+         * Track time after looping; sets finished once a non-looping effect is past its end
+         */
+        uint32_t effectTime(const Layer &layer, uint32_t nowMs, bool &finished) const;
+        uint16_t effectLength(const Layer &layer) const;
+
+        /**
+         * Value at t (ms), and the time until it next changes
+         */
+        static uint8_t evaluate(const Track &track, uint8_t fallback, uint32_t t, uint32_t &untilChangeMs);
+
+        static void wheel(uint8_t position, uint8_t &r, uint8_t &g, uint8_t &b);
+    };
+}
+
+#endif
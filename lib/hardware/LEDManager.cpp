@@ -3,6 +3,10 @@
  *
  * Implementation of the LED animation system with thread-safe event handling
  * and smooth animation effects for the NeoPixel LED ring.
+ *
+ * Brightness keyframes are perceptual (LED_GAMMA_X10 is applied on output):
+ * the idle pulse 58..167 and resume level 228 match the former raw
+ * strip brightness 10..100 and 200.
  */
 
 #include "./LEDManager.h"
@@ -14,39 +18,99 @@ namespace CloudMouse::Hardware
 
     using CloudMouse::Prefs::PreferencesManager;
 
+    // ============================================================================
+    // EFFECT TABLES
+    // ============================================================================
+
+    static const uint8_t LED_LEVEL_ACTIVE = 255;
+    static const uint8_t LED_LEVEL_RESUME = 228;
+    static const uint8_t LED_LEVEL_PULSE_LOW = 58;
+    static const uint8_t LED_LEVEL_PULSE_HIGH = 167;
+    static const uint16_t LED_IDLE_FADE_MS = 1000;
+    static const uint16_t LED_PULSE_UP_MS = 1500;
+    static const uint16_t LED_PULSE_DOWN_MS = 2000;
+
+    // Boot: cursor sweep out and back, blackout, flash up, slow fade; ends at 4 s
+    static const LEDKeyframe LED_INIT_CURSOR[] = {
+        {0, 0, LEDEasing::LINEAR},
+        {840, NUM_LEDS - 1, LEDEasing::LINEAR},
+        {1610, 0, LEDEasing::LINEAR},
+        {1610, 255, LEDEasing::STEP}, // All pixels from here on
+    };
+    static const LEDKeyframe LED_INIT_BRIGHTNESS[] = {
+        {0, 253, LEDEasing::LINEAR},
+        {1610, 253, LEDEasing::LINEAR},
+        {1610, 0, LEDEasing::STEP},
+        {2110, 0, LEDEasing::LINEAR},
+        {2260, 255, LEDEasing::LINEAR},
+        {4000, 0, LEDEasing::EASE_OUT},
+    };
+    static const LEDEffect LED_INIT_EFFECT = {
+        LEDPattern::CURSOR,
+        LED_INIT_BRIGHTNESS, sizeof(LED_INIT_BRIGHTNESS) / sizeof(LEDKeyframe),
+        LED_INIT_CURSOR, sizeof(LED_INIT_CURSOR) / sizeof(LEDKeyframe),
+        false, 0, LEDTrackEnd::REMOVE};
+
+    static const LEDKeyframe LED_LOADING_BRIGHTNESS[] = {
+        {0, 252, LEDEasing::LINEAR},
+        {400, 20, LEDEasing::EASE_IN_OUT},
+        {800, 252, LEDEasing::EASE_IN_OUT},
+    };
+    static const LEDEffect LED_LOADING_EFFECT = {
+        LEDPattern::SOLID,
+        LED_LOADING_BRIGHTNESS, sizeof(LED_LOADING_BRIGHTNESS) / sizeof(LEDKeyframe),
+        nullptr, 0,
+        true, 0, LEDTrackEnd::HOLD};
+
     // ============================================================================
     // SYSTEM INITIALIZATION
     // ============================================================================
 
-    LEDManager::LEDManager() : strip(NUM_LEDS, DATA_PIN, NEO_GRB + NEO_KHZ800)
+    LEDManager::LEDManager() : strip(NUM_LEDS, DATA_PIN)
     {
-        // Initialize NeoPixel strip configuration
+        // RMT channel and frame buffers are allocated in init()
     }
 
     void LEDManager::init()
     {
         SDK_LOGGER("💡 Initializing LEDManager...");
 
-        // Initialize NeoPixel hardware
-        strip.begin();
-        strip.setBrightness(currentBrightness);
-        resetAllLEDs();
+        // Initialize NeoPixel RMT output
+        if (!strip.begin())
+        {
+            SDK_LOGGER("❌ LED output unavailable");
+        }
+        strip.clear();
         strip.show();
 
         // Create event queue for thread-safe communication
-        ledEventQueue = xQueueCreate(LED_QUEUE_SIZE, sizeof(LEDEvent));
+        ledEventQueue = ledEventQueueStorage.create("led.queue");
         if (!ledEventQueue)
         {
             SDK_LOGGER("❌ Failed to create LED event queue!");
             return;
         }
 
+        // Boot sweep above the idle pulse; the task only starts rendering later
+        uint32_t now = millis();
+        playBase(LED_LEVEL_PULSE_LOW, 0, 0, now);
+        animator.play(LAYER_INIT, LED_INIT_EFFECT, red, green, blue, now);
+
         // Load user's preferred color theme
         setMainColor();
 
         SDK_LOGGER("✅ LEDManager initialized successfully");
     }
 
+    uint32_t LEDManager::measureShow()
+    {
+        uint32_t start = micros();
+        strip.show(true);
+        uint32_t elapsed = micros() - start;
+        strip.waitDone();
+        return elapsed;
+    }
+
     void LEDManager::startAnimationTask()
     {
         if (animationTaskHandle)
@@ -55,16 +119,13 @@ namespace CloudMouse::Hardware
             return;
         }
 
-        // Create animation task with priority 2 on Core 1
-        xTaskCreatePinnedToCore(
+        // Create animation task with priority 2 (below UI task) on Core 1
+        animationTaskHandle = animationTaskStorage.create(
             animationTaskFunction,
             "LED_Animation",
-            8192, // Stack size
             this, // Pass instance
-            2,    // Priority 2 (below UI task)
-            &animationTaskHandle,
-            1 // Core 1
-        );
+            2,
+            1);
 
         if (animationTaskHandle)
         {
@@ -98,372 +159,179 @@ namespace CloudMouse::Hardware
 
     void LEDManager::animationLoop()
     {
-        TickType_t lastWake = xTaskGetTickCount();
-        uint32_t loopCounter = 0;
+        uint32_t frameCounter = 0;
 
         SDK_LOGGER("💡 LED Animation loop started");
 
         while (true)
         {
-            loopCounter++;
-
-            // Health monitoring every 1000 loops
-            if (loopCounter % 1000 == 0)
-            {
-                SDK_LOGGER("💡 LED Task alive - loops: %d, free stack: %d\n",
-                              loopCounter, uxTaskGetStackHighWaterMark(NULL));
-            }
-
-            // Process incoming events from other tasks
-            processLEDEvents();
+            uint32_t now = millis();
 
-            // Update animation state machine
-            updateAnimations();
-
-            // 50Hz update rate (20ms intervals)
-            vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(20));
-        }
-    }
-
-    // ============================================================================
-    // EVENT PROCESSING SYSTEM
-    // ============================================================================
-
-    void LEDManager::processLEDEvents()
-    {
-        LEDEvent event;
+            // One frame per wakeup, sent only if it changed
+            animator.render(now, strip);
+            strip.show();
+            updateState(now);
 
-        // Process all pending events (non-blocking)
-        while (xQueueReceive(ledEventQueue, &event, 0) == pdPASS)
-        {
-            switch (event.type)
+            // Health monitoring every 1000 frames
+            if (++frameCounter % 1000 == 0)
             {
-            case LEDEventType::SET_LOADING:
-                loading = event.state;
-                if (loading)
-                {
-                    lastEncMovementTime = millis();
-                    pulsating = false;
-                    fading = false;
-                    setAllLEDs(244, 70, 17); // Orange loading color
-                }
-                else
-                {
-                    setAllLEDs(baseRed, baseGreen, baseBlue);
-                    fadeToBrightness(200, 150);
-                }
-                break;
-
-            case LEDEventType::FLASH_COLOR:
-                // Override all other animations for immediate feedback
-                pulsating = false;
-                fading = false;
-                flash = true;
-                flashDuration = event.duration;
-                lastFlashStarted = millis();
-                currentBrightness = event.brightness;
-
-                strip.setBrightness(event.brightness);
-                setAllLEDs(event.r, event.g, event.b);
-                strip.show();
-                break;
-
-            case LEDEventType::ACTIVATE:
-                if (!loading)
-                {
-                    lastEncMovementTime = millis();
-                }
-                pulsating = false;
-                fading = false;
-                currentBrightness = 255;
-
-                strip.setBrightness(255);
-                setAllLEDs(red, green, blue);
-                strip.show();
-                break;
-
-            case LEDEventType::SET_COLOR:
-                // Update color theme
-                setAllLEDs(event.r, event.g, event.b);
-                baseRed = event.r;
-                baseGreen = event.g;
-                baseBlue = event.b;
-                red = event.r;
-                green = event.g;
-                blue = event.b;
-                strip.show();
-                break;
-
-            case LEDEventType::SET_RAINBOW:
-                rainbow = event.state;
-                if (rainbow)
-                {
-                    pulsating = false;
-                    fading = false;
-                    loading = false;
-                    flash = false;
-                }
-                else
-                {
-                    setAllLEDs(baseRed, baseGreen, baseBlue);
-                    strip.show();
-                    pulsating = true;
-                }
-                break;
-
-            case LEDEventType::SET_BRIGHTNESS:
-                currentBrightness = event.brightness;
-
-                strip.setBrightness(currentBrightness);
-                break;
-
-            default:
-                // Unknown event type
-                break;
+                SDK_LOGGER("💡 LED Task alive - frames: %d sent / %d skipped, free stack: %d\n",
+                           strip.getFramesSent(), strip.getFramesSkipped(), uxTaskGetStackHighWaterMark(NULL));
             }
-        }
-    }
-
-    // ============================================================================
-    // ANIMATION STATE MACHINE
-    // ============================================================================
-
-    void LEDManager::updateAnimations()
-    {
-        unsigned long currentMillis = millis();
-
-        // Animation priority order:
-        // 1. Fade (smooth transitions)
-        // 2. Flash (immediate user feedback)
-        // 3. Loading (WiFi connection state)
-        // 4. Rainbow (Rainbow animation effect)
-        // 5. Init (boot sequence)
-        // 6. Pulsating (idle breathing)
-
-        if (fading)
-        {
-            updateFadeAnimation();
-            return;
-        }
-
-        if (flash)
-        {
-            updateFlashAnimation();
-            return;
-        }
-
-        if (loading)
-        {
-            updateLoadingAnimation();
-            return;
-        }
 
-        if (rainbow)
-        {
-            updateRainbowAnimation();
-            return;
-        }
+            // Sleep until the output changes or an event arrives
+            uint32_t waitMs = animator.nextDeadlineMs(millis());
+            TickType_t ticks = waitMs == LEDAnimator::NO_DEADLINE ? portMAX_DELAY : pdMS_TO_TICKS(waitMs);
 
-        if (!initAnimationCompleted)
-        {
-            updateInitAnimation();
-            return;
-        }
+            LEDEvent event;
+            if (xQueueReceive(ledEventQueue, &event, ticks) != pdPASS)
+                continue;
 
-        if (pulsating)
-        {
-            updatePulsatingAnimation();
-            return;
-        }
-
-        // Auto-return to pulsating after idle time
-        if (currentMillis - lastEncMovementTime >= IDLE_DELAY_SECONDS * 1000)
-        {
-            if (currentBrightness > 10)
+            do
             {
-                fadeToBrightness(10, 1000);
-            }
-            else
-            {
-                pulsating = true;
-            }
+                handleLEDEvent(event, millis());
+            } while (xQueueReceive(ledEventQueue, &event, 0) == pdPASS);
         }
     }
 
     // ============================================================================
-    // ANIMATION IMPLEMENTATIONS
+    // EVENT PROCESSING SYSTEM
     // ============================================================================
 
-    void LEDManager::updateInitAnimation()
+    void LEDManager::handleLEDEvent(const LEDEvent &event, uint32_t nowMs)
     {
-        unsigned long currentMillis = millis();
-
-        // Boot sequence: LED sweep animation
-        if (!inited && currentMillis - previousMillis >= ANIMATION_INTERVAL)
+        switch (event.type)
         {
-            previousMillis = currentMillis;
-
-            resetAllLEDs();
-            strip.setPixelColor(cursorLED, strip.Color(red, green, blue));
-            strip.show();
-
-            // Move cursor with bounce at ends
-            if (clockwise)
+        case LEDEventType::SET_LOADING:
+            loading = event.state;
+            if (loading)
             {
-                cursorLED++;
+                animator.play(LAYER_LOADING, LED_LOADING_EFFECT, 244, 70, 17, nowMs); // Orange loading color
             }
             else
             {
-                cursorLED--;
+                animator.stop(LAYER_LOADING);
+                playBase(LED_LEVEL_RESUME, 150, IDLE_DELAY_MS, nowMs);
             }
-
-            if (cursorLED >= NUM_LEDS)
+            break;
+
+        case LEDEventType::FLASH_COLOR:
+        {
+            // Covers all other layers for immediate feedback
+            uint8_t level = (uint8_t)constrain(event.brightness, 0, 255);
+            uint16_t duration = (uint16_t)constrain(event.duration, 1, 65535);
+            LEDKeyframe frames[] = {
+                {0, level, LEDEasing::LINEAR},
+                {duration, level, LEDEasing::LINEAR},
+            };
+            LEDEffect effect = {LEDPattern::SOLID, frames, 2, nullptr, 0, false, 0, LEDTrackEnd::REMOVE};
+            animator.play(LAYER_FLASH, effect, event.r, event.g, event.b, nowMs);
+            break;
+        }
+
+        case LEDEventType::ACTIVATE:
+            playBase(LED_LEVEL_ACTIVE, 0, IDLE_DELAY_MS, nowMs);
+            break;
+
+        case LEDEventType::SET_COLOR:
+            // Update color theme
+            red = event.r;
+            green = event.g;
+            blue = event.b;
+            animator.setColor(LAYER_BASE, red, green, blue);
+            animator.setColor(LAYER_INIT, red, green, blue);
+            break;
+
+        case LEDEventType::SET_RAINBOW:
+            if (event.state)
             {
-                clockwise = false;
-                cursorLED = NUM_LEDS - 1;
+                // Hue offset 0..255 in 256 steps of event.duration ms, at the current level
+                uint8_t level = animator.getBrightness(LAYER_BASE, nowMs);
+                uint16_t length = (uint16_t)constrain(event.duration, 1, 255) * 256;
+                LEDKeyframe brightness[] = {{0, level, LEDEasing::LINEAR}};
+                LEDKeyframe hue[] = {
+                    {0, 0, LEDEasing::LINEAR},
+                    {length, 255, LEDEasing::LINEAR},
+                };
+                LEDEffect effect = {LEDPattern::RAINBOW, brightness, 1, hue, 2, true, 0, LEDTrackEnd::HOLD};
+
+                loading = false;
+                animator.stop(LAYER_LOADING);
+                animator.stop(LAYER_FLASH);
+                animator.play(LAYER_RAINBOW, effect, 0, 0, 0, nowMs);
             }
-
-            if (cursorLED <= 0 && !clockwise)
+            else
             {
-                // Sweep complete - fade out
-                strip.setBrightness(0);
-                strip.show();
-                vTaskDelay(pdMS_TO_TICKS(500));
-
-                fadeToBrightness(255, 150);
-                inited = true;
-                cursorLED = 0;
-                clockwise = true;
+                animator.stop(LAYER_RAINBOW);
+                playBase(LED_LEVEL_PULSE_LOW, LED_IDLE_FADE_MS, 0, nowMs);
             }
-        }
+            break;
 
-        // Final fade to complete init
-        if (inited && currentBrightness != 0)
-        {
-            fadeToBrightness(0, 3000);
-        }
+        case LEDEventType::SET_BRIGHTNESS:
+            playBase((uint8_t)constrain(event.brightness, 0, 255), 150, IDLE_DELAY_MS, nowMs);
+            break;
 
-        // Init animation timeout (4 second max)
-        if (currentMillis > 4000 && !initAnimationCompleted)
-        {
-            initAnimationCompleted = true;
-            pulsating = true;
-            SDK_LOGGER("💡 LED Init animation completed!");
+        default:
+            // Unknown event type
+            break;
         }
     }
 
-    void LEDManager::updateLoadingAnimation()
+    // ============================================================================
+    // ANIMATION STATE
+    // ============================================================================
+
+    void LEDManager::playBase(uint8_t level, uint16_t fadeMs, uint16_t holdMs, uint32_t nowMs)
     {
-        static unsigned long lastLoadingUpdate = 0;
-        static bool loadingUp = true;
+        uint8_t from = animator.isActive(LAYER_BASE) ? animator.getBrightness(LAYER_BASE, nowMs) : 0;
+
+        // Transition, optional hold and idle fade, then the looping pulse
+        LEDKeyframe frames[6];
+        uint8_t count = 0;
+        uint16_t t = 0;
 
-        // Simple loading animation - alternates brightness
-        if (getBrightness() != 250)
+        frames[count++] = LEDKeyframe{0, from, LEDEasing::LINEAR};
+        t += fadeMs;
+        frames[count++] = LEDKeyframe{t, level, LEDEasing::EASE_OUT};
+        if (holdMs)
         {
-            fadeToBrightness(250, 50);
+            t += holdMs;
+            frames[count++] = LEDKeyframe{t, level, LEDEasing::LINEAR};
         }
-
-        if (getBrightness() != 1)
+        if (level != LED_LEVEL_PULSE_LOW)
         {
-            fadeToBrightness(1, 50);
+            t += LED_IDLE_FADE_MS;
+            frames[count++] = LEDKeyframe{t, LED_LEVEL_PULSE_LOW, LEDEasing::LINEAR};
         }
-    }
 
-    void LEDManager::updatePulsatingAnimation()
-    {
-        static unsigned long lastPulseUpdate = 0;
-        static bool pulseUp = true;
-
-        // Gentle breathing animation for idle state
-        if (millis() - lastPulseUpdate > 100)
-        { // 10Hz pulsating
-            lastPulseUpdate = millis();
+        uint16_t pulseFrom = t;
+        t += LED_PULSE_UP_MS;
+        frames[count++] = LEDKeyframe{t, LED_LEVEL_PULSE_HIGH, LEDEasing::EASE_IN_OUT};
+        t += LED_PULSE_DOWN_MS;
+        frames[count++] = LEDKeyframe{t, LED_LEVEL_PULSE_LOW, LEDEasing::EASE_IN_OUT};
 
-            if (pulseUp)
-            {
-                if (currentBrightness < 100)
-                {
-                    fadeToBrightness(100, 1500);
-                }
-                else
-                {
-                    pulseUp = false;
-                }
-            }
-            else
-            {
-                if (currentBrightness > 10)
-                {
-                    fadeToBrightness(10, 2000);
-                }
-                else
-                {
-                    pulseUp = true;
-                }
-            }
-        }
+        LEDEffect effect = {LEDPattern::SOLID, frames, count, nullptr, 0, true, pulseFrom, LEDTrackEnd::HOLD};
+        animator.play(LAYER_BASE, effect, red, green, blue, nowMs);
+        basePulseAtMs = nowMs + pulseFrom;
     }
 
-    void LEDManager::updateFlashAnimation()
+    void LEDManager::updateState(uint32_t nowMs)
     {
-        // Simple flash timer
-        if (millis() - lastFlashStarted >= flashDuration)
-        {
-            flash = false;
-            flashDuration = 0;
-            setAllLEDs(baseRed, baseGreen, baseBlue);
-            strip.show();
-        }
-    }
-
-    void LEDManager::updateFadeAnimation()
-    {
-        unsigned long elapsedTime = millis() - fadeStartMillis;
-
-        if (elapsedTime <= fadeDuration)
-        {
-            // Smooth brightness interpolation
-            int brightness = map(elapsedTime, 0, fadeDuration, startBrightness, targetBrightness);
-            strip.setBrightness(brightness);
-            setAllLEDs(red, green, blue);
-            strip.show();
-        }
-        else
+        if (!initAnimationCompleted && !animator.isActive(LAYER_INIT))
         {
-            // Fade completed
-            fading = false;
-            currentBrightness = targetBrightness;
-            strip.setBrightness(currentBrightness);
-            setAllLEDs(red, green, blue);
-            strip.show();
+            initAnimationCompleted = true;
+            SDK_LOGGER("💡 LED Init animation completed!");
         }
-    }
 
-    void LEDManager::updateRainbowAnimation()
-    {
-        static unsigned long lastRainbowUpdate = 0;
-        const uint8_t RAINBOW_SPEED_MS = 20;
+        pulsating = !loading && !animator.isActive(LAYER_RAINBOW) && (int32_t)(nowMs - basePulseAtMs) >= 0;
 
-        if (millis() - lastRainbowUpdate >= RAINBOW_SPEED_MS)
+        // Brightness of the layer on top
+        for (int layer = LAYER_FLASH; layer >= LAYER_BASE; layer--)
         {
-            lastRainbowUpdate = millis();
-
-            for (int i = 0; i < NUM_LEDS; i++)
+            if (animator.isActive(layer))
             {
-                // The key formula for the scrolling rainbow:
-                // Combines the LED position (i) and the current scrolling position (rainbowPosition)
-                // The offset ensures that each LED's color is slightly different
-                uint32_t color = Wheel(((i * 256 / NUM_LEDS) + rainbowPosition) & 255);
-                strip.setPixelColor(i, color);
-            }
-
-            strip.show();
-
-            // Increase the position for the next loop, creating the scrolling effect
-            rainbowPosition++;
-            if (rainbowPosition > 255)
-            {
-                rainbowPosition = 0;
+                currentBrightness = animator.getBrightness(layer, nowMs);
+                break;
             }
         }
     }
@@ -485,7 +353,7 @@ namespace CloudMouse::Hardware
         LEDEvent event;
         event.type = LEDEventType::SET_RAINBOW;
         event.state = on;
-        
+        event.duration = wait_ms;
         sendLEDEvent(event);
     }
 
@@ -493,7 +361,7 @@ namespace CloudMouse::Hardware
     {
         LEDEvent setBrightness;
         setBrightness.type = LEDEventType::SET_BRIGHTNESS;
-        setBrightness.brightness = 25;
+        setBrightness.brightness = brightness;
 
         sendLEDEvent(setBrightness);
     }
@@ -610,38 +478,6 @@ namespace CloudMouse::Hardware
         return true;
     }
 
-    void LEDManager::resetAllLEDs()
-    {
-        for (int i = 0; i < NUM_LEDS; i++)
-        {
-            strip.setPixelColor(i, strip.Color(0, 0, 0));
-        }
-    }
-
-    void LEDManager::setAllLEDs(uint8_t r, uint8_t g, uint8_t b)
-    {
-        red = r;
-        green = g;
-        blue = b;
-
-        for (int i = 0; i < NUM_LEDS; i++)
-        {
-            strip.setPixelColor(i, strip.Color(r, g, b));
-        }
-    }
-
-    void LEDManager::fadeToBrightness(int brightness, int duration)
-    {
-        startBrightness = currentBrightness;
-        targetBrightness = brightness;
-        if (!fading)
-        {
-            fadeStartMillis = millis();
-        }
-        fadeDuration = duration;
-        fading = true;
-    }
-
     void LEDManager::restartAnimationTask()
     {
         if (animationTaskHandle)
@@ -655,26 +491,4 @@ namespace CloudMouse::Hardware
         startAnimationTask();
     }
 
-    uint32_t LEDManager::Wheel(byte WheelPos)
-    {
-        WheelPos = 255 - WheelPos;
-        if (WheelPos < 85)
-        {
-            // Rosso -> Verde
-            return strip.Color(255 - WheelPos * 3, 0, WheelPos * 3);
-        }
-        else if (WheelPos < 170)
-        {
-            // Verde -> Blu
-            WheelPos -= 85;
-            return strip.Color(0, WheelPos * 3, 255 - WheelPos * 3);
-        }
-        else
-        {
-            // Blu -> Rosso
-            WheelPos -= 170;
-            return strip.Color(WheelPos * 3, 255 - WheelPos * 3, 0);
-        }
-    }
-
 } // namespace CloudMouse
\ No newline at end of file
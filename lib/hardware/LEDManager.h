@@ -5,17 +5,22 @@
  * Provides thread-safe event-driven interface for controlling LED states and animations.
  *
  * Features:
- * - Dedicated FreeRTOS task for smooth 50Hz animation rendering
- * - Priority-based animation state machine
+ * - Dedicated FreeRTOS task that renders only when the output changes: it
+ *   sleeps on the event queue until the next keyframe deadline (LEDAnimator)
+ * - Effects are keyframe tables composited on priority layers
  * - Thread-safe communication via event queues
- * - Multiple animation modes: init, loading, pulsating, flash effects
+ * - Multiple animation modes: init, loading, pulsating, flash, rainbow
  * - Configurable color themes with preferences storage
+ * - RMT output (NeoPixelRMT): each rendered frame is sent once, and only
+ *   when it differs from the previous one
  */
 
 #pragma once
-#include <Adafruit_NeoPixel.h>
+#include "./NeoPixelRMT.h"
+#include "./LEDAnimator.h"
 #include "../prefs/PreferencesManager.h"
 #include "../core/Events.h"
+#include "../utils/MemoryBudget.h"
 
 #define NUM_LEDS 12
 #define DATA_PIN 15
@@ -44,7 +49,7 @@ namespace CloudMouse::Hardware
         LEDEventType type;
         uint8_t r, g, b; // RGB color values (0-255)
         int brightness;  // Brightness level (0-255)
-        int duration;    // Duration in milliseconds
+        int duration;    // Duration in milliseconds (rainbow: ms per hue step)
         bool state;      // Boolean state for on/off operations
     };
 
@@ -52,14 +57,14 @@ namespace CloudMouse::Hardware
      * LED Animation Manager
      *
      * Controls the NeoPixel LED ring with various animation effects.
-     * Runs on dedicated FreeRTOS task for consistent timing.
+     * Runs on dedicated FreeRTOS task, woken by events and keyframe deadlines.
      *
-     * Animation Priority Order:
-     * 1. Fade transitions
-     * 2. Flash effects
-     * 3. Loading animation
+     * Layers (highest covers the ones below):
+     * 1. Flash effects
+     * 2. Loading animation
+     * 3. Rainbow
      * 4. Init boot sequence
-     * 5. Idle pulsating
+     * 5. Base: activation level, idle fade and idle pulsating
      */
     class LEDManager
     {
@@ -91,70 +96,64 @@ namespace CloudMouse::Hardware
         TaskHandle_t getAnimationTaskHandle() const { return animationTaskHandle; }
         void restartAnimationTask(); // Restart task if needed
 
+        // Measurement (benchmark firmware): time one forced strip.show() of the
+        // current pixel buffer (encode + start); only while the animation task is stopped
+        uint32_t measureShow();
+
+        // Output statistics: frames sent vs. skipped because nothing changed
+        uint32_t getFramesSent() const { return strip.getFramesSent(); }
+        uint32_t getFramesSkipped() const { return strip.getFramesSkipped(); }
+
     private:
         // Hardware
-        Adafruit_NeoPixel strip;
+        NeoPixelRMT strip;
 
         // Task management
         TaskHandle_t animationTaskHandle = nullptr;
         QueueHandle_t ledEventQueue = nullptr;
         static const int LED_QUEUE_SIZE = 10;
 
-        // Animation state flags
+        // Queue and task storage (held in place with SDK_STATIC_ALLOCATION)
+        Utils::QueueStorage<LEDEvent, LED_QUEUE_SIZE> ledEventQueueStorage;
+        Utils::TaskStorage<LED_TASK_STACK_SIZE> animationTaskStorage;
+
+        // Animation engine and its layers, lowest first
+        LEDAnimator animator;
+        enum : uint8_t
+        {
+            LAYER_BASE,
+            LAYER_INIT,
+            LAYER_RAINBOW,
+            LAYER_LOADING,
+            LAYER_FLASH
+        };
+
+        // State published by the animation task for the queries above
         bool pulsating = true;               // Idle breathing effect
         bool loading = false;                // Loading animation active
-        bool flash = false;                  // Flash effect active
-        bool fading = false;                 // Brightness fade active
-        bool inited = false;                 // Boot sequence completed
         bool initAnimationCompleted = false; // Full init sequence done
-
-        bool rainbow = false;
-        uint16_t rainbowPosition = 0;
-
-        // Timing variables
-        unsigned long previousMillis = 0;
-        unsigned long lastEncMovementTime = 0;
-        unsigned long lastFlashStarted = 0;
-        unsigned long fadeStartMillis = 0;
-
-        // Animation parameters
-        int cursorLED = 0;           // Current LED for sweep animations
-        int currentBrightness = 250; // Current brightness level
-        int startBrightness = 0;     // Fade start brightness
-        int targetBrightness = 0;    // Fade target brightness
-        int fadeDuration = 3000;     // Fade duration in milliseconds
-        int flashDuration = 0;       // Flash duration in milliseconds
-        bool clockwise = true;       // Animation direction
+        int currentBrightness = 0;           // Brightness of the top layer (perceptual)
+        uint32_t basePulseAtMs = 0;          // When the base effect reaches its idle pulse
 
         // Color state
-        uint8_t baseRed = 0, baseGreen = 181, baseBlue = 214; // Base color (azure)
-        uint8_t red = 0, green = 0, blue = 0;                 // Current RGB values
+        uint8_t red = 0, green = 181, blue = 214; // Theme color (azure)
 
         // Configuration constants
-        static const unsigned long ANIMATION_INTERVAL = 70; // Init sweep timing
-        static const int IDLE_DELAY_SECONDS = 5;            // Idle timeout
+        static const uint16_t IDLE_DELAY_MS = 5000; // Full level before the idle fade
 
         // FreeRTOS task functions
         static void animationTaskFunction(void *parameter); // Task entry point
 
         // Animation system
-        void animationLoop();    // Main animation loop (50Hz)
-        void processLEDEvents(); // Process incoming events
-        void updateAnimations(); // Update active animations
-
-        // Animation handlers
-        void updateInitAnimation();      // Boot sequence LED sweep
-        void updateLoadingAnimation();   // Loading pulse effect
-        void updatePulsatingAnimation(); // Idle breathing animation
-        void updateFlashAnimation();     // Flash effect timing
-        void updateFadeAnimation();      // Brightness fade transitions
-        void updateRainbowAnimation();
-
-        // Helper functions
-        void resetAllLEDs();                                 // Turn off all LEDs
-        void setAllLEDs(uint8_t r, uint8_t g, uint8_t b);    // Set all LEDs to color
-        void fadeToBrightness(int brightness, int duration); // Start brightness fade
-        uint32_t Wheel(byte WheelPos);
+        void animationLoop();                                 // Render, then sleep until deadline or event
+        void handleLEDEvent(const LEDEvent &event, uint32_t nowMs);
+        void updateState(uint32_t nowMs);                     // Refresh the published state
+
+        /**
+         * Restart the base layer: fade from its current level to 'level',
+         * hold for holdMs, fade to the idle level and pulse
+         */
+        void playBase(uint8_t level, uint16_t fadeMs, uint16_t holdMs, uint32_t nowMs);
 
         // Communication
         bool sendLEDEvent(const LEDEvent &event); // Send event to animation task
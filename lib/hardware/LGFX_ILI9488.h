@@ -54,14 +54,27 @@
 #ifndef LGFX_ILI9488_H
 #define LGFX_ILI9488_H
 
-#include <LovyanGFX.hpp>
 #include "../config/DeviceConfig.h"
 #include "../utils/Logger.h"
 
+#if CLOUDMOUSE_SIM
+
+// Host simulator: SDL window with the same interface (src/sim/shim/LGFX_Sim.h)
+#include <LGFX_Sim.h>
+
+#else
+
+#include <LovyanGFX.hpp>
+#include <driver/ledc.h>
+
 // Hardware pin definitions
 #define TFT_BL 8    // PWM backlight control pin
 #define TFT_PWR 1   // Power enable pin (PCB version dependent)
 
+// Backlight LEDC channel (must match light_cfg.pwm_channel, low-speed group on ESP32-S3)
+#define TFT_BL_LEDC_MODE LEDC_LOW_SPEED_MODE
+#define TFT_BL_LEDC_CHANNEL LEDC_CHANNEL_7
+
 // SPI host definition for ESP32-S3 compatibility
 #ifndef HSPI_HOST
 #define HSPI_HOST SPI2_HOST
@@ -93,6 +106,10 @@ class LGFX_ILI9488 : public lgfx::LGFX_Device {
     lgfx::Bus_SPI _bus_instance;            // SPI bus configuration
     lgfx::Light_PWM _light_instance;        // PWM backlight controller
 
+    bool _native_rgb666 = false;            // Raw 3-byte transfers (see setNativeRGB666)
+    bool _fade_installed = false;           // LEDC fade service installed
+    unsigned long _fade_end_ms = 0;         // millis() at which the running fade completes
+
 public:
     /**
      * Constructor - configures all hardware components and interfaces
@@ -222,11 +239,109 @@ public:
         
         // Apply landscape orientation with BGR-to-RGB correction
         // 0x60 = MY=0, MX=1, MV=1 (landscape), 0x08 = BGR order
-        _panel_instance.writeData(0x60 | 0x08, 1);
+        // Native RGB666 mode clears the BGR bit: LVGL stores RGB888 as B,G,R bytes
+        _panel_instance.writeData(_native_rgb666 ? 0x60 : (0x60 | 0x08), 1);
         
         endWrite();
     }
 
+    /**
+     * Select native RGB666 pixel transfer mode
+     * Must be called before init(). When enabled, the panel consumes LVGL's RGB888
+     * buffers byte-for-byte (the controller drops the 2 LSBs of each channel), so
+     * flushes skip the per-pixel RGB565 -> RGB666 expansion done by pushImage().
+     *
+     * Note: LovyanGFX drawing primitives assume the default color order, so only
+     * raw buffers should be pushed to the panel while this mode is active.
+     *
+     * @param enabled true to push 3-byte pixels through writeNativeRGB666()
+     */
+    void setNativeRGB666(bool enabled) { _native_rgb666 = enabled; }
+
+    /**
+     * Push a raw 3-byte-per-pixel buffer to the panel without color conversion
+     * Caller must hold the bus (startWrite) for the whole transfer.
+     *
+     * @param x Left coordinate of the target window
+     * @param y Top coordinate of the target window
+     * @param w Window width in pixels
+     * @param h Window height in pixels
+     * @param data Pixel data in panel byte order, first pixel of the window
+     * @param use_dma true to start a DMA transfer (completion via waitDMA())
+     * @param stride Source line length in pixels (0 = contiguous, same as w)
+     */
+    void writeNativeRGB666(int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t* data, bool use_dma, int32_t stride = 0) {
+        setWindow(x, y, x + w - 1, y + h - 1);
+        if (stride == 0 || stride == w) {
+            _bus_instance.writeBytes(data, w * h * 3, true, use_dma);
+            return;
+        }
+        // Window RAM auto-advances, so lines can be streamed one after another
+        for (int32_t row = 0; row < h; row++) {
+            _bus_instance.writeBytes(data + row * stride * 3, w * 3, true, use_dma);
+        }
+    }
+
+    // ========================================================================
+    // HARDWARE BACKLIGHT FADES
+    // ========================================================================
+
+    /**
+     * Fade the backlight to a new level using the LEDC hardware fade engine
+     * The CPU only programs the fade, the duty ramp runs in hardware.
+     * A fade that is still running is cut short and the new one starts from
+     * the current duty.
+     *
+     * Once fades are used, change brightness only through this method:
+     * setBrightness() writes the duty behind the fade engine's back.
+     *
+     * @param brightness Target level 0-255 (same scale as setBrightness)
+     * @param duration_ms Fade duration, 0 to apply immediately
+     * @return true if the hardware fade engine handled the change
+     */
+    bool fadeBrightness(uint8_t brightness, uint32_t duration_ms) {
+        if (!_fade_installed) {
+            if (ledc_fade_func_install(0) != ESP_OK) {
+                setBrightness(brightness);
+                return false;
+            }
+            _fade_installed = true;
+        }
+
+        if (isFading()) {
+            // ESP32-S3 cannot stop a hardware fade and a new fade would block until the
+            // running one ends: reset the fade service instead (duty stays where it is)
+            ledc_fade_func_uninstall();
+            ledc_fade_func_install(0);
+        }
+
+        // Same 8-bit duty mapping as lgfx::Light_PWM
+        uint32_t duty = brightness + (brightness >> 7);
+
+        if (duration_ms == 0) {
+            ledc_set_duty(TFT_BL_LEDC_MODE, TFT_BL_LEDC_CHANNEL, duty);
+            ledc_update_duty(TFT_BL_LEDC_MODE, TFT_BL_LEDC_CHANNEL);
+            _fade_end_ms = millis();
+            return true;
+        }
+
+        ledc_set_fade_with_time(TFT_BL_LEDC_MODE, TFT_BL_LEDC_CHANNEL, duty, duration_ms);
+        ledc_fade_start(TFT_BL_LEDC_MODE, TFT_BL_LEDC_CHANNEL, LEDC_FADE_NO_WAIT);
+        _fade_end_ms = millis() + duration_ms;
+        return true;
+    }
+
+    /**
+     * Time left before the running backlight fade completes
+     * @return Remaining milliseconds, 0 if no fade is running
+     */
+    uint32_t fadeRemainingMs() const {
+        long remaining = (long)(_fade_end_ms - millis());
+        return remaining > 0 ? (uint32_t)remaining : 0;
+    }
+
+    bool isFading() const { return fadeRemainingMs() > 0; }
+
     /**
      * Initialize display hardware with power management and configuration
      * Performs complete hardware setup including power control, display initialization,
@@ -287,11 +402,13 @@ public:
         
         SDK_LOGGER("✅ ILI9488 display initialized successfully");
         SDK_LOGGER("   Resolution: 480x320 pixels\n");
-        SDK_LOGGER("   Color depth: 16-bit RGB565\n");
+        SDK_LOGGER("   Color depth: %s\n", _native_rgb666 ? "18-bit RGB666 (native)" : "16-bit RGB565");
         SDK_LOGGER("   SPI frequency: 40MHz write, 16MHz read\n");
         SDK_LOGGER("   PWM backlight: 5KHz @ channel 7\n");
         SDK_LOGGER("   Power management: PCB v%d compatible\n", PCB_VERSION);
     }
 };
 
+#endif // CLOUDMOUSE_SIM
+
 #endif
\ No newline at end of file
@@ -0,0 +1,459 @@
+#include "./LvglAllocator.h"
+#include <lvgl.h>
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM
+
+#include <esp_heap_caps.h>
+#include <multi_heap.h>
+#include <string.h>
+#include "../config/DeviceConfig.h"
+#include "../utils/Logger.h"
+#include "../utils/MemoryBudget.h"
+
+namespace CloudMouse::Hardware
+{
+    // ============================================================================
+    // ALLOCATOR STATE
+    // ============================================================================
+
+    namespace
+    {
+        /**
+         * Fixed-size block pool in internal SRAM
+         * Free blocks are chained through their first word.
+         */
+        struct SlabPool
+        {
+            uint16_t blockSize;
+            uint16_t capacity;
+            uint8_t *arena;
+            void *freeList;
+            uint16_t used;
+            uint16_t peak;
+            uint32_t overflows;
+        };
+
+        SlabPool pools[LvglAllocator::SIZE_CLASS_COUNT] = {
+            {16, LVGL_SLAB_BLOCKS_16, nullptr, nullptr, 0, 0, 0},
+            {32, LVGL_SLAB_BLOCKS_32, nullptr, nullptr, 0, 0, 0},
+            {64, LVGL_SLAB_BLOCKS_64, nullptr, nullptr, 0, 0, 0},
+            {128, LVGL_SLAB_BLOCKS_128, nullptr, nullptr, 0, 0, 0},
+            {256, LVGL_SLAB_BLOCKS_256, nullptr, nullptr, 0, 0, 0},
+        };
+
+        portMUX_TYPE slabLock = portMUX_INITIALIZER_UNLOCKED;
+        portMUX_TYPE psramLock = portMUX_INITIALIZER_UNLOCKED;
+
+        // Large block region (TLSF managed by multi_heap)
+        multi_heap_handle_t psramHeap = nullptr;
+        uint8_t *psramStart = nullptr;
+        uint8_t *psramEnd = nullptr;
+        uint32_t psramBlocks = 0;
+
+#if SDK_STATIC_ALLOCATION
+        // Every slab arena, carved in size class order, in internal .bss
+        uint8_t slabStorage[16 * LVGL_SLAB_BLOCKS_16 + 32 * LVGL_SLAB_BLOCKS_32 + 64 * LVGL_SLAB_BLOCKS_64 +
+                            128 * LVGL_SLAB_BLOCKS_128 + 256 * LVGL_SLAB_BLOCKS_256] __attribute__((aligned(4)));
+#endif
+
+#if SDK_STATIC_PSRAM
+        SDK_PSRAM_BSS uint8_t psramRegion[LVGL_PSRAM_POOL_SIZE] __attribute__((aligned(16)));
+#endif
+
+        uint32_t fallbackBlocks = 0;
+        uint32_t failures = 0;
+        bool initialized = false;
+
+        SlabPool *findPool(const void *ptr)
+        {
+            const uint8_t *p = (const uint8_t *)ptr;
+            for (int i = 0; i < LvglAllocator::SIZE_CLASS_COUNT; i++)
+            {
+                SlabPool &pool = pools[i];
+                if (pool.arena && p >= pool.arena && p < pool.arena + (size_t)pool.blockSize * pool.capacity)
+                    return &pool;
+            }
+            return nullptr;
+        }
+
+        bool inPsramRegion(const void *ptr)
+        {
+            const uint8_t *p = (const uint8_t *)ptr;
+            return psramHeap && p >= psramStart && p < psramEnd;
+        }
+
+        void *slabAllocate(size_t size)
+        {
+            // First class that fits, spilling into larger classes when it is full
+            SlabPool *requested = nullptr;
+            void *block = nullptr;
+
+            taskENTER_CRITICAL(&slabLock);
+            for (int i = 0; i < LvglAllocator::SIZE_CLASS_COUNT && !block; i++)
+            {
+                SlabPool &pool = pools[i];
+                if (pool.blockSize < size)
+                    continue;
+                if (!requested)
+                    requested = &pool;
+
+                if (pool.freeList)
+                {
+                    block = pool.freeList;
+                    pool.freeList = *(void **)block;
+                    pool.used++;
+                    if (pool.used > pool.peak)
+                        pool.peak = pool.used;
+                }
+            }
+            if (requested && (!block || findPool(block) != requested))
+                requested->overflows++;
+            taskEXIT_CRITICAL(&slabLock);
+
+            return block;
+        }
+
+        void adjustCounter(uint32_t &counter, int delta)
+        {
+            taskENTER_CRITICAL(&slabLock);
+            counter += delta;
+            taskEXIT_CRITICAL(&slabLock);
+        }
+
+        void slabRelease(SlabPool *pool, void *ptr)
+        {
+            taskENTER_CRITICAL(&slabLock);
+            *(void **)ptr = pool->freeList;
+            pool->freeList = ptr;
+            pool->used--;
+            taskEXIT_CRITICAL(&slabLock);
+        }
+
+        void *largeAllocate(size_t size)
+        {
+            if (psramHeap)
+            {
+                void *ptr = multi_heap_malloc(psramHeap, size);
+                if (ptr)
+                {
+                    adjustCounter(psramBlocks, 1);
+                    return ptr;
+                }
+            }
+
+            // PSRAM region exhausted (or unavailable): fall back to the system heap
+            void *ptr = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+            if (!ptr)
+                ptr = heap_caps_malloc(size, MALLOC_CAP_8BIT);
+
+            adjustCounter(ptr ? fallbackBlocks : failures, 1);
+            return ptr;
+        }
+    }
+
+    // ============================================================================
+    // INITIALIZATION
+    // ============================================================================
+
+    void LvglAllocator::init()
+    {
+        if (initialized)
+            return;
+        initialized = true;
+
+        size_t slabBytes = 0;
+        for (int i = 0; i < SIZE_CLASS_COUNT; i++)
+        {
+            SlabPool &pool = pools[i];
+            size_t bytes = (size_t)pool.blockSize * pool.capacity;
+            if (bytes == 0)
+                continue;
+
+#if SDK_STATIC_ALLOCATION
+            pool.arena = slabStorage + slabBytes;
+#else
+            pool.arena = (uint8_t *)heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+#endif
+            if (!pool.arena)
+            {
+                SDK_LOGGER("⚠️ LVGL slab %d B: internal SRAM allocation failed, class disabled", pool.blockSize);
+                pool.capacity = 0;
+                continue;
+            }
+
+            // Chain every block into the free list
+            pool.freeList = nullptr;
+            for (int b = pool.capacity - 1; b >= 0; b--)
+            {
+                void *block = pool.arena + (size_t)b * pool.blockSize;
+                *(void **)block = pool.freeList;
+                pool.freeList = block;
+            }
+            slabBytes += bytes;
+        }
+
+#if SDK_STATIC_PSRAM
+        psramStart = psramRegion;
+#else
+        // Taken once and never returned, so it cannot fragment the PSRAM heap
+        psramStart = (uint8_t *)heap_caps_malloc(LVGL_PSRAM_POOL_SIZE, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+#endif
+        if (psramStart)
+        {
+            psramHeap = multi_heap_register(psramStart, LVGL_PSRAM_POOL_SIZE);
+            if (psramHeap)
+            {
+                multi_heap_set_lock(psramHeap, &psramLock);
+                psramEnd = psramStart + LVGL_PSRAM_POOL_SIZE;
+            }
+            else
+            {
+#if !SDK_STATIC_PSRAM
+                heap_caps_free(psramStart);
+#endif
+                psramStart = nullptr;
+            }
+        }
+
+        Utils::MemoryBudget::add("lvgl.slabs", slabBytes, Utils::MemoryBudget::Region::INTERNAL,
+                                 Utils::MemoryBudget::ALLOCATION);
+        if (psramHeap)
+            Utils::MemoryBudget::add("lvgl.psram_pool", LVGL_PSRAM_POOL_SIZE, Utils::MemoryBudget::Region::PSRAM,
+                                     SDK_STATIC_PSRAM ? Utils::MemoryBudget::Source::STATIC : Utils::MemoryBudget::Source::BOOT);
+
+        SDK_LOGGER("🧠 LVGL allocator: %d bytes slab pools (internal), %d bytes TLSF region (%s)",
+                   (int)slabBytes, psramHeap ? (int)LVGL_PSRAM_POOL_SIZE : 0, psramHeap ? "PSRAM" : "unavailable");
+    }
+
+    // ============================================================================
+    // ALLOCATION INTERFACE
+    // ============================================================================
+
+    void *LvglAllocator::allocate(size_t size)
+    {
+        if (!initialized)
+            init();
+
+        if (size <= pools[SIZE_CLASS_COUNT - 1].blockSize)
+        {
+            void *block = slabAllocate(size);
+            if (block)
+                return block;
+        }
+
+        return largeAllocate(size);
+    }
+
+    void *LvglAllocator::reallocate(void *ptr, size_t size)
+    {
+        if (!ptr)
+            return allocate(size);
+
+        SlabPool *pool = findPool(ptr);
+        if (pool)
+        {
+            // Block already large enough: nothing to move
+            if (size <= pool->blockSize)
+                return ptr;
+
+            void *moved = allocate(size);
+            if (!moved)
+                return nullptr;
+            memcpy(moved, ptr, pool->blockSize);
+            slabRelease(pool, ptr);
+            return moved;
+        }
+
+        if (inPsramRegion(ptr))
+        {
+            void *moved = multi_heap_realloc(psramHeap, ptr, size);
+            if (moved)
+                return moved;
+
+            // Region full: move the block out to the system heap
+            size_t oldSize = multi_heap_get_allocated_size(psramHeap, ptr);
+            moved = largeAllocate(size);
+            if (!moved)
+                return nullptr;
+            memcpy(moved, ptr, oldSize < size ? oldSize : size);
+            release(ptr);
+            return moved;
+        }
+
+        void *moved = heap_caps_realloc(ptr, size, MALLOC_CAP_8BIT);
+        if (!moved)
+            adjustCounter(failures, 1);
+        return moved;
+    }
+
+    void LvglAllocator::release(void *ptr)
+    {
+        if (!ptr)
+            return;
+
+        SlabPool *pool = findPool(ptr);
+        if (pool)
+        {
+            slabRelease(pool, ptr);
+            return;
+        }
+
+        if (inPsramRegion(ptr))
+        {
+            multi_heap_free(psramHeap, ptr);
+            adjustCounter(psramBlocks, -1);
+            return;
+        }
+
+        heap_caps_free(ptr);
+        adjustCounter(fallbackBlocks, -1);
+    }
+
+    // ============================================================================
+    // MONITORING
+    // ============================================================================
+
+    void LvglAllocator::getStats(Stats &stats)
+    {
+        memset(&stats, 0, sizeof(stats));
+
+        taskENTER_CRITICAL(&slabLock);
+        for (int i = 0; i < SIZE_CLASS_COUNT; i++)
+        {
+            const SlabPool &pool = pools[i];
+            stats.classes[i] = {pool.blockSize, pool.capacity, pool.used, pool.peak, pool.overflows};
+        }
+        taskEXIT_CRITICAL(&slabLock);
+
+        if (psramHeap)
+        {
+            multi_heap_info_t info;
+            multi_heap_get_info(psramHeap, &info);
+            stats.psramTotal = LVGL_PSRAM_POOL_SIZE;
+            stats.psramFree = info.total_free_bytes;
+            stats.psramLargestFree = info.largest_free_block;
+            stats.psramMinFree = info.minimum_free_bytes;
+        }
+
+        stats.psramBlocks = psramBlocks;
+        stats.fallbackBlocks = fallbackBlocks;
+        stats.failures = failures;
+    }
+
+    bool LvglAllocator::checkIntegrity()
+    {
+        return !psramHeap || multi_heap_check(psramHeap, true);
+    }
+
+    void LvglAllocator::printStats()
+    {
+        Stats stats;
+        getStats(stats);
+
+        SDK_LOGGER("\n🧠 LVGL allocator:");
+        SDK_LOGGER("   %-8s %8s %8s %8s %10s", "class", "used", "peak", "blocks", "overflows");
+        for (int i = 0; i < SIZE_CLASS_COUNT; i++)
+        {
+            const ClassStats &c = stats.classes[i];
+            SDK_LOGGER("   %5d B %8d %8d %8d %10lu", c.blockSize, c.used, c.peak, c.capacity, (unsigned long)c.overflows);
+        }
+
+        SDK_LOGGER("   PSRAM TLSF: %d/%d bytes free (largest %d, low-water %d), %lu blocks",
+                   (int)stats.psramFree, (int)stats.psramTotal, (int)stats.psramLargestFree, (int)stats.psramMinFree,
+                   (unsigned long)stats.psramBlocks);
+        SDK_LOGGER("   System heap fallback: %lu blocks, failed requests: %lu\n",
+                   (unsigned long)stats.fallbackBlocks, (unsigned long)stats.failures);
+    }
+}
+
+// ============================================================================
+// LVGL CUSTOM STDLIB HOOKS (LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM)
+// ============================================================================
+
+using CloudMouse::Hardware::LvglAllocator;
+
+extern "C"
+{
+    void lv_mem_init(void)
+    {
+        LvglAllocator::init();
+    }
+
+    void lv_mem_deinit(void)
+    {
+        // Pools live for the whole firmware lifetime
+    }
+
+    lv_mem_pool_t lv_mem_add_pool(void *mem, size_t bytes)
+    {
+        // Extra pools are not supported: tiers are sized in DeviceConfig.h
+        LV_UNUSED(mem);
+        LV_UNUSED(bytes);
+        return NULL;
+    }
+
+    void lv_mem_remove_pool(lv_mem_pool_t pool)
+    {
+        LV_UNUSED(pool);
+    }
+
+    void *lv_malloc_core(size_t size)
+    {
+        return LvglAllocator::allocate(size);
+    }
+
+    void *lv_realloc_core(void *p, size_t new_size)
+    {
+        return LvglAllocator::reallocate(p, new_size);
+    }
+
+    void lv_free_core(void *p)
+    {
+        LvglAllocator::release(p);
+    }
+
+    void lv_mem_monitor_core(lv_mem_monitor_t *mon_p)
+    {
+        LvglAllocator::Stats stats;
+        LvglAllocator::getStats(stats);
+
+        size_t total = stats.psramTotal;
+        size_t freeBytes = stats.psramFree;
+        size_t biggest = stats.psramLargestFree;
+        size_t peakBytes = stats.psramTotal - stats.psramMinFree;
+        size_t usedCount = stats.psramBlocks + stats.fallbackBlocks;
+        size_t freeCount = 0;
+
+        for (int i = 0; i < LvglAllocator::SIZE_CLASS_COUNT; i++)
+        {
+            const LvglAllocator::ClassStats &c = stats.classes[i];
+            size_t freeBlocks = c.capacity - c.used;
+
+            total += (size_t)c.blockSize * c.capacity;
+            freeBytes += (size_t)c.blockSize * freeBlocks;
+            peakBytes += (size_t)c.blockSize * c.peak;
+            usedCount += c.used;
+            freeCount += freeBlocks;
+            if (freeBlocks > 0 && c.blockSize > biggest)
+                biggest = c.blockSize;
+        }
+
+        mon_p->total_size = total;
+        mon_p->free_size = freeBytes;
+        mon_p->free_biggest_size = biggest;
+        mon_p->free_cnt = freeCount;
+        mon_p->used_cnt = usedCount;
+        mon_p->max_used = peakBytes;
+        mon_p->used_pct = total > 0 ? (uint8_t)((total - freeBytes) * 100 / total) : 0;
+
+        // Slab pools cannot fragment: only the TLSF region contributes
+        mon_p->frag_pct = stats.psramFree > 0 ? (uint8_t)(100 - stats.psramLargestFree * 100 / stats.psramFree) : 0;
+    }
+
+    lv_result_t lv_mem_test_core(void)
+    {
+        return LvglAllocator::checkIntegrity() ? LV_RESULT_OK : LV_RESULT_INVALID;
+    }
+}
+
+#endif
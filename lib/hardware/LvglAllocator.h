@@ -0,0 +1,94 @@
+/**
+ * CloudMouse SDK - LVGL Memory Allocator
+ *
+ * Custom lv_malloc/lv_free backend (LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM)
+ * splitting LVGL allocations by size so that small, frequently churned objects
+ * never fragment the region used by large buffers.
+ *
+ * Allocation Tiers:
+ * - Small blocks (<= 256 bytes): fixed-size slab pools in internal SRAM, one pool per
+ *   size class (16/32/64/128/256). O(1) alloc/free through intrusive free lists,
+ *   no fragmentation by construction (styles, label text, object structs, events)
+ * - Large blocks and slab overflow: TLSF region carved out of PSRAM and managed by
+ *   the ESP-IDF multi_heap allocator (image buffers, QR canvases, caches)
+ * - Last resort: system heap_caps_malloc() in PSRAM, counted as fallback
+ *
+ * Monitoring:
+ * - lv_mem_monitor() reports the aggregate of all tiers (total/free/biggest/frag)
+ * - printStats() prints per size class usage, peaks and overflows over serial
+ *
+ * Configuration:
+ * - LVGL_SLAB_BLOCKS_16 ... LVGL_SLAB_BLOCKS_256 and LVGL_PSRAM_POOL_SIZE in DeviceConfig.h
+ *
+ * Thread Safety:
+ * - Slab pools and the PSRAM region are protected by spinlocks (critical sections
+ *   only cover free list and TLSF bookkeeping)
+ */
+
+#ifndef LVGL_ALLOCATOR_H
+#define LVGL_ALLOCATOR_H
+
+#include <Arduino.h>
+
+namespace CloudMouse::Hardware
+{
+    class LvglAllocator
+    {
+    public:
+        static const int SIZE_CLASS_COUNT = 5;
+
+        /**
+         * Usage counters of a single slab size class
+         */
+        struct ClassStats
+        {
+            uint16_t blockSize;     // Bytes per block
+            uint16_t capacity;      // Blocks in the pool
+            uint16_t used;          // Blocks currently allocated
+            uint16_t peak;          // Highest 'used' since boot
+            uint32_t overflows;     // Requests served by the next tier because the pool was full
+        };
+
+        /**
+         * Aggregate allocator state
+         */
+        struct Stats
+        {
+            ClassStats classes[SIZE_CLASS_COUNT];
+            size_t psramTotal;          // PSRAM region size (0 if not available)
+            size_t psramFree;
+            size_t psramLargestFree;
+            size_t psramMinFree;        // Low-water mark of psramFree
+            uint32_t psramBlocks;       // Live blocks in the PSRAM region
+            uint32_t fallbackBlocks;    // Live blocks served by the system heap
+            uint32_t failures;          // Requests that could not be served at all
+        };
+
+        /**
+         * Allocate slab pools and the PSRAM region (called by lv_init through lv_mem_init)
+         */
+        static void init();
+
+        static void *allocate(size_t size);
+        static void *reallocate(void *ptr, size_t size);
+        static void release(void *ptr);
+
+        /**
+         * Snapshot of all counters
+         */
+        static void getStats(Stats &stats);
+
+        /**
+         * Verify the TLSF region bookkeeping (lv_mem_test)
+         * @return true if the region is consistent or not in use
+         */
+        static bool checkIntegrity();
+
+        /**
+         * Print per size class usage over serial
+         */
+        static void printStats();
+    };
+}
+
+#endif
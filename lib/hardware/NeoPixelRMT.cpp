@@ -0,0 +1,264 @@
+/**
+ * CloudMouse SDK - NeoPixel Output over RMT Implementation
+ *
+ * WS2812 timing at a 10 MHz RMT clock (100 ns per tick):
+ * - 0 bit: 300 ns high, 900 ns low
+ * - 1 bit: 900 ns high, 300 ns low
+ * - Latch: line low for at least 280 µs (WS2812B) between frames
+ */
+
+#include "./NeoPixelRMT.h"
+#include "../utils/Logger.h"
+#include <string.h>
+
+namespace CloudMouse::Hardware
+{
+    static const uint32_t NEOPIXEL_RMT_RESOLUTION_HZ = 10000000;
+    static const uint16_t NEOPIXEL_T0H = 3;
+    static const uint16_t NEOPIXEL_T0L = 9;
+    static const uint16_t NEOPIXEL_T1H = 9;
+    static const uint16_t NEOPIXEL_T1L = 3;
+    static const uint32_t NEOPIXEL_LATCH_US = 300;
+
+    NeoPixelRMT::NeoPixelRMT(uint16_t count, int pin)
+        : count(count), pin(pin)
+    {
+    }
+
+    NeoPixelRMT::~NeoPixelRMT()
+    {
+        if (ready)
+            waitDone(50);
+
+#ifdef USE_NEW_RMT_API
+        if (channel)
+        {
+            rmt_disable(channel);
+            rmt_del_channel(channel);
+        }
+        if (encoder)
+            rmt_del_encoder(encoder);
+#else
+        if (ready)
+            rmt_driver_uninstall(LED_RMT_CHANNEL);
+        free(items[0]);
+        free(items[1]);
+#endif
+        free(pixels);
+        free(wire[0]);
+        free(wire[1]);
+    }
+
+    // ============================================================================
+    // INITIALIZATION
+    // ============================================================================
+
+    bool NeoPixelRMT::begin()
+    {
+        if (ready)
+            return true;
+
+        pixels = (uint8_t *)calloc(frameBytes(), 1);
+        wire[0] = (uint8_t *)calloc(frameBytes(), 1);
+        wire[1] = (uint8_t *)calloc(frameBytes(), 1);
+        if (!pixels || !wire[0] || !wire[1])
+        {
+            SDK_LOGGER("❌ NeoPixel frame buffer allocation failed");
+            return false;
+        }
+
+#ifdef USE_NEW_RMT_API
+        rmt_tx_channel_config_t channelConfig = {};
+        channelConfig.gpio_num = (gpio_num_t)pin;
+        channelConfig.clk_src = RMT_CLK_SRC_DEFAULT;
+        channelConfig.resolution_hz = NEOPIXEL_RMT_RESOLUTION_HZ;
+        channelConfig.mem_block_symbols = 64;
+        channelConfig.trans_queue_depth = 2;
+        channelConfig.flags.with_dma = true;
+
+        esp_err_t err = rmt_new_tx_channel(&channelConfig, &channel);
+        if (err != ESP_OK)
+        {
+            // DMA channels are shared with other peripherals: fall back to ping-pong memory
+            SDK_LOGGER("⚠️ NeoPixel RMT DMA unavailable (%d), using channel memory", err);
+            channelConfig.flags.with_dma = false;
+            channelConfig.mem_block_symbols = 48;
+            err = rmt_new_tx_channel(&channelConfig, &channel);
+        }
+        if (err != ESP_OK)
+        {
+            SDK_LOGGER("❌ NeoPixel RMT channel creation failed: %d", err);
+            return false;
+        }
+
+        rmt_bytes_encoder_config_t encoderConfig = {};
+        encoderConfig.bit0.level0 = 1;
+        encoderConfig.bit0.duration0 = NEOPIXEL_T0H;
+        encoderConfig.bit0.level1 = 0;
+        encoderConfig.bit0.duration1 = NEOPIXEL_T0L;
+        encoderConfig.bit1.level0 = 1;
+        encoderConfig.bit1.duration0 = NEOPIXEL_T1H;
+        encoderConfig.bit1.level1 = 0;
+        encoderConfig.bit1.duration1 = NEOPIXEL_T1L;
+        encoderConfig.flags.msb_first = 1;
+
+        if (rmt_new_bytes_encoder(&encoderConfig, &encoder) != ESP_OK || rmt_enable(channel) != ESP_OK)
+        {
+            SDK_LOGGER("❌ NeoPixel RMT encoder setup failed");
+            return false;
+        }
+#else
+        size_t itemCount = frameBytes() * 8;
+        items[0] = (rmt_item32_t *)malloc(itemCount * sizeof(rmt_item32_t));
+        items[1] = (rmt_item32_t *)malloc(itemCount * sizeof(rmt_item32_t));
+        if (!items[0] || !items[1])
+        {
+            SDK_LOGGER("❌ NeoPixel RMT item buffer allocation failed");
+            return false;
+        }
+
+        rmt_config_t config = RMT_DEFAULT_CONFIG_TX((gpio_num_t)pin, LED_RMT_CHANNEL);
+        config.clk_div = APB_CLK_FREQ / NEOPIXEL_RMT_RESOLUTION_HZ; // 80 MHz / 8
+        config.mem_block_num = 1;
+
+        if (rmt_config(&config) != ESP_OK || rmt_driver_install(LED_RMT_CHANNEL, 0, 0) != ESP_OK)
+        {
+            SDK_LOGGER("❌ NeoPixel RMT driver install failed");
+            return false;
+        }
+#endif
+
+        ready = true;
+        SDK_LOGGER("✅ NeoPixel RMT output ready (%d pixels on GPIO %d)", count, pin);
+        return true;
+    }
+
+    // ============================================================================
+    // BACK BUFFER
+    // ============================================================================
+
+    void NeoPixelRMT::setPixelColor(uint16_t index, uint32_t color)
+    {
+        setPixelColor(index, (uint8_t)(color >> 16), (uint8_t)(color >> 8), (uint8_t)color);
+    }
+
+    void NeoPixelRMT::setPixelColor(uint16_t index, uint8_t r, uint8_t g, uint8_t b)
+    {
+        if (!pixels || index >= count)
+            return;
+
+        uint8_t *p = &pixels[index * 3];
+        p[0] = r;
+        p[1] = g;
+        p[2] = b;
+    }
+
+    uint32_t NeoPixelRMT::getPixelColor(uint16_t index) const
+    {
+        if (!pixels || index >= count)
+            return 0;
+
+        const uint8_t *p = &pixels[index * 3];
+        return Color(p[0], p[1], p[2]);
+    }
+
+    void NeoPixelRMT::clear()
+    {
+        if (pixels)
+            memset(pixels, 0, frameBytes());
+    }
+
+    // ============================================================================
+    // OUTPUT
+    // ============================================================================
+
+    uint32_t NeoPixelRMT::frameDurationUs() const
+    {
+        // 24 bits of 1.2 µs per pixel
+        return (uint32_t)count * 24 * (NEOPIXEL_T0H + NEOPIXEL_T0L) / 10;
+    }
+
+    bool NeoPixelRMT::show(bool force)
+    {
+        if (!ready)
+            return false;
+
+        // Encode into the buffer that is not in flight: scaled, GRB wire order
+        uint8_t next = hasSent ? sentIndex ^ 1 : 0;
+        uint8_t *out = wire[next];
+        uint16_t scale = (uint16_t)brightness + 1;
+        for (uint16_t i = 0; i < count; i++)
+        {
+            const uint8_t *p = &pixels[i * 3];
+            out[i * 3 + 0] = (uint8_t)((p[1] * scale) >> 8);
+            out[i * 3 + 1] = (uint8_t)((p[0] * scale) >> 8);
+            out[i * 3 + 2] = (uint8_t)((p[2] * scale) >> 8);
+        }
+
+        if (!force && hasSent && memcmp(out, wire[sentIndex], frameBytes()) == 0)
+        {
+            framesSkipped++;
+            return false;
+        }
+
+        // Previous frame out and latched before the next one starts
+        waitDone();
+        uint32_t sinceStart = micros() - lastStartUs;
+        uint32_t minGap = frameDurationUs() + NEOPIXEL_LATCH_US;
+        if (hasSent && sinceStart < minGap)
+            delayMicroseconds(minGap - sinceStart);
+
+        if (!transmit(next))
+            return false;
+
+        sentIndex = next;
+        hasSent = true;
+        lastStartUs = micros();
+        framesSent++;
+        return true;
+    }
+
+    bool NeoPixelRMT::transmit(uint8_t index)
+    {
+#ifdef USE_NEW_RMT_API
+        rmt_transmit_config_t txConfig = {};
+        txConfig.loop_count = 0;
+        esp_err_t err = rmt_transmit(channel, encoder, wire[index], frameBytes(), &txConfig);
+#else
+        rmt_item32_t *item = items[index];
+        const uint8_t *bytes = wire[index];
+        for (size_t i = 0; i < frameBytes(); i++)
+        {
+            for (int bit = 7; bit >= 0; bit--)
+            {
+                bool one = bytes[i] & (1 << bit);
+                item->level0 = 1;
+                item->duration0 = one ? NEOPIXEL_T1H : NEOPIXEL_T0H;
+                item->level1 = 0;
+                item->duration1 = one ? NEOPIXEL_T1L : NEOPIXEL_T0L;
+                item++;
+            }
+        }
+        esp_err_t err = rmt_write_items(LED_RMT_CHANNEL, items[index], frameBytes() * 8, false);
+#endif
+
+        if (err != ESP_OK)
+        {
+            SDK_LOGD(LED, "⚠️ NeoPixel RMT transmit failed: %d", err);
+            return false;
+        }
+        return true;
+    }
+
+    bool NeoPixelRMT::waitDone(uint32_t timeoutMs)
+    {
+        if (!ready || !hasSent)
+            return true;
+
+#ifdef USE_NEW_RMT_API
+        return rmt_tx_wait_all_done(channel, timeoutMs) == ESP_OK;
+#else
+        return rmt_wait_tx_done(LED_RMT_CHANNEL, pdMS_TO_TICKS(timeoutMs)) == ESP_OK;
+#endif
+    }
+}
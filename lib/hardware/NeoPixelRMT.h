@@ -0,0 +1,145 @@
+/**
+ * CloudMouse SDK - NeoPixel Output over RMT
+ *
+ * WS2812/NeoPixel driver that generates the bit timing in the RMT peripheral
+ * instead of bit-banging it with interrupts masked. show() encodes the frame
+ * and returns while the peripheral (DMA on ESP-IDF 5.x) is still sending it,
+ * so encoder, WiFi and timer interrupts keep running during the transfer.
+ *
+ * Frame Buffers:
+ * - Pixels are drawn into an unscaled RGB back buffer (setPixelColor)
+ * - show() scales by brightness into the next wire buffer (GRB) and compares it
+ *   with the frame sent last; identical frames are skipped
+ * - Two wire buffers alternate: the one in flight is never written to
+ *
+ * API Selection:
+ * - ESP-IDF 5.x: rmt_tx channel with DMA + bytes encoder (driver/rmt_tx.h)
+ * - ESP-IDF 4.4: legacy driver (driver/rmt.h) with a pre-built item buffer;
+ *   no DMA there, the driver refills channel memory from its ISR
+ *
+ * Interface:
+ * - Mirrors the subset of Adafruit_NeoPixel used by LEDManager (begin,
+ *   setPixelColor, setBrightness, show, Color), so callers only change the type
+ * - Brightness is applied when the frame is encoded, so it is not lossy
+ *
+ * Thread Safety:
+ * - Not synchronized: use from one task (the LED animation task)
+ */
+
+#ifndef NEOPIXEL_RMT_H
+#define NEOPIXEL_RMT_H
+
+#include <Arduino.h>
+#include <esp_idf_version.h>
+
+#if ESP_IDF_VERSION_MAJOR >= 5
+#include "driver/rmt_tx.h"
+#include "driver/rmt_encoder.h"
+#define USE_NEW_RMT_API
+#else
+#include "driver/rmt.h"
+#define USE_OLD_RMT_API
+#endif
+
+// Legacy driver channel (ESP32-S3 TX channels are 0-3)
+#ifndef LED_RMT_CHANNEL
+#define LED_RMT_CHANNEL RMT_CHANNEL_0
+#endif
+
+namespace CloudMouse::Hardware
+{
+    class NeoPixelRMT
+    {
+    public:
+        /**
+         * @param count Number of pixels on the strip
+         * @param pin Data GPIO
+         */
+        NeoPixelRMT(uint16_t count, int pin);
+        ~NeoPixelRMT();
+
+        /**
+         * Allocate the frame buffers and set up the RMT channel
+         *
+         * @return false if memory or the RMT channel could not be allocated
+         */
+        bool begin();
+
+        // ========================================================================
+        // BACK BUFFER
+        // ========================================================================
+
+        void setPixelColor(uint16_t index, uint32_t color);
+        void setPixelColor(uint16_t index, uint8_t r, uint8_t g, uint8_t b);
+        uint32_t getPixelColor(uint16_t index) const;
+        void clear();
+
+        /**
+         * Global brightness applied at encode time (255 = full)
+         */
+        void setBrightness(uint8_t value) { brightness = value; }
+        uint8_t getBrightness() const { return brightness; }
+
+        uint16_t numPixels() const { return count; }
+
+        /**
+         * Pack a color the way Adafruit_NeoPixel::Color() does (0x00RRGGBB)
+         */
+        static uint32_t Color(uint8_t r, uint8_t g, uint8_t b)
+        {
+            return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+        }
+
+        // ========================================================================
+        // OUTPUT
+        // ========================================================================
+
+        /**
+         * Send the back buffer if it differs from the frame sent last
+         * Waits only for the previous transfer (about 30 µs per pixel) and the
+         * latch gap, then returns while the new frame is being sent.
+         *
+         * @param force Send even if the frame is unchanged
+         * @return true if a frame was started
+         */
+        bool show(bool force = false);
+
+        /**
+         * Block until the current transfer is complete
+         */
+        bool waitDone(uint32_t timeoutMs = 10);
+
+        // Statistics
+        uint32_t getFramesSent() const { return framesSent; }
+        uint32_t getFramesSkipped() const { return framesSkipped; }
+
+    private:
+        uint16_t count;
+        int pin;
+        uint8_t brightness = 255;
+        bool ready = false;
+
+        uint8_t *pixels = nullptr;          // Back buffer, RGB, unscaled
+        uint8_t *wire[2] = {nullptr, nullptr}; // Encoded frames, GRB, scaled
+        uint8_t sentIndex = 0;              // wire[] holding the frame sent last
+        bool hasSent = false;
+        uint32_t lastStartUs = 0;
+
+        uint32_t framesSent = 0;
+        uint32_t framesSkipped = 0;
+
+        size_t frameBytes() const { return (size_t)count * 3; }
+        uint32_t frameDurationUs() const;
+
+        bool transmit(uint8_t index);
+
+#ifdef USE_NEW_RMT_API
+        rmt_channel_handle_t channel = nullptr;
+        rmt_encoder_handle_t encoder = nullptr;
+#else
+        rmt_item32_t *items[2] = {nullptr, nullptr}; // Per wire buffer, kept valid while in flight
+#endif
+    };
+}
+
+#endif
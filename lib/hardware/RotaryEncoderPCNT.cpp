@@ -17,6 +17,10 @@ void RotaryEncoderPCNT::init() {
     
     SDK_LOGGER("🔧 Initializing PCNT on pins A=%d, B=%d\n", pin_a, pin_b);
     
+    // Detent interrupts: the counter wraps to 0 at ±countsPerDetent
+    int16_t h_lim = detentCounts > 0 ? detentCounts : 32767;
+    int16_t l_lim = detentCounts > 0 ? -detentCounts : -32768;
+    
     // Configure GPIO pins with pull-up resistors
     pinMode(pin_a, INPUT_PULLUP);
     pinMode(pin_b, INPUT_PULLUP);
@@ -29,8 +33,8 @@ void RotaryEncoderPCNT::init() {
     pcnt_config_a.hctrl_mode = PCNT_MODE_REVERSE;
     pcnt_config_a.pos_mode = PCNT_COUNT_INC;
     pcnt_config_a.neg_mode = PCNT_COUNT_DEC;
-    pcnt_config_a.counter_h_lim = 32767;
-    pcnt_config_a.counter_l_lim = -32768;
+    pcnt_config_a.counter_h_lim = h_lim;
+    pcnt_config_a.counter_l_lim = l_lim;
     pcnt_config_a.unit = PCNT_UNIT_0;
     pcnt_config_a.channel = PCNT_CHANNEL_0;
     
@@ -48,8 +52,8 @@ void RotaryEncoderPCNT::init() {
     pcnt_config_b.hctrl_mode = PCNT_MODE_REVERSE;
     pcnt_config_b.pos_mode = PCNT_COUNT_DEC;
     pcnt_config_b.neg_mode = PCNT_COUNT_INC;
-    pcnt_config_b.counter_h_lim = 32767;
-    pcnt_config_b.counter_l_lim = -32768;
+    pcnt_config_b.counter_h_lim = h_lim;
+    pcnt_config_b.counter_l_lim = l_lim;
     pcnt_config_b.unit = PCNT_UNIT_0;
     pcnt_config_b.channel = PCNT_CHANNEL_1;
     
@@ -68,9 +72,24 @@ void RotaryEncoderPCNT::init() {
         }
     }
     
+    // Limit events: one interrupt per detent instead of one per GPIO edge
+    if (detentCounts > 0) {
+        pcnt_event_enable(PCNT_UNIT_0, PCNT_EVT_H_LIM);
+        pcnt_event_enable(PCNT_UNIT_0, PCNT_EVT_L_LIM);
+        
+        err = pcnt_isr_service_install(0);
+        if (err == ESP_OK || err == ESP_ERR_INVALID_STATE) {   // Already installed is fine
+            isrInstalled = pcnt_isr_handler_add(PCNT_UNIT_0, onLimitISR, this) == ESP_OK;
+        }
+        if (!isrInstalled) {
+            SDK_LOGGER("❌ PCNT limit interrupt setup failed: %d\n", err);
+        }
+    }
+    
     // Initialize counter
     pcnt_counter_pause(PCNT_UNIT_0);
     pcnt_counter_clear(PCNT_UNIT_0);
+    detents = 0;
     pcnt_counter_resume(PCNT_UNIT_0);
     
     SDK_LOGGER("✅ RotaryEncoder initialized (IDF 4.4 API)");
@@ -80,10 +99,10 @@ void RotaryEncoderPCNT::init() {
     
     SDK_LOGGER("🔧 Initializing PCNT on pins A=%d, B=%d\n", pin_a, pin_b);
     
-    // Configure PCNT unit
+    // Configure PCNT unit (counter wraps to 0 at ±countsPerDetent with detent interrupts)
     pcnt_unit_config_t unit_config = {
-        .low_limit = low_limit,
-        .high_limit = high_limit,
+        .low_limit = detentCounts > 0 ? (int)-detentCounts : low_limit,
+        .high_limit = detentCounts > 0 ? (int)detentCounts : high_limit,
     };
     pcnt_new_unit(&unit_config, &unit);
     
@@ -114,9 +133,23 @@ void RotaryEncoderPCNT::init() {
     pcnt_channel_set_edge_action(chan_b, PCNT_CHANNEL_EDGE_ACTION_INCREASE, PCNT_CHANNEL_EDGE_ACTION_DECREASE);
     pcnt_channel_set_level_action(chan_b, PCNT_CHANNEL_LEVEL_ACTION_KEEP, PCNT_CHANNEL_LEVEL_ACTION_INVERSE);
     
+    // Watch points at the limits: one interrupt per detent
+    if (detentCounts > 0) {
+        pcnt_unit_add_watch_point(unit, detentCounts);
+        pcnt_unit_add_watch_point(unit, -detentCounts);
+        
+        pcnt_event_callbacks_t callbacks = {
+            .on_reach = onWatchPoint,
+        };
+        if (pcnt_unit_register_event_callbacks(unit, &callbacks, this) != ESP_OK) {
+            SDK_LOGGER("❌ PCNT watch point callback registration failed");
+        }
+    }
+    
     // Enable and start unit
     pcnt_unit_enable(unit);
     pcnt_unit_clear_count(unit);
+    detents = 0;
     pcnt_unit_start(unit);
     
     SDK_LOGGER("✅ RotaryEncoder initialized (IDF 5.x API)");
@@ -132,6 +165,10 @@ void RotaryEncoderPCNT::deinit() {
     // ESP-IDF 4.4 cleanup
     pcnt_counter_pause(PCNT_UNIT_0);
     pcnt_counter_clear(PCNT_UNIT_0);
+    if (isrInstalled) {
+        pcnt_isr_handler_remove(PCNT_UNIT_0);
+        isrInstalled = false;
+    }
     SDK_LOGGER("🔧 PCNT deinitialized (IDF 4.4 API)");
     
 #elif defined(USE_NEW_PCNT_API)
@@ -162,7 +199,7 @@ int RotaryEncoderPCNT::position() {
     int16_t count = 0;
     esp_err_t err = pcnt_get_counter_value(PCNT_UNIT_0, &count);
     if (err == ESP_OK) {
-        value = count + offset;
+        value = detents * detentCounts + count + offset;
     } else {
         // Error handling: return last valid value
         static int last_valid = 0;
@@ -176,7 +213,7 @@ int RotaryEncoderPCNT::position() {
     if (unit) {
         esp_err_t err = pcnt_unit_get_count(unit, &temp_count);
         if (err == ESP_OK) {
-            value = temp_count + offset;
+            value = detents * detentCounts + temp_count + offset;
         } else {
             SDK_LOGGER("⚠️ PCNT read error: %d\n", err);
             value = offset; // Fallback to offset only
@@ -199,6 +236,7 @@ void RotaryEncoderPCNT::setPosition(int pos) {
     offset = pos;
     
     // Clear hardware counter to establish new zero point
+    detents = 0;
 #ifdef USE_OLD_PCNT_API
     pcnt_counter_clear(PCNT_UNIT_0);
     SDK_LOGGER("🔧 Position set to %d (IDF 4.4)\n", pos);
@@ -216,4 +254,44 @@ void RotaryEncoderPCNT::setPosition(int pos) {
 void RotaryEncoderPCNT::zero() {
     // Reset to default starting position
     setPosition(START_POS_DEFAULT);
-}
\ No newline at end of file
+}
+// ============================================================================
+// DETENT INTERRUPT IMPLEMENTATION
+// ============================================================================
+
+void RotaryEncoderPCNT::setDetentCallback(DetentCallback callback, void *arg, int16_t countsPerDetent) {
+    detentCallback = callback;
+    detentArg = arg;
+    detentCounts = callback ? countsPerDetent : 0;
+}
+
+void IRAM_ATTR RotaryEncoderPCNT::onDetent(int8_t direction) {
+    detents = detents + direction;
+    if (detentCallback) {
+        detentCallback(direction, detentArg);
+    }
+}
+
+#ifdef USE_OLD_PCNT_API
+void IRAM_ATTR RotaryEncoderPCNT::onLimitISR(void *arg) {
+    RotaryEncoderPCNT *self = static_cast<RotaryEncoderPCNT *>(arg);
+    uint32_t status = 0;
+    pcnt_get_event_status(PCNT_UNIT_0, &status);
+    
+    if (status & PCNT_EVT_H_LIM) {
+        self->onDetent(1);
+    } else if (status & PCNT_EVT_L_LIM) {
+        self->onDetent(-1);
+    }
+}
+
+#elif defined(USE_NEW_PCNT_API)
+bool IRAM_ATTR RotaryEncoderPCNT::onWatchPoint(pcnt_unit_handle_t unit, const pcnt_watch_event_data_t *edata, void *ctx) {
+    (void)unit;
+    RotaryEncoderPCNT *self = static_cast<RotaryEncoderPCNT *>(ctx);
+    self->onDetent(edata->watch_point_value > 0 ? 1 : -1);
+    
+    // The callback does its own portYIELD_FROM_ISR through vTaskNotifyGiveFromISR
+    return false;
+}
+#endif
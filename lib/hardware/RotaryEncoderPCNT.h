@@ -38,6 +38,12 @@
  * - Hardware state machine eliminates software debouncing requirements
  * - Immune to moderate electrical noise with glitch filtering
  * 
+ * Detent Interrupts (optional):
+ * - setDetentCallback() before init() narrows the counter limits to ±counts per
+ *   detent; the hardware clears the counter at each limit and raises an
+ *   interrupt, which adds one detent and calls the callback in ISR context
+ * - position() keeps counting across limits (detents × counts + counter)
+ *
  * Usage Pattern:
  * 1. Instantiate with pin assignments: RotaryEncoderPCNT encoder(pin_a, pin_b)
  * 2. Call init() to configure PCNT hardware
@@ -91,6 +97,12 @@
  */
 class RotaryEncoderPCNT {
 public:
+    /**
+     * Detent notification, called from the PCNT interrupt
+     * @param direction +1 clockwise, -1 counter-clockwise
+     */
+    typedef void (*DetentCallback)(int8_t direction, void *arg);
+
     // ========================================================================
     // CONSTRUCTORS - Flexible initialization options
     // ========================================================================
@@ -244,6 +256,17 @@ public:
      * Resets both hardware counter and offset to initial state
      */
     void zero();
+
+    /**
+     * Report every full detent from the PCNT limit interrupt
+     * Must be called before init(). The callback runs in ISR context: it must
+     * be short, IRAM-safe and use only FromISR FreeRTOS calls.
+     *
+     * @param callback Detent handler (nullptr = polling only)
+     * @param arg Passed back to the callback
+     * @param countsPerDetent Quadrature counts per physical detent (typically 4)
+     */
+    void setDetentCallback(DetentCallback callback, void *arg, int16_t countsPerDetent = 4);
     
     // ========================================================================
     // PUBLIC CONFIGURATION MEMBERS
@@ -262,7 +285,24 @@ private:
     pcnt_unit_handle_t unit = nullptr;      // PCNT unit handle
     pcnt_channel_handle_t chan_a = nullptr; // Channel A handle
     pcnt_channel_handle_t chan_b = nullptr; // Channel B handle
+
+    static bool IRAM_ATTR onWatchPoint(pcnt_unit_handle_t unit, const pcnt_watch_event_data_t *edata, void *ctx);
+#else
+    bool isrInstalled = false;
+
+    static void IRAM_ATTR onLimitISR(void *arg);
 #endif
+
+    // ========================================================================
+    // DETENT INTERRUPT STATE
+    // ========================================================================
+
+    DetentCallback detentCallback = nullptr;
+    void *detentArg = nullptr;
+    int16_t detentCounts = 0;               // 0 = full-range counter, no interrupts
+    volatile int32_t detents = 0;           // Detents counted by the limit interrupt
+
+    void onDetent(int8_t direction);
     
     // ========================================================================
     // INTERNAL STATE VARIABLES
@@ -0,0 +1,228 @@
+/**
+ * CloudMouse SDK - Simple Buzzer Implementation
+ *
+ * advance() takes the next queued tone and programs the LEDC channel, then arms
+ * the one-shot timer for the tone duration. It runs either in the caller that
+ * queues the first tone of an idle buzzer, or in the esp_timer task when the
+ * previous tone ends; the 'playing' flag makes sure only one of them owns the
+ * sequence at a time.
+ */
+
+#include "./SimpleBuzzer.h"
+#include "../utils/Logger.h"
+
+namespace CloudMouse::Hardware
+{
+    // LEDC resolution: 10 bits cover 50 Hz - 5 kHz with the default clock
+    static const ledc_timer_bit_t BUZZER_DUTY_RESOLUTION = LEDC_TIMER_10_BIT;
+    static const uint32_t BUZZER_DUTY_MAX = (1u << 10) - 1;
+
+    SimpleBuzzer::Tone SimpleBuzzer::queue[BUZZER_QUEUE_SIZE];
+    uint8_t SimpleBuzzer::queueHead = 0;
+    uint8_t SimpleBuzzer::queueCount = 0;
+    bool SimpleBuzzer::playing = false;
+    bool SimpleBuzzer::initialized = false;
+    esp_timer_handle_t SimpleBuzzer::timer = nullptr;
+    portMUX_TYPE SimpleBuzzer::lock = portMUX_INITIALIZER_UNLOCKED;
+
+    // ============================================================================
+    // INITIALIZATION
+    // ============================================================================
+
+    void SimpleBuzzer::init()
+    {
+        if (initialized)
+            return;
+
+        ledc_timer_config_t timerConfig = {};
+        timerConfig.speed_mode = BUZZER_LEDC_MODE;
+        timerConfig.duty_resolution = BUZZER_DUTY_RESOLUTION;
+        timerConfig.timer_num = BUZZER_LEDC_TIMER;
+        timerConfig.freq_hz = 1000;
+        timerConfig.clk_cfg = LEDC_AUTO_CLK;
+
+        ledc_channel_config_t channelConfig = {};
+        channelConfig.gpio_num = BUZZER_PIN;
+        channelConfig.speed_mode = BUZZER_LEDC_MODE;
+        channelConfig.channel = BUZZER_LEDC_CHANNEL;
+        channelConfig.timer_sel = BUZZER_LEDC_TIMER;
+        channelConfig.duty = 0; // Ensure buzzer starts silent
+        channelConfig.hpoint = 0;
+
+        if (ledc_timer_config(&timerConfig) != ESP_OK || ledc_channel_config(&channelConfig) != ESP_OK)
+        {
+            SDK_LOGGER("❌ Buzzer LEDC setup failed");
+            return;
+        }
+
+        esp_timer_create_args_t timerArgs = {};
+        timerArgs.callback = timerCallback;
+        timerArgs.dispatch_method = ESP_TIMER_TASK;
+        timerArgs.name = "buzzer";
+
+        if (esp_timer_create(&timerArgs, &timer) != ESP_OK)
+        {
+            SDK_LOGGER("❌ Buzzer sequencer timer creation failed");
+            return;
+        }
+
+        initialized = true;
+    }
+
+    // ============================================================================
+    // SOUND PATTERNS
+    // ============================================================================
+
+    void SimpleBuzzer::buzz()
+    {
+        static const Tone pattern[] = {
+            {740, 75, 20}, // High tone
+            {120, 75, 20}, // Low tone
+            {270, 75, 20}, // Medium tone
+        };
+        play(pattern, sizeof(pattern) / sizeof(pattern[0]));
+    }
+
+    void SimpleBuzzer::error()
+    {
+        static const Tone pattern[] = {
+            {230, 75, 20}, // Alert tone 1
+            {120, 75, 20}, // Alert tone 2
+            {230, 75, 20}, // Alert tone 1
+            {120, 75, 20}, // Alert tone 2
+            {230, 75, 20}, // Alert tone 1
+            {120, 75, 20}, // Alert tone 2
+        };
+        play(pattern, sizeof(pattern) / sizeof(pattern[0]));
+    }
+
+    void SimpleBuzzer::beep(int frequency, int duration)
+    {
+        buzzWithPWM(frequency, duration, 25);
+    }
+
+    void SimpleBuzzer::doubleBeep()
+    {
+        const Tone pattern[] = {
+            {800, 80, 25},
+            {0, 50, 0}, // Rest
+            {800, 80, 25},
+        };
+        play(pattern, sizeof(pattern) / sizeof(pattern[0]));
+    }
+
+    void SimpleBuzzer::buzzWithPWM(int frequency, int duration, int dutyCycle)
+    {
+        if (frequency < 0 || duration <= 0)
+            return;
+
+        Tone tone;
+        tone.frequency = (uint16_t)constrain(frequency, 0, 20000);
+        tone.duration = (uint16_t)constrain(duration, 1, 60000);
+        tone.dutyCycle = (uint8_t)constrain(dutyCycle, 0, 100);
+        play(&tone, 1);
+    }
+
+    // ============================================================================
+    // SEQUENCER
+    // ============================================================================
+
+    bool SimpleBuzzer::play(const Tone *tones, size_t count)
+    {
+        if (!initialized || !tones)
+            return false;
+
+        bool start = false;
+        size_t queued = 0;
+
+        portENTER_CRITICAL(&lock);
+        while (queued < count && queueCount < BUZZER_QUEUE_SIZE)
+        {
+            queue[(queueHead + queueCount) % BUZZER_QUEUE_SIZE] = tones[queued++];
+            queueCount++;
+        }
+        if (!playing && queueCount > 0)
+        {
+            playing = true;
+            start = true;
+        }
+        portEXIT_CRITICAL(&lock);
+
+        // Idle buzzer: the first tone starts here, the timer takes over from there
+        if (start)
+            advance();
+
+        if (queued < count)
+        {
+            SDK_LOGD(GENERAL, "⚠️ Buzzer queue full - %d tones dropped", (int)(count - queued));
+            return false;
+        }
+        return true;
+    }
+
+    void SimpleBuzzer::silence()
+    {
+        portENTER_CRITICAL(&lock);
+        queueCount = 0;
+        playing = false;
+        portEXIT_CRITICAL(&lock);
+
+        if (timer)
+            esp_timer_stop(timer);
+        if (initialized)
+            output(0, 0);
+    }
+
+    bool SimpleBuzzer::isPlaying()
+    {
+        portENTER_CRITICAL(&lock);
+        bool active = playing;
+        portEXIT_CRITICAL(&lock);
+        return active;
+    }
+
+    void SimpleBuzzer::advance()
+    {
+        Tone tone = {0, 0, 0};
+        bool hasTone = false;
+
+        portENTER_CRITICAL(&lock);
+        if (playing && queueCount > 0)
+        {
+            tone = queue[queueHead];
+            queueHead = (queueHead + 1) % BUZZER_QUEUE_SIZE;
+            queueCount--;
+            hasTone = true;
+        }
+        else
+        {
+            playing = false;
+        }
+        portEXIT_CRITICAL(&lock);
+
+        output(tone.frequency, tone.dutyCycle);
+
+        if (hasTone)
+            esp_timer_start_once(timer, (uint64_t)tone.duration * 1000);
+    }
+
+    void SimpleBuzzer::timerCallback(void *arg)
+    {
+        (void)arg;
+        advance();
+    }
+
+    void SimpleBuzzer::output(uint16_t frequency, uint8_t dutyCycle)
+    {
+        if (frequency == 0 || dutyCycle == 0)
+        {
+            ledc_set_duty(BUZZER_LEDC_MODE, BUZZER_LEDC_CHANNEL, 0);
+            ledc_update_duty(BUZZER_LEDC_MODE, BUZZER_LEDC_CHANNEL);
+            return;
+        }
+
+        ledc_set_freq(BUZZER_LEDC_MODE, BUZZER_LEDC_TIMER, frequency);
+        ledc_set_duty(BUZZER_LEDC_MODE, BUZZER_LEDC_CHANNEL, (BUZZER_DUTY_MAX * dutyCycle) / 100);
+        ledc_update_duty(BUZZER_LEDC_MODE, BUZZER_LEDC_CHANNEL);
+    }
+};
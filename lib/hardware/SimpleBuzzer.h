@@ -5,30 +5,45 @@
  * Provides pre-configured sound patterns for common user interactions and system events.
  *
  * Features:
- * - Software PWM generation for precise frequency control
+ * - Hardware PWM (LEDC) tone generation, no CPU time spent while a tone plays
  * - Pre-defined sound patterns for success, error, and notification events
  * - Configurable frequency, duration, and duty cycle parameters
- * - Non-blocking sound generation with microsecond timing precision
- * - Low-level GPIO control for compatibility with various buzzer types
+ * - Non-blocking: every call queues tones and returns immediately
+ *
+ * Sequencer:
+ * - Tones (and silent rests) wait in a fixed queue of BUZZER_QUEUE_SIZE entries
+ * - A one-shot esp_timer fires at the end of each tone and starts the next one
+ * - Patterns queued while another one plays are appended after it; when the
+ *   queue is full the extra tones are dropped
  *
  * Hardware Requirements:
  * - Piezo buzzer or passive speaker connected to GPIO pin 14
  * - Optional: Current limiting resistor (100-330Ω) for protection
+ * - LEDC timer 2 / channel 5 (the backlight uses channel 7 on timer 3)
  *
  * Usage:
  * 1. Call init() during system initialization
  * 2. Use buzz() for positive feedback (button clicks, confirmations)
  * 3. Use error() for negative feedback (failures, warnings)
- * 4. Use buzzWithPWM() for custom sound patterns
+ * 4. Use buzzWithPWM() or play() for custom sound patterns
+ *
+ * Thread Safety:
+ * - All methods may be called from any task (not from ISRs)
  */
 
 #ifndef SIMPLE_BUZZER_H
 #define SIMPLE_BUZZER_H
 
 #include <Arduino.h>
+#include <driver/ledc.h>
+#include <esp_timer.h>
 
 // Hardware configuration
 #define BUZZER_PIN 14
+#define BUZZER_LEDC_MODE LEDC_LOW_SPEED_MODE
+#define BUZZER_LEDC_TIMER LEDC_TIMER_2
+#define BUZZER_LEDC_CHANNEL LEDC_CHANNEL_5
+#define BUZZER_QUEUE_SIZE 32
 
 namespace CloudMouse::Hardware
 {
@@ -36,16 +51,23 @@ namespace CloudMouse::Hardware
     class SimpleBuzzer
     {
     public:
+        /**
+         * One step of a sound pattern
+         * frequency 0 is a silent rest of the given duration.
+         */
+        struct Tone
+        {
+            uint16_t frequency; // Hz (50-5000 recommended range)
+            uint16_t duration;  // Milliseconds
+            uint8_t dutyCycle;  // Percent (1-99, typical: 10-50)
+        };
+
         /**
          * Initialize buzzer hardware
-         * Configures GPIO pin as output for buzzer control
+         * Configures the LEDC timer/channel and the sequencer timer
          * Call once during system setup
          */
-        static void init()
-        {
-            pinMode(BUZZER_PIN, OUTPUT);
-            digitalWrite(BUZZER_PIN, LOW); // Ensure buzzer starts silent
-        }
+        static void init();
 
         /**
          * Play positive feedback sound pattern
@@ -53,14 +75,9 @@ namespace CloudMouse::Hardware
          * Use for: button confirmations, successful operations, positive notifications
          *
          * Pattern: High → Low → Medium frequency tones
-         * Total duration: ~225ms
+         * Total duration: ~225ms (played in the background)
          */
-        static void buzz()
-        {
-            buzzWithPWM(740, 75, 20); // High tone
-            buzzWithPWM(120, 75, 20); // Low tone
-            buzzWithPWM(270, 75, 20); // Medium tone
-        }
+        static void buzz();
 
         /**
          * Play error/warning sound pattern
@@ -68,58 +85,44 @@ namespace CloudMouse::Hardware
          * Use for: errors, warnings, failed operations, critical notifications
          *
          * Pattern: Alternating mid-low frequency tones (6 tones total)
-         * Total duration: ~450ms
+         * Total duration: ~450ms (played in the background)
          */
-        static void error()
-        {
-            buzzWithPWM(230, 75, 20); // Alert tone 1
-            buzzWithPWM(120, 75, 20); // Alert tone 2
-            buzzWithPWM(230, 75, 20); // Alert tone 1
-            buzzWithPWM(120, 75, 20); // Alert tone 2
-            buzzWithPWM(230, 75, 20); // Alert tone 1
-            buzzWithPWM(120, 75, 20); // Alert tone 2
-        }
+        static void error();
 
         /**
-         * Generate custom PWM tone with precise control
-         * Creates square wave signal with specified parameters
+         * Queue a custom PWM tone
          *
          * @param frequency Tone frequency in Hz (50-5000 recommended range)
          * @param duration Sound duration in milliseconds
          * @param dutyCycle PWM duty cycle percentage (1-99, typical: 10-50)
          *
          * Technical notes:
-         * - Uses software PWM for precise timing control
          * - Higher duty cycles = louder volume but more power consumption
          * - Lower frequencies = deeper tones, higher frequencies = sharper tones
-         * - Function blocks execution for specified duration
+         * - Returns immediately; the tone starts after the ones already queued
          */
-        static void buzzWithPWM(int frequency, int duration, int dutyCycle)
-        {
-            // Calculate PWM timing parameters
-            int period = 1000000 / frequency;       // Period in microseconds
-            int pulse = (period * dutyCycle) / 100; // High pulse duration
-
-            // Generate PWM signal for specified duration
-            unsigned long startTime = millis();
-            while (millis() - startTime < duration)
-            {
-                digitalWrite(BUZZER_PIN, HIGH);
-                delayMicroseconds(pulse); // High phase
-                digitalWrite(BUZZER_PIN, LOW);
-                delayMicroseconds(period - pulse); // Low phase
-            }
-        }
+        static void buzzWithPWM(int frequency, int duration, int dutyCycle);
+
+        /**
+         * Queue a sound pattern
+         *
+         * @param tones Pattern steps (copied)
+         * @param count Number of steps
+         * @return false if some steps did not fit in the queue
+         */
+        static bool play(const Tone *tones, size_t count);
 
         /**
          * Silence buzzer immediately
-         * Ensures buzzer output is low (silent state)
+         * Stops the current tone and drops everything queued
          * Use for emergency stop or cleanup
          */
-        static void silence()
-        {
-            digitalWrite(BUZZER_PIN, LOW);
-        }
+        static void silence();
+
+        /**
+         * Check whether a pattern is playing or queued
+         */
+        static bool isPlaying();
 
         /**
          * Play single short beep
@@ -129,22 +132,27 @@ namespace CloudMouse::Hardware
          * @param frequency Optional frequency in Hz (default: 1000Hz)
          * @param duration Optional duration in ms (default: 100ms)
          */
-        static void beep(int frequency = 1000, int duration = 100)
-        {
-            buzzWithPWM(frequency, duration, 25);
-        }
+        static void beep(int frequency = 1000, int duration = 100);
 
         /**
          * Play double beep pattern
          * Two quick beeps for intermediate feedback
          * Use for: mode changes, setting confirmations, intermediate states
          */
-        static void doubleBeep()
-        {
-            beep(800, 80);
-            delay(50);
-            beep(800, 80);
-        }
+        static void doubleBeep();
+
+    private:
+        static Tone queue[BUZZER_QUEUE_SIZE];
+        static uint8_t queueHead;
+        static uint8_t queueCount;
+        static bool playing;
+        static bool initialized;
+        static esp_timer_handle_t timer;
+        static portMUX_TYPE lock;
+
+        static void advance();
+        static void timerCallback(void *arg);
+        static void output(uint16_t frequency, uint8_t dutyCycle);
     };
 };
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,186 @@
+/**
+ * CloudMouse SDK - UI State Store Implementation
+ */
+
+#include "./UiStateStore.h"
+#include "../utils/Logger.h"
+
+namespace CloudMouse::Hardware
+{
+    // ============================================================================
+    // BINDINGS
+    // ============================================================================
+
+    UiStateStore::Handle UiStateStore::bind(lv_obj_t *label, Formatter formatter, const void *context, int32_t initial)
+    {
+        if (!label || !formatter)
+            return INVALID_HANDLE;
+
+        // One binding per label: the delete callback unbinds by label
+        int slot = -1;
+        for (int i = 0; i < UI_STATE_MAX_BINDINGS; i++)
+        {
+            if (bindings[i].label == label)
+            {
+                slot = i;
+                break;
+            }
+            if (slot < 0 && !bindings[i].label)
+                slot = i;
+        }
+
+        if (slot < 0)
+        {
+            SDK_LOGW(DISPLAY, "⚠️ UI state store full (%d bindings)", UI_STATE_MAX_BINDINGS);
+            return INVALID_HANDLE;
+        }
+
+        Binding &binding = bindings[slot];
+        if (binding.label != label)
+            lv_obj_add_event_cb(label, onLabelDeleted, LV_EVENT_DELETE, this);
+
+        binding.label = label;
+        binding.formatter = formatter;
+        binding.context = context;
+        binding.value = initial;
+        binding.dirty = false;
+        write(binding);
+
+        return (Handle)(binding.generation << 8 | slot);
+    }
+
+    UiStateStore::Handle UiStateStore::bind(lv_obj_t *label, const char *format, int32_t initial)
+    {
+        return bind(label, formatPrintf, format, initial);
+    }
+
+    void UiStateStore::unbind(Handle handle)
+    {
+        int slot = slotOf(handle);
+        if (slot < 0)
+            return;
+
+        lv_obj_remove_event_cb_with_user_data(bindings[slot].label, onLabelDeleted, this);
+        release(bindings[slot]);
+    }
+
+    void UiStateStore::onLabelDeleted(lv_event_t *e)
+    {
+        UiStateStore *self = (UiStateStore *)lv_event_get_user_data(e);
+        lv_obj_t *label = (lv_obj_t *)lv_event_get_target(e);
+
+        for (int i = 0; i < UI_STATE_MAX_BINDINGS; i++)
+        {
+            if (self->bindings[i].label == label)
+            {
+                self->release(self->bindings[i]);
+                break;
+            }
+        }
+    }
+
+    // Bound slot of a handle, -1 if the handle is stale
+    int UiStateStore::slotOf(Handle handle) const
+    {
+        int slot = handle & 0xFF;
+        if (slot >= UI_STATE_MAX_BINDINGS)
+            return -1;
+
+        const Binding &binding = bindings[slot];
+        if (!binding.label || binding.generation != (uint8_t)(handle >> 8))
+            return -1;
+        return slot;
+    }
+
+    // Free a slot; handles given out for it stop matching
+    void UiStateStore::release(Binding &binding)
+    {
+        uint8_t generation = binding.generation + 1;
+        binding = Binding();
+        binding.generation = generation;
+    }
+
+    // ============================================================================
+    // STATE UPDATES
+    // ============================================================================
+
+    void UiStateStore::set(Handle handle, int32_t value)
+    {
+        int slot = slotOf(handle);
+        if (slot < 0)
+            return;
+
+        Binding &binding = bindings[slot];
+        if (binding.value == value)
+            return;
+
+        changes++;
+        if (binding.dirty)
+            coalesced++;
+
+        binding.value = value;
+        binding.dirty = true;
+    }
+
+    int32_t UiStateStore::get(Handle handle) const
+    {
+        int slot = slotOf(handle);
+        return slot >= 0 ? bindings[slot].value : 0;
+    }
+
+    uint32_t UiStateStore::flush()
+    {
+        uint32_t written = 0;
+        for (int i = 0; i < UI_STATE_MAX_BINDINGS; i++)
+        {
+            Binding &binding = bindings[i];
+            if (!binding.dirty)
+                continue;
+
+            binding.dirty = false;
+            formats++;
+            if (write(binding))
+                written++;
+        }
+        return written;
+    }
+
+    bool UiStateStore::write(Binding &binding)
+    {
+        char text[UI_STATE_TEXT_MAX];
+        binding.formatter(text, sizeof(text), binding.value, binding.context);
+        text[sizeof(text) - 1] = '\0';
+
+        // Different values may format the same (e.g. thresholds): no redraw then
+        const char *shown = lv_label_get_text(binding.label);
+        if (shown && strcmp(shown, text) == 0)
+            return false;
+
+        lv_label_set_text(binding.label, text);
+        writes++;
+        return true;
+    }
+
+    void UiStateStore::formatPrintf(char *buffer, size_t size, int32_t value, const void *context)
+    {
+        snprintf(buffer, size, (const char *)context, (long)value);
+    }
+
+    // ============================================================================
+    // REPORT
+    // ============================================================================
+
+    void UiStateStore::printStats() const
+    {
+        int bound = 0;
+        for (int i = 0; i < UI_STATE_MAX_BINDINGS; i++)
+        {
+            if (bindings[i].label)
+                bound++;
+        }
+
+        SDK_LOGGER("   UI state: %d/%d bindings, %lu changes (%lu coalesced), %lu formatted, %lu label writes",
+                   bound, UI_STATE_MAX_BINDINGS, (unsigned long)changes, (unsigned long)coalesced,
+                   (unsigned long)formats, (unsigned long)writes);
+    }
+}
@@ -0,0 +1,120 @@
+/**
+ * CloudMouse SDK - UI State Store
+ *
+ * Binds integer state values to LVGL labels through a formatter, so event
+ * handlers only update state and the label text is formatted and
+ * invalidated at most once per frame.
+ *
+ * Flow:
+ * - Screen builders bind() a label with a formatter (or printf format) and
+ *   an initial value; the text is written once at bind time
+ * - Event handlers call set(): a value equal to the current one is ignored,
+ *   a new value only marks the binding dirty
+ * - DisplayManager::update() calls flush() once, after the event drain and
+ *   before LVGL renders: dirty bindings are formatted and the label is only
+ *   touched when the text differs from what it shows
+ * A burst of rotation events in one update() therefore costs one format and
+ * one invalidation per label instead of one per event.
+ *
+ * Lifetime:
+ * - Bound labels are unbound automatically when LVGL deletes them (screen
+ *   eviction, DISPLAY_CLEAR); set() on a stale handle is a no-op
+ * - A handle carries the slot generation, bumped each time a slot is freed,
+ *   so a stale handle does not reach the label that reuses its slot (up to
+ *   256 reuses of one slot)
+ * - One binding per label: binding a label again replaces its binding
+ *
+ * Usage (custom DisplayManager, see registerAppCallback()):
+ *   temp = store.bind(label, "Temp: %ld C", 0);
+ *   ... event handler: store.set(temp, event.value);
+ *
+ * Thread Safety:
+ * - UI task only (same as every LVGL call)
+ */
+
+#ifndef UI_STATE_STORE_H
+#define UI_STATE_STORE_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include "../config/DeviceConfig.h"
+
+namespace CloudMouse::Hardware
+{
+    class UiStateStore
+    {
+    public:
+        typedef uint16_t Handle; // Generation << 8 | slot
+        static const Handle INVALID_HANDLE = 0xFFFF;
+
+        /**
+         * Write the text for a value into buffer (always null terminated)
+         *
+         * @param context Pointer given to bind()
+         */
+        typedef void (*Formatter)(char *buffer, size_t size, int32_t value, const void *context);
+
+        /**
+         * Bind a label to a value rendered by a formatter
+         *
+         * @return Handle for set(), INVALID_HANDLE if the table is full
+         */
+        Handle bind(lv_obj_t *label, Formatter formatter, const void *context, int32_t initial);
+
+        /**
+         * Bind a label to a value rendered with a printf format taking one long (%ld)
+         *
+         * @param format String literal (only the pointer is stored)
+         */
+        Handle bind(lv_obj_t *label, const char *format, int32_t initial);
+
+        void unbind(Handle handle);
+
+        /**
+         * Update a value; the label follows at the next flush() if it changed
+         */
+        void set(Handle handle, int32_t value);
+
+        int32_t get(Handle handle) const;
+
+        /**
+         * Format and write dirty bindings (once per update(), before rendering)
+         *
+         * @return Labels whose text changed
+         */
+        uint32_t flush();
+
+        /**
+         * Print binding count and update counters (frame profiler report)
+         */
+        void printStats() const;
+
+    private:
+        struct Binding
+        {
+            lv_obj_t *label = nullptr; // nullptr = free slot
+            Formatter formatter = nullptr;
+            const void *context = nullptr;
+            int32_t value = 0;
+            bool dirty = false;
+            uint8_t generation = 0; // Kept when the slot is freed, then bumped
+        };
+
+        Binding bindings[UI_STATE_MAX_BINDINGS];
+
+        // Counters since boot
+        uint32_t changes = 0;   // set() calls with a new value
+        uint32_t coalesced = 0; // New values replacing one not flushed yet
+        uint32_t formats = 0;   // Formatter runs in flush()
+        uint32_t writes = 0;    // Labels actually updated (and invalidated)
+
+        bool write(Binding &binding);
+        int slotOf(Handle handle) const;
+        void release(Binding &binding);
+
+        static void formatPrintf(char *buffer, size_t size, int32_t value, const void *context);
+        static void onLabelDeleted(lv_event_t *e);
+    };
+}
+
+#endif
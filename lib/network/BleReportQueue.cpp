@@ -0,0 +1,325 @@
+/**
+ * CloudMouse SDK - Paced BLE HID Report Queue Implementation
+ */
+
+#include "./BleReportQueue.h"
+#include <esp_timer.h>
+#include <string.h>
+#include "../utils/Logger.h"
+
+namespace CloudMouse::Network
+{
+    // ============================================================================
+    // LIFECYCLE
+    // ============================================================================
+
+    bool BleReportQueue::begin(BleKeyboard *bleKeyboard)
+    {
+        if (task || !bleKeyboard)
+            return task != nullptr;
+
+        lock = xSemaphoreCreateMutex();
+        space = xSemaphoreCreateBinary();
+        if (!lock || !space)
+        {
+            SDK_LOGGER("❌ BLE report queue: out of memory");
+            end();
+            return false;
+        }
+
+        keyboard = bleKeyboard;
+        xTaskCreatePinnedToCore(
+            taskFunction,
+            "BLE_HID",
+            3072,
+            this,
+            BLE_HID_TASK_PRIORITY,
+            &task,
+            BLE_HID_TASK_CORE);
+
+        if (!task)
+        {
+            SDK_LOGGER("❌ BLE report task could not be started");
+            end();
+            return false;
+        }
+
+        keyboard->setReportSink(sink, this);
+        return true;
+    }
+
+    void BleReportQueue::end()
+    {
+        if (keyboard)
+        {
+            keyboard->setReportSink(nullptr, nullptr);
+            keyboard = nullptr;
+        }
+        if (task)
+        {
+            vTaskDelete(task);
+            task = nullptr;
+        }
+        if (lock)
+        {
+            vSemaphoreDelete(lock);
+            lock = nullptr;
+        }
+        if (space)
+        {
+            vSemaphoreDelete(space);
+            space = nullptr;
+        }
+        head = 0;
+        count = 0;
+    }
+
+    // ============================================================================
+    // SUBMISSION
+    // ============================================================================
+
+    bool BleReportQueue::sink(void *context, uint8_t reportId, const uint8_t *report, size_t length)
+    {
+        return static_cast<BleReportQueue *>(context)->submit(reportId, report, length);
+    }
+
+    bool BleReportQueue::submit(uint8_t reportId, const uint8_t *report, size_t length)
+    {
+        if (!task || length > sizeof(ring[0].data))
+            return false;
+
+        bool isKeyboard = length == sizeof(KeyReport);
+        KeyReport keys = {};
+        if (isKeyboard)
+            memcpy(&keys, report, sizeof(keys));
+
+        TickType_t waitStart = xTaskGetTickCount();
+        TickType_t waitLimit = pdMS_TO_TICKS(BLE_HID_QUEUE_TIMEOUT_MS);
+
+        while (true)
+        {
+            xSemaphoreTake(lock, portMAX_DELAY);
+
+            if (isKeyboard && mergeKeyboard(keys, lastQueuedTicket + 1))
+            {
+                lastQueuedTicket++;
+                xSemaphoreGive(lock);
+                return true;
+            }
+
+            if (count < BLE_HID_QUEUE_DEPTH)
+                break;
+
+            xSemaphoreGive(lock);
+
+            // Full: wait for the task to make room; a token may be left from an
+            // earlier pop, so the count is checked again until the time is up
+            TickType_t waited = xTaskGetTickCount() - waitStart;
+            if (waited < waitLimit && xSemaphoreTake(space, waitLimit - waited) == pdTRUE)
+                continue;
+
+            xSemaphoreTake(lock, portMAX_DELAY);
+            if (count < BLE_HID_QUEUE_DEPTH)
+                break;
+
+            bool folded = replaceNewest(reportId, report, length);
+            if (folded)
+            {
+                foldedCount++;
+                if (isKeyboard)
+                    lastKeys = keys;
+            }
+            else
+            {
+                droppedCount++;
+            }
+            xSemaphoreGive(lock);
+            SDK_LOGD(NETWORK, "⚠️ BLE report queue full - report %s", folded ? "folded" : "dropped");
+            return folded;
+        }
+
+        Report &slot = ring[(head + count) % BLE_HID_QUEUE_DEPTH];
+        slot.ticket = ++lastQueuedTicket;
+        slot.reportId = reportId;
+        slot.length = (uint8_t)length;
+        memcpy(slot.data, report, length);
+        count++;
+        if (count > highWater)
+            highWater = count;
+
+        if (isKeyboard)
+        {
+            previousKeys = lastKeys;
+            lastKeys = keys;
+        }
+
+        xSemaphoreGive(lock);
+        xTaskNotifyGive(task);
+        return true;
+    }
+
+    bool BleReportQueue::mergeKeyboard(const KeyReport &keys, uint32_t ticket)
+    {
+        if (count == 0)
+            return false;
+
+        // Only the newest entry can change: older ones keep their order
+        Report &newest = ring[(head + count - 1) % BLE_HID_QUEUE_DEPTH];
+        if (newest.length != sizeof(KeyReport) || !isEmpty(*(const KeyReport *)newest.data))
+            return false;
+
+        // The host must see the release if a key repeats
+        if (sharesKey(previousKeys, keys))
+            return false;
+
+        // A modifier held across the release is fine only together with a new key
+        bool hasKey = false;
+        for (int i = 0; i < 6; i++)
+            hasKey |= keys.keys[i] != 0;
+        if (!hasKey && (keys.modifiers & previousKeys.modifiers))
+            return false;
+
+        memcpy(newest.data, &keys, sizeof(keys));
+        newest.ticket = ticket;
+        lastKeys = keys;
+        mergedCount++;
+        return true;
+    }
+
+    bool BleReportQueue::replaceNewest(uint8_t reportId, const uint8_t *report, size_t length)
+    {
+        // Keeps the entry's ticket: tickets must stay in queue order
+        for (int i = count - 1; i >= 0; i--)
+        {
+            Report &entry = ring[(head + i) % BLE_HID_QUEUE_DEPTH];
+            if (entry.reportId != reportId || entry.length != length)
+                continue;
+
+            // A queued release must reach the host, or the keys before it stay down
+            if (length == sizeof(KeyReport) && isEmpty(*(const KeyReport *)entry.data))
+                return false;
+
+            memcpy(entry.data, report, length);
+            return true;
+        }
+        return false;
+    }
+
+    int BleReportQueue::clear()
+    {
+        if (!lock)
+            return 0;
+
+        xSemaphoreTake(lock, portMAX_DELAY);
+        int discarded = count;
+        droppedCount += discarded;
+        head = 0;
+        count = 0;
+        previousKeys = KeyReport();
+        lastKeys = KeyReport();
+        lastDoneTicket = lastQueuedTicket;
+        uint32_t ticket = lastDoneTicket;
+        xSemaphoreGive(lock);
+        xSemaphoreGive(space);
+
+        if (discarded)
+        {
+            SDK_LOGGER("🔵 BLE report queue cleared: %d reports discarded\n", discarded);
+            if (onComplete)
+                onComplete(ticket, false);
+        }
+        return discarded;
+    }
+
+    // ============================================================================
+    // DELIVERY TASK
+    // ============================================================================
+
+    uint32_t BleReportQueue::getReportIntervalUs() const
+    {
+        uint32_t interval = keyboard ? keyboard->getConnectionIntervalUs() : 0;
+        if (interval == 0)
+            interval = BLE_HID_DEFAULT_INTERVAL_US;
+        return interval < BLE_HID_MIN_INTERVAL_US ? BLE_HID_MIN_INTERVAL_US : interval;
+    }
+
+    bool BleReportQueue::isEmpty(const KeyReport &keys)
+    {
+        if (keys.modifiers)
+            return false;
+        for (int i = 0; i < 6; i++)
+            if (keys.keys[i])
+                return false;
+        return true;
+    }
+
+    bool BleReportQueue::sharesKey(const KeyReport &a, const KeyReport &b)
+    {
+        for (int i = 0; i < 6; i++)
+        {
+            if (!b.keys[i])
+                continue;
+            for (int j = 0; j < 6; j++)
+                if (a.keys[j] == b.keys[i])
+                    return true;
+        }
+        return false;
+    }
+
+    void BleReportQueue::taskFunction(void *parameter)
+    {
+        static_cast<BleReportQueue *>(parameter)->run();
+    }
+
+    void BleReportQueue::run()
+    {
+        int64_t nextSendUs = 0;
+
+        while (true)
+        {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+            while (true)
+            {
+                // One report per connection interval; later reports may merge meanwhile
+                int64_t waitUs = nextSendUs - esp_timer_get_time();
+                if (waitUs > 0)
+                {
+                    TickType_t ticks = pdMS_TO_TICKS((waitUs + 999) / 1000);
+                    vTaskDelay(ticks ? ticks : 1);
+                }
+
+                Report report;
+                xSemaphoreTake(lock, portMAX_DELAY);
+                if (count == 0)
+                {
+                    xSemaphoreGive(lock);
+                    break;
+                }
+                report = ring[head];
+                head = (head + 1) % BLE_HID_QUEUE_DEPTH;
+                count--;
+                bool drained = count == 0;
+                xSemaphoreGive(lock);
+                xSemaphoreGive(space);
+
+                if (!keyboard->notifyReport(report.reportId, report.data, report.length))
+                {
+                    // Host gone: nothing queued can be delivered
+                    droppedCount++;
+                    lastDoneTicket = report.ticket;
+                    if (clear() == 0 && onComplete)
+                        onComplete(report.ticket, false);
+                    break;
+                }
+
+                sentCount++;
+                lastDoneTicket = report.ticket;
+                nextSendUs = esp_timer_get_time() + getReportIntervalUs();
+
+                if (drained && onComplete)
+                    onComplete(report.ticket, true);
+            }
+        }
+    }
+} // namespace CloudMouse::Network
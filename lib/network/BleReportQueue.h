@@ -0,0 +1,165 @@
+/**
+ * CloudMouse SDK - Paced BLE HID Report Queue
+ *
+ * Non-blocking delivery of BleKeyboard reports. Installed as the keyboard's
+ * report sink by BluetoothManager, so press()/release()/write() return as soon
+ * as the report is copied; a dedicated task notifies the host.
+ *
+ * Pacing:
+ * - One report per negotiated BLE connection interval (tracked by BleKeyboard
+ *   from the connect event and later parameter updates), never faster than
+ *   BLE_HID_MIN_INTERVAL_US; BLE_HID_DEFAULT_INTERVAL_US while unknown
+ * - Replaces the busy-wait BleKeyboard did after every report
+ *
+ * Merging (keyboard reports only):
+ * - A queued "all keys up" report followed by a press of different keys is
+ *   replaced by that press: the host sees the old keys released and the new
+ *   ones pressed in one report, which halves the reports when typing text
+ * - Not merged when a key (or, without new keys, a modifier) repeats, because
+ *   then the host must see the release
+ * - Consumer (media) reports are never merged
+ *
+ * Completion:
+ * - Every report gets a ticket; getTicket() returns the one of the last
+ *   report submitted, isDone(ticket) tells when it was sent
+ * - The completion callback runs in the queue task whenever the queue drains
+ *   (delivered = false when it was cleared because the host disconnected)
+ *
+ * Backpressure:
+ * - A full queue blocks the caller up to BLE_HID_QUEUE_TIMEOUT_MS, then the
+ *   report overwrites the newest queued report of the same kind (counted as
+ *   folded), so the host still ends in the final key state
+ * - A queued keyboard release is never overwritten (the keys before it would
+ *   stay down): if the newest keyboard report is a release, the new report
+ *   is dropped instead, which leaves the host with those keys up
+ *
+ * Thread Safety:
+ * - submit() may be called from any task; the callback must not block
+ */
+
+#pragma once
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include <functional>
+#include <BleKeyboard.h>
+#include "../config/DeviceConfig.h"
+
+namespace CloudMouse::Network
+{
+    /**
+     * Called when the queue drains
+     *
+     * @param ticket Ticket of the last report handled
+     * @param delivered false if pending reports were discarded (disconnect)
+     */
+    using BleReportCompleteCallback = std::function<void(uint32_t ticket, bool delivered)>;
+
+    class BleReportQueue
+    {
+    public:
+        BleReportQueue() = default;
+        ~BleReportQueue() { end(); }
+
+        /**
+         * Start the delivery task and install the queue as the keyboard's report sink
+         *
+         * @param keyboard Started BleKeyboard instance
+         * @return true if the task and synchronization objects were created
+         */
+        bool begin(BleKeyboard *keyboard);
+
+        /**
+         * Remove the sink and stop the task; pending reports are discarded
+         */
+        void end();
+
+        /**
+         * Copy a report into the queue (BleReportSink signature via sink())
+         *
+         * @return true if queued, merged or folded, false if dropped (queue full)
+         */
+        bool submit(uint8_t reportId, const uint8_t *report, size_t length);
+
+        /**
+         * Discard pending reports (host disconnected)
+         *
+         * @return Number of reports discarded
+         */
+        int clear();
+
+        /**
+         * Ticket of the most recently submitted report
+         */
+        uint32_t getTicket() const { return lastQueuedTicket; }
+
+        /**
+         * Check if the report with this ticket (and all before it) was handled
+         */
+        bool isDone(uint32_t ticket) const { return (int32_t)(lastDoneTicket - ticket) >= 0; }
+
+        void setOnComplete(BleReportCompleteCallback callback) { onComplete = callback; }
+
+        // Statistics
+        int getDepth() const { return count; }
+        int getHighWater() const { return highWater; }
+        uint32_t getSentCount() const { return sentCount; }
+        uint32_t getMergedCount() const { return mergedCount; }
+        uint32_t getFoldedCount() const { return foldedCount; }
+        uint32_t getDroppedCount() const { return droppedCount; }
+        uint32_t getReportIntervalUs() const;
+
+    private:
+        struct Report
+        {
+            uint32_t ticket;
+            uint8_t reportId;
+            uint8_t length;
+            uint8_t data[sizeof(KeyReport)];
+        };
+
+        BleKeyboard *keyboard = nullptr;
+        TaskHandle_t task = nullptr;
+        SemaphoreHandle_t lock = nullptr;  // Guards the ring and the merge state
+        SemaphoreHandle_t space = nullptr; // Given by the task after each pop (hint, count is re-checked)
+        BleReportCompleteCallback onComplete;
+
+        Report ring[BLE_HID_QUEUE_DEPTH];
+        volatile int head = 0; // Oldest entry
+        volatile int count = 0;
+        volatile int highWater = 0;
+
+        // Newest submitted keyboard report and the one before it (merge decisions)
+        KeyReport previousKeys = {};
+        KeyReport lastKeys = {};
+
+        volatile uint32_t lastQueuedTicket = 0;
+        volatile uint32_t lastDoneTicket = 0;
+        volatile uint32_t sentCount = 0;
+        volatile uint32_t mergedCount = 0;
+        volatile uint32_t foldedCount = 0; // Written over a queued report (queue full)
+        volatile uint32_t droppedCount = 0;
+
+        static bool sink(void *context, uint8_t reportId, const uint8_t *report, size_t length);
+        static void taskFunction(void *parameter);
+        void run();
+
+        /**
+         * Try to fold a keyboard report into the newest queued "all keys up" report
+         * Called with lock held
+         */
+        bool mergeKeyboard(const KeyReport &keys, uint32_t ticket);
+
+        /**
+         * Overwrite the newest queued report of the same kind (queue full)
+         * Called with lock held
+         *
+         * @return false if there is none or it is a keyboard release
+         */
+        bool replaceNewest(uint8_t reportId, const uint8_t *report, size_t length);
+
+        static bool isEmpty(const KeyReport &keys);
+        static bool sharesKey(const KeyReport &a, const KeyReport &b);
+    };
+} // namespace CloudMouse::Network
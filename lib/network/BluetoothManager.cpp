@@ -35,6 +35,12 @@ namespace CloudMouse::Network
         // Start BLE HID service and begin advertising
         bleKeyboard->begin();
 
+        // Reports go through the paced queue instead of blocking the caller
+        if (!reportQueue.begin(bleKeyboard))
+        {
+            SDK_LOGGER("⚠️ BLE report queue unavailable - key reports will block");
+        }
+
         initialized = true;
         setState(BluetoothState::ADVERTISING);
 
@@ -62,6 +68,9 @@ namespace CloudMouse::Network
             setState(BluetoothState::DISCONNECTED);
             SDK_LOGGER("🔵 Device disconnected");
 
+            // Reports for the old connection must not reach the next host
+            reportQueue.clear();
+
             // Auto-restart advertising after disconnect
             setState(BluetoothState::ADVERTISING);
             SDK_LOGGER("🔵 Advertising... Waiting for reconnection");
@@ -75,6 +84,9 @@ namespace CloudMouse::Network
 
         SDK_LOGGER("🔵 Shutting down Bluetooth...");
 
+        // Stop report delivery before the keyboard goes away
+        reportQueue.end();
+
         // Release BLE keyboard instance
         if (bleKeyboard)
         {
@@ -12,6 +12,8 @@
  * - Automatic pairing and connection handling
  * - Event-driven state machine for connection lifecycle
  * - Exposes BleKeyboard instance for application layer
+ * - Non-blocking key reports: BleKeyboard calls return immediately, a
+ *   BleReportQueue task paces the notifications to the connection interval
  *
  * Architecture:
  * - Network Layer: BluetoothManager (connection only)
@@ -40,6 +42,7 @@
 #pragma once
 #include <Arduino.h>
 #include <BleKeyboard.h>
+#include "BleReportQueue.h"
 #include "../utils/DeviceID.h"
 #include "../config/DeviceConfig.h"
 
@@ -169,10 +172,50 @@ namespace CloudMouse::Network
          */
         const BleKeyboard *getBleKeyboard() const { return bleKeyboard; }
 
+        /**
+         * Get the report queue behind BleKeyboard
+         * Use getTicket()/isDone() or setOnComplete() to learn when typed
+         * text has actually been sent.
+         *
+         * Example:
+         *   bt.getBleKeyboard()->print("hello");
+         *   uint32_t ticket = bt.getReportQueue().getTicket();
+         *   ...
+         *   if (bt.getReportQueue().isDone(ticket)) { ... }
+         */
+        BleReportQueue &getReportQueue() { return reportQueue; }
+
+        // ========================================================================
+        // STATISTICS
+        // ========================================================================
+
+        /**
+         * Reports waiting to be notified
+         */
+        int getReportQueueDepth() const { return reportQueue.getDepth(); }
+
+        /**
+         * Notifications the BLE stack reported as failed (e.g. host not subscribed)
+         */
+        uint32_t getNotifyFailures() const { return bleKeyboard ? bleKeyboard->getNotifyFailures() : 0; }
+
+        /**
+         * Reports discarded: queue full past BLE_HID_QUEUE_TIMEOUT_MS, or host disconnected
+         */
+        uint32_t getReportsDropped() const { return reportQueue.getDroppedCount(); }
+
+        /**
+         * Reports written over a queued one of the same kind (queue full past BLE_HID_QUEUE_TIMEOUT_MS)
+         */
+        uint32_t getReportsFolded() const { return reportQueue.getFoldedCount(); }
+
     private:
         // BLE HID keyboard instance (application layer interface)
         BleKeyboard *bleKeyboard = nullptr;
 
+        // Paced, non-blocking delivery of the keyboard's reports
+        BleReportQueue reportQueue;
+
         // State management
         BluetoothState currentState = BluetoothState::IDLE;
         bool initialized = false;
@@ -0,0 +1,159 @@
+/**
+ * CloudMouse SDK - Compressed Web Assets
+ *
+ * GENERATED by tools/web_assets.py from web/ - do not edit.
+ * Serve with Content-Encoding: gzip.
+ */
+
+#pragma once
+#include <Arduino.h>
+
+namespace CloudMouse::Network
+{
+    // config.html: 6908 bytes, 2243 compressed
+    static const uint8_t WEB_CONFIG_HTML_GZ[] PROGMEM = {
+        0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x59, 0x6d, 0x8f, 0xdb, 0x36,
+        0x12, 0xfe, 0x9e, 0x5f, 0xc1, 0x38, 0x68, 0x65, 0xa7, 0x96, 0x6c, 0xef, 0x8b, 0x9b, 0xf5, 0xda,
+        0xee, 0x5d, 0x36, 0x1b, 0x5c, 0x80, 0x24, 0x4d, 0xb3, 0x1b, 0x1c, 0x8a, 0xa2, 0x1f, 0x68, 0x89,
+        0xb2, 0xd8, 0x95, 0x49, 0x95, 0xa4, 0xec, 0xf5, 0x2d, 0xf2, 0x1f, 0x0e, 0xbd, 0x3b, 0xf4, 0x63,
+        0xd1, 0x9f, 0x70, 0xff, 0xac, 0x3f, 0xe1, 0x86, 0xa4, 0xde, 0x2d, 0xed, 0xa6, 0xc1, 0x39, 0xc0,
+        0x5a, 0x26, 0x87, 0x2f, 0xf3, 0xcc, 0xcc, 0x33, 0x33, 0xca, 0xfc, 0xf1, 0x8b, 0x6f, 0x2f, 0xae,
+        0xbf, 0x7f, 0x77, 0x89, 0xfe, 0x76, 0xfd, 0xe6, 0xf5, 0xf2, 0xd1, 0x3c, 0x52, 0x9b, 0x18, 0xc5,
+        0x98, 0xad, 0x17, 0x3d, 0xc2, 0x7a, 0x7a, 0x80, 0xe0, 0x60, 0xf9, 0x08, 0xc1, 0x67, 0xbe, 0x21,
+        0x0a, 0x23, 0x3f, 0xc2, 0x42, 0x12, 0xb5, 0xe8, 0x7d, 0xb8, 0x7e, 0xe9, 0x3e, 0xeb, 0x55, 0xa7,
+        0x18, 0xde, 0x90, 0x45, 0x6f, 0x4b, 0xc9, 0x2e, 0xe1, 0x42, 0xf5, 0x90, 0xcf, 0x99, 0x22, 0x0c,
+        0x44, 0x77, 0x34, 0x50, 0xd1, 0x22, 0x20, 0x5b, 0xea, 0x13, 0xd7, 0xfc, 0x18, 0x22, 0xca, 0xa8,
+        0xa2, 0x38, 0x76, 0xa5, 0x8f, 0x63, 0xb2, 0x98, 0x78, 0xe3, 0x7c, 0x2b, 0x45, 0x55, 0x4c, 0x96,
+        0x17, 0x31, 0x4f, 0x83, 0x37, 0x3c, 0x95, 0x04, 0xb9, 0xe8, 0xef, 0xf4, 0x25, 0x45, 0x17, 0x9c,
+        0x85, 0x74, 0x9d, 0x0a, 0xac, 0x28, 0x67, 0xf3, 0x91, 0x15, 0xb3, 0x4b, 0xa4, 0xda, 0xe7, 0xcf,
+        0xfa, 0x33, 0x7a, 0x8a, 0xde, 0x13, 0xb8, 0x23, 0xc2, 0x2c, 0x40, 0x2b, 0x0c, 0x5b, 0x18, 0x01,
+        0x89, 0x9e, 0x8e, 0x0a, 0x99, 0xa7, 0xe8, 0x0e, 0xad, 0xf8, 0xad, 0x2b, 0xe9, 0x3f, 0x28, 0x5b,
+        0xcf, 0xe0, 0x59, 0x04, 0x44, 0xb8, 0x30, 0x74, 0x8e, 0x36, 0x58, 0xac, 0x29, 0x9b, 0xa1, 0xf1,
+        0x39, 0x4a, 0x70, 0x10, 0x98, 0x79, 0x78, 0xfe, 0x58, 0x2c, 0x5e, 0xf1, 0x60, 0x0f, 0xeb, 0x8b,
+        0xdf, 0xfa, 0x13, 0x82, 0xb2, 0x6e, 0x88, 0x37, 0x34, 0xde, 0xcf, 0x90, 0x8b, 0x93, 0x24, 0x26,
+        0xae, 0xdc, 0x4b, 0x45, 0x36, 0x43, 0xf4, 0x3c, 0xa6, 0xec, 0xe6, 0x0d, 0xf6, 0xaf, 0xcc, 0xef,
+        0x97, 0x20, 0x39, 0x44, 0xce, 0x15, 0x59, 0x73, 0x82, 0x3e, 0xbc, 0x72, 0x86, 0xe8, 0x3d, 0x5f,
+        0x71, 0xc5, 0x87, 0x48, 0x62, 0x26, 0x5d, 0x49, 0x04, 0x0d, 0xcf, 0x6b, 0x7b, 0xaf, 0xb0, 0x7f,
+        0xb3, 0x16, 0x3c, 0x65, 0xc1, 0x0c, 0xc1, 0x56, 0x04, 0x0b, 0x77, 0x2d, 0x70, 0x40, 0x01, 0xdc,
+        0xfe, 0xe4, 0xf8, 0x34, 0x20, 0xeb, 0x21, 0x7a, 0x32, 0x9d, 0x7e, 0x4d, 0x08, 0x46, 0xe3, 0x2f,
+        0xe0, 0xf9, 0xeb, 0xe9, 0xc9, 0x0a, 0x1f, 0xa1, 0xc9, 0x78, 0xfc, 0xc5, 0xa0, 0xbe, 0xd5, 0x86,
+        0x32, 0x37, 0x22, 0x74, 0x1d, 0xa9, 0x99, 0x9e, 0xde, 0x46, 0xf5, 0xe9, 0x80, 0xca, 0x24, 0xc6,
+        0xa0, 0x41, 0x18, 0x93, 0xdb, 0xfa, 0x14, 0x8e, 0xe9, 0x9a, 0xb9, 0x14, 0x14, 0x90, 0x33, 0xe4,
+        0xc3, 0xd1, 0x44, 0xd4, 0x05, 0x7e, 0x4a, 0xa5, 0xa2, 0xe1, 0xde, 0xcd, 0xcc, 0xde, 0x2e, 0x54,
+        0x00, 0x7a, 0x34, 0x4e, 0x2a, 0x07, 0x94, 0xd8, 0x56, 0xad, 0xf8, 0x06, 0x53, 0x66, 0xbc, 0x08,
+        0xbe, 0x89, 0xa8, 0x9a, 0xcf, 0x2b, 0x47, 0xef, 0x3a, 0xa1, 0xda, 0x45, 0x70, 0xdb, 0x06, 0x92,
+        0xd6, 0xcc, 0x1a, 0xbc, 0x14, 0xd4, 0x98, 0x4c, 0x93, 0xdb, 0xa6, 0x00, 0xf8, 0x44, 0x84, 0x03,
+        0xbe, 0x03, 0x9b, 0x9b, 0x4b, 0xa2, 0x13, 0xfd, 0x47, 0xac, 0x57, 0xb8, 0x3f, 0x1e, 0x9a, 0x7f,
+        0xde, 0x64, 0xd0, 0xa1, 0xd4, 0xc9, 0xb8, 0xb9, 0xdf, 0x06, 0xdf, 0x5a, 0x8f, 0xd7, 0x93, 0x07,
+        0xb3, 0xd9, 0x8c, 0xb6, 0xd3, 0x43, 0x58, 0xbc, 0xe6, 0x6b, 0x6e, 0x1d, 0x5a, 0xc0, 0x5f, 0x38,
+        0xad, 0x06, 0x47, 0xac, 0x67, 0xeb, 0x48, 0x28, 0x72, 0xab, 0x5c, 0x63, 0xb4, 0x76, 0x4b, 0x58,
+        0x2f, 0x07, 0x8f, 0x57, 0x8a, 0x6f, 0x66, 0xe8, 0xb8, 0xc3, 0x1e, 0x76, 0xeb, 0x68, 0xd2, 0xd8,
+        0xdd, 0xe7, 0x31, 0x17, 0x33, 0xf4, 0xe4, 0xf8, 0xf8, 0xf8, 0xfc, 0x30, 0x0e, 0x20, 0xaa, 0x08,
+        0x98, 0xf8, 0xa4, 0xa9, 0xaf, 0x99, 0xdc, 0x65, 0xee, 0x37, 0x1d, 0x8f, 0xbb, 0x0f, 0x4c, 0x3a,
+        0xce, 0x9b, 0x4e, 0xa7, 0x9d, 0xe7, 0x4d, 0x4e, 0x0e, 0xd1, 0x37, 0x3a, 0x2a, 0x9e, 0xcc, 0xd0,
+        0xe9, 0xc3, 0xfe, 0xf6, 0x92, 0x8b, 0x8d, 0xe1, 0x8a, 0x26, 0xbc, 0x21, 0x4c, 0xb8, 0xda, 0xad,
+        0x9a, 0xd7, 0x6a, 0x80, 0xd8, 0xe5, 0xd4, 0x31, 0x5e, 0x91, 0xb8, 0xb1, 0xb4, 0x08, 0xb5, 0x55,
+        0xcc, 0xfd, 0x9b, 0x7b, 0x6d, 0xf3, 0xac, 0xa9, 0xd7, 0xfd, 0xe8, 0xe7, 0x00, 0x9f, 0xb6, 0x03,
+        0x2c, 0x49, 0x4c, 0x7c, 0xa5, 0x19, 0x38, 0x49, 0xd5, 0x0f, 0x6a, 0x9f, 0x00, 0x69, 0x27, 0x58,
+        0xca, 0x1d, 0xc4, 0x46, 0xef, 0xc7, 0xc6, 0x2d, 0x5b, 0x3d, 0xb4, 0xe6, 0xf3, 0x93, 0x23, 0x08,
+        0x8f, 0xb6, 0x40, 0xd2, 0x91, 0x06, 0x90, 0xc0, 0xac, 0xe4, 0x31, 0x0d, 0xd0, 0x13, 0x32, 0x21,
+        0xa7, 0xe4, 0xec, 0xde, 0x80, 0x7c, 0xd6, 0xea, 0x31, 0x99, 0x79, 0x0f, 0xce, 0x50, 0x10, 0x0a,
+        0x92, 0xea, 0x7c, 0x50, 0x10, 0xb8, 0x41, 0x06, 0x8d, 0xbd, 0x63, 0xd9, 0xad, 0xfa, 0x2c, 0xe4,
+        0x7e, 0x2a, 0xbb, 0x00, 0xb0, 0xb3, 0x0d, 0x18, 0x78, 0xaa, 0x34, 0xf1, 0xce, 0x10, 0xe3, 0xac,
+        0x9d, 0x52, 0x4a, 0x07, 0xd5, 0x34, 0xfc, 0x90, 0xa7, 0x3d, 0x4f, 0xc1, 0xb2, 0xac, 0xd5, 0xd7,
+        0x56, 0x8a, 0xb9, 0x89, 0xa0, 0xe0, 0x02, 0xfb, 0x4f, 0xb5, 0xc5, 0xff, 0x31, 0x3f, 0x64, 0x6a,
+        0x74, 0x52, 0x67, 0x1b, 0x02, 0xa5, 0x2b, 0x9c, 0xb4, 0x7b, 0xc1, 0x67, 0x9a, 0xb7, 0x9b, 0x2d,
+        0xcc, 0x4d, 0x53, 0x21, 0xf5, 0x55, 0x13, 0x4e, 0x0f, 0xc9, 0xad, 0xea, 0x19, 0xe6, 0x59, 0x47,
+        0x30, 0xb8, 0xc5, 0x51, 0xab, 0x5b, 0x54, 0x31, 0x9f, 0x45, 0x7c, 0x7b, 0x90, 0x55, 0x8a, 0x2d,
+        0xb2, 0xdd, 0x62, 0xac, 0xc8, 0xf7, 0x7d, 0x17, 0x7c, 0x7b, 0xf0, 0x90, 0xa5, 0x5f, 0xb1, 0x90,
+        0xeb, 0xac, 0xd2, 0x6a, 0x6b, 0xaa, 0x27, 0xbb, 0x13, 0xd8, 0x93, 0xf0, 0x59, 0x78, 0x16, 0xe2,
+        0x3f, 0x07, 0x69, 0x69, 0x8d, 0xe9, 0x7d, 0x74, 0x78, 0x34, 0xbe, 0xcf, 0x16, 0x27, 0x5d, 0x8c,
+        0x53, 0xe3, 0xdf, 0x0a, 0x82, 0x3f, 0x0b, 0x37, 0x02, 0x3b, 0x7c, 0x5e, 0x0e, 0xfa, 0x84, 0x0b,
+        0x1d, 0x75, 0x5d, 0xe8, 0xec, 0xec, 0xec, 0x21, 0x13, 0x40, 0xe5, 0xc8, 0x20, 0xec, 0x35, 0xf8,
+        0xba, 0x38, 0xad, 0x59, 0x20, 0xa2, 0x41, 0x40, 0x18, 0x14, 0x73, 0x05, 0x1d, 0x1b, 0xff, 0xae,
+        0xaa, 0xe6, 0x97, 0xcb, 0xef, 0xda, 0x34, 0xaa, 0xb1, 0x71, 0x75, 0xa1, 0x4c, 0x28, 0x6b, 0xa9,
+        0x50, 0xb2, 0x38, 0x3a, 0xf9, 0x24, 0x62, 0x34, 0xd0, 0x54, 0x44, 0x9b, 0xf4, 0xd2, 0xe2, 0x11,
+        0xa7, 0x4d, 0x7a, 0xc8, 0x78, 0xe3, 0xf4, 0x00, 0xe0, 0xa8, 0x48, 0x14, 0xcd, 0x19, 0xcc, 0x20,
+        0x18, 0x6c, 0xf8, 0x68, 0x2d, 0xd0, 0x44, 0x66, 0xc4, 0x02, 0xa4, 0x19, 0xea, 0xd2, 0x9d, 0xb4,
+        0x19, 0xd2, 0x1a, 0x11, 0xe1, 0x54, 0xf1, 0x36, 0x9b, 0xfc, 0xe5, 0x86, 0xec, 0x43, 0x01, 0x4d,
+        0x82, 0xb4, 0x9b, 0xde, 0x01, 0x19, 0x69, 0x48, 0xcb, 0xe0, 0x12, 0x5c, 0x41, 0x64, 0xf5, 0xc7,
+        0xc0, 0x58, 0x03, 0x80, 0xd2, 0x10, 0x54, 0xab, 0xc4, 0xf1, 0xb4, 0x90, 0xb1, 0xfb, 0xcf, 0x47,
+        0x59, 0x13, 0x30, 0x1f, 0xd9, 0x8e, 0x65, 0xae, 0x8b, 0xf4, 0xac, 0x3f, 0x08, 0xe8, 0x16, 0xf9,
+        0x31, 0x30, 0xfc, 0xa2, 0x57, 0xd4, 0x8d, 0xbd, 0xb2, 0x5f, 0xa8, 0xce, 0xeb, 0xe2, 0xa3, 0x32,
+        0x65, 0xa6, 0xa3, 0xc9, 0xf2, 0x8f, 0xdf, 0xfe, 0xf3, 0x4f, 0x54, 0xf6, 0x24, 0x70, 0xc8, 0xa4,
+        0x21, 0x94, 0x2c, 0xdb, 0xba, 0x94, 0xa4, 0x72, 0xca, 0x08, 0x8e, 0x59, 0x1e, 0x3a, 0xe8, 0xfc,
+        0xb1, 0x9b, 0x75, 0x38, 0xbe, 0x20, 0xe0, 0x8b, 0xba, 0x2b, 0x42, 0x86, 0xae, 0x5c, 0xb7, 0xb2,
+        0xda, 0x8c, 0xd0, 0xc0, 0x68, 0x00, 0x27, 0xf4, 0x10, 0xf6, 0xf5, 0x11, 0x8b, 0xde, 0x28, 0x1f,
+        0x80, 0x1e, 0x2c, 0xe2, 0x20, 0xf0, 0xee, 0xdb, 0xab, 0xeb, 0xa6, 0x0a, 0x15, 0x0d, 0xcb, 0x5a,
+        0xa6, 0x21, 0x64, 0x04, 0x6d, 0xa5, 0x02, 0x32, 0x8b, 0x9e, 0x94, 0x34, 0xe8, 0x59, 0xad, 0xde,
+        0x12, 0x05, 0xc9, 0xf1, 0x66, 0x36, 0x1f, 0x99, 0xf9, 0x96, 0x75, 0x36, 0xb3, 0x66, 0x2d, 0xa0,
+        0x59, 0x69, 0x2e, 0x6b, 0x9f, 0x04, 0xf9, 0x39, 0xa5, 0xa0, 0xdc, 0xe1, 0x3a, 0xb3, 0x96, 0x27,
+        0x5a, 0x13, 0xb4, 0xc5, 0x71, 0x0a, 0x8b, 0x7b, 0xcb, 0x2b, 0x1f, 0x33, 0xa6, 0xc3, 0x8d, 0xd9,
+        0x63, 0xa5, 0xe7, 0x79, 0xf3, 0x91, 0x95, 0x6a, 0x39, 0x7a, 0x64, 0xcf, 0x6e, 0x68, 0x5c, 0x47,
+        0xbb, 0x86, 0xf8, 0x67, 0x23, 0x52, 0x14, 0x09, 0xcb, 0x77, 0xd9, 0xd3, 0x3d, 0x88, 0x98, 0xea,
+        0x02, 0x35, 0xaa, 0x8b, 0x0c, 0xa0, 0xf2, 0xb7, 0x06, 0xa9, 0xfc, 0xd5, 0x8a, 0x8f, 0xe6, 0xf4,
+        0x18, 0xfb, 0x24, 0xe2, 0x31, 0x84, 0xf9, 0xa2, 0x77, 0xa9, 0x59, 0xc7, 0x7a, 0x4c, 0xb9, 0xb2,
+        0x1d, 0xe2, 0x07, 0x51, 0x58, 0xd9, 0x3a, 0xc4, 0xde, 0x52, 0xa6, 0xab, 0x0d, 0xd5, 0x7d, 0xbb,
+        0x85, 0xa5, 0x92, 0x14, 0x5b, 0x70, 0xf9, 0xe3, 0xb7, 0x7f, 0xff, 0x9a, 0x33, 0x6b, 0xe3, 0x4c,
+        0xbb, 0x69, 0xd5, 0xf3, 0x35, 0xc2, 0x5d, 0xae, 0xff, 0x01, 0x1a, 0x5e, 0xb4, 0x4e, 0x69, 0x80,
+        0x99, 0x4f, 0xea, 0x3e, 0x5f, 0xb1, 0x91, 0xce, 0x94, 0x4d, 0xa7, 0x96, 0x4a, 0x70, 0xb6, 0x86,
+        0xd8, 0xfc, 0xe5, 0x77, 0xf4, 0x96, 0x2b, 0x32, 0xd3, 0x24, 0x60, 0x86, 0xe6, 0x2b, 0x51, 0x97,
+        0xfd, 0x6b, 0xa8, 0x31, 0xcb, 0x99, 0x9c, 0xb3, 0x21, 0x52, 0x11, 0x41, 0xf6, 0x8d, 0x04, 0xf0,
+        0x63, 0x1c, 0x03, 0x80, 0x52, 0x61, 0xa1, 0x0c, 0x79, 0x69, 0xea, 0xf3, 0x71, 0x1c, 0xef, 0x51,
+        0x83, 0x14, 0xa1, 0xfb, 0x22, 0x20, 0x89, 0xa1, 0xfd, 0x07, 0x95, 0x10, 0x30, 0x81, 0xf7, 0x70,
+        0x7c, 0x57, 0xb4, 0xc8, 0xb2, 0x64, 0x43, 0x11, 0xe3, 0xef, 0x24, 0x40, 0xdf, 0xbd, 0x87, 0x1b,
+        0x06, 0x04, 0x85, 0x82, 0x6f, 0xf2, 0xbb, 0x65, 0x69, 0xe9, 0x1b, 0xc0, 0xfb, 0x5f, 0xff, 0x6d,
+        0x3b, 0xab, 0xf2, 0xf8, 0xa8, 0xc0, 0xf4, 0x2a, 0xe2, 0x3b, 0x86, 0xb0, 0x51, 0x5a, 0x2b, 0x5a,
+        0x32, 0x8b, 0x44, 0x3b, 0x22, 0x08, 0x90, 0x87, 0x4f, 0x12, 0x05, 0x67, 0xe6, 0x78, 0x9b, 0x5b,
+        0x66, 0xf4, 0x92, 0x65, 0xbb, 0xde, 0x01, 0x67, 0xa2, 0x4a, 0x2a, 0xb4, 0x89, 0xb3, 0xca, 0xa2,
+        0xd1, 0xd1, 0xb2, 0xea, 0x14, 0x20, 0x64, 0xe2, 0x16, 0x86, 0x5b, 0xb1, 0xc8, 0xb2, 0x63, 0x6f,
+        0xd9, 0x00, 0x0e, 0x98, 0xf4, 0x85, 0xd5, 0x9d, 0xca, 0xea, 0x81, 0x8a, 0xe7, 0x7c, 0x90, 0x5b,
+        0xde, 0xdc, 0x17, 0x8c, 0xb6, 0x26, 0x4a, 0xef, 0x92, 0xdb, 0xbe, 0x46, 0xba, 0xc9, 0xf2, 0x3a,
+        0x82, 0x7d, 0x12, 0xbc, 0xce, 0xec, 0xec, 0xc7, 0x5c, 0x92, 0xba, 0x95, 0xbd, 0x62, 0xc9, 0x01,
+        0x98, 0xd2, 0x17, 0x34, 0xa9, 0x50, 0xcb, 0x68, 0x94, 0x73, 0x21, 0xe4, 0x43, 0xa9, 0xe0, 0x7e,
+        0x3a, 0x9b, 0x19, 0x83, 0x8d, 0x70, 0x42, 0x47, 0x39, 0x63, 0x0d, 0x21, 0x5f, 0x1b, 0xe4, 0xcd,
+        0xc1, 0x54, 0x01, 0x45, 0x85, 0x5a, 0x1f, 0x0c, 0x65, 0xa0, 0x3e, 0x16, 0x01, 0x04, 0xa4, 0x8c,
+        0x1b, 0x50, 0x13, 0x36, 0xcb, 0x38, 0x74, 0x81, 0x02, 0xe8, 0x40, 0x36, 0x60, 0x2f, 0x0f, 0x34,
+        0xbb, 0x8c, 0x89, 0x7e, 0x7c, 0xbe, 0x7f, 0x15, 0xf4, 0x1d, 0x4d, 0xa7, 0x4e, 0xa5, 0xe4, 0xac,
+        0xde, 0xeb, 0xba, 0x74, 0x68, 0x09, 0x0e, 0x25, 0x21, 0x53, 0x9b, 0x1b, 0x94, 0x05, 0xe5, 0x39,
+        0xd4, 0xca, 0x80, 0x00, 0xd4, 0xf6, 0x31, 0x31, 0x53, 0x21, 0x15, 0xfa, 0x58, 0x90, 0xd6, 0x77,
+        0x13, 0xa9, 0x61, 0xdd, 0x62, 0xcf, 0x30, 0x65, 0x26, 0x56, 0x50, 0xcc, 0x71, 0x90, 0x69, 0x2d,
+        0xfb, 0x83, 0x46, 0x39, 0x13, 0x12, 0xe5, 0x47, 0x7d, 0xa7, 0xa6, 0xbd, 0x33, 0x38, 0xa0, 0x0b,
+        0x0f, 0xce, 0x63, 0x7d, 0x08, 0xb2, 0x04, 0x54, 0x25, 0x68, 0xb1, 0x44, 0xf9, 0xb3, 0xf7, 0x93,
+        0xe4, 0xac, 0x3f, 0xe8, 0x5a, 0x12, 0x60, 0x85, 0xb5, 0xf8, 0x5d, 0x2b, 0x37, 0xd2, 0x10, 0x19,
+        0x09, 0x4f, 0xe6, 0x39, 0xe3, 0xcb, 0x2f, 0xd1, 0x63, 0x33, 0x52, 0x24, 0x8f, 0x98, 0xb0, 0xb5,
+        0x8a, 0x06, 0x1d, 0x3b, 0xd8, 0xb6, 0x50, 0x5d, 0xd3, 0x0d, 0x81, 0x26, 0xaf, 0x5f, 0xd5, 0x75,
+        0x88, 0x26, 0xd0, 0x42, 0x37, 0x1a, 0xa4, 0xea, 0x47, 0x10, 0x95, 0x0a, 0xd6, 0x3e, 0xff, 0xf1,
+        0x51, 0xfb, 0x49, 0xda, 0xc4, 0x9e, 0xcd, 0x65, 0xf2, 0x87, 0xf1, 0x8f, 0x9e, 0x2e, 0x28, 0xb5,
+        0xc9, 0x5b, 0xae, 0x8c, 0xbe, 0xd1, 0x6f, 0x09, 0x8d, 0x4f, 0xe0, 0xdc, 0xf7, 0x21, 0xa4, 0x1c,
+        0x34, 0x43, 0xce, 0xdb, 0x22, 0x1a, 0xc0, 0xfd, 0xb4, 0x71, 0x9d, 0xf6, 0x6b, 0xd4, 0xf7, 0x05,
+        0xd2, 0xba, 0xc4, 0x60, 0xae, 0x3c, 0x90, 0x3a, 0x71, 0x2d, 0x9d, 0x32, 0x4b, 0xce, 0x15, 0xa7,
+        0x04, 0x32, 0x81, 0x12, 0x2c, 0xf3, 0xcb, 0xbe, 0x63, 0x05, 0x9c, 0x7b, 0x60, 0xb2, 0x12, 0x9e,
+        0xc9, 0xef, 0xb0, 0x51, 0xae, 0x89, 0x76, 0xe6, 0x07, 0x17, 0x65, 0xf0, 0x54, 0xd7, 0xa0, 0xaf,
+        0x90, 0x83, 0xfa, 0x0e, 0x7c, 0xe5, 0xa3, 0x02, 0x86, 0xcd, 0x68, 0xf0, 0x7c, 0x33, 0xd0, 0x13,
+        0xfd, 0x42, 0x9e, 0x40, 0x9b, 0x48, 0x34, 0x90, 0x3a, 0x61, 0xfd, 0x62, 0xa0, 0xbb, 0xef, 0xaa,
+        0x99, 0x7d, 0xa0, 0x85, 0xea, 0xdb, 0x0b, 0x74, 0xc8, 0x7e, 0x6c, 0x19, 0xff, 0xd8, 0xe2, 0xc2,
+        0x3e, 0xd6, 0xd1, 0x01, 0x41, 0xa3, 0x91, 0xee, 0xb6, 0xbe, 0x93, 0x93, 0x8a, 0x89, 0xc5, 0x94,
+        0xe1, 0x2d, 0xa6, 0x50, 0x57, 0xc4, 0xc4, 0x39, 0xaf, 0x1d, 0x55, 0x79, 0xa3, 0x54, 0x8b, 0xc9,
+        0x16, 0x46, 0xe8, 0xe4, 0x10, 0x5b, 0x2e, 0x3a, 0x03, 0xad, 0xe4, 0xe5, 0x16, 0x86, 0x5f, 0x03,
+        0x91, 0x11, 0x60, 0x62, 0xa0, 0x17, 0x53, 0x00, 0x38, 0x43, 0x44, 0xf4, 0xf8, 0xa1, 0x77, 0x98,
+        0x61, 0x2f, 0x11, 0xe6, 0xfb, 0x05, 0x09, 0x71, 0x1a, 0xab, 0xfe, 0xc1, 0x0b, 0x04, 0xed, 0x35,
+        0xa6, 0x5a, 0x5d, 0x64, 0x0b, 0x2c, 0x45, 0x9f, 0x77, 0x97, 0x21, 0x39, 0x87, 0x64, 0x57, 0x1b,
+        0x02, 0x54, 0xb6, 0x98, 0x05, 0x6b, 0xe9, 0x6a, 0x16, 0x46, 0x74, 0x35, 0x0f, 0xbd, 0x19, 0x74,
+        0x6f, 0x1f, 0xde, 0xbf, 0xbe, 0x82, 0x46, 0xc4, 0x8f, 0xde, 0x61, 0xe8, 0x25, 0x64, 0x5f, 0x8f,
+        0xe9, 0x17, 0x77, 0x2f, 0xc0, 0xd3, 0xfb, 0xfa, 0xdc, 0xc1, 0xa0, 0xd5, 0x14, 0x07, 0x04, 0xd4,
+        0xcd, 0x28, 0x8f, 0x0b, 0x6e, 0xe2, 0x37, 0x03, 0x60, 0x4a, 0xc1, 0x77, 0xe6, 0xe8, 0x4b, 0x21,
+        0xb8, 0x28, 0xf6, 0xf0, 0x34, 0x95, 0xa7, 0xb2, 0xc3, 0x43, 0x3a, 0xf1, 0xb7, 0x68, 0x00, 0xfe,
+        0xda, 0xf6, 0x17, 0xf6, 0x5d, 0x39, 0x40, 0x95, 0xf9, 0x86, 0x09, 0x92, 0xf6, 0x1d, 0xb5, 0x6e,
+        0x5e, 0x82, 0x05, 0xc8, 0xbf, 0x85, 0x32, 0xc1, 0x33, 0x79, 0x54, 0x1b, 0xcf, 0xb8, 0xab, 0x63,
+        0x13, 0xb2, 0xf3, 0x67, 0xaf, 0x53, 0x66, 0x58, 0xb8, 0x52, 0xb9, 0xa5, 0x20, 0x1b, 0xbe, 0x25,
+        0x0f, 0xed, 0x5a, 0x21, 0x4e, 0xeb, 0xe3, 0x3b, 0xca, 0x02, 0xbe, 0xf3, 0x4c, 0x92, 0xed, 0x0f,
+        0x86, 0xfa, 0x15, 0xe4, 0xf8, 0x33, 0x42, 0x05, 0xc7, 0x44, 0x00, 0xb5, 0x5c, 0xf0, 0x34, 0x0e,
+        0xa0, 0x21, 0x87, 0x1c, 0x65, 0x3c, 0xb3, 0x59, 0xcb, 0x0c, 0xa1, 0x30, 0x26, 0xfa, 0xff, 0x77,
+        0x80, 0x88, 0xc5, 0xde, 0x73, 0x06, 0xd5, 0x50, 0xc9, 0x9e, 0xa1, 0x2e, 0xc8, 0x72, 0x38, 0x14,
+        0xa6, 0xa6, 0x25, 0x84, 0x92, 0x44, 0x6d, 0xa0, 0x62, 0xff, 0x1f, 0x66, 0x49, 0x4f, 0xf2, 0xfc,
+        0x1a, 0x00, 0x00,
+    };
+    static const size_t WEB_CONFIG_HTML_GZ_LEN = sizeof(WEB_CONFIG_HTML_GZ);
+
+} // namespace CloudMouse::Network
@@ -3,37 +3,45 @@
  *
  * Captive portal implementation for WiFi credential collection during device setup.
  * Provides responsive web interface with automatic network detection and modern UI.
+ *
+ * The page markup lives in web/config.html; tools/web_assets.py compresses it
+ * into WebAssets.h at build time.
  */
 
 #include "./WebServerManager.h"
+#include "./WebAssets.h"
+#include <ArduinoJson.h>
 #include "../prefs/PreferencesManager.h"
 #include "../utils/Logger.h"
+#include "../core/EventBus.h"
+#include "../utils/TaskProfiler.h"
 
 namespace CloudMouse::Network
 {
-    // Static instance pointer for callback system
-    WebServerManager *WebServerManager::instance = nullptr;
-
     WebServerManager::WebServerManager(WiFiManager &wifiMgr)
         : webServer(80), wifiManager(wifiMgr)
     {
-        // Set static instance for callback handlers
-        instance = this;
     }
 
     void WebServerManager::init()
     {
-        SDK_LOGGER("🌐 Initializing WebServer...");
+        if (serverRunning)
+            return;
 
-        // Scan for available WiFi networks to populate selection list
-        scanNetworks();
+        SDK_LOGGER("🌐 Initializing WebServer...");
 
         // Register HTTP route handlers
-        webServer.on("/", handleRoot);                    // Main configuration page
-        webServer.on("/config", HTTP_POST, handleConfig); // Credential submission endpoint
-        webServer.onNotFound(handleNotFound);             // 404 handler for undefined routes
-
-        // Start HTTP server on port 80
+        webServer.on("/", HTTP_GET, [this](AsyncWebServerRequest *request)
+                     { handleRoot(request); }); // Main configuration page
+        webServer.on("/api/networks", HTTP_GET, [this](AsyncWebServerRequest *request)
+                     { handleNetworks(request); }); // Scanned networks (JSON)
+        webServer.on("/config", HTTP_POST, [this](AsyncWebServerRequest *request)
+                     { handleConfig(request); }); // Credential submission endpoint
+        registerMetricsRoutes();
+        webServer.onNotFound([this](AsyncWebServerRequest *request)
+                             { handleNotFound(request); }); // 404 handler for undefined routes
+
+        // Start HTTP server on port 80 (served by the AsyncTCP task)
         webServer.begin();
         serverRunning = true;
 
@@ -41,284 +49,185 @@ namespace CloudMouse::Network
         SDK_LOGGER("🌐 Access configuration at: http://192.168.4.1");
     }
 
-    void WebServerManager::update()
+    void WebServerManager::startMetrics()
     {
-        // Process incoming HTTP requests (non-blocking)
-        // Should be called regularly in main loop
-        webServer.handleClient();
+#if WEB_METRICS_WHEN_CONNECTED
+        // The setup portal already serves the metrics routes
+        if (serverRunning)
+            return;
+
+        registerMetricsRoutes();
+        webServer.onNotFound([this](AsyncWebServerRequest *request)
+                             { handleNotFound(request); });
+
+        webServer.begin();
+        serverRunning = true;
+
+        SDK_LOGGER("🌐 Metrics server started: http://%s/api/metrics/{eventbus,tasks}\n",
+                   WiFi.localIP().toString().c_str());
+#endif
     }
 
-    void WebServerManager::stop()
+    void WebServerManager::registerMetricsRoutes()
     {
-        webServer.stop();
-        serverRunning = false;
-        SDK_LOGGER("🌐 WebServer stopped");
+        webServer.on("/api/metrics/eventbus", HTTP_GET, [this](AsyncWebServerRequest *request)
+                     { handleEventBusMetrics(request); }); // EventBus counters (JSON)
+        webServer.on("/api/metrics/tasks", HTTP_GET, [this](AsyncWebServerRequest *request)
+                     { handleTaskMetrics(request); }); // Task CPU/stack profile (JSON)
     }
 
-    void WebServerManager::scanNetworks()
+    void WebServerManager::update()
     {
-        SDK_LOGGER("🔍 Scanning WiFi networks...");
-
-        // Perform WiFi network scan
-        int networkCount = WiFi.scanNetworks();
-        networkList = "";
+        // Requests are served asynchronously; only submitted credentials are handled here
+        char ssid[sizeof(pendingSsid)];
+        char password[sizeof(pendingPassword)];
 
-        // Build HTML option elements for each discovered network
-        for (int i = 0; i < networkCount; i++)
+        portENTER_CRITICAL(&pendingLock);
+        bool due = credentialsPending && millis() - pendingSinceMs >= CONNECT_DELAY_MS;
+        if (due)
         {
-            networkList += "<option value='" + WiFi.SSID(i) + "'>";
-            networkList += WiFi.SSID(i) + " (" + String(WiFi.RSSI(i)) + " dBm)";
-            networkList += "</option>";
+            memcpy(ssid, pendingSsid, sizeof(ssid));
+            memcpy(password, pendingPassword, sizeof(password));
+            memset(pendingPassword, 0, sizeof(pendingPassword));
+            credentialsPending = false;
         }
+        portEXIT_CRITICAL(&pendingLock);
 
-        SDK_LOGGER("✅ Found %d networks\n", networkCount);
+        if (!due)
+            return;
+
+        // Save credentials for future use
+        wifiManager.saveCredentials(ssid, password);
+
+        // Attempt WiFi connection with provided credentials
+        wifiManager.connect(ssid, password);
+        memset(password, 0, sizeof(password));
     }
 
-    String WebServerManager::generateConfigPage()
+    void WebServerManager::stop()
     {
-        // Generate complete HTML page with embedded CSS and JavaScript
-        // Uses modern responsive design with gradient styling
-        // Includes form validation and user experience enhancements
-
-        return R"rawliteral(
-<!DOCTYPE HTML>
-<html lang="en">
-<head>
-    <meta charset="UTF-8">
-    <meta name="viewport" content="width=device-width, initial-scale=1.0">
-    <title>CloudMouse - WiFi Configuration</title>
-    <style>
-        /* Reset and base styles */
-        * { box-sizing: border-box; margin: 0; padding: 0; }
-        body { 
-            font-family: -apple-system, BlinkMacSystemFont, 'Segoe UI', Roboto, sans-serif;
-            background: linear-gradient(135deg, #667eea 0%, #764ba2 100%);
-            min-height: 100vh;
-            display: flex;
-            align-items: center;
-            justify-content: center;
-            padding: 20px;
-        }
-        
-        /* Main container */
-        .container {
-            background: white;
-            border-radius: 16px;
-            box-shadow: 0 20px 40px rgba(0,0,0,0.1);
-            padding: 40px;
-            max-width: 400px;
-            width: 100%;
-        }
-        
-        /* Logo and branding */
-        .logo {
-            text-align: center;
-            margin-bottom: 30px;
-        }
-        .logo h1 {
-            color: #333;
-            font-size: 24px;
-            font-weight: 600;
-        }
-        .logo p {
-            color: #666;
-            font-size: 14px;
-            margin-top: 5px;
-        }
-        
-        /* Form styling */
-        .form-group {
-            margin-bottom: 20px;
-        }
-        label {
-            display: block;
-            margin-bottom: 8px;
-            color: #333;
-            font-weight: 500;
-        }
-        select, input[type="password"] {
-            width: 100%;
-            padding: 12px 16px;
-            border: 2px solid #e1e5e9;
-            border-radius: 8px;
-            font-size: 16px;
-            transition: border-color 0.3s;
-        }
-        select:focus, input[type="password"]:focus {
-            outline: none;
-            border-color: #667eea;
-        }
-        
-        /* Button styling */
-        .btn-primary {
-            width: 100%;
-            background: linear-gradient(135deg, #667eea 0%, #764ba2 100%);
-            color: white;
-            border: none;
-            padding: 14px;
-            border-radius: 8px;
-            font-size: 16px;
-            font-weight: 600;
-            cursor: pointer;
-            transition: transform 0.2s;
-        }
-        .btn-primary:hover {
-            transform: translateY(-2px);
-        }
-        
-        /* Info box styling */
-        .info {
-            background: #f8f9fa;
-            border-radius: 8px;
-            padding: 16px;
-            margin-top: 20px;
-            font-size: 14px;
-            color: #666;
-        }
-        .qr-hint {
-            text-align: center;
-            margin-top: 20px;
-            font-size: 12px;
-            color: #999;
+        webServer.end();
+        webServer.reset();
+        serverRunning = false;
+        SDK_LOGGER("🌐 WebServer stopped");
+    }
+
+    void WebServerManager::buildNetworksJson()
+    {
+        ScannedNetwork scanned[WIFI_SCAN_MAX_NETWORKS];
+        int count = wifiManager.getScanResults(scanned, WIFI_SCAN_MAX_NETWORKS);
+
+        JsonDocument doc;
+        JsonArray networks = doc["networks"].to<JsonArray>();
+        for (int i = 0; i < count; i++)
+        {
+            JsonObject network = networks.add<JsonObject>();
+            network["ssid"] = (const char *)scanned[i].ssid; // Copied: the array is local
+            network["rssi"] = scanned[i].rssi;
+            network["channel"] = scanned[i].channel;
+            network["auth"] = (int)scanned[i].auth;
+            network["secure"] = scanned[i].auth != WIFI_AUTH_OPEN;
         }
-    </style>
-</head>
-<body>
-    <div class="container">
-        <div class="logo">
-            <h1>🕐 CloudMouse</h1>
-            <p>WiFi Configuration</p>
-        </div>
-        
-        <!-- WiFi credential form -->
-        <form action="/config" method="POST">
-            <div class="form-group">
-                <label for="ssid">WiFi Network:</label>
-                <select name="ssid" id="ssid" required>
-                    <option value="">Select a network...</option>
-)rawliteral" + networkList +
-               R"rawliteral(
-                </select>
-            </div>
-            
-            <div class="form-group">
-                <label for="password">Password:</label>
-                <input type="password" name="password" id="password" 
-                       placeholder="Enter WiFi password" required>
-            </div>
-            
-            <button type="submit" class="btn-primary">
-                🔗 Connect
-            </button>
-        </form>
-        
-        <!-- User guidance -->
-        <div class="info">
-            <strong>💡 Note:</strong><br>
-            After connection, the device will restart automatically 
-            and be ready for use.
-        </div>
-        
-        <div class="qr-hint">
-            Scanned QR code from device display? 📱
-        </div>
-    </div>
-</body>
-</html>
-)rawliteral";
+
+        networksJson = "";
+        serializeJson(doc, networksJson);
     }
 
     // ============================================================================
-    // STATIC HTTP REQUEST HANDLERS
+    // HTTP REQUEST HANDLERS
     // ============================================================================
 
-    void WebServerManager::handleRoot()
+    void WebServerManager::handleRoot(AsyncWebServerRequest *request)
     {
-        if (!instance)
-            return;
-
-        // Serve main configuration page
-        instance->webServer.send(200, "text/html", instance->generateConfigPage());
+        // Serve the compressed page straight from flash
+        AsyncWebServerResponse *response =
+            request->beginResponse_P(200, "text/html", WEB_CONFIG_HTML_GZ, WEB_CONFIG_HTML_GZ_LEN);
+        response->addHeader("Content-Encoding", "gzip");
+        request->send(response);
     }
 
-    void WebServerManager::handleConfig()
+    void WebServerManager::handleNetworks(AsyncWebServerRequest *request)
     {
-        if (!instance)
-            return;
+        if (request->hasParam("refresh"))
+            wifiManager.requestScan();
+
+        // Only serialize again after a new scan
+        uint32_t generation = wifiManager.getScanGeneration();
+        if (generation != networksGeneration || networksJson.length() == 0)
+        {
+            buildNetworksJson();
+            networksGeneration = generation;
+        }
+
+        // Scan state is live, so it is spliced in front of the cached list
+        bool scanning = wifiManager.isScanning() || generation == 0;
+        String body = "{\"scanning\":";
+        body += scanning ? "true" : "false";
+        body += ",\"age_ms\":";
+        body += String(wifiManager.getScanAgeMs());
+        body += ",";
+        body += networksJson.c_str() + 1; // Without the opening brace
+        request->send(200, "application/json", body);
+    }
 
+    void WebServerManager::handleConfig(AsyncWebServerRequest *request)
+    {
         // Validate form data presence
-        if (instance->webServer.hasArg("ssid") && instance->webServer.hasArg("password"))
+        if (!request->hasParam("ssid", true) || !request->hasParam("password", true))
         {
-            String ssid = instance->webServer.arg("ssid");
-            String password = instance->webServer.arg("password");
-
-            SDK_LOGGER("🌐 WiFi credentials received: %s\n", ssid.c_str());
-
-            // Generate immediate success response for user feedback
-            String successPage = R"rawliteral(
-<!DOCTYPE HTML>
-<html>
-<head>
-    <meta charset="UTF-8">
-    <meta name="viewport" content="width=device-width, initial-scale=1.0">
-    <title>Connecting...</title>
-    <style>
-        body { 
-            font-family: -apple-system, BlinkMacSystemFont, sans-serif;
-            text-align: center; 
-            padding: 50px;
-            background: linear-gradient(135deg, #667eea 0%, #764ba2 100%);
-            color: white;
+            // Handle missing form data
+            SDK_LOGGER("❌ Invalid form submission - missing SSID or password");
+            request->send(400, "text/plain", "Error: Missing SSID or password");
+            return;
         }
-        .spinner { 
-            border: 4px solid rgba(255,255,255,0.3);
-            border-top: 4px solid white;
-            border-radius: 50%;
-            width: 50px;
-            height: 50px;
-            animation: spin 1s linear infinite;
-            margin: 20px auto;
+
+        const String &ssid = request->getParam("ssid", true)->value();
+        const String &password = request->getParam("password", true)->value();
+        if (ssid.isEmpty() || ssid.length() >= sizeof(pendingSsid) || password.length() >= sizeof(pendingPassword))
+        {
+            request->send(400, "text/plain", "Error: Invalid SSID or password length");
+            return;
         }
-        @keyframes spin { 0% { transform: rotate(0deg); } 100% { transform: rotate(360deg); } }
-    </style>
-</head>
-<body>
-    <h2>🔗 Connecting...</h2>
-    <div class="spinner"></div>
-    <p>Device is connecting to network <strong>)rawliteral" +
-                                 ssid + R"rawliteral(</strong></p>
-    <p>This page will close automatically.</p>
-    <script>setTimeout(() => window.close(), 5000);</script>
-</body>
-</html>
-)rawliteral";
-
-            // Send immediate response to prevent browser timeout
-            instance->webServer.send(200, "text/html", successPage);
-
-            // Save credentials for future use
-            instance->wifiManager.saveCredentials(ssid, password);
-
-            // Brief delay to ensure response is sent
-            delay(1000);
-
-            // Attempt WiFi connection with provided credentials
-            instance->wifiManager.connect(ssid.c_str(), password.c_str());
+
+        // Copied under the lock: update() reads them from the Core task
+        portENTER_CRITICAL(&pendingLock);
+        bool busy = credentialsPending;
+        if (!busy)
+        {
+            memcpy(pendingSsid, ssid.c_str(), ssid.length() + 1);
+            memcpy(pendingPassword, password.c_str(), password.length() + 1);
+            pendingSinceMs = millis();
+            credentialsPending = true;
         }
-        else
+        portEXIT_CRITICAL(&pendingLock);
+
+        if (busy)
         {
-            // Handle missing form data
-            SDK_LOGGER("❌ Invalid form submission - missing SSID or password");
-            instance->webServer.send(400, "text/plain", "Error: Missing SSID or password");
+            request->send(409, "text/plain", "Error: Connection already in progress");
+            return;
         }
+
+        SDK_LOGGER("🌐 WiFi credentials received: %s\n", ssid.c_str());
+
+        // Immediate response; the page shows its own connecting view
+        request->send(200, "text/plain", "Connecting to " + ssid);
     }
 
-    void WebServerManager::handleNotFound()
+    void WebServerManager::handleEventBusMetrics(AsyncWebServerRequest *request)
     {
-        if (!instance)
-            return;
+        // Per-type EventBus counters, latency histograms and queue high-water marks
+        request->send(200, "application/json", CloudMouse::EventBus::instance().getMetricsJson());
+    }
 
+    void WebServerManager::handleTaskMetrics(AsyncWebServerRequest *request)
+    {
+        // Per-task CPU load and stack, per-core history
+        request->send(200, "application/json", CloudMouse::Utils::TaskProfiler::getJson());
+    }
+
+    void WebServerManager::handleNotFound(AsyncWebServerRequest *request)
+    {
         // Handle requests to undefined routes
-        instance->webServer.send(404, "text/plain", "Page not found");
+        request->send(404, "text/plain", "Page not found");
     }
 } // namespace CloudMouse::Network
\ No newline at end of file
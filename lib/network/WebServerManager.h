@@ -5,21 +5,39 @@
  * Provides a responsive web interface for network selection and credential entry.
  *
  * Features:
- * - Automatic WiFi network scanning and display
- * - Responsive HTML interface with modern CSS styling
+ * - ESPAsyncWebServer: requests are served by the AsyncTCP task, independent
+ *   of the Core coordination loop
+ * - Configuration page is a static asset (web/config.html), gzipped at build
+ *   time into WebAssets.h and sent from flash without building it on the heap
+ * - Network list fetched separately by the page as JSON (/api/networks),
+ *   built from WiFiManager's background scan cache: opening the portal never
+ *   waits for a scan
  * - Form-based credential collection with validation
  * - Integration with WiFiManager for connection handling
- * - Static file serving and error handling
+ *
+ * Routes:
+ * - GET  /                      configuration page (gzip)
+ * - GET  /api/networks          {"scanning","age_ms","networks":[{"ssid","rssi","channel","auth","secure"}]}
+ *                                ?refresh=1 requests a new scan
+ * - POST /config                ssid + password, applied by update()
+ * - GET  /api/metrics/eventbus  EventBus::getMetricsJson()
+ * - GET  /api/metrics/tasks     TaskProfiler::getJson()
+ *
+ * init() serves every route (setup portal, AP mode). startMetrics() serves
+ * only the /api/metrics routes, on the station address once WiFi is CONNECTED
+ * (WEB_METRICS_WHEN_CONNECTED), so congestion and per-task CPU load can be
+ * read in the field.
  *
  * Usage:
  * 1. Initialize after setting up Access Point mode
- * 2. Call update() in main loop to handle client requests
+ * 2. Call update() periodically: it applies submitted credentials outside
+ *    the AsyncTCP task (saving to NVS and reconnecting must not run there)
  * 3. Web interface accessible at device IP (typically 192.168.4.1)
  * 4. Automatically saves credentials and initiates connection
  */
 
 #pragma once
-#include <WebServer.h>
+#include <ESPAsyncWebServer.h>
 #include <WiFi.h>
 #include "WiFiManager.h"
 
@@ -38,14 +56,20 @@ namespace CloudMouse::Network
 
         /**
          * Initialize web server and register route handlers
-         * Automatically scans for available WiFi networks
          * Starts HTTP server on port 80
          */
         void init();
 
         /**
-         * Process incoming HTTP requests
-         * Should be called regularly in main loop when AP mode is active
+         * Start the server with the metrics routes only (WiFi CONNECTED)
+         * No-op if the portal is already running or WEB_METRICS_WHEN_CONNECTED is 0
+         */
+        void startMetrics();
+
+        /**
+         * Apply credentials submitted through /config
+         * Should be called regularly when AP mode is active; requests
+         * themselves are served asynchronously
          */
         void update();
 
@@ -63,56 +87,75 @@ namespace CloudMouse::Network
         bool isRunning() const { return serverRunning; }
 
         /**
-         * Manually trigger network scan
-         * Updates available networks list for web interface
+         * Request a background network scan
+         * /api/networks serves the new list once the scan completes
          */
-        void refreshNetworks() { scanNetworks(); }
+        void refreshNetworks() { wifiManager.requestScan(); }
 
     private:
-        WebServer webServer;        // ESP32 web server instance (port 80)
+        AsyncWebServer webServer;   // Async web server instance (port 80)
         WiFiManager &wifiManager;   // Reference to WiFi connection manager
-        String networkList;         // HTML options list of scanned networks
+        String networksJson;        // Last /api/networks body
+        uint32_t networksGeneration = 0; // Scan generation networksJson was built from
         bool serverRunning = false; // Server status flag
 
-        // Static instance pointer for callback handlers
-        static WebServerManager *instance;
+        // Credentials handed from the AsyncTCP task to update(), guarded by pendingLock
+        char pendingSsid[33] = {};     // 802.11 SSID: up to 32 bytes
+        char pendingPassword[65] = {}; // WPA2 passphrase or PSK: up to 64 characters
+        uint32_t pendingSinceMs = 0;
+        bool credentialsPending = false;
+        portMUX_TYPE pendingLock = portMUX_INITIALIZER_UNLOCKED;
+
+        // Delay before connecting, so the /config response reaches the browser
+        static const uint32_t CONNECT_DELAY_MS = 1000;
 
         /**
-         * Scan for available WiFi networks and build HTML options list
-         * Includes SSID and signal strength (RSSI) for each network
-         * Results stored in networkList for web page generation
+         * Rebuild networksJson from the WiFiManager scan cache
+         * Includes SSID, signal strength (RSSI), channel, auth mode and whether the network is secured
          */
-        void scanNetworks();
+        void buildNetworksJson();
 
         /**
-         * Generate complete HTML configuration page
-         * Includes responsive CSS styling and JavaScript enhancements
-         * Embeds scanned network list as select options
-         *
-         * @return Complete HTML page as String
+         * Register the /api/metrics routes (portal and connected mode)
          */
-        String generateConfigPage();
+        void registerMetricsRoutes();
 
-        // Static HTTP request handlers (required for WebServer callback system)
+        // HTTP request handlers (run in the AsyncTCP task)
 
         /**
          * Handle GET requests to root path "/"
-         * Serves main configuration page with network selection form
+         * Serves the gzipped configuration page from flash
+         */
+        void handleRoot(AsyncWebServerRequest *request);
+
+        /**
+         * Handle GET requests to "/api/networks"
+         * Returns the cached scan result as JSON, rebuilt only when a new scan completed
          */
-        static void handleRoot();
+        void handleNetworks(AsyncWebServerRequest *request);
 
         /**
          * Handle POST requests to "/config" endpoint
-         * Processes WiFi credential form submission
-         * Validates input and initiates connection attempt
-         * Returns success page with connection status
+         * Validates the form fields and queues them for update()
+         */
+        void handleConfig(AsyncWebServerRequest *request);
+
+        /**
+         * Handle GET requests to "/api/metrics/eventbus"
+         * Returns EventBus::getMetricsJson()
+         */
+        void handleEventBusMetrics(AsyncWebServerRequest *request);
+
+        /**
+         * Handle GET requests to "/api/metrics/tasks"
+         * Returns TaskProfiler::getJson()
          */
-        static void handleConfig();
+        void handleTaskMetrics(AsyncWebServerRequest *request);
 
         /**
          * Handle requests to undefined routes
          * Returns 404 error response
          */
-        static void handleNotFound();
+        void handleNotFound(AsyncWebServerRequest *request);
     };
 };
\ No newline at end of file
@@ -2,28 +2,79 @@
 
 #include "WebSocketClient.h"
 #include "../utils/Logger.h"
+#include <esp_heap_caps.h>
+#include <esp_idf_version.h>
+#include <string.h>
 
 namespace CloudMouse::SDK
 {
     WebSocketClient::WebSocketClient(const String& url)
-        : url(url), connected(false), client(nullptr)
+        : url(url), connected(false), client(nullptr),
+          rxBuffer(nullptr), rxCapacity(0), rxLength(0), rxOpcode(0), rxOverflow(false),
+          messagesReceived(0), messagesDropped(0),
+          sendHead(0), sendCount(0), sendLock(nullptr), sendSpace(nullptr), sendTask(nullptr),
+          sendExited(nullptr), sendStopping(false),
+          sendPolicy(WsSendPolicy::DROP_OLDEST), sendBlockTimeoutMs(0), batching(false), batchSeparator('\n'),
+          batchBuffer(nullptr), framesSent(0), sendDropped(0), sendFailed(0)
     {
+        memset(sendQueue, 0, sizeof(sendQueue));
     }
 
     WebSocketClient::~WebSocketClient()
     {
+        // The sender may be inside a send on the client: let it finish and exit first
+        if (sendTask) {
+            sendStopping = true;
+            xTaskNotifyGive(sendTask);
+            xSemaphoreTake(sendExited, portMAX_DELAY);
+            sendTask = nullptr;
+        }
         if (client) {
             esp_websocket_client_stop(client);
             esp_websocket_client_destroy(client);
         }
+        if (sendLock) {
+            clearSendQueue();
+            vSemaphoreDelete(sendLock);
+        }
+        if (sendSpace) {
+            vSemaphoreDelete(sendSpace);
+        }
+        if (sendExited) {
+            vSemaphoreDelete(sendExited);
+        }
+        free(batchBuffer);
+        if (rxBuffer) {
+            heap_caps_free(rxBuffer);
+        }
     }
 
     void WebSocketClient::begin()
     {
         SDK_LOGGER("Connecting WebSocket to %s", url.c_str());
+
+        if (!sendTask) {
+            sendLock = xSemaphoreCreateMutex();
+            sendSpace = xSemaphoreCreateBinary();
+            sendExited = xSemaphoreCreateBinary();
+            if (sendLock && sendSpace && sendExited) {
+                xTaskCreatePinnedToCore(
+                    sendTaskFunction,
+                    "WS_Send",
+                    4096,
+                    this,
+                    WS_SEND_TASK_PRIORITY,
+                    &sendTask,
+                    WS_SEND_TASK_CORE);
+            }
+            if (!sendTask) {
+                SDK_LOGGER("❌ WebSocket sender task could not be started");
+            }
+        }
         
         esp_websocket_client_config_t ws_cfg = {};
         ws_cfg.uri = url.c_str();
+        ws_cfg.buffer_size = WS_TRANSPORT_BUFFER_SIZE;
         
         client = esp_websocket_client_init(&ws_cfg);
         
@@ -41,26 +92,14 @@ namespace CloudMouse::SDK
         connected = false;
     }
 
-    bool WebSocketClient::sendText(const String& message)
+    WsSendStatus WebSocketClient::sendText(const String& message, uint16_t key)
     {
-        if (!connected || !client) {
-            SDK_LOGGER("Cannot send - not connected");
-            return false;
-        }
-        
-        int sent = esp_websocket_client_send_text(client, message.c_str(), message.length(), portMAX_DELAY);
-        return sent >= 0;
+        return enqueue(0x01, message.c_str(), message.length(), key);
     }
 
-    bool WebSocketClient::sendBinary(const char* data, size_t length)
+    WsSendStatus WebSocketClient::sendBinary(const char* data, size_t length, uint16_t key)
     {
-        if (!connected || !client) {
-            SDK_LOGGER("Cannot send binary - not connected");
-            return false;
-        }
-        
-        int sent = esp_websocket_client_send_bin(client, data, length, portMAX_DELAY);
-        return sent >= 0;
+        return enqueue(0x02, data, length, key);
     }
 
     void WebSocketClient::websocket_event_handler(void* handler_args, esp_event_base_t base, int32_t event_id, void* event_data)
@@ -72,6 +111,9 @@ namespace CloudMouse::SDK
             case WEBSOCKET_EVENT_CONNECTED:
                 SDK_LOGGER("WebSocket Connected");
                 self->connected = true;
+                if (self->sendTask) {
+                    xTaskNotifyGive(self->sendTask);
+                }
                 if (self->onConnected) {
                     self->onConnected();
                 }
@@ -80,19 +122,14 @@ namespace CloudMouse::SDK
             case WEBSOCKET_EVENT_DISCONNECTED:
                 SDK_LOGGER("WebSocket Disconnected");
                 self->connected = false;
+                self->clearSendQueue();
                 if (self->onDisconnected) {
                     self->onDisconnected();
                 }
                 break;
 
             case WEBSOCKET_EVENT_DATA:
-                if (data->op_code == 0x01) {  // Text frame
-                    String message = String((char*)data->data_ptr, data->data_len);
-                    SDK_LOGGER("WebSocket received: %s", message.c_str());
-                    if (self->onMessage) {
-                        self->onMessage(message);
-                    }
-                }
+                self->handleData(data);
                 break;
 
             case WEBSOCKET_EVENT_ERROR:
@@ -106,4 +143,316 @@ namespace CloudMouse::SDK
                 break;
         }
     }
-}
\ No newline at end of file
+
+    // ============================================================================
+    // SEND PATH
+    // ============================================================================
+
+    WsSendStatus WebSocketClient::enqueue(uint8_t opcode, const char* data, size_t length, uint16_t key)
+    {
+        if (!client || !connected || !sendTask) {
+            return WsSendStatus::NOT_CONNECTED;
+        }
+
+        uint8_t* copy = (uint8_t*)malloc(length ? length : 1);
+        if (!copy) {
+            return WsSendStatus::NO_MEMORY;
+        }
+        memcpy(copy, data, length);
+
+        OutboundMessage incoming = {copy, length, key, opcode};
+        TickType_t waitStart = xTaskGetTickCount();
+        TickType_t waitLimit = pdMS_TO_TICKS(sendBlockTimeoutMs);
+
+        while (true) {
+            xSemaphoreTake(sendLock, portMAX_DELAY);
+
+            if (sendPolicy == WsSendPolicy::COALESCE_BY_KEY && key != 0) {
+                for (uint8_t i = 0; i < sendCount; i++) {
+                    OutboundMessage& queued = sendQueue[(sendHead + i) % WS_SEND_QUEUE_DEPTH];
+                    if (queued.key == key && queued.opcode == opcode) {
+                        free(queued.data);
+                        queued = incoming;
+                        xSemaphoreGive(sendLock);
+                        return WsSendStatus::COALESCED;
+                    }
+                }
+            }
+
+            WsSendStatus status = WsSendStatus::QUEUED;
+            if (sendCount == WS_SEND_QUEUE_DEPTH && sendPolicy == WsSendPolicy::DROP_OLDEST) {
+                OutboundMessage oldest;
+                popOldest(oldest, true);
+                sendDropped++;
+                status = WsSendStatus::DROPPED_OLDEST;
+            }
+
+            if (sendCount < WS_SEND_QUEUE_DEPTH) {
+                sendQueue[(sendHead + sendCount) % WS_SEND_QUEUE_DEPTH] = incoming;
+                sendCount++;
+                xSemaphoreGive(sendLock);
+                xTaskNotifyGive(sendTask);
+                return status;
+            }
+
+            xSemaphoreGive(sendLock);
+
+            // Full: only BLOCK_WITH_TIMEOUT waits, for the sender task to make room
+            TickType_t waited = xTaskGetTickCount() - waitStart;
+            if (sendPolicy != WsSendPolicy::BLOCK_WITH_TIMEOUT || waited >= waitLimit ||
+                xSemaphoreTake(sendSpace, waitLimit - waited) != pdTRUE) {
+                break;
+            }
+        }
+
+        free(copy);
+        sendDropped++;
+        SDK_LOGD(WEBSOCKET, "⚠️ WebSocket send queue full, message dropped (%u bytes)", (unsigned)length);
+        return WsSendStatus::QUEUE_FULL;
+    }
+
+    bool WebSocketClient::popOldest(OutboundMessage& message, bool release)
+    {
+        if (sendCount == 0) {
+            return false;
+        }
+
+        message = sendQueue[sendHead];
+        sendQueue[sendHead].data = nullptr;
+        sendHead = (sendHead + 1) % WS_SEND_QUEUE_DEPTH;
+        sendCount--;
+
+        if (release) {
+            free(message.data);
+            message.data = nullptr;
+        }
+        return true;
+    }
+
+    void WebSocketClient::clearSendQueue()
+    {
+        if (!sendLock) {
+            return;
+        }
+
+        xSemaphoreTake(sendLock, portMAX_DELAY);
+        OutboundMessage message;
+        while (popOldest(message, true)) {
+            sendDropped++;
+        }
+        xSemaphoreGive(sendLock);
+    }
+
+    void WebSocketClient::sendTaskFunction(void* parameter)
+    {
+        static_cast<WebSocketClient*>(parameter)->sendLoop();
+    }
+
+    void WebSocketClient::sendLoop()
+    {
+        while (!sendStopping) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+            while (connected && !sendStopping) {
+                OutboundMessage message;
+
+                xSemaphoreTake(sendLock, portMAX_DELAY);
+                if (!popOldest(message, false)) {
+                    xSemaphoreGive(sendLock);
+                    break;
+                }
+
+                // Join the following small text messages into one frame
+                const uint8_t* frame = message.data;
+                size_t frameLength = message.length;
+                bool batched = false;
+
+                if (batching && message.opcode == 0x01 && !batchBuffer) {
+                    batchBuffer = (uint8_t*)malloc(WS_SEND_BATCH_MAX_SIZE);
+                }
+                if (batching && message.opcode == 0x01 && batchBuffer) {
+                    while (sendCount > 0) {
+                        OutboundMessage& next = sendQueue[sendHead];
+                        if (next.opcode != 0x01 || frameLength + 1 + next.length > WS_SEND_BATCH_MAX_SIZE) {
+                            break;
+                        }
+                        if (!batched) {
+                            memcpy(batchBuffer, message.data, message.length);
+                            batched = true;
+                        }
+                        batchBuffer[frameLength] = (uint8_t)batchSeparator;
+                        memcpy(batchBuffer + frameLength + 1, next.data, next.length);
+                        frameLength += 1 + next.length;
+
+                        OutboundMessage joined;
+                        popOldest(joined, true);
+                    }
+                }
+
+                xSemaphoreGive(sendLock);
+                xSemaphoreGive(sendSpace);
+
+                if (batched) {
+                    free(message.data);
+                    message.data = nullptr;
+                    frame = batchBuffer;
+                }
+
+                // Only this task waits on the link
+                TickType_t timeout = pdMS_TO_TICKS(WS_SEND_TIMEOUT_MS);
+                int sent = message.opcode == 0x01
+                    ? esp_websocket_client_send_text(client, (const char*)frame, frameLength, timeout)
+                    : esp_websocket_client_send_bin(client, (const char*)frame, frameLength, timeout);
+
+                if (sent < 0) {
+                    sendFailed++;
+                    SDK_LOGD(WEBSOCKET, "⚠️ WebSocket frame not sent (%u bytes)", (unsigned)frameLength);
+                } else {
+                    framesSent++;
+                }
+
+                free(message.data);
+            }
+        }
+
+        // Destructor waits for this before destroying the client
+        xSemaphoreGive(sendExited);
+        vTaskDelete(nullptr);
+    }
+
+    // ============================================================================
+    // RECEIVE PATH
+    // ============================================================================
+
+    // ESP-IDF 4.4 does not report FIN and the transport handle is private to the
+    // client: every frame is taken as the end of its message, so a fragmented
+    // message arrives as its first fragment and the continuations are dropped
+    static bool isFinalFrame(const esp_websocket_event_data_t* data)
+    {
+#if ESP_IDF_VERSION_MAJOR >= 5
+        return data->fin;
+#else
+        (void)data;
+        return true;
+#endif
+    }
+
+    void WebSocketClient::handleData(const esp_websocket_event_data_t* data)
+    {
+        uint8_t opcode = data->op_code;
+
+        // Close/ping/pong are answered by the ESP-IDF client and may sit between fragments
+        if (opcode >= 0x08) {
+            return;
+        }
+
+        size_t chunkLength = data->data_len > 0 ? data->data_len : 0;
+        bool frameStart = data->payload_offset == 0;
+        bool frameEnd = data->payload_offset + data->data_len >= data->payload_len;
+
+        if (frameStart && opcode != 0x00) {
+            // New text/binary message; a message still in progress is lost
+            if (rxOpcode != 0) {
+                messagesDropped++;
+                SDK_LOGD(WEBSOCKET, "⚠️ WebSocket message interrupted after %u bytes", (unsigned)rxLength);
+            }
+
+            // Whole message in one event: deliver straight from the transport buffer
+            if (frameEnd && isFinalFrame(data)) {
+                rxOpcode = 0;
+                deliver(opcode, (const uint8_t*)data->data_ptr, chunkLength);
+                return;
+            }
+
+            rxOpcode = opcode;
+            rxLength = 0;
+            rxOverflow = false;
+        } else if (rxOpcode == 0) {
+            // Continuation without a start frame (after a dropped message, or any
+            // fragmented message on ESP-IDF 4.4): counted once per frame
+            if (frameStart) {
+                messagesDropped++;
+                SDK_LOGD(WEBSOCKET, "⚠️ WebSocket continuation frame without a message dropped (%d bytes)",
+                         data->payload_len);
+            }
+            return;
+        }
+
+        if (!rxOverflow && !appendChunk(data->data_ptr, chunkLength)) {
+            rxOverflow = true;
+        }
+
+        if (!frameEnd || !isFinalFrame(data)) {
+            return;
+        }
+
+        if (rxOverflow) {
+            messagesDropped++;
+            SDK_LOGGER("⚠️ WebSocket message dropped: larger than %u bytes", (unsigned)WS_RX_MAX_MESSAGE_SIZE);
+            if (onError) {
+                onError("WebSocket message too large");
+            }
+        } else {
+            deliver(rxOpcode, rxBuffer, rxLength);
+        }
+
+        rxOpcode = 0;
+        rxLength = 0;
+        rxOverflow = false;
+    }
+
+    bool WebSocketClient::appendChunk(const char* chunk, size_t length)
+    {
+        size_t needed = rxLength + length;
+        if (needed > WS_RX_MAX_MESSAGE_SIZE) {
+            return false;
+        }
+
+        if (needed > rxCapacity) {
+            // Grow by doubling; the buffer is kept for the next messages
+            size_t capacity = rxCapacity ? rxCapacity : WS_RX_BUFFER_SIZE;
+            while (capacity < needed) {
+                capacity *= 2;
+            }
+            if (capacity > WS_RX_MAX_MESSAGE_SIZE) {
+                capacity = WS_RX_MAX_MESSAGE_SIZE;
+            }
+
+            uint8_t* grown = (uint8_t*)heap_caps_realloc(rxBuffer, capacity, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+            if (!grown) {
+                grown = (uint8_t*)heap_caps_realloc(rxBuffer, capacity, MALLOC_CAP_8BIT);
+            }
+            if (!grown) {
+                SDK_LOGGER("❌ WebSocket receive buffer allocation failed (%u bytes)", (unsigned)capacity);
+                return false;
+            }
+
+            rxBuffer = grown;
+            rxCapacity = capacity;
+        }
+
+        memcpy(rxBuffer + rxLength, chunk, length);
+        rxLength = needed;
+        return true;
+    }
+
+    void WebSocketClient::deliver(uint8_t opcode, const uint8_t* payload, size_t length)
+    {
+        messagesReceived++;
+
+        if (opcode == 0x01) {  // Text
+            SDK_LOGD(WEBSOCKET, "WebSocket text message: %u bytes", (unsigned)length);
+            if (onText) {
+                onText((const char*)payload, length);
+            }
+            if (onMessage) {
+                onMessage(String((const char*)payload, length));
+            }
+        } else if (opcode == 0x02) {  // Binary
+            SDK_LOGD(WEBSOCKET, "WebSocket binary message: %u bytes", (unsigned)length);
+            if (onBinary) {
+                onBinary(payload, length);
+            }
+        }
+    }
+}
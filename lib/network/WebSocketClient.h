@@ -4,6 +4,7 @@
 #include <Arduino.h>
 #include <esp_websocket_client.h>
 #include <functional>
+#include "../config/DeviceConfig.h"
 
 namespace CloudMouse::SDK
 {
@@ -20,9 +21,49 @@ namespace CloudMouse::SDK
     /**
      * @brief Callback invoked when a text message is received
      * @param payload The message payload as string
+     * @note Copies the message; prefer WsOnTextCallback for large payloads
      */
     using WsOnMessageCallback = std::function<void(const String& payload)>;
 
+    /**
+     * @brief Callback invoked with a complete text message
+     * @param data Message bytes (UTF-8, not NUL-terminated)
+     * @param length Message length in bytes
+     * @note The view is only valid during the call - copy what must outlive it
+     */
+    using WsOnTextCallback = std::function<void(const char* data, size_t length)>;
+
+    /**
+     * @brief Callback invoked with a complete binary message
+     * @param data Message bytes
+     * @param length Message length in bytes
+     * @note The view is only valid during the call - copy what must outlive it
+     */
+    using WsOnBinaryCallback = std::function<void(const uint8_t* data, size_t length)>;
+
+    /**
+     * @brief What sendText()/sendBinary() do when the outbound queue is full
+     */
+    enum class WsSendPolicy : uint8_t
+    {
+        DROP_OLDEST,        ///< Discard the oldest queued message to make room
+        COALESCE_BY_KEY,    ///< Keyed messages replace a queued one with the same key; otherwise reject when full
+        BLOCK_WITH_TIMEOUT  ///< Wait up to the configured timeout for room, then reject
+    };
+
+    /**
+     * @brief Result of queuing an outbound message
+     */
+    enum class WsSendStatus : uint8_t
+    {
+        QUEUED,         ///< Added to the queue
+        COALESCED,      ///< Replaced a queued message with the same key
+        DROPPED_OLDEST, ///< Added after discarding the oldest queued message
+        QUEUE_FULL,     ///< Rejected: no room (and the policy did not make any)
+        NOT_CONNECTED,  ///< Rejected: the connection is not up
+        NO_MEMORY       ///< Rejected: payload copy could not be allocated
+    };
+
     /**
      * @brief Callback invoked when an error occurs
      * @param error Error description
@@ -42,6 +83,29 @@ namespace CloudMouse::SDK
      * - Zero external dependencies
      * - Production-grade stability
      * 
+     * **Receive Path:**
+     * - Text and binary messages are delivered as pointer/length views
+     * - A message that arrives in one event is passed straight from the
+     *   transport buffer (no copy)
+     * - Frames split by the transport (payload_offset/payload_len) and
+     *   fragmented messages (continuation frames until FIN) are reassembled
+     *   in one reusable buffer, allocated in PSRAM when available and grown
+     *   on demand up to WS_RX_MAX_MESSAGE_SIZE; larger messages are dropped
+     * - Fragment reassembly needs the FIN flag, which the client only reports
+     *   from ESP-IDF 5. On 4.4 (Arduino core 2.x) the first fragment is
+     *   delivered as the whole message and each continuation frame counts in
+     *   getMessagesDropped(); unfragmented messages are not affected
+     * 
+     * **Send Path:**
+     * - sendText()/sendBinary() copy the message into a bounded outbound
+     *   queue (WS_SEND_QUEUE_DEPTH) and return at once with a WsSendStatus
+     * - A sender task owned by the client writes the frames, each with a
+     *   timeout of WS_SEND_TIMEOUT_MS, so a slow link only delays that task
+     * - When the queue is full the WsSendPolicy applies (default DROP_OLDEST)
+     * - Optional batching joins consecutive small text messages (separator
+     *   in between) into one frame of at most WS_SEND_BATCH_MAX_SIZE bytes
+     * - Messages still queued when the connection drops are discarded
+     * 
      * **Usage Example:**
      * @code
      * auto ws = new WebSocketClient("ws://192.168.1.100:8123/api/websocket");
@@ -50,8 +114,8 @@ namespace CloudMouse::SDK
      *     Serial.println("Connected!");
      * });
      * 
-     * ws->setOnMessage([](const String& msg) {
-     *     Serial.printf("Received: %s\n", msg.c_str());
+     * ws->setOnText([](const char* data, size_t length) {
+     *     Serial.printf("Received: %.*s\n", (int)length, data);
      * });
      * 
      * ws->begin();
@@ -69,9 +133,49 @@ namespace CloudMouse::SDK
         
         WsOnConnectedCallback onConnected;         ///< Connected callback
         WsOnDisconnectedCallback onDisconnected;   ///< Disconnected callback
-        WsOnMessageCallback onMessage;             ///< Message callback
+        WsOnMessageCallback onMessage;             ///< Message callback (String copy)
+        WsOnTextCallback onText;                   ///< Text message view callback
+        WsOnBinaryCallback onBinary;               ///< Binary message view callback
         WsOnErrorCallback onError;                 ///< Error callback
 
+        uint8_t* rxBuffer;                      ///< Reassembly buffer (kept between messages)
+        size_t rxCapacity;                      ///< Allocated size of rxBuffer
+        size_t rxLength;                        ///< Bytes of the message in progress
+        uint8_t rxOpcode;                       ///< Opcode of the message in progress, 0 if none
+        bool rxOverflow;                        ///< Message in progress exceeds WS_RX_MAX_MESSAGE_SIZE
+
+        uint32_t messagesReceived;              ///< Complete messages delivered
+        uint32_t messagesDropped;               ///< Oversized, incomplete or orphaned-continuation messages discarded
+
+        /**
+         * @brief Queued outbound message (payload copied on the heap)
+         */
+        struct OutboundMessage
+        {
+            uint8_t* data;
+            size_t length;
+            uint16_t key;                       ///< Coalescing key, 0 = none
+            uint8_t opcode;                     ///< 0x01 text, 0x02 binary
+        };
+
+        OutboundMessage sendQueue[WS_SEND_QUEUE_DEPTH]; ///< Ring of pending messages
+        uint8_t sendHead;                       ///< Index of the oldest message
+        uint8_t sendCount;                      ///< Messages in the ring
+        SemaphoreHandle_t sendLock;             ///< Guards the ring
+        SemaphoreHandle_t sendSpace;            ///< Given by the sender task after each pop
+        TaskHandle_t sendTask;                  ///< Sender task
+        SemaphoreHandle_t sendExited;           ///< Given by the sender task when it leaves its loop
+        volatile bool sendStopping;             ///< Set by the destructor: sender task exits
+        WsSendPolicy sendPolicy;
+        uint32_t sendBlockTimeoutMs;            ///< BLOCK_WITH_TIMEOUT wait
+        bool batching;
+        char batchSeparator;
+        uint8_t* batchBuffer;                   ///< Frame being assembled by the sender task
+
+        uint32_t framesSent;                    ///< Frames written (a batch counts once)
+        uint32_t sendDropped;                   ///< Messages discarded by policy or disconnect
+        uint32_t sendFailed;                    ///< Frames that could not be written in time
+
     public:
         /**
          * @brief Constructs a new WebSocket Client
@@ -81,7 +185,7 @@ namespace CloudMouse::SDK
         WebSocketClient(const String& url);
 
         /**
-         * @brief Destructor - cleans up WebSocket client
+         * @brief Destructor - waits for the sender task to exit, then cleans up WebSocket client
          */
         ~WebSocketClient();
 
@@ -106,23 +210,56 @@ namespace CloudMouse::SDK
         bool isConnected() const { return connected; }
 
         /**
-         * @brief Sends a text message to the server
+         * @brief Queues a text message for the server
          * 
          * @param message Text message to send
-         * @return true if sent successfully
-         * @return false if not connected or send failed
+         * @param key Coalescing key for COALESCE_BY_KEY (0 = never coalesced)
+         * @return QUEUED/COALESCED/DROPPED_OLDEST if accepted, otherwise why not
+         * @note Never waits on the network; only BLOCK_WITH_TIMEOUT waits for queue room
          */
-        bool sendText(const String& message);
+        WsSendStatus sendText(const String& message, uint16_t key = 0);
 
         /**
-         * @brief Sends binary data to the server
+         * @brief Queues binary data for the server
          * 
-         * @param data Pointer to binary data
+         * @param data Pointer to binary data (copied)
          * @param length Data length in bytes
-         * @return true if sent successfully
-         * @return false if not connected or send failed
+         * @param key Coalescing key for COALESCE_BY_KEY (0 = never coalesced)
+         * @return QUEUED/COALESCED/DROPPED_OLDEST if accepted, otherwise why not
+         */
+        WsSendStatus sendBinary(const char* data, size_t length, uint16_t key = 0);
+
+        /**
+         * @brief Sets the full-queue behaviour
+         * 
+         * @param policy Backpressure policy
+         * @param blockTimeoutMs Longest wait for room with BLOCK_WITH_TIMEOUT
+         */
+        void setSendPolicy(WsSendPolicy policy, uint32_t blockTimeoutMs = 0)
+        {
+            sendPolicy = policy;
+            sendBlockTimeoutMs = blockTimeoutMs;
+        }
+
+        /**
+         * @brief Enables joining consecutive small text messages into one frame
+         * 
+         * @param enabled Batching on/off (off by default: the server must split batches)
+         * @param separator Byte written between batched messages
+         */
+        void setBatching(bool enabled, char separator = '\n')
+        {
+            batching = enabled;
+            batchSeparator = separator;
+        }
+
+        /**
+         * @brief Send statistics
          */
-        bool sendBinary(const char* data, size_t length);
+        uint8_t getQueuedCount() const { return sendCount; }
+        uint32_t getFramesSent() const { return framesSent; }
+        uint32_t getSendDropped() const { return sendDropped; }
+        uint32_t getSendFailed() const { return sendFailed; }
 
         /**
          * @brief Sets callback for connection established event
@@ -145,6 +282,20 @@ namespace CloudMouse::SDK
          */
         void setOnMessage(WsOnMessageCallback callback) { onMessage = callback; }
 
+        /**
+         * @brief Sets callback for text messages, passed as a view
+         * 
+         * @param callback Function to invoke with each complete text message
+         */
+        void setOnText(WsOnTextCallback callback) { onText = callback; }
+
+        /**
+         * @brief Sets callback for binary messages, passed as a view
+         * 
+         * @param callback Function to invoke with each complete binary message
+         */
+        void setOnBinary(WsOnBinaryCallback callback) { onBinary = callback; }
+
         /**
          * @brief Sets callback for error events
          * 
@@ -152,6 +303,13 @@ namespace CloudMouse::SDK
          */
         void setOnError(WsOnErrorCallback callback) { onError = callback; }
 
+        /**
+         * @brief Receive statistics
+         */
+        uint32_t getMessagesReceived() const { return messagesReceived; }
+        uint32_t getMessagesDropped() const { return messagesDropped; }
+        size_t getRxBufferSize() const { return rxCapacity; }
+
     private:
         /**
          * @brief Static event handler for ESP-IDF WebSocket events
@@ -162,5 +320,45 @@ namespace CloudMouse::SDK
          * @param event_data Event data
          */
         static void websocket_event_handler(void* handler_args, esp_event_base_t base, int32_t event_id, void* event_data);
+
+        /**
+         * @brief Sender task entry point
+         */
+        static void sendTaskFunction(void* parameter);
+        void sendLoop();
+
+        /**
+         * @brief Copies a message into the outbound queue according to the policy
+         */
+        WsSendStatus enqueue(uint8_t opcode, const char* data, size_t length, uint16_t key);
+
+        /**
+         * @brief Removes the oldest message; frees its payload when 'release' is set
+         * 
+         * @note Call with sendLock held
+         */
+        bool popOldest(OutboundMessage& message, bool release);
+
+        /**
+         * @brief Frees every queued message (on disconnect and destruction)
+         */
+        void clearSendQueue();
+
+        /**
+         * @brief Handles one WEBSOCKET_EVENT_DATA chunk (runs in the client task)
+         */
+        void handleData(const esp_websocket_event_data_t* data);
+
+        /**
+         * @brief Appends a chunk to the reassembly buffer, growing it if needed
+         * 
+         * @return false if the message would exceed WS_RX_MAX_MESSAGE_SIZE or memory is exhausted
+         */
+        bool appendChunk(const char* chunk, size_t length);
+
+        /**
+         * @brief Passes a complete message to the callbacks
+         */
+        void deliver(uint8_t opcode, const uint8_t* payload, size_t length);
     };
 }
\ No newline at end of file
@@ -14,6 +14,7 @@
 
 #include "./WiFiManager.h"
 #include "../utils/NTPManager.h"
+#include "../utils/BootProfiler.h"
 #include "../utils/Logger.h"
 
 namespace CloudMouse::Network
@@ -21,6 +22,9 @@ namespace CloudMouse::Network
     // Static instance pointer for ESP32 event callback system
     WiFiManager *WiFiManager::staticInstance = nullptr;
 
+    // NVS key of the fast reconnect record
+    static const char *WIFI_FAST_CONNECT_KEY = "wifi_fast";
+
     // ============================================================================
     // INITIALIZATION AND LIFECYCLE
     // ============================================================================
@@ -43,6 +47,7 @@ namespace CloudMouse::Network
         initialized = true;
 
         // Attempt automatic connection with saved credentials
+        Utils::BootProfiler::begin("wifi.connect");
         if (connectWithSavedCredentials())
         {
             SDK_LOGGER("📶 Attempting connection with saved credentials...");
@@ -65,8 +70,32 @@ namespace CloudMouse::Network
         // Only active when in CONNECTING state
         if (currentState == WiFiState::CONNECTING)
         {
-            handleConnectionTimeout();
+            // Associated on the reused lease: confirm it with the router before going online
+            if (leaseRenewPending)
+            {
+                renewLease();
+            }
+
+            if (fastConnectAttempt && leaseRenewing)
+            {
+                if (fastConnectFailed || millis() - leaseRenewStartMs > WIFI_FAST_CONNECT_RENEW_TIMEOUT_MS)
+                {
+                    fallbackToFullConnect();
+                }
+            }
+            else if (fastConnectAttempt &&
+                     (fastConnectFailed || millis() - connectionStartTime > WIFI_FAST_CONNECT_TIMEOUT_MS))
+            {
+                fallbackToFullConnect();
+            }
+            else
+            {
+                handleConnectionTimeout();
+            }
         }
+
+        // Background network scan for the provisioning portal
+        serviceScan();
     }
 
     // ============================================================================
@@ -87,9 +116,139 @@ namespace CloudMouse::Network
         }
 
         SDK_LOGGER("📶 Found saved credentials for network: %s\n", savedSSID.c_str());
+
+#if WIFI_FAST_CONNECT_ENABLED
+        // Last good BSSID/channel/lease for this network, if any
+        if (!prefs.getBytes(WIFI_FAST_CONNECT_KEY, &fastRecord, sizeof(fastRecord)) ||
+            fastRecord.version != FAST_CONNECT_VERSION)
+        {
+            fastRecord = FastConnectRecord();
+        }
+
+        if (fastRecord.version && fastRecord.ssidHash == hashSsid(savedSSID.c_str()))
+            return connectFast(savedSSID.c_str(), savedPassword.c_str());
+#endif
+
         return connect(savedSSID.c_str(), savedPassword.c_str());
     }
 
+    bool WiFiManager::connectFast(const char *ssid, const char *password)
+    {
+        if (!initialized)
+            return false;
+
+        SDK_LOGGER("⚡ Fast reconnect: %s on channel %d (BSSID %02X:%02X:%02X:%02X:%02X:%02X)\n",
+                   ssid, fastRecord.channel,
+                   fastRecord.bssid[0], fastRecord.bssid[1], fastRecord.bssid[2],
+                   fastRecord.bssid[3], fastRecord.bssid[4], fastRecord.bssid[5]);
+
+        // No disconnect/settle delay: nothing is associated yet at this point
+        WiFi.mode(WIFI_STA);
+
+#if WIFI_FAST_CONNECT_STATIC_IP
+        // Reuse the last lease: no DHCP exchange before GOT_IP
+        if (fastRecord.ip)
+        {
+            staticIpApplied = WiFi.config(IPAddress(fastRecord.ip), IPAddress(fastRecord.gateway),
+                                          IPAddress(fastRecord.subnet), IPAddress(fastRecord.dns1),
+                                          IPAddress(fastRecord.dns2));
+        }
+#endif
+
+        onlineStartMs = millis();
+        fastConnectFailed = false;
+        fastConnectAttempt = true;
+        setState(WiFiState::CONNECTING);
+        connectionStartTime = onlineStartMs;
+        connectionTimeout = WIFI_FAST_CONNECT_TIMEOUT_MS;
+
+        // Directed connect: only this channel, only this access point
+        WiFi.begin(ssid, password, fastRecord.channel, fastRecord.bssid, true);
+
+        return true;
+    }
+
+    void WiFiManager::fallbackToFullConnect()
+    {
+        SDK_LOGGER("⚡ Fast reconnect %s after %lu ms - using full connect\n",
+                   fastConnectFailed ? "rejected" : leaseRenewing ? "got no DHCP answer" : "timed out",
+                   (unsigned long)(millis() - connectionStartTime));
+
+        fastConnectAttempt = false;
+        fastConnectFailed = false;
+
+        // Access point or lease changed: rebuilt from the next good connection
+        prefs.remove(WIFI_FAST_CONNECT_KEY);
+        fastRecord = FastConnectRecord();
+
+        // Time-to-online keeps counting from the fast attempt
+        uint32_t started = onlineStartMs;
+        connectWithSavedCredentials();
+        onlineStartMs = started;
+    }
+
+    void WiFiManager::rememberConnection()
+    {
+        lastConnectDurationMs = onlineStartMs ? millis() - onlineStartMs : 0; // 0 after WPS
+        lastConnectFast = fastConnectAttempt;
+        fastConnectAttempt = false;
+        SDK_LOGGER("📶 Online after %lu ms (%s)\n", (unsigned long)lastConnectDurationMs,
+                   lastConnectFast ? "fast reconnect" : "full connect");
+
+#if WIFI_FAST_CONNECT_ENABLED
+        FastConnectRecord record = {};
+        record.version = FAST_CONNECT_VERSION;
+        record.channel = (uint8_t)WiFi.channel();
+        const uint8_t *bssid = WiFi.BSSID();
+        if (bssid)
+            memcpy(record.bssid, bssid, sizeof(record.bssid));
+        record.ssidHash = hashSsid(WiFi.SSID().c_str());
+        record.ip = (uint32_t)WiFi.localIP();
+        record.gateway = (uint32_t)WiFi.gatewayIP();
+        record.subnet = (uint32_t)WiFi.subnetMask();
+        record.dns1 = (uint32_t)WiFi.dnsIP(0);
+        record.dns2 = (uint32_t)WiFi.dnsIP(1);
+
+        // Unchanged on most boots: skip the flash write
+        if (memcmp(&record, &fastRecord, sizeof(record)) != 0)
+        {
+            if (prefs.saveBytes(WIFI_FAST_CONNECT_KEY, &record, sizeof(record)))
+                fastRecord = record;
+            SDK_LOGGER("💾 Fast reconnect record saved (channel %d)\n", record.channel);
+        }
+#endif
+    }
+
+    void WiFiManager::renewLease()
+    {
+        SDK_LOGGER("⚡ Associated on reused lease %s - confirming via DHCP\n",
+                   WiFi.localIP().toString().c_str());
+
+        leaseRenewPending = false;
+        leaseRenewing = true;
+        leaseRenewStartMs = millis();
+        staticIpApplied = false;
+
+        // INADDR_NONE restarts the DHCP client; association is kept
+        if (!WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE))
+        {
+            SDK_LOGGER("⚠️ DHCP restart failed");
+            fastConnectFailed = true; // update() falls back to the full connect
+        }
+    }
+
+    uint32_t WiFiManager::hashSsid(const char *ssid)
+    {
+        // FNV-1a
+        uint32_t hash = 2166136261u;
+        while (*ssid)
+        {
+            hash ^= (uint8_t)*ssid++;
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
     bool WiFiManager::connect(const char *ssid, const char *password, uint32_t timeout)
     {
         if (!initialized)
@@ -105,9 +264,20 @@ namespace CloudMouse::Network
         WiFi.disconnect();   // Clear any previous connections
         delay(100);          // Brief stabilization delay
 
+        // Back to DHCP if a fast reconnect applied a static lease
+        if (staticIpApplied)
+        {
+            WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);
+            staticIpApplied = false;
+        }
+        leaseRenewPending = false;
+        leaseRenewing = false;
+
         // Update state and start connection timing
+        fastConnectAttempt = false;
         setState(WiFiState::CONNECTING);
         connectionStartTime = millis();
+        onlineStartMs = connectionStartTime;
         connectionTimeout = timeout;
 
         // Initiate connection attempt
@@ -147,6 +317,7 @@ namespace CloudMouse::Network
     {
         setState(WiFiState::AP_MODE_INIT);
         SDK_LOGGER("📶 Configuring device as WiFi Access Point...");
+        Utils::BootProfiler::end("wifi.connect"); // No network: setup portal instead
 
         // Set WiFi mode to Access Point
         WiFi.mode(WIFI_AP);
@@ -161,6 +332,8 @@ namespace CloudMouse::Network
         if (apStarted)
         {
             setState(WiFiState::AP_MODE);
+            Utils::BootProfiler::mark("wifi.ap");
+            requestScan(); // Networks are listed from the cache once this completes
             SDK_LOGGER("✅ Access Point created successfully\n");
             SDK_LOGGER("📶 Network Name: %s\n", apSSID.c_str());
             SDK_LOGGER("📶 Password: %s\n", apPassword.c_str());
@@ -189,6 +362,138 @@ namespace CloudMouse::Network
         return WiFi.softAPgetStationNum() > 0;
     }
 
+    // ============================================================================
+    // NETWORK SCANNING
+    // ============================================================================
+
+    void WiFiManager::serviceScan()
+    {
+        uint32_t now = millis();
+
+        if (scanning)
+        {
+            int result = WiFi.scanComplete();
+            if (result == WIFI_SCAN_RUNNING && now - scanStartedMs < WIFI_SCAN_TIMEOUT_MS)
+                return;
+
+            scanning = false;
+            if (result >= 0)
+                collectScanResults(result);
+            else
+                SDK_LOGGER("⚠️ WiFi scan %s", result == WIFI_SCAN_RUNNING ? "timed out" : "failed");
+            WiFi.scanDelete();
+            return;
+        }
+
+        // Scanning while associating would delay the connection
+        if (currentState == WiFiState::CONNECTING)
+            return;
+
+        // In AP mode: repeat on a schedule, sooner while nothing was found
+        uint32_t interval = scanResultCount ? WIFI_SCAN_INTERVAL_MS : WIFI_SCAN_RETRY_MS;
+        bool due = currentState == WiFiState::AP_MODE && now - scanStartedMs >= interval;
+        if (!scanRequested && !due)
+            return;
+
+        scanRequested = false;
+        scanStartedMs = now;
+
+        // Returns at once; the driver scans in the background
+        if (WiFi.scanNetworks(true, false) == WIFI_SCAN_RUNNING)
+        {
+            scanning = true;
+            SDK_LOGD(NETWORK, "🔍 WiFi scan started");
+        }
+        else
+        {
+            SDK_LOGGER("⚠️ WiFi scan could not be started");
+        }
+    }
+
+    void WiFiManager::collectScanResults(int count)
+    {
+        ScannedNetwork fresh[WIFI_SCAN_MAX_NETWORKS];
+        int freshCount = 0;
+
+        for (int i = 0; i < count; i++)
+        {
+            const wifi_ap_record_t *record = (const wifi_ap_record_t *)WiFi.getScanInfoByIndex(i);
+            if (!record || record->ssid[0] == 0)
+                continue; // Hidden network
+
+            const char *ssid = (const char *)record->ssid;
+
+            // Same SSID from several access points: keep the strongest
+            int slot = -1;
+            for (int j = 0; j < freshCount; j++)
+            {
+                if (strncmp(fresh[j].ssid, ssid, sizeof(fresh[j].ssid)) == 0)
+                {
+                    slot = j;
+                    break;
+                }
+            }
+
+            if (slot < 0)
+            {
+                if (freshCount < WIFI_SCAN_MAX_NETWORKS)
+                {
+                    slot = freshCount++;
+                }
+                else
+                {
+                    // Full: replace the weakest if this one is stronger
+                    slot = 0;
+                    for (int j = 1; j < freshCount; j++)
+                        if (fresh[j].rssi < fresh[slot].rssi)
+                            slot = j;
+                    if (record->rssi <= fresh[slot].rssi)
+                        continue;
+                }
+                strlcpy(fresh[slot].ssid, ssid, sizeof(fresh[slot].ssid));
+            }
+            else if (record->rssi <= fresh[slot].rssi)
+            {
+                continue;
+            }
+
+            fresh[slot].rssi = record->rssi;
+            fresh[slot].channel = record->primary;
+            fresh[slot].auth = record->authmode;
+        }
+
+        // Strongest first
+        for (int i = 1; i < freshCount; i++)
+        {
+            ScannedNetwork network = fresh[i];
+            int j = i - 1;
+            while (j >= 0 && fresh[j].rssi < network.rssi)
+            {
+                fresh[j + 1] = fresh[j];
+                j--;
+            }
+            fresh[j + 1] = network;
+        }
+
+        portENTER_CRITICAL(&scanLock);
+        memcpy(scanResults, fresh, sizeof(ScannedNetwork) * freshCount);
+        scanResultCount = freshCount;
+        scanGeneration++;
+        portEXIT_CRITICAL(&scanLock);
+
+        lastScanMs = millis();
+        SDK_LOGGER("✅ WiFi scan: %d access points, %d networks\n", count, freshCount);
+    }
+
+    int WiFiManager::getScanResults(ScannedNetwork *out, int maxCount) const
+    {
+        portENTER_CRITICAL(&scanLock);
+        int count = scanResultCount < maxCount ? scanResultCount : maxCount;
+        memcpy(out, scanResults, sizeof(ScannedNetwork) * count);
+        portEXIT_CRITICAL(&scanLock);
+        return count;
+    }
+
     // ============================================================================
     // WPS (WiFi Protected Setup) SUPPORT
     // ============================================================================
@@ -364,6 +669,14 @@ namespace CloudMouse::Network
         switch (event)
         {
         case ARDUINO_EVENT_WIFI_STA_GOT_IP:
+            if (staticInstance->staticIpApplied)
+            {
+                // Reused lease only: nobody is told before DHCP confirms an address
+                staticInstance->leaseRenewPending = true;
+                break;
+            }
+            staticInstance->leaseRenewing = false;
+
             // Connection successful - IP address assigned
             SDK_LOGGER("✅ WiFi connection successful!");
             SDK_LOGGER("📶 IP Address: %s\n", WiFi.localIP().toString().c_str());
@@ -373,12 +686,11 @@ namespace CloudMouse::Network
 
             // Save successful credentials for future use
             staticInstance->saveCredentials(WiFi.SSID(), WiFi.psk());
+            staticInstance->rememberConnection();
+            Utils::BootProfiler::end("wifi.connect");
             staticInstance->setState(WiFiState::CONNECTED);
 
-            // Brief stabilization delay before additional services
-            delay(1000);
-
-            // Initialize NTP time synchronization
+            // Start NTP time synchronization (completes in the background)
             SDK_LOGGER("⏰ Initializing network time synchronization...");
             CloudMouse::Utils::NTPManager::init();
             break;
@@ -387,7 +699,12 @@ namespace CloudMouse::Network
             // Connection lost or failed
             SDK_LOGGER("📶 WiFi connection lost");
 
-            if (staticInstance->currentState == WiFiState::CONNECTING)
+            if (staticInstance->currentState == WiFiState::CONNECTING && staticInstance->fastConnectAttempt)
+            {
+                // Stale BSSID/channel: update() falls back to the full procedure
+                staticInstance->fastConnectFailed = true;
+            }
+            else if (staticInstance->currentState == WiFiState::CONNECTING)
             {
                 // Timeout will be handled by handleConnectionTimeout()
                 SDK_LOGGER("📶 Connection attempt failed - timeout monitoring active");
@@ -396,6 +713,8 @@ namespace CloudMouse::Network
             {
                 // Unexpected disconnection from established connection
                 SDK_LOGGER("📶 Unexpected disconnection - attempting automatic reconnection");
+                staticInstance->leaseRenewPending = false;
+                staticInstance->leaseRenewing = false;
                 staticInstance->setState(WiFiState::DISCONNECTED);
             }
             break;
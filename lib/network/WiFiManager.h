@@ -13,6 +13,10 @@
  * - Automatic NTP time synchronization on successful connection
  * - Integration with PreferencesManager for credential persistence
  * - Device-specific AP credentials using hardware MAC address
+ * - Fast reconnect: directed connect to the last access point (BSSID, channel)
+ *   with its DHCP lease reused, falling back to scan + DHCP
+ * - Background network scanning (async scans on a schedule while in AP mode),
+ *   results cached as a de-duplicated snapshot for the provisioning portal
  *
  * Connection Flow:
  * 1. Initialize and attempt saved credentials
@@ -45,6 +49,18 @@ using namespace CloudMouse::Utils;
 using namespace CloudMouse::Prefs;
 namespace CloudMouse::Network
 {
+    /**
+     * One network from the cached scan result
+     * De-duplicated by SSID (strongest access point kept), hidden networks skipped.
+     */
+    struct ScannedNetwork
+    {
+        char ssid[33];          // NUL-terminated, up to 32 bytes
+        int8_t rssi;            // dBm
+        uint8_t channel;
+        wifi_auth_mode_t auth;  // WIFI_AUTH_OPEN = unsecured
+    };
+
     class WiFiManager
     {
     public:
@@ -94,7 +110,9 @@ namespace CloudMouse::Network
 
         /**
          * Attempt connection using saved credentials from NVS
-         * Automatically retrieves SSID and password from preferences
+         * Automatically retrieves SSID and password from preferences.
+         * Tries the fast path first when a record of the last connection to
+         * this SSID exists (see WIFI_FAST_CONNECT_ENABLED).
          *
          * @return true if credentials found and connection attempt started
          */
@@ -273,6 +291,53 @@ namespace CloudMouse::Network
          */
         wifi_mode_t getMode() const { return WiFi.getMode(); }
 
+        /**
+         * Time-to-online of the last connection: from the connect call to
+         * GOT_IP, including a failed fast attempt and its fallback
+         *
+         * @return Milliseconds, 0 before the first connection
+         */
+        uint32_t getLastConnectDurationMs() const { return lastConnectDurationMs; }
+
+        /**
+         * Check if the last connection was made through the fast path
+         *
+         * @return true if BSSID/channel (and lease) reuse succeeded
+         */
+        bool wasLastConnectFast() const { return lastConnectFast; }
+
+        // ========================================================================
+        // NETWORK SCANNING
+        // ========================================================================
+
+        /**
+         * Request a scan at the next update()
+         * Scans run asynchronously (WiFi.scanNetworks(true)); update() collects the
+         * results. While in AP mode scans also repeat every WIFI_SCAN_INTERVAL_MS.
+         */
+        void requestScan() { scanRequested = true; }
+
+        /**
+         * Copy the cached scan result, strongest network first
+         * Safe to call from any task (e.g. the AsyncTCP web server task).
+         *
+         * @param out Destination array
+         * @param maxCount Capacity of out
+         * @return Number of networks copied
+         */
+        int getScanResults(ScannedNetwork *out, int maxCount) const;
+
+        /**
+         * Incremented each time a scan completes; lets consumers rebuild derived data only on change
+         */
+        uint32_t getScanGeneration() const { return scanGeneration; }
+
+        /**
+         * Scan state
+         */
+        bool isScanning() const { return scanning; }
+        uint32_t getScanAgeMs() const { return scanGeneration ? millis() - lastScanMs : 0; }
+
         // ========================================================================
         // CONFIGURATION MANAGEMENT
         // ========================================================================
@@ -310,6 +375,84 @@ namespace CloudMouse::Network
         // Static instance pointer for ESP32 event callback system
         static WiFiManager *staticInstance;
 
+        /**
+         * Last good connection, stored in NVS for the fast reconnect path
+         * Addresses are IPAddress values (network byte order).
+         */
+        struct FastConnectRecord
+        {
+            uint8_t version;
+            uint8_t channel;
+            uint8_t bssid[6];
+            uint32_t ssidHash; // FNV-1a of the SSID this record belongs to
+            uint32_t ip;
+            uint32_t gateway;
+            uint32_t subnet;
+            uint32_t dns1;
+            uint32_t dns2;
+        };
+
+        static const uint8_t FAST_CONNECT_VERSION = 1;
+
+        FastConnectRecord fastRecord = {};        // Copy of the stored record (version 0 = none)
+        volatile bool fastConnectAttempt = false; // Current CONNECTING is the fast path
+        volatile bool fastConnectFailed = false;  // Set by the event handler, handled in update()
+        bool staticIpApplied = false;             // WiFi.config() set a static address
+        volatile bool leaseRenewPending = false;  // GOT_IP on a reused lease, DHCP restart due in update()
+        volatile bool leaseRenewing = false;      // DHCP restarted, CONNECTED waits for its GOT_IP
+        uint32_t leaseRenewStartMs = 0;
+        uint32_t onlineStartMs = 0;               // Start of the current time-to-online measurement
+        uint32_t lastConnectDurationMs = 0;
+        bool lastConnectFast = false;
+
+        /**
+         * Directed connect with the stored BSSID, channel and lease
+         */
+        bool connectFast(const char *ssid, const char *password);
+
+        /**
+         * Drop the fast record and restart with the full procedure
+         * Called from update() when the fast attempt fails or takes too long
+         */
+        void fallbackToFullConnect();
+
+        /**
+         * Store BSSID, channel and lease of the current connection if they changed
+         * Called on GOT_IP of a DHCP address (never for the reused static lease)
+         */
+        void rememberConnection();
+
+        /**
+         * Drop the reused static lease and restart DHCP on the associated link
+         * Called from update() while still CONNECTING; CONNECTED follows the DHCP
+         * GOT_IP, or update() falls back to the full connect after
+         * WIFI_FAST_CONNECT_RENEW_TIMEOUT_MS
+         */
+        void renewLease();
+
+        static uint32_t hashSsid(const char *ssid);
+
+        // Scan cache (written by update(), read by getScanResults() from any task)
+        ScannedNetwork scanResults[WIFI_SCAN_MAX_NETWORKS];
+        int scanResultCount = 0;
+        volatile uint32_t scanGeneration = 0;
+        uint32_t lastScanMs = 0;
+        uint32_t scanStartedMs = 0;
+        volatile bool scanning = false;
+        volatile bool scanRequested = false;
+        mutable portMUX_TYPE scanLock = portMUX_INITIALIZER_UNLOCKED;
+
+        /**
+         * Start a scheduled or requested scan, collect finished scan results
+         * Called from update()
+         */
+        void serviceScan();
+
+        /**
+         * Move the driver's scan list into the cache (de-duplicate, sort by RSSI)
+         */
+        void collectScanResults(int count);
+
         /**
          * Update internal state and trigger state change logging
          *
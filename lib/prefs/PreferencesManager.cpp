@@ -1,74 +1,405 @@
 /**
  * @file PreferencesManager.cpp
  * @brief Implementation of persistent storage manager using ESP32 NVS
- * 
+ *
  * Provides thread-safe access to device configuration, WiFi credentials,
- * and generic key-value storage with automatic initialization.
+ * and generic key-value storage with automatic initialization. Values are
+ * served from a RAM mirror of the namespace shared by all instances and
+ * committed to NVS in coalesced batches.
  */
 
 #include "PreferencesManager.h"
 #include "../utils/Logger.h"
+#include "../utils/BootProfiler.h"
+#include <esp_idf_version.h>
+#include <esp_system.h>
+#include <nvs.h>
+#include <map>
+#include <vector>
 
 namespace CloudMouse::Prefs
 {
     // ============================================================================
-    // SYSTEM INITIALIZATION
+    // SHARED RAM MIRROR
     // ============================================================================
 
     /**
-     * @brief Initialize the preferences manager
-     * 
-     * Creates mutex for thread-safe NVS access and initializes device settings
-     * with default values if not already present.
+     * @brief Cached value of one NVS key
      */
-    void PreferencesManager::init()
+    struct PrefsEntry
+    {
+        String text;                // NVS_TYPE_STR value
+        std::vector<uint8_t> bytes; // NVS_TYPE_BLOB value
+        bool blob = false;
+        bool dirty = false;   // Changed since the last commit
+        bool removed = false; // Pending removal from NVS
+    };
+
+    /**
+     * @brief Mirror of the namespace, shared by every PreferencesManager
+     */
+    struct PrefsStore
+    {
+        Preferences preferences;              // Used only with commitMutex held
+        std::map<String, PrefsEntry> entries; // Guarded by cacheMutex
+        SemaphoreHandle_t cacheMutex = NULL;  // Entries and pending state
+        SemaphoreHandle_t commitMutex = NULL; // Serializes NVS access
+        volatile bool loaded = false;
+        volatile int pendingCount = 0; // Dirty entries
+        volatile int batchDepth = 0;
+        volatile uint32_t firstDirtyMs = 0; // Oldest uncommitted write
+        volatile uint32_t lastWriteMs = 0;  // Newest uncommitted write
+        volatile uint32_t commitCount = 0;
+    };
+
+    static PrefsStore prefsStore;
+    static portMUX_TYPE prefsStoreInitLock = portMUX_INITIALIZER_UNLOCKED;
+
+    /** @brief NVS namespace identifier */
+    static const char *PREFS_NAMESPACE = "my-app";
+
+    /** @brief Longest wait for the locks when flushing from the shutdown handler */
+    static const uint32_t PREFS_SHUTDOWN_WAIT_MS = 500;
+
+    // NVS iterator API changed in ESP-IDF 5 (error codes, iterator by pointer)
+    static nvs_iterator_t prefsFirstEntry()
+    {
+#if ESP_IDF_VERSION_MAJOR >= 5
+        nvs_iterator_t it = NULL;
+        if (nvs_entry_find(NVS_DEFAULT_PART_NAME, PREFS_NAMESPACE, NVS_TYPE_ANY, &it) != ESP_OK)
+        {
+            nvs_release_iterator(it);
+            return NULL;
+        }
+        return it;
+#else
+        return nvs_entry_find(NVS_DEFAULT_PART_NAME, PREFS_NAMESPACE, NVS_TYPE_ANY);
+#endif
+    }
+
+    static nvs_iterator_t prefsNextEntry(nvs_iterator_t it)
+    {
+#if ESP_IDF_VERSION_MAJOR >= 5
+        if (nvs_entry_next(&it) != ESP_OK)
+        {
+            nvs_release_iterator(it);
+            return NULL;
+        }
+        return it;
+#else
+        return nvs_entry_next(it);
+#endif
+    }
+
+    /**
+     * @brief Read every string and blob of the namespace into the mirror
+     *
+     * Called once, with cacheMutex held: commits and clear() wait for the
+     * mirror, so the Preferences instance is free. Other NVS types are not
+     * written by PreferencesManager and are not mirrored.
+     */
+    static void prefsLoad()
+    {
+        uint32_t start = millis();
+        Utils::BootProfiler::begin("nvs.load");
+
+        // Fails when the namespace does not exist yet: nothing to load
+        if (prefsStore.preferences.begin(PREFS_NAMESPACE, true))
+        {
+            for (nvs_iterator_t it = prefsFirstEntry(); it != NULL; it = prefsNextEntry(it))
+            {
+                nvs_entry_info_t info;
+                nvs_entry_info(it, &info);
+
+                if (info.type == NVS_TYPE_STR)
+                {
+                    PrefsEntry &entry = prefsStore.entries[String(info.key)];
+                    entry.text = prefsStore.preferences.getString(info.key, "");
+                }
+                else if (info.type == NVS_TYPE_BLOB)
+                {
+                    PrefsEntry &entry = prefsStore.entries[String(info.key)];
+                    entry.blob = true;
+                    entry.bytes.resize(prefsStore.preferences.getBytesLength(info.key));
+                    if (!entry.bytes.empty())
+                        prefsStore.preferences.getBytes(info.key, entry.bytes.data(), entry.bytes.size());
+                }
+            }
+            prefsStore.preferences.end();
+        }
+
+        prefsStore.loaded = true;
+        Utils::BootProfiler::end("nvs.load");
+        SDK_LOGGER("✅ Preferences loaded: %d keys in %lu ms\n",
+                   (int)prefsStore.entries.size(), (unsigned long)(millis() - start));
+    }
+
+    /**
+     * @brief Commit dirty entries to NVS
+     * @param wait Longest wait for each lock
+     * @return True if nothing is left pending
+     *
+     * The entries are copied with cacheMutex held and written without it, so
+     * readers and writers are never blocked by flash writes. A key written
+     * again meanwhile is simply dirty again and goes with the next commit.
+     */
+    static bool prefsFlush(TickType_t wait)
     {
-        // Create mutex for thread-safe access
-        if (nvsMutex == NULL)
+        if (!prefsStore.loaded || prefsStore.pendingCount == 0)
+            return true;
+
+        if (xSemaphoreTake(prefsStore.commitMutex, wait) != pdTRUE)
+            return false;
+        if (xSemaphoreTake(prefsStore.cacheMutex, wait) != pdTRUE)
+        {
+            xSemaphoreGive(prefsStore.commitMutex);
+            return false;
+        }
+
+        std::vector<std::pair<String, PrefsEntry>> pending;
+        for (auto &item : prefsStore.entries)
         {
-            nvsMutex = xSemaphoreCreateMutex();
-            if (nvsMutex == NULL)
+            if (item.second.dirty)
+            {
+                pending.push_back(item);
+                item.second.dirty = false;
+            }
+        }
+        prefsStore.pendingCount = 0;
+        xSemaphoreGive(prefsStore.cacheMutex);
+
+        if (pending.empty())
+        {
+            xSemaphoreGive(prefsStore.commitMutex);
+            return true;
+        }
+
+        uint32_t start = micros();
+        bool opened = prefsStore.preferences.begin(PREFS_NAMESPACE, false);
+        std::vector<bool> written(pending.size(), false);
+
+        if (opened)
+        {
+            for (size_t i = 0; i < pending.size(); i++)
+            {
+                const char *key = pending[i].first.c_str();
+                const PrefsEntry &entry = pending[i].second;
+
+                if (entry.removed)
+                    written[i] = !prefsStore.preferences.isKey(key) || prefsStore.preferences.remove(key);
+                else if (entry.blob)
+                    written[i] = prefsStore.preferences.putBytes(key, entry.bytes.data(), entry.bytes.size()) == entry.bytes.size();
+                else
+                    written[i] = prefsStore.preferences.putString(key, entry.text) == entry.text.length();
+            }
+            prefsStore.preferences.end();
+        }
+        else
+        {
+            SDK_LOGGER("❌ Preferences commit failed: cannot open namespace %s\n", PREFS_NAMESPACE);
+        }
+        prefsStore.commitCount++;
+
+        // Drop committed removals, retry failed keys with the next commit
+        int failed = 0;
+        xSemaphoreTake(prefsStore.cacheMutex, portMAX_DELAY);
+        for (size_t i = 0; i < pending.size(); i++)
+        {
+            auto item = prefsStore.entries.find(pending[i].first);
+            if (item == prefsStore.entries.end() || item->second.dirty)
+                continue;
+
+            if (!written[i])
+            {
+                item->second.dirty = true;
+                if (prefsStore.pendingCount++ == 0)
+                    prefsStore.firstDirtyMs = millis();
+                prefsStore.lastWriteMs = millis();
+                failed++;
+            }
+            else if (item->second.removed)
+            {
+                prefsStore.entries.erase(item);
+            }
+        }
+        xSemaphoreGive(prefsStore.cacheMutex);
+        xSemaphoreGive(prefsStore.commitMutex);
+
+        if (failed)
+            SDK_LOGGER("⚠️ Preferences commit: %d of %d keys failed, retrying later\n", failed, (int)pending.size());
+        else
+            SDK_LOGD(PREFS, "💾 Preferences commit: %d keys in %lu us",
+                     (int)pending.size(), (unsigned long)(micros() - start));
+
+        return failed == 0;
+    }
+
+    /**
+     * @brief Flush pending writes on ESP.restart() / esp_restart()
+     */
+    static void prefsShutdownHandler()
+    {
+        prefsFlush(pdMS_TO_TICKS(PREFS_SHUTDOWN_WAIT_MS));
+    }
+
+    /**
+     * @brief Create the locks and load the mirror on first use
+     * @return True if the mirror is available
+     */
+    static bool prefsEnsureLoaded()
+    {
+        if (prefsStore.loaded)
+            return true;
+
+        // First use may race between tasks: keep the locks that were published first
+        if (prefsStore.cacheMutex == NULL)
+        {
+            SemaphoreHandle_t cache = xSemaphoreCreateMutex();
+            SemaphoreHandle_t commit = xSemaphoreCreateMutex();
+            if (cache == NULL || commit == NULL)
             {
                 SDK_LOGGER("❌ FATAL: Failed to create NVS mutex!");
+                if (cache)
+                    vSemaphoreDelete(cache);
+                if (commit)
+                    vSemaphoreDelete(commit);
+                return false;
+            }
+
+            bool published = false;
+            portENTER_CRITICAL(&prefsStoreInitLock);
+            if (prefsStore.cacheMutex == NULL)
+            {
+                prefsStore.cacheMutex = cache;
+                prefsStore.commitMutex = commit;
+                published = true;
+            }
+            portEXIT_CRITICAL(&prefsStoreInitLock);
+
+            if (published)
+            {
+                esp_register_shutdown_handler(prefsShutdownHandler);
             }
             else
             {
-                SDK_LOGGER("✅ NVS mutex created");
+                vSemaphoreDelete(cache);
+                vSemaphoreDelete(commit);
             }
         }
 
-        initDeviceSettings();
+        xSemaphoreTake(prefsStore.cacheMutex, portMAX_DELAY);
+        if (!prefsStore.loaded)
+            prefsLoad();
+        xSemaphoreGive(prefsStore.cacheMutex);
+        return true;
     }
 
     /**
-     * @brief Open preferences namespace with optional read-only mode
-     * @param readOnly If true, opens in read-only mode
-     * 
-     * Thread-safe operation using mutex locking.
+     * @brief Flag an entry for the next commit
+     *
+     * Called with cacheMutex held.
      */
-    void PreferencesManager::begin(bool readOnly)
+    static void prefsMarkDirty(PrefsEntry &entry)
     {
-        if (nvsMutex != NULL)
+        uint32_t now = millis();
+        if (!entry.dirty)
         {
-            xSemaphoreTake(nvsMutex, portMAX_DELAY);
+            entry.dirty = true;
+            if (prefsStore.pendingCount++ == 0)
+                prefsStore.firstDirtyMs = now;
         }
+        prefsStore.lastWriteMs = now;
+    }
 
-        preferences.begin(space, readOnly);
+    static bool prefsStoreString(const char *key, const String &value)
+    {
+        if (!key || !prefsEnsureLoaded())
+            return false;
+
+        xSemaphoreTake(prefsStore.cacheMutex, portMAX_DELAY);
+        auto item = prefsStore.entries.find(String(key));
+        bool unchanged = item != prefsStore.entries.end() && !item->second.removed &&
+                         !item->second.blob && item->second.text == value;
+        if (!unchanged)
+        {
+            PrefsEntry &entry = item != prefsStore.entries.end() ? item->second : prefsStore.entries[String(key)];
+            entry.text = value;
+            entry.bytes.clear();
+            entry.blob = false;
+            entry.removed = false;
+            prefsMarkDirty(entry);
+        }
+        xSemaphoreGive(prefsStore.cacheMutex);
+        return true;
+    }
+
+    static String prefsLoadString(const char *key, const String &defaultValue)
+    {
+        if (!key || !prefsEnsureLoaded())
+            return defaultValue;
+
+        xSemaphoreTake(prefsStore.cacheMutex, portMAX_DELAY);
+        auto item = prefsStore.entries.find(String(key));
+        String value = item != prefsStore.entries.end() && !item->second.removed && !item->second.blob
+                           ? item->second.text
+                           : defaultValue;
+        xSemaphoreGive(prefsStore.cacheMutex);
+        return value;
+    }
+
+    // ============================================================================
+    // SYSTEM INITIALIZATION
+    // ============================================================================
+
+    /**
+     * @brief Initialize the preferences manager
+     *
+     * Loads the namespace into the shared RAM mirror (first call only) and
+     * initializes device settings with default values if not already present.
+     */
+    void PreferencesManager::init()
+    {
+        if (prefsEnsureLoaded())
+        {
+            initDeviceSettings();
+        }
     }
 
     /**
-     * @brief Close preferences namespace and release mutex
+     * @brief Commit pending writes once they are due
      */
-    void PreferencesManager::end()
+    void PreferencesManager::update()
     {
-        preferences.end();
+        if (!prefsStore.loaded || prefsStore.pendingCount == 0 || prefsStore.batchDepth > 0)
+            return;
 
-        if (nvsMutex != NULL)
+        uint32_t now = millis();
+        if (now - prefsStore.lastWriteMs >= PREFS_COMMIT_DELAY_MS ||
+            now - prefsStore.firstDirtyMs >= PREFS_COMMIT_MAX_DELAY_MS)
         {
-            xSemaphoreGive(nvsMutex);
+            prefsFlush(portMAX_DELAY);
         }
     }
 
+    /**
+     * @brief Commit all pending writes to NVS now
+     * @return True if every pending key was written
+     */
+    bool PreferencesManager::flush()
+    {
+        return prefsFlush(portMAX_DELAY);
+    }
+
+    int PreferencesManager::getPendingCount() const
+    {
+        return prefsStore.pendingCount;
+    }
+
+    uint32_t PreferencesManager::getCommitCount() const
+    {
+        return prefsStore.commitCount;
+    }
+
     // ============================================================================
     // WIFI CREDENTIAL MANAGEMENT
     // ============================================================================
@@ -86,13 +417,14 @@ namespace CloudMouse::Prefs
      * @brief Save WiFi credentials to NVS
      * @param ssid WiFi network SSID
      * @param password WiFi network password
+     *
+     * Committed immediately: the device reconnects (and may reboot) right after.
      */
     void PreferencesManager::saveWiFiCredentials(const String &ssid, const String &password)
     {
-        begin(false);
-        preferences.putString("wifi_ssid", ssid);
-        preferences.putString("wifi_password", password);
-        end();
+        prefsStoreString("wifi_ssid", ssid);
+        prefsStoreString("wifi_password", password);
+        flush();
     }
 
     /**
@@ -101,10 +433,7 @@ namespace CloudMouse::Prefs
      */
     String PreferencesManager::getWiFiSSID()
     {
-        begin(true);
-        String value = preferences.getString("wifi_ssid", "");
-        end();
-        return value;
+        return prefsLoadString("wifi_ssid", "");
     }
 
     /**
@@ -113,10 +442,7 @@ namespace CloudMouse::Prefs
      */
     String PreferencesManager::getWiFiPassword()
     {
-        begin(true);
-        String value = preferences.getString("wifi_password", "");
-        end();
-        return value;
+        return prefsLoadString("wifi_password", "");
     }
 
     // ============================================================================
@@ -124,166 +450,171 @@ namespace CloudMouse::Prefs
     // ============================================================================
 
     /**
-     * @brief Save a string value to NVS
+     * @brief Save a string value (committed to NVS later)
      * @param key Storage key
      * @param value String value to store
-     * @return True if save was successful
+     * @return True if the value was stored in the mirror
      */
     bool PreferencesManager::save(const char *key, const String &value)
     {
-        begin(false);
-        preferences.putString(key, value);
-        end();
-        return true;
+        return prefsStoreString(key, value);
     }
 
     /**
-     * @brief Retrieve a string value from NVS
+     * @brief Retrieve a string value
      * @param key Storage key
      * @return Stored value or empty string if not found
      */
     String PreferencesManager::get(const char *key)
     {
-        begin(true);
-        String value = preferences.getString(key, "");
-        end();
-        return value;
+        return prefsLoadString(key, "");
     }
 
-    // ============================================================================
-    // BATCH OPERATIONS
-    // ============================================================================
-
     /**
-     * @brief Begin batch operation for multiple read/write operations
-     * @param readOnly If true, opens in read-only mode
-     * @return True if batch was successfully opened
-     * 
-     * Keeps NVS namespace open for multiple operations to improve performance.
-     * Supports nested calls with depth tracking. Automatically retries on failure.
+     * @brief Save a binary record (committed to NVS later)
+     * @param key Storage key
+     * @param data Record bytes
+     * @param length Record size in bytes
+     * @return True if the record was stored in the mirror
      */
-    bool PreferencesManager::beginBatch(bool readOnly)
+    bool PreferencesManager::saveBytes(const char *key, const void *data, size_t length)
     {
+        if (!key || (!data && length) || !prefsEnsureLoaded())
+            return false;
 
-        // Lock mutex FIRST
-        if (nvsMutex != NULL)
-        {
-            xSemaphoreTake(nvsMutex, portMAX_DELAY);
-        }
+        const uint8_t *bytes = (const uint8_t *)data;
 
-        // Check if already open (nested call)
-        if (batchOpen)
+        xSemaphoreTake(prefsStore.cacheMutex, portMAX_DELAY);
+        auto item = prefsStore.entries.find(String(key));
+        bool unchanged = item != prefsStore.entries.end() && !item->second.removed && item->second.blob &&
+                         item->second.bytes.size() == length &&
+                         (length == 0 || memcmp(item->second.bytes.data(), bytes, length) == 0);
+        if (!unchanged)
         {
-            SDK_LOGGER("⚠️ Batch already open (nested call), keeping it open");
-            batchDepth++;
-            return true;
+            PrefsEntry &entry = item != prefsStore.entries.end() ? item->second : prefsStore.entries[String(key)];
+            entry.bytes.assign(bytes, bytes + length);
+            entry.text = "";
+            entry.blob = true;
+            entry.removed = false;
+            prefsMarkDirty(entry);
         }
+        xSemaphoreGive(prefsStore.cacheMutex);
+        return true;
+    }
 
-        // Try up to 3 times with small delay
-        for (int attempt = 0; attempt < 3; attempt++)
-        {
-            batchOpen = preferences.begin(space, readOnly);
-
-            if (batchOpen)
-            {
-                batchDepth = 1;
-                if (attempt > 0)
-                {
-                    SDK_LOGGER("✅ Batch opened on attempt %d\n", attempt + 1);
-                }
-                return true;
-            }
+    /**
+     * @brief Retrieve a binary record
+     * @param key Storage key
+     * @param data Destination buffer
+     * @param length Expected record size
+     * @return True if a record of exactly this size was found
+     *
+     * A size mismatch (record written by another firmware layout) is treated as missing.
+     */
+    bool PreferencesManager::getBytes(const char *key, void *data, size_t length)
+    {
+        if (!key || !prefsEnsureLoaded())
+            return false;
+
+        xSemaphoreTake(prefsStore.cacheMutex, portMAX_DELAY);
+        auto item = prefsStore.entries.find(String(key));
+        bool found = item != prefsStore.entries.end() && !item->second.removed && item->second.blob &&
+                     item->second.bytes.size() == length;
+        if (found && length)
+            memcpy(data, item->second.bytes.data(), length);
+        xSemaphoreGive(prefsStore.cacheMutex);
+        return found;
+    }
 
-            SDK_LOGGER("⚠️ Batch open failed (attempt %d/3), retrying...\n", attempt + 1);
-            delay(10);
-        }
+    /**
+     * @brief Remove a single key (removed from NVS with the next commit)
+     * @param key Storage key
+     */
+    void PreferencesManager::remove(const char *key)
+    {
+        if (!key || !prefsEnsureLoaded())
+            return;
 
-        SDK_LOGGER("❌ Batch open FAILED after 3 attempts! (namespace=%s)\n", space);
-        
-        // Release mutex on failure
-        if (nvsMutex != NULL)
+        xSemaphoreTake(prefsStore.cacheMutex, portMAX_DELAY);
+        auto item = prefsStore.entries.find(String(key));
+        if (item != prefsStore.entries.end() && !item->second.removed)
         {
-            xSemaphoreGive(nvsMutex);
+            item->second.text = "";
+            item->second.bytes.clear();
+            item->second.removed = true;
+            prefsMarkDirty(item->second);
         }
-        
-        return false;
+        xSemaphoreGive(prefsStore.cacheMutex);
     }
 
+    // ============================================================================
+    // BATCH OPERATIONS
+    // ============================================================================
+
     /**
-     * @brief End batch operation and close NVS namespace
-     * 
-     * Handles nested calls by tracking depth. Only closes namespace when
-     * depth reaches zero.
+     * @brief Begin batch operation for multiple read/write operations
+     * @param readOnly Kept for compatibility, ignored
+     * @return Always true
+     *
+     * Holds back commits until the matching endBatch(). Supports nested
+     * calls with depth tracking.
+     */
+    bool PreferencesManager::beginBatch(bool readOnly)
+    {
+        (void)readOnly;
+        if (!prefsEnsureLoaded())
+            return false;
+
+        xSemaphoreTake(prefsStore.cacheMutex, portMAX_DELAY);
+        prefsStore.batchDepth++;
+        xSemaphoreGive(prefsStore.cacheMutex);
+        return true;
+    }
+
+    /**
+     * @brief End batch operation
+     *
+     * Handles nested calls by tracking depth. When depth reaches zero the
+     * quiet period before the commit starts over.
      */
     void PreferencesManager::endBatch()
     {
-        if (!batchOpen)
-        {
-            // Not open, but still release mutex if taken
-            if (nvsMutex != NULL && batchDepth > 0)
-            {
-                xSemaphoreGive(nvsMutex);
-                batchDepth = 0;
-            }
+        if (!prefsStore.loaded)
             return;
-        }
 
-        // Handle nested calls
-        batchDepth--;
-        if (batchDepth > 0)
+        xSemaphoreTake(prefsStore.cacheMutex, portMAX_DELAY);
+        if (prefsStore.batchDepth > 0 && --prefsStore.batchDepth == 0 && prefsStore.pendingCount > 0)
         {
-            SDK_LOGGER("⚠️ Nested batch, depth now: %d\n", batchDepth);
-            return;
+            prefsStore.lastWriteMs = millis();
         }
+        xSemaphoreGive(prefsStore.cacheMutex);
+    }
 
-        // Actually close
-        preferences.end();
-        batchOpen = false;
-        batchDepth = 0;
-
-        // Release mutex LAST
-        if (nvsMutex != NULL)
-        {
-            xSemaphoreGive(nvsMutex);
-        }
+    bool PreferencesManager::isBatchOpen() const
+    {
+        return prefsStore.batchDepth > 0;
     }
 
     /**
-     * @brief Save string during batch operation
+     * @brief Save string (same as save())
      * @param key Storage key
      * @param value String value to store
      * @return True if save was successful
-     * 
-     * If batch is not open, falls back to normal save().
      */
     bool PreferencesManager::putString(const char *key, const String &value)
     {
-        if (!batchOpen)
-        {
-            // Fallback to normal save
-            return save(key, value);
-        }
-
-        return preferences.putString(key, value.c_str());
+        return prefsStoreString(key, value);
     }
 
     /**
-     * @brief Retrieve string during batch operation
+     * @brief Retrieve string with an explicit default
      * @param key Storage key
      * @param defaultValue Value to return if key not found
      * @return Stored value or defaultValue if not found
-     * 
-     * If batch is not open, falls back to normal get().
      */
     String PreferencesManager::getString(const char *key, const String &defaultValue)
     {
-        if (!batchOpen)
-        {
-            // Fallback to normal get
-            return get(key);
-        }
-
-        return preferences.getString(key, defaultValue.c_str());
+        return prefsLoadString(key, defaultValue);
     }
 
     // ============================================================================
@@ -292,33 +623,39 @@ namespace CloudMouse::Prefs
 
     /**
      * @brief Clear all preferences in current namespace
-     * 
-     * Removes all stored key-value pairs and reinitializes namespace
-     * to ensure clean state.
+     *
+     * Removes all stored key-value pairs, pending writes included, from
+     * the mirror and from NVS.
      */
     void PreferencesManager::clear()
     {
-        begin(false);
-        preferences.clear(); // Clear all preferences in current namespace
-        end();
+        if (!prefsEnsureLoaded())
+            return;
 
-        // Reinitialize namespace to ensure clean state
-        preferences.begin(space, false);
-        preferences.clear();
-        end();
+        xSemaphoreTake(prefsStore.commitMutex, portMAX_DELAY);
+
+        xSemaphoreTake(prefsStore.cacheMutex, portMAX_DELAY);
+        prefsStore.entries.clear();
+        prefsStore.pendingCount = 0;
+        xSemaphoreGive(prefsStore.cacheMutex);
+
+        prefsStore.preferences.begin(PREFS_NAMESPACE, false);
+        prefsStore.preferences.clear(); // Clear all preferences in current namespace
+        prefsStore.preferences.end();
+        prefsStore.commitCount++;
+
+        xSemaphoreGive(prefsStore.commitMutex);
     }
 
     /**
      * @brief Clear all stored preferences
-     * 
+     *
      * Complete wipe of all preferences data.
      */
     void PreferencesManager::clearAll()
     {
         SDK_LOGGER("🗑️ Clearing all preferences...");
-        begin(false);
-        preferences.clear();
-        end();
+        clear();
         SDK_LOGGER("✅ All preferences cleared!");
     }
 
@@ -328,12 +665,14 @@ namespace CloudMouse::Prefs
 
     /**
      * @brief Initialize device settings with default values
-     * 
+     *
      * Sets default values for brightness, LED color, language, and theme
-     * if not already present in storage.
+     * if not already present in storage. Committed together.
      */
     void PreferencesManager::initDeviceSettings()
     {
+        beginBatch();
+
         // Initialize brightness setting if not present
         if (get("conf.brightness").equals(""))
         {
@@ -357,6 +696,8 @@ namespace CloudMouse::Prefs
         {
             save("conf.theme", DEFAULT_THEME);
         }
+
+        endBatch();
     }
 
-} // namespace CloudMouse::Prefs
\ No newline at end of file
+} // namespace CloudMouse::Prefs
@@ -5,6 +5,17 @@
  * Provides thread-safe access to device configuration, WiFi credentials,
  * and generic key-value storage with automatic initialization and default values.
  *
+ * Write-back cache:
+ * - The whole NVS namespace is mirrored in RAM on first use (init()), and all
+ *   PreferencesManager instances share that mirror: reads never touch NVS
+ * - Writes only update the mirror and mark the key dirty (writing an unchanged
+ *   value does nothing); dirty keys are committed together by update() once no
+ *   write happened for PREFS_COMMIT_DELAY_MS, and at the latest
+ *   PREFS_COMMIT_MAX_DELAY_MS after the first pending write
+ * - flush() commits immediately; pending writes are also flushed by a
+ *   shutdown handler on ESP.restart()
+ * - clear()/clearAll() go to NVS immediately
+ *
  * @namespace CloudMouse::Prefs
  * @brief Preferences management components
  */
@@ -13,6 +24,7 @@
 #define PREFERENCESMANAGER_H
 
 #include <Preferences.h>
+#include "../config/DeviceConfig.h"
 
 namespace CloudMouse::Prefs
 {
@@ -26,7 +38,7 @@ namespace CloudMouse::Prefs
      * Features:
      * - Automatic initialization with default device settings
      * - Thread-safe WiFi credential management
-     * - Batch operations for improved performance
+     * - RAM mirror with coalesced, delayed commits
      * - Generic key-value storage interface
      * - Safe clear/reset operations
      *
@@ -38,11 +50,36 @@ namespace CloudMouse::Prefs
         /**
          * @brief Initialize the preferences manager
          *
-         * Creates mutex for thread-safe access and sets default values
-         * for device settings if not already present.
+         * Loads the namespace into the shared RAM mirror (once) and sets
+         * default values for device settings if not already present.
          */
         void init();
 
+        /**
+         * @brief Commit pending writes once they are due
+         *
+         * Called periodically by the Core coordination task. Commits when
+         * no write happened for PREFS_COMMIT_DELAY_MS or the oldest pending
+         * write is PREFS_COMMIT_MAX_DELAY_MS old; never inside a batch.
+         */
+        void update();
+
+        /**
+         * @brief Commit all pending writes to NVS now
+         * @return True if every pending key was written
+         */
+        bool flush();
+
+        /**
+         * @brief Number of keys written in RAM but not yet committed
+         */
+        int getPendingCount() const;
+
+        /**
+         * @brief Number of commits (NVS open/write/close cycles) so far
+         */
+        uint32_t getCommitCount() const;
+
         /**
          * @brief Check if WiFi credentials are stored
          * @return True if both SSID and password are present
@@ -70,21 +107,21 @@ namespace CloudMouse::Prefs
 
         /**
          * @brief Begin batch operation for multiple read/write operations
-         * @param readOnly If true, opens in read-only mode (default: false)
-         * @return True if batch was successfully opened
+         * @param readOnly Kept for compatibility, ignored
+         * @return Always true
          *
-         * Keeps NVS namespace open for multiple operations to improve performance.
-         * Supports nested calls with depth tracking. Automatically retries on failure.
+         * Holds back commits until the matching endBatch(), so related keys
+         * reach NVS together. Supports nested calls with depth tracking.
          *
-         * @note Must be followed by endBatch() to release resources
+         * @note Must be followed by endBatch()
          */
         bool beginBatch(bool readOnly = false);
 
         /**
-         * @brief End batch operation and close NVS namespace
+         * @brief End batch operation
          *
-         * Handles nested calls by tracking depth. Only closes namespace
-         * when depth reaches zero.
+         * Handles nested calls by tracking depth. When depth reaches zero
+         * the batch's writes are committed after the usual quiet period.
          */
         void endBatch();
 
@@ -92,43 +129,63 @@ namespace CloudMouse::Prefs
          * @brief Check if batch operation is currently open
          * @return True if batch is open
          */
-        bool isBatchOpen() const { return batchOpen; }
+        bool isBatchOpen() const;
 
         /**
-         * @brief Save string during batch operation
+         * @brief Save string (same as save())
          * @param key Storage key
          * @param value String value to store
          * @return True if save was successful
-         *
-         * If batch is not open, falls back to normal save().
          */
         bool putString(const char *key, const String &value);
 
         /**
-         * @brief Retrieve string during batch operation
+         * @brief Retrieve string with an explicit default
          * @param key Storage key
          * @param defaultValue Value to return if key not found (default: empty string)
          * @return Stored value or defaultValue if not found
-         *
-         * If batch is not open, falls back to normal get().
          */
         String getString(const char *key, const String &defaultValue = "");
 
         /**
-         * @brief Save a string value to NVS
+         * @brief Save a string value (committed to NVS later)
          * @param key Storage key
          * @param value String value to store
-         * @return True if save was successful
+         * @return True if the value was stored in the mirror
          */
         bool save(const char *key, const String &value);
 
         /**
-         * @brief Retrieve a string value from NVS
+         * @brief Retrieve a string value
          * @param key Storage key
          * @return Stored value or empty string if not found
          */
         String get(const char *key);
 
+        /**
+         * @brief Save a binary record (committed to NVS later)
+         * @param key Storage key
+         * @param data Record bytes
+         * @param length Record size in bytes
+         * @return True if the record was stored in the mirror
+         */
+        bool saveBytes(const char *key, const void *data, size_t length);
+
+        /**
+         * @brief Retrieve a binary record
+         * @param key Storage key
+         * @param data Destination buffer
+         * @param length Expected record size
+         * @return True if a record of exactly this size was found
+         */
+        bool getBytes(const char *key, void *data, size_t length);
+
+        /**
+         * @brief Remove a single key (removed from NVS with the next commit)
+         * @param key Storage key
+         */
+        void remove(const char *key);
+
         /**
          * @brief Clear all preferences in current namespace
          *
@@ -145,21 +202,6 @@ namespace CloudMouse::Prefs
         void clearAll();
 
     private:
-        /** @brief ESP32 NVS interface */
-        Preferences preferences;
-
-        /** @brief Batch operation state flag */
-        bool batchOpen = false;
-
-        /** @brief NVS namespace identifier */
-        const char *space = "my-app";
-
-        /** @brief Nested batch operation depth counter */
-        int batchDepth = 0;
-
-        /** @brief FreeRTOS mutex for thread-safe NVS access */
-        SemaphoreHandle_t nvsMutex = NULL;
-
         /** @brief Default brightness level (0-100) */
         const int DEFAULT_BRIGHTNESS = 80;
 
@@ -172,19 +214,6 @@ namespace CloudMouse::Prefs
         /** @brief Default theme name */
         const String DEFAULT_THEME = "light";
 
-        /**
-         * @brief Open preferences namespace with optional read-only mode
-         * @param readOnly If true, opens in read-only mode
-         *
-         * Thread-safe operation using mutex locking.
-         */
-        void begin(bool readOnly);
-
-        /**
-         * @brief Close preferences namespace and release mutex
-         */
-        void end();
-
         /**
          * @brief Initialize device settings with default values
          *
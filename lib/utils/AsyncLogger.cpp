@@ -0,0 +1,634 @@
+/**
+ * CloudMouse SDK - Asynchronous Logger Implementation
+ *
+ * Record layout in the ring (4-byte aligned, never wrapping around the end):
+ *   RecordHead  header word (size | flags | level | module), format pointer,
+ *               number of argument bytes
+ *   arguments   8 bytes per numeric argument, strings as u16 length + bytes,
+ *               4 bytes per '*' width/precision
+ *
+ * A record whose header word has no COMMITTED bit is still being written: the
+ * consumer stops there. Consumed records are zeroed so a reserved but not yet
+ * committed area always reads as uncommitted.
+ */
+
+#include "./AsyncLogger.h"
+#include "../config/DeviceConfig.h"
+#include "./MemoryBudget.h"
+#include <atomic>
+#include <stdarg.h>
+
+namespace CloudMouse::Utils
+{
+    volatile uint32_t AsyncLogger::moduleMask = 0xFFFFFFFFu;
+    TaskHandle_t AsyncLogger::task = nullptr;
+
+    namespace
+    {
+        // ============================================================================
+        // RING BUFFER STATE
+        // ============================================================================
+
+        const uint32_t RING_MASK = LOG_BUFFER_SIZE - 1;
+
+        const uint32_t HEADER_SIZE_MASK = 0xFFFFu;
+        const uint32_t HEADER_COMMITTED = 1u << 16;
+        const uint32_t HEADER_PADDING = 1u << 17;
+
+        struct RecordHead
+        {
+            uint32_t header;        // size | flags | level << 20 | module << 24
+            const char *format;
+            uint16_t argBytes;
+            uint16_t reserved;
+        };
+
+        alignas(4) uint8_t logRing[LOG_BUFFER_SIZE];
+        TaskStorage<LOG_TASK_STACK_SIZE> loggerTaskStorage;
+        std::atomic<uint32_t> writePos(0);   // Reserved up to (producers)
+        std::atomic<uint32_t> readPos(0);    // Freed up to (logger task)
+
+        std::atomic<uint32_t> writtenCount(0);
+        std::atomic<uint32_t> droppedCount(0);
+        uint32_t highWater = 0;
+        uint32_t reportedDropped = 0;
+
+        // Only the logger task renders, so the line buffer is not on its stack
+        char logLine[LOG_RECORD_MAX_SIZE + 64];
+        char logText[LOG_RECORD_MAX_SIZE];
+
+        // ============================================================================
+        // FORMAT PARSING (shared by capture and rendering)
+        // ============================================================================
+
+        enum LengthModifier : uint8_t
+        {
+            LEN_NONE,
+            LEN_HH,
+            LEN_H,
+            LEN_L,
+            LEN_LL,
+            LEN_Z,
+            LEN_J,
+            LEN_T,
+            LEN_BIG_L
+        };
+
+        struct FormatSpec
+        {
+            const char *start;      // '%'
+            const char *end;        // One past the conversion character
+            char conversion;
+            LengthModifier length;
+            bool starWidth;
+            bool starPrecision;
+        };
+
+        bool parseSpec(const char *percent, FormatSpec &spec)
+        {
+            const char *p = percent + 1;
+            spec.start = percent;
+            spec.length = LEN_NONE;
+            spec.starWidth = false;
+            spec.starPrecision = false;
+
+            while (*p && strchr("-+ #0", *p))
+                p++;
+
+            if (*p == '*')
+            {
+                spec.starWidth = true;
+                p++;
+            }
+            while (*p >= '0' && *p <= '9')
+                p++;
+
+            if (*p == '.')
+            {
+                p++;
+                if (*p == '*')
+                {
+                    spec.starPrecision = true;
+                    p++;
+                }
+                while (*p >= '0' && *p <= '9')
+                    p++;
+            }
+
+            switch (*p)
+            {
+            case 'h':
+                spec.length = (p[1] == 'h') ? LEN_HH : LEN_H;
+                p += (p[1] == 'h') ? 2 : 1;
+                break;
+            case 'l':
+                spec.length = (p[1] == 'l') ? LEN_LL : LEN_L;
+                p += (p[1] == 'l') ? 2 : 1;
+                break;
+            case 'z':
+                spec.length = LEN_Z;
+                p++;
+                break;
+            case 'j':
+                spec.length = LEN_J;
+                p++;
+                break;
+            case 't':
+                spec.length = LEN_T;
+                p++;
+                break;
+            case 'L':
+                spec.length = LEN_BIG_L;
+                p++;
+                break;
+            default:
+                break;
+            }
+
+            if (!*p)
+                return false;
+
+            spec.conversion = *p;
+            spec.end = p + 1;
+            return true;
+        }
+
+        bool isInteger(char c) { return strchr("diuoxXc", c) != nullptr; }
+        bool isSigned(char c) { return c == 'd' || c == 'i' || c == 'c'; }
+        bool isFloat(char c) { return strchr("fFeEgGaA", c) != nullptr; }
+
+        // ============================================================================
+        // CAPTURE
+        // ============================================================================
+
+        struct RecordWriter
+        {
+            uint8_t *data;
+            size_t used;
+            size_t capacity;
+
+            bool put(const void *value, size_t size)
+            {
+                if (used + size > capacity)
+                    return false;
+                memcpy(data + used, value, size);
+                used += size;
+                return true;
+            }
+
+            bool putString(const char *str)
+            {
+                if (!str)
+                    str = "(null)";
+                if (used + sizeof(uint16_t) > capacity)
+                    return false;
+
+                size_t length = strlen(str);
+                size_t room = capacity - used - sizeof(uint16_t);
+                if (length > room)
+                    length = room;
+
+                uint16_t stored = length;
+                put(&stored, sizeof(stored));
+                return put(str, length);
+            }
+        };
+
+        int64_t readSigned(va_list &args, LengthModifier length)
+        {
+            switch (length)
+            {
+            case LEN_L:
+                return va_arg(args, long);
+            case LEN_LL:
+                return va_arg(args, long long);
+            case LEN_Z:
+                return (int64_t)va_arg(args, size_t);
+            case LEN_J:
+                return va_arg(args, intmax_t);
+            case LEN_T:
+                return va_arg(args, ptrdiff_t);
+            default:
+                return va_arg(args, int);
+            }
+        }
+
+        uint64_t readUnsigned(va_list &args, LengthModifier length)
+        {
+            switch (length)
+            {
+            case LEN_L:
+                return va_arg(args, unsigned long);
+            case LEN_LL:
+                return va_arg(args, unsigned long long);
+            case LEN_Z:
+                return va_arg(args, size_t);
+            case LEN_J:
+                return va_arg(args, uintmax_t);
+            case LEN_T:
+                return (uint64_t)va_arg(args, ptrdiff_t);
+            default:
+                return va_arg(args, unsigned int);
+            }
+        }
+
+        // @return false if the arguments did not fit (remaining ones are rendered as "…")
+        bool captureArguments(const char *format, va_list &args, RecordWriter &out)
+        {
+            for (const char *p = strchr(format, '%'); p; p = strchr(p, '%'))
+            {
+                FormatSpec spec;
+                if (!parseSpec(p, spec))
+                    return true;
+                p = spec.end;
+
+                if (spec.conversion == '%')
+                    continue;
+
+                if (spec.starWidth)
+                {
+                    int32_t width = va_arg(args, int);
+                    if (!out.put(&width, sizeof(width)))
+                        return false;
+                }
+                if (spec.starPrecision)
+                {
+                    int32_t precision = va_arg(args, int);
+                    if (!out.put(&precision, sizeof(precision)))
+                        return false;
+                }
+
+                bool stored;
+                if (spec.conversion == 's')
+                {
+                    stored = out.putString(va_arg(args, const char *));
+                }
+                else if (isInteger(spec.conversion))
+                {
+                    uint64_t value = isSigned(spec.conversion) ? (uint64_t)readSigned(args, spec.length)
+                                                               : readUnsigned(args, spec.length);
+                    stored = out.put(&value, sizeof(value));
+                }
+                else if (isFloat(spec.conversion))
+                {
+                    double value = (spec.length == LEN_BIG_L) ? (double)va_arg(args, long double) : va_arg(args, double);
+                    stored = out.put(&value, sizeof(value));
+                }
+                else if (spec.conversion == 'p')
+                {
+                    uint64_t value = (uintptr_t)va_arg(args, void *);
+                    stored = out.put(&value, sizeof(value));
+                }
+                else
+                {
+                    // Unknown conversion: the argument type cannot be known
+                    return false;
+                }
+
+                if (!stored)
+                    return false;
+            }
+            return true;
+        }
+
+        // ============================================================================
+        // RENDERING (logger task)
+        // ============================================================================
+
+        struct RecordReader
+        {
+            const uint8_t *data;
+            size_t used;
+            size_t size;
+
+            bool get(void *value, size_t bytes)
+            {
+                if (used + bytes > size)
+                    return false;
+                memcpy(value, data + used, bytes);
+                used += bytes;
+                return true;
+            }
+        };
+
+        struct LineBuffer
+        {
+            size_t length = 0;
+
+            void append(const char *str, size_t count)
+            {
+                size_t room = sizeof(logLine) - 1 - length;
+                if (count > room)
+                    count = room;
+                memcpy(logLine + length, str, count);
+                length += count;
+            }
+
+            template <typename T>
+            void appendFormatted(const char *spec, T value)
+            {
+                size_t room = sizeof(logLine) - length;
+                int written = snprintf(logLine + length, room, spec, value);
+                if (written > 0)
+                    length += ((size_t)written < room) ? (size_t)written : room - 1;
+            }
+        };
+
+        // Spec text with '*' replaced by the captured width/precision
+        void buildSpecText(const FormatSpec &spec, RecordReader &args, char *buffer, size_t size)
+        {
+            size_t length = 0;
+            for (const char *p = spec.start; p < spec.end && length + 12 < size; p++)
+            {
+                if (*p == '*')
+                {
+                    int32_t value = 0;
+                    args.get(&value, sizeof(value));
+                    length += snprintf(buffer + length, size - length, "%d", (int)value);
+                }
+                else
+                {
+                    buffer[length++] = *p;
+                }
+            }
+            buffer[length] = '\0';
+        }
+
+        void renderSigned(LineBuffer &out, const char *spec, LengthModifier length, int64_t value)
+        {
+            switch (length)
+            {
+            case LEN_L:
+                out.appendFormatted(spec, (long)value);
+                break;
+            case LEN_LL:
+            case LEN_J:
+                out.appendFormatted(spec, (long long)value);
+                break;
+            case LEN_Z:
+                out.appendFormatted(spec, (size_t)value);
+                break;
+            case LEN_T:
+                out.appendFormatted(spec, (ptrdiff_t)value);
+                break;
+            default:
+                out.appendFormatted(spec, (int)value);
+                break;
+            }
+        }
+
+        void renderUnsigned(LineBuffer &out, const char *spec, LengthModifier length, uint64_t value)
+        {
+            switch (length)
+            {
+            case LEN_L:
+                out.appendFormatted(spec, (unsigned long)value);
+                break;
+            case LEN_LL:
+            case LEN_J:
+                out.appendFormatted(spec, (unsigned long long)value);
+                break;
+            case LEN_Z:
+                out.appendFormatted(spec, (size_t)value);
+                break;
+            case LEN_T:
+                out.appendFormatted(spec, (ptrdiff_t)value);
+                break;
+            default:
+                out.appendFormatted(spec, (unsigned int)value);
+                break;
+            }
+        }
+
+        void renderRecord(const uint8_t *record)
+        {
+            RecordHead head;
+            memcpy(&head, record, sizeof(head));
+
+            RecordReader args = {record + sizeof(RecordHead), 0, head.argBytes};
+            LineBuffer out;
+            char spec[32];
+
+            const char *p = head.format;
+            while (*p)
+            {
+                const char *percent = strchr(p, '%');
+                if (!percent)
+                {
+                    out.append(p, strlen(p));
+                    break;
+                }
+                out.append(p, percent - p);
+
+                FormatSpec parsed;
+                if (!parseSpec(percent, parsed))
+                {
+                    out.append(percent, strlen(percent));
+                    break;
+                }
+                p = parsed.end;
+
+                if (parsed.conversion == '%')
+                {
+                    out.append("%", 1);
+                    continue;
+                }
+
+                buildSpecText(parsed, args, spec, sizeof(spec));
+
+                if (parsed.conversion == 's')
+                {
+                    uint16_t length = 0;
+                    if (!args.get(&length, sizeof(length)) || !args.get(logText, length))
+                    {
+                        out.append("…", strlen("…"));
+                        continue;
+                    }
+                    logText[length] = '\0';
+                    out.appendFormatted(spec, (const char *)logText);
+                    continue;
+                }
+
+                uint64_t raw;
+                if (!args.get(&raw, sizeof(raw)))
+                {
+                    // Argument was not captured (record full or unknown conversion)
+                    out.append("…", strlen("…"));
+                    continue;
+                }
+
+                if (isInteger(parsed.conversion))
+                {
+                    if (isSigned(parsed.conversion))
+                        renderSigned(out, spec, parsed.length, (int64_t)raw);
+                    else
+                        renderUnsigned(out, spec, parsed.length, raw);
+                }
+                else if (isFloat(parsed.conversion))
+                {
+                    double value;
+                    memcpy(&value, &raw, sizeof(value));
+                    if (parsed.length == LEN_BIG_L)
+                        out.appendFormatted(spec, (long double)value);
+                    else
+                        out.appendFormatted(spec, value);
+                }
+                else if (parsed.conversion == 'p')
+                {
+                    out.appendFormatted(spec, (void *)(uintptr_t)raw);
+                }
+            }
+
+            // Lines cut at the buffer size still end the line
+            if (out.length == sizeof(logLine) - 1 && logLine[out.length - 1] != '\n')
+                logLine[out.length - 1] = '\n';
+
+            Serial.write((const uint8_t *)logLine, out.length);
+        }
+    }
+
+    // ============================================================================
+    // PUBLIC API
+    // ============================================================================
+
+    void AsyncLogger::begin()
+    {
+        if (task || !LOG_ASYNC)
+            return;
+
+        task = loggerTaskStorage.create(taskFunction, "Logger", nullptr, LOG_TASK_PRIORITY, LOG_TASK_CORE);
+        MemoryBudget::add("logger.ring", LOG_BUFFER_SIZE, MemoryBudget::Region::INTERNAL, MemoryBudget::Source::STATIC);
+    }
+
+    void AsyncLogger::log(uint8_t level, uint8_t module, const char *format, ...)
+    {
+        if (!(moduleMask & (1u << module)))
+            return;
+
+        va_list args;
+        va_start(args, format);
+
+#if !LOG_ASYNC
+        // Synchronous mode (crash debugging): format and write in the caller
+        char buffer[LOG_RECORD_MAX_SIZE];
+        vsnprintf(buffer, sizeof(buffer), format, args);
+        va_end(args);
+        Serial.print(buffer);
+#else
+        // Capture into a local record first, then reserve its exact size
+        alignas(4) uint8_t record[LOG_RECORD_MAX_SIZE];
+        RecordWriter out = {record, sizeof(RecordHead), sizeof(record)};
+        captureArguments(format, args, out);
+        va_end(args);
+
+        uint32_t size = (out.used + 3) & ~3u;
+        RecordHead head;
+        head.header = size | HEADER_COMMITTED | ((uint32_t)(level & 0x0F) << 20) | ((uint32_t)module << 24);
+        head.format = format;
+        head.argBytes = out.used - sizeof(RecordHead);
+        head.reserved = 0;
+        memcpy(record, &head, sizeof(head));
+
+        // Reserve space: records never wrap, a padding record fills the tail end
+        uint32_t pos = writePos.load(std::memory_order_relaxed);
+        uint32_t pad;
+        do
+        {
+            uint32_t offset = pos & RING_MASK;
+            pad = (LOG_BUFFER_SIZE - offset < size) ? LOG_BUFFER_SIZE - offset : 0;
+            if (pos + pad + size - readPos.load(std::memory_order_acquire) > LOG_BUFFER_SIZE)
+            {
+                droppedCount.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+        } while (!writePos.compare_exchange_weak(pos, pos + pad + size, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+        if (pad)
+            __atomic_store_n((uint32_t *)&logRing[pos & RING_MASK], pad | HEADER_COMMITTED | HEADER_PADDING, __ATOMIC_RELEASE);
+
+        // Body first, header word last: the consumer only reads committed records
+        uint8_t *slot = &logRing[(pos + pad) & RING_MASK];
+        memcpy(slot + sizeof(uint32_t), record + sizeof(uint32_t), out.used - sizeof(uint32_t));
+        __atomic_store_n((uint32_t *)slot, head.header, __ATOMIC_RELEASE);
+
+        writtenCount.fetch_add(1, std::memory_order_relaxed);
+#endif
+    }
+
+    bool AsyncLogger::flush(uint32_t timeoutMs)
+    {
+        // No logger task (not started or synchronous mode): drain in the caller
+        if (!task)
+            return drain();
+
+        unsigned long start = millis();
+        while (readPos.load(std::memory_order_acquire) != writePos.load(std::memory_order_acquire))
+        {
+            if (millis() - start >= timeoutMs)
+                return false;
+            xTaskNotifyGive(task);
+            vTaskDelay(1);
+        }
+        Serial.flush();
+        return true;
+    }
+
+    void AsyncLogger::getStats(Stats &stats)
+    {
+        stats.written = writtenCount.load(std::memory_order_relaxed);
+        stats.dropped = droppedCount.load(std::memory_order_relaxed);
+        stats.pending = writePos.load(std::memory_order_relaxed) - readPos.load(std::memory_order_relaxed);
+        stats.highWater = highWater;
+    }
+
+    // ============================================================================
+    // LOGGER TASK
+    // ============================================================================
+
+    void AsyncLogger::taskFunction(void *param)
+    {
+        while (true)
+        {
+            drain();
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(LOG_FLUSH_INTERVAL_MS));
+        }
+    }
+
+    bool AsyncLogger::drain()
+    {
+        uint32_t pos = readPos.load(std::memory_order_relaxed);
+        uint32_t end = writePos.load(std::memory_order_acquire);
+
+        if (end - pos > highWater)
+            highWater = end - pos;
+
+        while (pos != end)
+        {
+            uint8_t *slot = &logRing[pos & RING_MASK];
+            uint32_t header = __atomic_load_n((uint32_t *)slot, __ATOMIC_ACQUIRE);
+
+            // Reserved but still being written by a producer
+            if (!(header & HEADER_COMMITTED))
+                return false;
+
+            uint32_t size = header & HEADER_SIZE_MASK;
+            if (!(header & HEADER_PADDING))
+                renderRecord(slot);
+
+            memset(slot, 0, size);
+            pos += size;
+            readPos.store(pos, std::memory_order_release);
+        }
+
+        // Reported after the lines that made it into the ring, in order
+        uint32_t dropped = droppedCount.load(std::memory_order_relaxed);
+        if (dropped != reportedDropped)
+        {
+            int length = snprintf(logLine, sizeof(logLine), "[SDK] ⚠️ Logger: %lu messages dropped (ring full)\n",
+                                  (unsigned long)(dropped - reportedDropped));
+            Serial.write((const uint8_t *)logLine, length);
+            reportedDropped = dropped;
+        }
+        return true;
+    }
+}
@@ -0,0 +1,95 @@
+/**
+ * CloudMouse SDK - Asynchronous Logger
+ *
+ * Backend of the SDK_LOGGER / APP_LOGGER / SDK_LOG* macros (Logger.h).
+ * Callers only capture the format pointer and the arguments into a ring
+ * buffer; formatting and the Serial write happen later on a low-priority task,
+ * so logging no longer runs at UART/CDC speed inside the event loop.
+ *
+ * Capture:
+ * - The format string is stored by pointer and must have static storage
+ *   (the logging macros always pass string literals)
+ * - Numeric arguments are stored by value, %s arguments are copied (truncated
+ *   to fit LOG_RECORD_MAX_SIZE), so temporaries such as String::c_str() are safe
+ * - Supported conversions: d i u o x X c (with hh/h/l/ll/z/j/t), f F e E g G a A,
+ *   s, p and %%; '*' width/precision is supported
+ *
+ * Ring Buffer:
+ * - Multi-producer, single-consumer, lock-free: producers reserve space with a
+ *   compare-and-swap on the write position and publish the record by writing its
+ *   header word last; the logger task frees records in order
+ * - When the ring is full the message is dropped and counted; the logger task
+ *   reports the number of dropped messages on the next line it prints
+ *
+ * Configuration (DeviceConfig.h):
+ * - LOG_LEVEL / LOG_MODULE_MASK: compile-time filtering
+ * - LOG_ASYNC, LOG_BUFFER_SIZE, LOG_TASK_PRIORITY, LOG_TASK_CORE, LOG_FLUSH_INTERVAL_MS
+ *
+ * Thread Safety:
+ * - log() may be called from any task on either core; not from ISRs
+ */
+
+#ifndef ASYNC_LOGGER_H
+#define ASYNC_LOGGER_H
+
+#include <Arduino.h>
+
+namespace CloudMouse::Utils
+{
+    class AsyncLogger
+    {
+    public:
+        /**
+         * Logger counters
+         */
+        struct Stats
+        {
+            uint32_t written;       // Messages captured
+            uint32_t dropped;       // Messages lost because the ring was full
+            uint32_t pending;       // Bytes currently waiting in the ring
+            uint32_t highWater;     // Highest 'pending' since boot
+        };
+
+        /**
+         * Start the logger task (idempotent)
+         * Messages logged before begin() are kept in the ring and printed once
+         * the task runs.
+         */
+        static void begin();
+
+        /**
+         * Capture a message
+         *
+         * @param level LOG_LEVEL_* of the message
+         * @param module LOG_MODULE_* index (checked against the runtime module mask)
+         * @param format printf format with static storage
+         */
+        static void log(uint8_t level, uint8_t module, const char *format, ...) __attribute__((format(printf, 3, 4)));
+
+        /**
+         * Wait until every captured message has been written to Serial
+         * Use before restarting or entering deep sleep.
+         *
+         * @param timeoutMs Maximum wait time
+         * @return true if the ring is empty
+         */
+        static bool flush(uint32_t timeoutMs = 200);
+
+        /**
+         * Runtime per-module filter (bit = 1 << LOG_MODULE_*), on top of LOG_MODULE_MASK
+         */
+        static void setModuleMask(uint32_t mask) { moduleMask = mask; }
+        static uint32_t getModuleMask() { return moduleMask; }
+
+        static void getStats(Stats &stats);
+
+    private:
+        static volatile uint32_t moduleMask;
+        static TaskHandle_t task;
+
+        static void taskFunction(void *param);
+        static bool drain();
+    };
+}
+
+#endif
@@ -0,0 +1,142 @@
+/**
+ * CloudMouse SDK - Boot Timeline Profiler Implementation
+ */
+
+#include "./BootProfiler.h"
+#include "./Logger.h"
+#include <esp_timer.h>
+#include <string.h>
+
+namespace CloudMouse::Utils
+{
+    BootProfiler::Phase BootProfiler::phases[BOOT_PROFILER_MAX_PHASES];
+    volatile int BootProfiler::phaseCount = 0;
+    volatile int64_t BootProfiler::readyUs = 0;
+    portMUX_TYPE BootProfiler::lock = portMUX_INITIALIZER_UNLOCKED;
+
+    // Width of the timeline bars in characters
+    static const int BOOT_PROFILER_BAR_WIDTH = 40;
+
+    // ============================================================================
+    // RECORDING
+    // ============================================================================
+
+    void BootProfiler::begin(const char *name)
+    {
+        int64_t now = esp_timer_get_time();
+
+        portENTER_CRITICAL(&lock);
+        if (readyUs == 0 && phaseCount < BOOT_PROFILER_MAX_PHASES)
+        {
+            Phase &phase = phases[phaseCount++];
+            phase.name = name;
+            phase.startUs = now;
+            phase.endUs = 0;
+            phase.core = (int8_t)xPortGetCoreID();
+        }
+        portEXIT_CRITICAL(&lock);
+    }
+
+    void BootProfiler::end(const char *name)
+    {
+        int64_t now = esp_timer_get_time();
+
+        portENTER_CRITICAL(&lock);
+        for (int i = phaseCount - 1; i >= 0; i--)
+        {
+            if (phases[i].endUs == 0 && strcmp(phases[i].name, name) == 0)
+            {
+                phases[i].endUs = now > phases[i].startUs ? now : phases[i].startUs + 1;
+                break;
+            }
+        }
+        portEXIT_CRITICAL(&lock);
+    }
+
+    void BootProfiler::mark(const char *name)
+    {
+        int64_t now = esp_timer_get_time();
+
+        portENTER_CRITICAL(&lock);
+        if (readyUs == 0 && phaseCount < BOOT_PROFILER_MAX_PHASES)
+        {
+            Phase &phase = phases[phaseCount++];
+            phase.name = name;
+            phase.startUs = now;
+            phase.endUs = now;
+            phase.core = (int8_t)xPortGetCoreID();
+        }
+        portEXIT_CRITICAL(&lock);
+    }
+
+    void BootProfiler::setReady()
+    {
+        bool first = false;
+        int64_t now = esp_timer_get_time();
+
+        portENTER_CRITICAL(&lock);
+        if (readyUs == 0)
+        {
+            readyUs = now;
+            first = true;
+        }
+        portEXIT_CRITICAL(&lock);
+
+        if (first)
+        {
+            print();
+        }
+    }
+
+    // ============================================================================
+    // REPORT
+    // ============================================================================
+
+    void BootProfiler::print()
+    {
+        // Copy first: phases may still end while printing
+        Phase snapshot[BOOT_PROFILER_MAX_PHASES];
+        portENTER_CRITICAL(&lock);
+        int count = phaseCount;
+        memcpy(snapshot, phases, sizeof(Phase) * count);
+        int64_t ready = readyUs;
+        portEXIT_CRITICAL(&lock);
+
+        // Scale: up to the ready stamp or the last phase end, whichever is later
+        int64_t now = esp_timer_get_time();
+        int64_t spanUs = ready;
+        for (int i = 0; i < count; i++)
+        {
+            int64_t endUs = snapshot[i].endUs ? snapshot[i].endUs : now;
+            if (endUs > spanUs)
+                spanUs = endUs;
+        }
+        if (spanUs <= 0)
+            spanUs = 1;
+
+        if (ready)
+            SDK_LOGGER("\n⏱️ Boot timeline: usable after %lu ms\n", (unsigned long)(ready / 1000));
+        else
+            SDK_LOGGER("\n⏱️ Boot timeline: not ready yet (%lu ms)\n", (unsigned long)(now / 1000));
+        SDK_LOGGER("  start ms   dur ms  core  phase");
+
+        for (int i = 0; i < count; i++)
+        {
+            const Phase &phase = snapshot[i];
+            int64_t endUs = phase.endUs ? phase.endUs : now;
+
+            char bar[BOOT_PROFILER_BAR_WIDTH + 1];
+            int from = (int)(phase.startUs * BOOT_PROFILER_BAR_WIDTH / spanUs);
+            int to = (int)(endUs * BOOT_PROFILER_BAR_WIDTH / spanUs);
+            for (int c = 0; c < BOOT_PROFILER_BAR_WIDTH; c++)
+                bar[c] = c >= from && (c < to || c == from) ? '#' : '.';
+            bar[BOOT_PROFILER_BAR_WIDTH] = '\0';
+
+            SDK_LOGGER("  %8lu %8lu  %4d  %-16s |%s|%s\n",
+                       (unsigned long)(phase.startUs / 1000),
+                       (unsigned long)((endUs - phase.startUs) / 1000),
+                       phase.core, phase.name, bar,
+                       phase.endUs ? "" : " (running)");
+        }
+    }
+}
@@ -0,0 +1,102 @@
+/**
+ * CloudMouse SDK - Boot Timeline Profiler
+ *
+ * Stamps the startup phases (display and LVGL bring-up, NVS load, WiFi
+ * association, NTP sync, ...) with esp_timer time and prints them as a
+ * timeline, so the time from power-on to a usable device can be measured and
+ * the parallel startup (WiFi on Core 0, display on Core 1) verified.
+ *
+ * Timeline:
+ * - Times are microseconds since the application started (esp_timer); the
+ *   ROM and second-stage bootloader run before that and are not included
+ * - begin()/end() bracket a phase, by name; Scope does both for a block
+ * - mark() records an instant (zero-length phase)
+ * - setReady() stamps the moment the device is usable (Core RUNNING or the
+ *   setup portal) and prints the timeline once; phases started before it can
+ *   still end afterwards (e.g. NTP) and show up in print() ("boot" command)
+ * - Phases started after setReady() are not recorded: reconnects are not boot
+ *
+ * Usage:
+ *   BootProfiler::begin("wifi.connect");
+ *   ...
+ *   BootProfiler::end("wifi.connect");
+ *
+ *   { BootProfiler::Scope phase("lvgl.buffers"); allocateBuffers(); }
+ *
+ * Thread Safety:
+ * - begin/end/mark may be called from any task on either core (spinlock);
+ *   names must be string literals (only the pointer is stored)
+ */
+
+#ifndef BOOT_PROFILER_H
+#define BOOT_PROFILER_H
+
+#include <Arduino.h>
+#include "../config/DeviceConfig.h"
+
+namespace CloudMouse::Utils
+{
+    class BootProfiler
+    {
+    public:
+        /**
+         * One recorded phase
+         */
+        struct Phase
+        {
+            const char *name;
+            int64_t startUs;
+            int64_t endUs; // 0 while the phase is running
+            int8_t core;   // Core that began the phase
+        };
+
+        /**
+         * Start a phase (ignored after setReady() or when the table is full)
+         */
+        static void begin(const char *name);
+
+        /**
+         * End the most recent running phase with this name
+         */
+        static void end(const char *name);
+
+        /**
+         * Record an instant
+         */
+        static void mark(const char *name);
+
+        /**
+         * Stamp the device as usable and print the timeline (first call only)
+         */
+        static void setReady();
+
+        static bool isReady() { return readyUs != 0; }
+        static int64_t getReadyUs() { return readyUs; }
+
+        /**
+         * Print the timeline: start, duration and core of each phase, with a bar
+         */
+        static void print();
+
+        /**
+         * begin() on construction, end() on destruction
+         */
+        class Scope
+        {
+        public:
+            explicit Scope(const char *phaseName) : name(phaseName) { BootProfiler::begin(name); }
+            ~Scope() { BootProfiler::end(name); }
+
+        private:
+            const char *name;
+        };
+
+    private:
+        static Phase phases[BOOT_PROFILER_MAX_PHASES];
+        static volatile int phaseCount;
+        static volatile int64_t readyUs;
+        static portMUX_TYPE lock;
+    };
+}
+
+#endif
@@ -0,0 +1,47 @@
+/**
+ * CloudMouse SDK - Content Hashing Utility
+ *
+ * FNV-1a 32-bit hash for cache keys (QR bitmaps, rendered content, dedup).
+ * Not cryptographic: callers that must not confuse two contents on a
+ * collision compare the content itself after a hash match.
+ */
+
+#ifndef HASH_H
+#define HASH_H
+
+#include <Arduino.h>
+
+namespace CloudMouse::Utils
+{
+    static const uint32_t FNV1A_OFFSET = 2166136261u;
+    static const uint32_t FNV1A_PRIME = 16777619u;
+
+    /**
+     * Hash a byte range, optionally continuing a previous hash
+     *
+     * @param data Bytes to hash
+     * @param length Number of bytes
+     * @param seed Previous hash value to chain multiple fields
+     */
+    inline uint32_t fnv1a(const void *data, size_t length, uint32_t seed = FNV1A_OFFSET)
+    {
+        const uint8_t *bytes = (const uint8_t *)data;
+        uint32_t hash = seed;
+        for (size_t i = 0; i < length; i++)
+        {
+            hash ^= bytes[i];
+            hash *= FNV1A_PRIME;
+        }
+        return hash;
+    }
+
+    /**
+     * Hash a null-terminated string
+     */
+    inline uint32_t fnv1aText(const char *text, uint32_t seed = FNV1A_OFFSET)
+    {
+        return text ? fnv1a(text, strlen(text), seed) : seed;
+    }
+}
+
+#endif
@@ -0,0 +1,282 @@
+/**
+ * CloudMouse SDK - JSON Helper Implementation
+ *
+ * Allocators behind the JSON documents and the array scanner used by
+ * JsonParser::forEach().
+ */
+
+#include "./JsonHelper.h"
+#include <esp_timer.h>
+#include <string.h>
+
+namespace CloudMouse::Utils
+{
+    // ============================================================================
+    // PSRAM ALLOCATOR
+    // ============================================================================
+
+    JsonPsramAllocator &JsonPsramAllocator::instance()
+    {
+        static JsonPsramAllocator allocator;
+        return allocator;
+    }
+
+    void *JsonPsramAllocator::allocate(size_t size)
+    {
+        void *ptr = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (!ptr)
+            ptr = heap_caps_malloc(size, MALLOC_CAP_8BIT);
+        return ptr;
+    }
+
+    void JsonPsramAllocator::deallocate(void *ptr)
+    {
+        heap_caps_free(ptr);
+    }
+
+    void *JsonPsramAllocator::reallocate(void *ptr, size_t newSize)
+    {
+        void *grown = heap_caps_realloc(ptr, newSize, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (!grown)
+            grown = heap_caps_realloc(ptr, newSize, MALLOC_CAP_8BIT);
+        return grown;
+    }
+
+    // ============================================================================
+    // ARENA
+    // ============================================================================
+
+    JsonArena::JsonArena(size_t arenaCapacity)
+    {
+        block = (uint8_t *)heap_caps_malloc(arenaCapacity, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (!block)
+            block = (uint8_t *)heap_caps_malloc(arenaCapacity, MALLOC_CAP_8BIT);
+        capacity = block ? arenaCapacity : 0;
+    }
+
+    JsonArena::~JsonArena()
+    {
+        heap_caps_free(block);
+    }
+
+    bool JsonArena::owns(const void *ptr) const
+    {
+        return block && (const uint8_t *)ptr >= block && (const uint8_t *)ptr < block + capacity;
+    }
+
+    size_t JsonArena::blockSize(const void *ptr)
+    {
+        return *(const size_t *)((const uint8_t *)ptr - HEADER_SIZE);
+    }
+
+    void *JsonArena::allocate(size_t size)
+    {
+        size_t offset = (top + 7) & ~(size_t)7;
+        if (size > capacity || offset + HEADER_SIZE + size > capacity)
+        {
+            fallbackCount++;
+            return JsonPsramAllocator::instance().allocate(size);
+        }
+
+        *(size_t *)(block + offset) = size;
+        lastOffset = offset;
+        lastLive = true;
+        live++;
+        top = offset + HEADER_SIZE + size;
+        if (top > highWater)
+            highWater = top;
+        return block + offset + HEADER_SIZE;
+    }
+
+    void JsonArena::deallocate(void *ptr)
+    {
+        if (!ptr)
+            return;
+        if (!owns(ptr))
+        {
+            JsonPsramAllocator::instance().deallocate(ptr);
+            return;
+        }
+
+        live--;
+        if (live == 0)
+        {
+            // Document cleared: start over
+            top = 0;
+            lastLive = false;
+        }
+        else if (lastLive && (uint8_t *)ptr == block + lastOffset + HEADER_SIZE)
+        {
+            top = lastOffset;
+            lastLive = false;
+        }
+    }
+
+    void *JsonArena::reallocate(void *ptr, size_t newSize)
+    {
+        if (!ptr)
+            return allocate(newSize);
+        if (!owns(ptr))
+            return JsonPsramAllocator::instance().reallocate(ptr, newSize);
+
+        size_t oldSize = blockSize(ptr);
+        bool newest = lastLive && (uint8_t *)ptr == block + lastOffset + HEADER_SIZE;
+
+        // Newest block grows or shrinks in place
+        if (newest && lastOffset + HEADER_SIZE + newSize <= capacity)
+        {
+            *(size_t *)(block + lastOffset) = newSize;
+            top = lastOffset + HEADER_SIZE + newSize;
+            if (top > highWater)
+                highWater = top;
+            return ptr;
+        }
+
+        // Older blocks keep their space when shrinking
+        if (newSize <= oldSize)
+            return ptr;
+
+        void *moved = allocate(newSize);
+        if (!moved)
+            return nullptr;
+        memcpy(moved, ptr, oldSize);
+        deallocate(ptr);
+        return moved;
+    }
+
+    // ============================================================================
+    // PARSER
+    // ============================================================================
+
+    JsonParser::JsonParser(size_t arenaSize)
+        : arena(arenaSize), document(&arena)
+    {
+    }
+
+    DeserializationError JsonParser::parse(const char *data, size_t length)
+    {
+        int64_t start = esp_timer_get_time();
+        DeserializationError error = deserializeJson(document, data, length,
+                                                     DeserializationOption::NestingLimit(JSON_NESTING_LIMIT));
+        lastParseUs = (uint32_t)(esp_timer_get_time() - start);
+
+        if (error)
+            SDK_LOGD(GENERAL, "❌ JSON parsing error: %s", error.c_str());
+        return error;
+    }
+
+    DeserializationError JsonParser::parse(const char *data, size_t length, const JsonDocument &filter)
+    {
+        int64_t start = esp_timer_get_time();
+        DeserializationError error = deserializeJson(document, data, length,
+                                                     DeserializationOption::Filter(filter.as<JsonVariantConst>()),
+                                                     DeserializationOption::NestingLimit(JSON_NESTING_LIMIT));
+        lastParseUs = (uint32_t)(esp_timer_get_time() - start);
+
+        if (error)
+            SDK_LOGD(GENERAL, "❌ JSON parsing error: %s", error.c_str());
+        return error;
+    }
+
+    // ============================================================================
+    // ARRAY SCANNER (streaming mode)
+    // ============================================================================
+
+    const char *JsonParser::skipSpace(const char *p, const char *end)
+    {
+        while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r'))
+            p++;
+        return p;
+    }
+
+    const char *JsonParser::skipString(const char *p, const char *end)
+    {
+        // p is on the opening quote
+        for (p++; p < end; p++)
+        {
+            if (*p == '\\')
+                p++;
+            else if (*p == '"')
+                return p + 1;
+        }
+        return nullptr;
+    }
+
+    const char *JsonParser::skipValue(const char *p, const char *end)
+    {
+        if (p >= end)
+            return nullptr;
+
+        if (*p == '"')
+            return skipString(p, end);
+
+        if (*p != '{' && *p != '[')
+        {
+            // Number or literal: up to the next delimiter
+            while (p < end && *p != ',' && *p != ']' && *p != '}' &&
+                   *p != ' ' && *p != '\t' && *p != '\n' && *p != '\r')
+                p++;
+            return p;
+        }
+
+        int depth = 0;
+        while (p < end)
+        {
+            char c = *p;
+            if (c == '"')
+            {
+                p = skipString(p, end);
+                if (!p)
+                    return nullptr;
+                continue;
+            }
+            if (c == '{' || c == '[')
+                depth++;
+            else if (c == '}' || c == ']')
+            {
+                if (--depth == 0)
+                    return p + 1;
+            }
+            p++;
+        }
+        return nullptr;
+    }
+
+    const char *JsonParser::findArray(const char *p, const char *end, const char *key)
+    {
+        p = skipSpace(p, end);
+
+        if (!key)
+            return p < end && *p == '[' ? p + 1 : nullptr;
+
+        // Walk the root object's members, skipping the values of other keys
+        if (p >= end || *p != '{')
+            return nullptr;
+        p = skipSpace(p + 1, end);
+
+        size_t keyLength = strlen(key);
+        while (p < end && *p == '"')
+        {
+            const char *nameEnd = skipString(p, end);
+            if (!nameEnd)
+                return nullptr;
+            bool match = (size_t)(nameEnd - p - 2) == keyLength && memcmp(p + 1, key, keyLength) == 0;
+
+            p = skipSpace(nameEnd, end);
+            if (p >= end || *p != ':')
+                return nullptr;
+            p = skipSpace(p + 1, end);
+
+            if (match)
+                return p < end && *p == '[' ? p + 1 : nullptr;
+
+            p = skipValue(p, end);
+            if (!p)
+                return nullptr;
+            p = skipSpace(p, end);
+            if (p < end && *p == ',')
+                p = skipSpace(p + 1, end);
+        }
+        return nullptr;
+    }
+} // namespace CloudMouse::Utils
@@ -1,13 +1,35 @@
 /**
  * CloudMouse SDK - JSON Helper Utilities
  *
- * Provides JSON parsing and handling utilities for HTTP responses and configuration.
- * Uses ArduinoJson library with PSRAM support for memory-efficient operations.
+ * Provides JSON parsing and handling utilities for HTTP responses, WebSocket
+ * messages and configuration. Uses ArduinoJson 7 with PSRAM-backed allocators.
  *
  * Features:
  * - Safe JSON deserialization with error handling
- * - Dynamic memory allocation with PSRAM support
+ * - JsonParser: caller-owned, reusable document parsing straight from a
+ *   pointer and length (e.g. a WebSocket view), no String copy
+ * - JsonArena: bump allocator over one PSRAM block; the document's pools are
+ *   carved from it and it rewinds once the document is cleared, so repeated
+ *   parses do not touch the heap
+ * - ArduinoJson Filter documents: only the fields the caller needs are stored
+ * - Streaming mode for large arrays: elements are parsed one at a time into
+ *   the same document, so memory stays at the size of one element
  * - HTTP response parsing utilities
+ *
+ * Usage:
+ *   JsonParser parser;                       // Reuse across messages
+ *   JsonDocument filter;
+ *   filter["type"] = true;
+ *   filter["data"]["value"] = true;
+ *
+ *   if (!parser.parse(data, length, filter)) {
+ *       int value = parser.root()["data"]["value"];
+ *   }
+ *
+ *   parser.forEach(data, length, "items", [](JsonVariantConst item, size_t index) {
+ *       ...
+ *       return true; // false stops the iteration
+ *   });
  */
 
 #ifndef JSON_HELPER_H
@@ -15,34 +37,219 @@
 
 #include <ArduinoJson.h>
 #include <esp_heap_caps.h>
+#include "../config/DeviceConfig.h"
+#include "./Logger.h"
 
 namespace CloudMouse::Utils
 {
+    // ============================================================================
+    // ALLOCATORS
+    // ============================================================================
+
+    /**
+     * ArduinoJson allocator on PSRAM, internal RAM when PSRAM is exhausted or absent
+     */
+    class JsonPsramAllocator : public ArduinoJson::Allocator
+    {
+    public:
+        static JsonPsramAllocator &instance();
+
+        void *allocate(size_t size) override;
+        void deallocate(void *ptr) override;
+        void *reallocate(void *ptr, size_t newSize) override;
+    };
+
+    /**
+     * Bump allocator over a single PSRAM block
+     *
+     * - Blocks are freed by rewinding: the newest one immediately, all of them
+     *   once nothing is allocated any more (the document was cleared)
+     * - Growing the newest block happens in place (string building)
+     * - When the block is full, allocations go to JsonPsramAllocator (counted)
+     *
+     * Not synchronized: one arena per document, used by one task.
+     */
+    class JsonArena : public ArduinoJson::Allocator
+    {
+    public:
+        explicit JsonArena(size_t capacity = JSON_ARENA_SIZE);
+        ~JsonArena();
+
+        void *allocate(size_t size) override;
+        void deallocate(void *ptr) override;
+        void *reallocate(void *ptr, size_t newSize) override;
+
+        size_t getCapacity() const { return capacity; }
+        size_t getUsed() const { return top; }
+        size_t getHighWater() const { return highWater; }
+        uint32_t getFallbackCount() const { return fallbackCount; }
+
+    private:
+        uint8_t *block = nullptr;
+        size_t capacity = 0;
+        size_t top = 0;        // Bytes used
+        size_t lastOffset = 0; // Header offset of the newest block, valid while lastLive
+        bool lastLive = false;
+        int live = 0;          // Blocks currently allocated from the arena
+        size_t highWater = 0;
+        uint32_t fallbackCount = 0;
+
+        // Each block is preceded by its size, keeping 8-byte alignment
+        static const size_t HEADER_SIZE = 8;
+
+        bool owns(const void *ptr) const;
+        static size_t blockSize(const void *ptr);
+    };
+
+    // ============================================================================
+    // REUSABLE PARSER
+    // ============================================================================
+
+    /**
+     * Caller-owned parse target: one document and its arena, reused per message
+     *
+     * The document returned by root()/doc() is valid until the next parse.
+     */
+    class JsonParser
+    {
+    public:
+        explicit JsonParser(size_t arenaSize = JSON_ARENA_SIZE);
+
+        /**
+         * Parse a complete JSON text
+         *
+         * @param data JSON bytes (need not be NUL-terminated)
+         * @param length Number of bytes
+         * @return DeserializationError::Ok on success
+         */
+        DeserializationError parse(const char *data, size_t length);
+
+        /**
+         * Parse keeping only the fields present in filter
+         *
+         * @param filter ArduinoJson filter document (true = keep, nested objects select
+         *               sub-fields, an array's first element filters every element)
+         */
+        DeserializationError parse(const char *data, size_t length, const JsonDocument &filter);
+
+        /**
+         * Streaming mode: parse the elements of a large array one at a time
+         *
+         * Each element is deserialized into this parser's document and passed
+         * to the callback before the next one replaces it.
+         *
+         * @param data JSON bytes
+         * @param length Number of bytes
+         * @param arrayKey Key of the array in the root object, nullptr if the root is the array
+         * @param callback bool(JsonVariantConst element, size_t index); return false to stop
+         * @param filter Optional filter applied to each element
+         * @return Ok when the array was walked (or stopped by the callback),
+         *         InvalidInput if the array was not found or is malformed,
+         *         or the first element deserialization error
+         */
+        template <typename Callback>
+        DeserializationError forEach(const char *data, size_t length, const char *arrayKey,
+                                     Callback callback, const JsonDocument *filter = nullptr)
+        {
+            const char *end = data + length;
+            const char *cursor = findArray(data, end, arrayKey);
+            if (!cursor)
+                return DeserializationError::InvalidInput;
+
+            size_t index = 0;
+            while (true)
+            {
+                // cursor is just past '[' or past the previous element
+                cursor = skipSpace(cursor, end);
+                if (cursor < end && *cursor == ']')
+                    return DeserializationError::Ok;
+                if (index > 0)
+                {
+                    if (cursor >= end || *cursor != ',')
+                        return DeserializationError::InvalidInput;
+                    cursor = skipSpace(cursor + 1, end);
+                }
+
+                const char *elementEnd = skipValue(cursor, end);
+                if (!elementEnd)
+                    return DeserializationError::InvalidInput;
+
+                DeserializationError error = filter ? parse(cursor, elementEnd - cursor, *filter)
+                                                    : parse(cursor, elementEnd - cursor);
+                if (error)
+                    return error;
+                if (!callback(root(), index++))
+                    return DeserializationError::Ok;
+
+                cursor = elementEnd;
+            }
+        }
+
+        JsonDocument &doc() { return document; }
+        JsonVariantConst root() const { return document.as<JsonVariantConst>(); }
+
+        // Statistics
+        uint32_t getLastParseUs() const { return lastParseUs; }
+        const JsonArena &getArena() const { return arena; }
+
+    private:
+        JsonArena arena; // Declared before document: the document allocates from it
+        JsonDocument document;
+        uint32_t lastParseUs = 0;
+
+        /**
+         * Position just past the '[' of the array to stream, nullptr if not found
+         */
+        static const char *findArray(const char *p, const char *end, const char *key);
+
+        /**
+         * End of the JSON value starting at p (strings, nesting and escapes aware),
+         * nullptr if it is truncated
+         */
+        static const char *skipValue(const char *p, const char *end);
+        static const char *skipString(const char *p, const char *end);
+        static const char *skipSpace(const char *p, const char *end);
+    };
+
+    // ============================================================================
+    // ONE-SHOT HELPERS
+    // ============================================================================
+
     class JsonHelper
     {
     public:
         /**
-         * Parse JSON string into DynamicJsonDocument
+         * Parse JSON string into a new document (PSRAM-backed)
+         * Allocates per call: for repeated messages use a JsonParser instead.
          *
          * @param payload JSON string to parse
-         * @return DynamicJsonDocument containing parsed data, or empty document on error
+         * @return JsonDocument containing parsed data, or empty document on error
          */
-        static DynamicJsonDocument parseJson(const String &payload)
+        static JsonDocument parseJson(const String &payload)
         {
-            // Calculate required capacity (object size + string data + safety margin)
-            const size_t capacity = JSON_OBJECT_SIZE(20) + payload.length() + 1000;
+            return parseJson(payload.c_str(), payload.length());
+        }
 
-            // Create document with dynamic memory allocation (uses PSRAM if available)
-            DynamicJsonDocument doc(capacity);
+        /**
+         * Parse JSON bytes into a new document (PSRAM-backed)
+         *
+         * @param data JSON bytes (need not be NUL-terminated)
+         * @param length Number of bytes
+         * @return JsonDocument containing parsed data, or empty document on error
+         */
+        static JsonDocument parseJson(const char *data, size_t length)
+        {
+            JsonDocument doc(&JsonPsramAllocator::instance());
 
             // Parse JSON payload
-            DeserializationError error = deserializeJson(doc, payload);
+            DeserializationError error = deserializeJson(doc, data, length,
+                                                         DeserializationOption::NestingLimit(JSON_NESTING_LIMIT));
 
             // Handle parsing errors
             if (error)
             {
                 SDK_LOGGER("❌ JSON parsing error: %s\n", error.c_str());
-                return DynamicJsonDocument(0); // Return empty document on error
+                doc.clear(); // Return empty document on error
             }
 
             return doc;
@@ -53,9 +260,9 @@ namespace CloudMouse::Utils
          * Legacy method name for backward compatibility
          *
          * @param payload HTTP response body containing JSON
-         * @return DynamicJsonDocument containing parsed data
+         * @return JsonDocument containing parsed data
          */
-        static DynamicJsonDocument decodeResponse(const String &payload)
+        static JsonDocument decodeResponse(const String &payload)
         {
             return parseJson(payload);
         }
@@ -66,9 +273,9 @@ namespace CloudMouse::Utils
          * @param doc JSON document to validate
          * @return true if document contains valid data
          */
-        static bool isValidJson(const DynamicJsonDocument &doc)
+        static bool isValidJson(const JsonDocument &doc)
         {
-            return !doc.isNull() && doc.capacity() > 0;
+            return !doc.isNull() && !doc.overflowed();
         }
 
         /**
@@ -79,11 +286,12 @@ namespace CloudMouse::Utils
          * @param defaultValue Default value if key not found
          * @return String value or default
          */
-        static String getString(const DynamicJsonDocument &doc, const char *key, const String &defaultValue = "")
+        static String getString(const JsonDocument &doc, const char *key, const String &defaultValue = "")
         {
-            if (doc.containsKey(key))
+            JsonVariantConst value = doc[key];
+            if (!value.isNull())
             {
-                return doc[key].as<String>();
+                return value.as<String>();
             }
             return defaultValue;
         }
@@ -96,11 +304,12 @@ namespace CloudMouse::Utils
          * @param defaultValue Default value if key not found
          * @return Integer value or default
          */
-        static int getInt(const DynamicJsonDocument &doc, const char *key, int defaultValue = 0)
+        static int getInt(const JsonDocument &doc, const char *key, int defaultValue = 0)
         {
-            if (doc.containsKey(key))
+            JsonVariantConst value = doc[key];
+            if (!value.isNull())
             {
-                return doc[key].as<int>();
+                return value.as<int>();
             }
             return defaultValue;
         }
@@ -113,14 +322,15 @@ namespace CloudMouse::Utils
          * @param defaultValue Default value if key not found
          * @return Boolean value or default
          */
-        static bool getBool(const DynamicJsonDocument &doc, const char *key, bool defaultValue = false)
+        static bool getBool(const JsonDocument &doc, const char *key, bool defaultValue = false)
         {
-            if (doc.containsKey(key))
+            JsonVariantConst value = doc[key];
+            if (!value.isNull())
             {
-                return doc[key].as<bool>();
+                return value.as<bool>();
             }
             return defaultValue;
         }
     };
 };
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,239 @@
+/**
+ * CloudMouse SDK - Input-to-Photon Latency Tracer Implementation
+ */
+
+#include "./LatencyTracer.h"
+#include "./Logger.h"
+
+namespace CloudMouse::Utils
+{
+#if INPUT_LATENCY_TRACE
+    LatencyTracer::Trace LatencyTracer::traces[LATENCY_TRACE_PENDING];
+    RollingStats<LATENCY_TRACE_WINDOW> LatencyTracer::stages[LatencyTracer::STAGE_COUNT];
+    uint16_t LatencyTracer::lastId = 0;
+    uint32_t LatencyTracer::completed = 0;
+    uint32_t LatencyTracer::noRedraw = 0;
+    uint32_t LatencyTracer::dropped = 0;
+    portMUX_TYPE LatencyTracer::lock = portMUX_INITIALIZER_UNLOCKED;
+
+    static const char *const LATENCY_STAGE_NAMES[] = {
+        "encoder", "queue", "handle", "wait frame", "render", "total", "core recv"};
+
+    static_assert(sizeof(LATENCY_STAGE_NAMES) / sizeof(LATENCY_STAGE_NAMES[0]) == LatencyTracer::STAGE_COUNT,
+                  "One name per latency stage");
+
+    // ============================================================================
+    // RECORDING (UI task, except coreReceived)
+    // ============================================================================
+
+    uint16_t LatencyTracer::nextId()
+    {
+        portENTER_CRITICAL(&lock);
+        lastId = lastId == UINT16_MAX ? 1 : lastId + 1;
+        uint16_t id = lastId;
+        portEXIT_CRITICAL(&lock);
+        return id;
+    }
+
+    void LatencyTracer::received(uint16_t id, uint32_t inputUs, uint32_t publishUs)
+    {
+        if (id == 0)
+            return;
+
+        uint32_t now = micros();
+
+        portENTER_CRITICAL(&lock);
+        expire(now);
+
+        Trace *slot = nullptr;
+        for (int i = 0; i < LATENCY_TRACE_PENDING && !slot; i++)
+        {
+            if (traces[i].state == TRACE_FREE)
+                slot = &traces[i];
+        }
+
+        if (slot)
+        {
+            slot->id = id;
+            slot->inputUs = inputUs;
+            slot->publishUs = publishUs;
+            slot->receivedUs = now;
+            slot->state = TRACE_RECEIVED;
+        }
+        else
+        {
+            dropped++;
+        }
+        portEXIT_CRITICAL(&lock);
+    }
+
+    void LatencyTracer::handled(uint16_t id)
+    {
+        if (id == 0)
+            return;
+
+        uint32_t now = micros();
+
+        portENTER_CRITICAL(&lock);
+        for (int i = 0; i < LATENCY_TRACE_PENDING; i++)
+        {
+            if (traces[i].state == TRACE_RECEIVED && traces[i].id == id)
+            {
+                traces[i].handledUs = now;
+                traces[i].state = TRACE_HANDLED;
+                break;
+            }
+        }
+        portEXIT_CRITICAL(&lock);
+    }
+
+    void LatencyTracer::frameStarted()
+    {
+        uint32_t now = micros();
+
+        portENTER_CRITICAL(&lock);
+        expire(now);
+
+        // Restamped while refresh cycles come up empty: the wait lasts until a frame draws
+        for (int i = 0; i < LATENCY_TRACE_PENDING; i++)
+        {
+            if (traces[i].state == TRACE_HANDLED || traces[i].state == TRACE_RENDERING)
+            {
+                traces[i].renderUs = now;
+                traces[i].state = TRACE_RENDERING;
+            }
+        }
+        portEXIT_CRITICAL(&lock);
+    }
+
+    void LatencyTracer::frameFlushed()
+    {
+        uint32_t now = micros();
+
+        portENTER_CRITICAL(&lock);
+        for (int i = 0; i < LATENCY_TRACE_PENDING; i++)
+        {
+            Trace &trace = traces[i];
+            if (trace.state != TRACE_RENDERING)
+                continue;
+
+            addSample(STAGE_ENCODER, trace.publishUs - trace.inputUs);
+            addSample(STAGE_QUEUE, trace.receivedUs - trace.publishUs);
+            addSample(STAGE_HANDLE, trace.handledUs - trace.receivedUs);
+            addSample(STAGE_WAIT, trace.renderUs - trace.handledUs);
+            addSample(STAGE_RENDER, now - trace.renderUs);
+            addSample(STAGE_TOTAL, now - trace.inputUs);
+            completed++;
+            trace.state = TRACE_FREE;
+        }
+        portEXIT_CRITICAL(&lock);
+    }
+
+    void LatencyTracer::coreReceived(uint16_t id, uint32_t publishUs)
+    {
+        if (id == 0)
+            return;
+
+        uint32_t now = micros();
+
+        portENTER_CRITICAL(&lock);
+        addSample(STAGE_CORE, now - publishUs);
+        portEXIT_CRITICAL(&lock);
+    }
+
+    // Lock held by the caller
+    void LatencyTracer::expire(uint32_t now)
+    {
+        for (int i = 0; i < LATENCY_TRACE_PENDING; i++)
+        {
+            Trace &trace = traces[i];
+            if (trace.state == TRACE_FREE)
+                continue;
+
+            // A trace that is never handled (event dropped by a handler) times out from reception
+            uint32_t since = trace.state == TRACE_RECEIVED ? trace.receivedUs : trace.handledUs;
+            if (now - since >= (uint32_t)LATENCY_TRACE_TIMEOUT_MS * 1000)
+            {
+                noRedraw++;
+                trace.state = TRACE_FREE;
+            }
+        }
+    }
+
+    // Lock held by the caller; wrapped intervals come from traces older than ~71 min
+    void LatencyTracer::addSample(Stage stage, uint32_t us)
+    {
+        if ((int32_t)us >= 0)
+            stages[stage].add(us);
+    }
+
+    // ============================================================================
+    // REPORT
+    // ============================================================================
+
+    void LatencyTracer::print()
+    {
+        portENTER_CRITICAL(&lock);
+        expire(micros());
+        uint32_t done = completed;
+        uint32_t idle = noRedraw;
+        uint32_t lost = dropped;
+        portEXIT_CRITICAL(&lock);
+
+        SDK_LOGGER("\n⏱️ Input latency (last %d traces, %lu drawn, %lu no redraw, %lu dropped):",
+                   (int)LATENCY_TRACE_WINDOW, (unsigned long)done, (unsigned long)idle, (unsigned long)lost);
+        SDK_LOGGER("   %-12s %10s %10s %10s %10s", "stage us", "min", "avg", "p99", "max");
+
+        for (int i = 0; i < STAGE_COUNT; i++)
+        {
+            // Copy under the lock, sort outside it
+            portENTER_CRITICAL(&lock);
+            RollingStats<LATENCY_TRACE_WINDOW> stats = stages[i];
+            portEXIT_CRITICAL(&lock);
+
+            if (i == STAGE_CORE)
+                SDK_LOGGER("   (side path, not part of total)");
+            SDK_LOGGER("   %-12s %10lu %10lu %10lu %10lu", LATENCY_STAGE_NAMES[i],
+                       (unsigned long)stats.min(), (unsigned long)stats.avg(),
+                       (unsigned long)stats.percentile(99), (unsigned long)stats.max());
+        }
+        SDK_LOGGER("");
+    }
+
+    void LatencyTracer::reset()
+    {
+        portENTER_CRITICAL(&lock);
+        for (int i = 0; i < LATENCY_TRACE_PENDING; i++)
+            traces[i].state = TRACE_FREE;
+        for (int i = 0; i < STAGE_COUNT; i++)
+            stages[i].reset();
+        completed = 0;
+        noRedraw = 0;
+        dropped = 0;
+        portEXIT_CRITICAL(&lock);
+
+        SDK_LOGGER("🔄 Input latency traces cleared");
+    }
+
+#else
+
+    // Compiled out: only the report entry points remain, for the serial commands
+
+    uint16_t LatencyTracer::nextId() { return 0; }
+    void LatencyTracer::received(uint16_t, uint32_t, uint32_t) {}
+    void LatencyTracer::handled(uint16_t) {}
+    void LatencyTracer::frameStarted() {}
+    void LatencyTracer::frameFlushed() {}
+    void LatencyTracer::coreReceived(uint16_t, uint32_t) {}
+    void LatencyTracer::expire(uint32_t) {}
+    void LatencyTracer::addSample(Stage, uint32_t) {}
+
+    void LatencyTracer::print()
+    {
+        SDK_LOGGER("⏱️ Input latency tracing is disabled (set INPUT_LATENCY_TRACE to 1 in DeviceConfig.h)");
+    }
+
+    void LatencyTracer::reset() {}
+
+#endif
+}
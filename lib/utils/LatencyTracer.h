@@ -0,0 +1,137 @@
+/**
+ * CloudMouse SDK - Input-to-Photon Latency Tracer
+ *
+ * Measures how long an encoder detent or button edge takes to become visible
+ * pixels, split into the stages it goes through, so a regression can be
+ * pinned to the encoder, the bus, the screen handler or the render.
+ *
+ * Trace of one ENCODER_INPUT snapshot (all times micros()):
+ *   input      interrupt record (InputSnapshot::inputUs), or the snapshot
+ *              time for timer-driven gestures (long press)
+ *   publish    Event::timestamp of the ENCODER_INPUT event
+ *   received   DisplayManager::update() takes it off the UI queue
+ *   handled    processEvent() returned (widgets updated, areas invalidated)
+ *   render     LV_EVENT_REFR_START of the first frame drawn after handling
+ *   flushed    LV_EVENT_REFR_READY of that frame (last stripe sent)
+ * Core's copy of the event (LED/buzzer feedback, app forwarding) is reported
+ * separately as publish -> Core receive: it is not on the path to the panel.
+ *
+ * Trace IDs:
+ * - EncoderManager::takeSnapshot() stamps nextId() into InputSnapshot::traceId,
+ *   so the ID and the first two timestamps travel with the event; the later
+ *   stamps are kept here in a table of LATENCY_TRACE_PENDING traces in flight
+ * - A trace completes at the first frame that starts after it was handled;
+ *   one with no frame within LATENCY_TRACE_TIMEOUT_MS counts as "no redraw"
+ *   (input that changed nothing on screen is not a latency sample)
+ *
+ * Enabled with INPUT_LATENCY_TRACE in DeviceConfig.h; when disabled the hooks
+ * are compiled out and print() only says so.
+ *
+ * Thread Safety:
+ * - Recording from the UI task and from Core (coreReceived) is guarded by a
+ *   spinlock; print() copies one stage at a time before formatting
+ */
+
+#ifndef LATENCY_TRACER_H
+#define LATENCY_TRACER_H
+
+#include <Arduino.h>
+#include "../config/DeviceConfig.h"
+#include "./RollingStats.h"
+
+namespace CloudMouse::Utils
+{
+    class LatencyTracer
+    {
+    public:
+        /**
+         * Measured intervals, in report order
+         */
+        enum Stage : uint8_t
+        {
+            STAGE_ENCODER, // input -> publish
+            STAGE_QUEUE,   // publish -> received
+            STAGE_HANDLE,  // received -> handled
+            STAGE_WAIT,    // handled -> render
+            STAGE_RENDER,  // render -> flushed
+            STAGE_TOTAL,   // input -> flushed
+            STAGE_CORE,    // publish -> Core receive (side path)
+            STAGE_COUNT
+        };
+
+        /**
+         * Allocate a trace ID for a new snapshot (never 0)
+         */
+        static uint16_t nextId();
+
+        /**
+         * UI task took the traced event off its queue
+         *
+         * @param inputUs input time (InputSnapshot::inputUs or timestampUs)
+         * @param publishUs Event::timestamp
+         */
+        static void received(uint16_t id, uint32_t inputUs, uint32_t publishUs);
+
+        /**
+         * DisplayManager finished handling the traced event
+         */
+        static void handled(uint16_t id);
+
+        /**
+         * A refresh cycle started (LV_EVENT_REFR_START)
+         */
+        static void frameStarted();
+
+        /**
+         * The frame started last was drawn and flushed (LV_EVENT_REFR_READY with pixels)
+         */
+        static void frameFlushed();
+
+        /**
+         * Core received its copy of the traced event
+         */
+        static void coreReceived(uint16_t id, uint32_t publishUs);
+
+        /**
+         * Print min/avg/p99/max per stage and the trace counters
+         */
+        static void print();
+
+        static void reset();
+
+    private:
+        enum TraceState : uint8_t
+        {
+            TRACE_FREE,
+            TRACE_RECEIVED,
+            TRACE_HANDLED,  // waiting for a frame
+            TRACE_RENDERING // a frame started after handling
+        };
+
+        struct Trace
+        {
+            uint32_t inputUs;
+            uint32_t publishUs;
+            uint32_t receivedUs;
+            uint32_t handledUs;
+            uint32_t renderUs;
+            uint16_t id;
+            TraceState state;
+        };
+
+        static void expire(uint32_t now);
+        static void addSample(Stage stage, uint32_t us);
+
+#if INPUT_LATENCY_TRACE
+        static Trace traces[LATENCY_TRACE_PENDING];
+        static RollingStats<LATENCY_TRACE_WINDOW> stages[STAGE_COUNT];
+        static uint16_t lastId;
+        static uint32_t completed;
+        static uint32_t noRedraw;
+        static uint32_t dropped;
+        static portMUX_TYPE lock;
+#endif
+    };
+}
+
+#endif
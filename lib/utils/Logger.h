@@ -1,7 +1,44 @@
 #pragma once
 
-#include <Arduino.h> // Necessario per Serial.printf
+#include <Arduino.h>
 #include "../config/DeviceConfig.h"
+#include "./AsyncLogger.h"
+
+
+// ========================================================================
+// LOG MODULES (index of the bit in LOG_MODULE_MASK / setModuleMask())
+// ========================================================================
+
+#define LOG_MODULE_GENERAL 0
+#define LOG_MODULE_CORE 1
+#define LOG_MODULE_EVENTBUS 2
+#define LOG_MODULE_DISPLAY 3
+#define LOG_MODULE_INPUT 4
+#define LOG_MODULE_LED 5
+#define LOG_MODULE_NETWORK 6
+#define LOG_MODULE_WEBSOCKET 7
+#define LOG_MODULE_PREFS 8
+#define LOG_MODULE_APP 9
+
+#define LOG_MODULE_BIT(module) (1u << (module))
+
+
+// ========================================================================
+// Leveled logging core
+// ========================================================================
+
+/**
+ * @brief Capture a message if its level and module pass the compile-time filters.
+ * * Both conditions are constant expressions, so filtered calls (and their
+ * arguments) disappear from the build. Formatting happens later on the
+ * logger task (see AsyncLogger.h).
+ */
+#define CM_LOG_AT(level, module, prefix, format, ...)                                           \
+    do                                                                                          \
+    {                                                                                           \
+        if ((level) <= LOG_LEVEL && (LOG_MODULE_MASK & LOG_MODULE_BIT(module)))                 \
+            CloudMouse::Utils::AsyncLogger::log((level), (module), prefix format "\n", ##__VA_ARGS__); \
+    } while (0)
 
 
 // ========================================================================
@@ -12,20 +49,20 @@
 
     /**
      * @brief It prints a message with [APP] prefix.
-     * * This macro uses Serial.printf to let params formatting.
+     * * printf-style formatting, deferred to the logger task (info level).
      * a new line character is added ('\n') at the end of the string.
-     * 
+     *
      * - Example: APP_LOGGER("Value: %d", myValue);
      */
     #define APP_LOGGER(format, ...) \
-        Serial.printf("[APP] " format "\n", ##__VA_ARGS__)
+        CM_LOG_AT(LOG_LEVEL_INFO, LOG_MODULE_APP, "[APP] ", format, ##__VA_ARGS__)
 
 #else
 
     /**
      * @brief disabled macro version.
-     * * When APP_DEBUGGER_ACTIVE is false, this macro resolves in a 
-     * 'do/while(0)' empty block, which assures no interactions with the code 
+     * * When APP_DEBUGGER_ACTIVE is false, this macro resolves in a
+     * 'do/while(0)' empty block, which assures no interactions with the code
      * with no added overhead in runtime.
      */
     #define APP_LOGGER(format, ...) do { } while (0)
@@ -41,22 +78,41 @@
 
     /**
      * @brief It prints a message with [SDK] prefix.
-     * * This macro uses Serial.printf to let params formatting.
+     * * printf-style formatting, deferred to the logger task (info level).
      * a new line character is added ('\n') at the end of the string.
-     * 
-     * - Example: APP_LOGGER("Value: %d", myValue);
+     *
+     * - Example: SDK_LOGGER("Value: %d", myValue);
      */
     #define SDK_LOGGER(format, ...) \
-        Serial.printf("[SDK] " format "\n", ##__VA_ARGS__)
+        CM_LOG_AT(LOG_LEVEL_INFO, LOG_MODULE_GENERAL, "[SDK] ", format, ##__VA_ARGS__)
+
+    /**
+     * @brief Leveled SDK logging with a module tag.
+     * * module is a LOG_MODULE_* suffix, e.g. SDK_LOGD(EVENTBUS, "queued %d", n);
+     * Use SDK_LOGD for per-event traces on hot paths: they are compiled out
+     * unless LOG_LEVEL is LOG_LEVEL_DEBUG.
+     */
+    #define SDK_LOGE(module, format, ...) \
+        CM_LOG_AT(LOG_LEVEL_ERROR, LOG_MODULE_##module, "[SDK] ", format, ##__VA_ARGS__)
+    #define SDK_LOGW(module, format, ...) \
+        CM_LOG_AT(LOG_LEVEL_WARN, LOG_MODULE_##module, "[SDK] ", format, ##__VA_ARGS__)
+    #define SDK_LOGI(module, format, ...) \
+        CM_LOG_AT(LOG_LEVEL_INFO, LOG_MODULE_##module, "[SDK] ", format, ##__VA_ARGS__)
+    #define SDK_LOGD(module, format, ...) \
+        CM_LOG_AT(LOG_LEVEL_DEBUG, LOG_MODULE_##module, "[SDK] ", format, ##__VA_ARGS__)
 
 #else
 
     /**
      * @brief disabled macro version.
-     * * When SDK_DEBUGGER_ACTIVE is false, this macro resolves in a 
-     * 'do/while(0)' empty block, which assures no interactions with the code 
+     * * When SDK_DEBUGGER_ACTIVE is false, this macro resolves in a
+     * 'do/while(0)' empty block, which assures no interactions with the code
      * with no added overhead in runtime.
      */
     #define SDK_LOGGER(format, ...) do { } while (0)
+    #define SDK_LOGE(module, format, ...) do { } while (0)
+    #define SDK_LOGW(module, format, ...) do { } while (0)
+    #define SDK_LOGI(module, format, ...) do { } while (0)
+    #define SDK_LOGD(module, format, ...) do { } while (0)
 
-#endif
\ No newline at end of file
+#endif
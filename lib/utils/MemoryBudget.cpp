@@ -0,0 +1,118 @@
+/**
+ * CloudMouse SDK - Memory Budget Implementation
+ */
+
+#include "./MemoryBudget.h"
+#include "./Logger.h"
+#include <esp_heap_caps.h>
+#include <string.h>
+
+namespace CloudMouse::Utils
+{
+    MemoryBudget::Entry MemoryBudget::entries[MEMORY_BUDGET_MAX_ENTRIES];
+    int MemoryBudget::entryCount = 0;
+    portMUX_TYPE MemoryBudget::lock = portMUX_INITIALIZER_UNLOCKED;
+
+    // ============================================================================
+    // RECORDING
+    // ============================================================================
+
+    void MemoryBudget::add(const char *subsystem, size_t bytes, Region region, Source source)
+    {
+        portENTER_CRITICAL(&lock);
+        int index = 0;
+        while (index < entryCount && strcmp(entries[index].name, subsystem) != 0)
+            index++;
+
+        // Same name updates the row: restarted tasks and reallocated buffers are not new costs
+        if (index < MEMORY_BUDGET_MAX_ENTRIES)
+        {
+            Entry &entry = entries[index];
+            entry.name = subsystem;
+            entry.bytes = (uint32_t)bytes;
+            entry.region = region;
+            entry.source = source;
+            if (index == entryCount)
+                entryCount++;
+        }
+        portEXIT_CRITICAL(&lock);
+    }
+
+    size_t MemoryBudget::getTotal(Region region)
+    {
+        size_t total = 0;
+        portENTER_CRITICAL(&lock);
+        for (int i = 0; i < entryCount; i++)
+        {
+            if (entries[i].region == region)
+                total += entries[i].bytes;
+        }
+        portEXIT_CRITICAL(&lock);
+        return total;
+    }
+
+    size_t MemoryBudget::getTotal(Region region, Source source)
+    {
+        size_t total = 0;
+        portENTER_CRITICAL(&lock);
+        for (int i = 0; i < entryCount; i++)
+        {
+            if (entries[i].region == region && entries[i].source == source)
+                total += entries[i].bytes;
+        }
+        portEXIT_CRITICAL(&lock);
+        return total;
+    }
+
+    // ============================================================================
+    // REPORT
+    // ============================================================================
+
+    const char *MemoryBudget::sourceName(Source source)
+    {
+        switch (source)
+        {
+        case Source::STATIC:
+            return "static";
+        case Source::BOOT:
+            return "boot";
+        case Source::HEAP:
+            return "heap";
+        default:
+            return "unknown";
+        }
+    }
+
+    void MemoryBudget::print()
+    {
+        // Copy first: SDK_LOGGER must not run inside the critical section
+        Entry snapshot[MEMORY_BUDGET_MAX_ENTRIES];
+        portENTER_CRITICAL(&lock);
+        int count = entryCount;
+        memcpy(snapshot, entries, sizeof(Entry) * count);
+        portEXIT_CRITICAL(&lock);
+
+        SDK_LOGGER("\n🧮 SDK memory budget (%s allocation):\n", SDK_STATIC_ALLOCATION ? "static" : "heap");
+        SDK_LOGGER("  %-20s %9s  %-8s  %s\n", "subsystem", "bytes", "region", "source");
+        for (int i = 0; i < count; i++)
+        {
+            const Entry &entry = snapshot[i];
+            SDK_LOGGER("  %-20s %9lu  %-8s  %s\n", entry.name, (unsigned long)entry.bytes,
+                       entry.region == Region::PSRAM ? "psram" : "internal", sourceName(entry.source));
+        }
+
+        const Region regions[] = {Region::INTERNAL, Region::PSRAM};
+        const uint32_t caps[] = {MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT};
+        for (int r = 0; r < 2; r++)
+        {
+            size_t sdkBytes = getTotal(regions[r]);
+            size_t heapBytes = getTotal(regions[r], Source::HEAP);
+            SDK_LOGGER("  %-8s SDK %lu bytes (%lu from heap) | heap free %lu, min %lu, largest block %lu\n",
+                       r == 0 ? "internal" : "psram",
+                       (unsigned long)sdkBytes, (unsigned long)heapBytes,
+                       (unsigned long)heap_caps_get_free_size(caps[r]),
+                       (unsigned long)heap_caps_get_minimum_free_size(caps[r]),
+                       (unsigned long)heap_caps_get_largest_free_block(caps[r]));
+        }
+    }
+}
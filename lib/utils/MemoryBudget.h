@@ -0,0 +1,173 @@
+/**
+ * CloudMouse SDK - Memory Budget and Static Allocation
+ *
+ * Records the fixed RAM cost of every SDK subsystem (queues, task stacks,
+ * pools, draw buffers) and prints it as a budget, so what the SDK holds and
+ * what is left for the app can be read off one report.
+ *
+ * Static allocation (SDK_STATIC_ALLOCATION in DeviceConfig.h):
+ * - TaskStorage / QueueStorage hold the TCB, stack and queue storage in .bss
+ *   and create with xTaskCreateStaticPinnedToCore / xQueueCreateStatic;
+ *   with the option off they compile to the heap versions and hold nothing
+ * - Task stacks and queues always live in internal SRAM: stacks in PSRAM
+ *   fault while the flash cache is disabled (NVS writes, OTA)
+ * - SDK_PSRAM_BSS places large buffers in .ext_ram.bss; it is only available
+ *   when the core enables CONFIG_SPIRAM_ALLOW_BSS_SEG_EXTERNAL_MEMORY
+ *   (SDK_STATIC_PSRAM), otherwise PSRAM storage is allocated once at init and
+ *   never freed (Source::BOOT)
+ *
+ * Report:
+ * - One row per subsystem: bytes, region (internal/PSRAM) and source
+ *   (static .bss, boot reservation, or runtime heap)
+ * - Totals per region next to the current free, minimum free and largest
+ *   free block of each heap
+ * - Printed once at boot (Core) and by the `memory` serial command
+ *
+ * Usage:
+ *   static Utils::TaskStorage<UI_TASK_STACK_SIZE> uiTaskStorage;
+ *   handle = uiTaskStorage.create(fn, "UI_Task", this, 1, 1);
+ *
+ *   MemoryBudget::add("lvgl.slabs", bytes, MemoryBudget::Region::INTERNAL, MemoryBudget::Source::STATIC);
+ *
+ * Thread Safety:
+ * - add() may be called from any task (spinlock); names must be string
+ *   literals (only the pointer is stored)
+ */
+
+#ifndef MEMORY_BUDGET_H
+#define MEMORY_BUDGET_H
+
+#include <Arduino.h>
+#include <esp_attr.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include "../config/DeviceConfig.h"
+
+// PSRAM .bss placement for static buffers
+#if SDK_STATIC_ALLOCATION && defined(CONFIG_SPIRAM_ALLOW_BSS_SEG_EXTERNAL_MEMORY)
+#define SDK_STATIC_PSRAM 1
+#define SDK_PSRAM_BSS EXT_RAM_BSS_ATTR
+#else
+#define SDK_STATIC_PSRAM 0
+#define SDK_PSRAM_BSS
+#endif
+
+namespace CloudMouse::Utils
+{
+    class MemoryBudget
+    {
+    public:
+        enum class Region : uint8_t
+        {
+            INTERNAL,
+            PSRAM
+        };
+
+        enum class Source : uint8_t
+        {
+            STATIC, // Reserved at link time (.bss / .ext_ram.bss)
+            BOOT,   // Allocated once at init, never freed
+            HEAP    // Runtime heap allocation (may be freed and reallocated)
+        };
+
+        // Source of queues and task stacks in this build
+        static const Source ALLOCATION = SDK_STATIC_ALLOCATION ? Source::STATIC : Source::HEAP;
+
+        /**
+         * Record (or update, by name) the fixed cost of a subsystem
+         */
+        static void add(const char *subsystem, size_t bytes, Region region, Source source);
+
+        /**
+         * Bytes recorded for a region, optionally only from one source
+         */
+        static size_t getTotal(Region region);
+        static size_t getTotal(Region region, Source source);
+
+        /**
+         * Print the budget table and the heap state
+         */
+        static void print();
+
+    private:
+        struct Entry
+        {
+            const char *name;
+            uint32_t bytes;
+            Region region;
+            Source source;
+        };
+
+        static Entry entries[MEMORY_BUDGET_MAX_ENTRIES];
+        static int entryCount;
+        static portMUX_TYPE lock;
+
+        static const char *sourceName(Source source);
+    };
+
+    // ============================================================================
+    // STATIC TASK AND QUEUE STORAGE
+    // ============================================================================
+
+    /**
+     * Task control block and stack for one task (stack size in bytes)
+     */
+    template <uint32_t STACK_SIZE>
+    class TaskStorage
+    {
+    public:
+        TaskHandle_t create(TaskFunction_t function, const char *name, void *param,
+                            UBaseType_t priority, BaseType_t core)
+        {
+            TaskHandle_t handle = nullptr;
+#if SDK_STATIC_ALLOCATION
+            // Safe to reuse after vTaskDelete() once the task is no longer running
+            handle = xTaskCreateStaticPinnedToCore(function, name, STACK_SIZE / sizeof(StackType_t),
+                                                   param, priority, stack, &tcb, core);
+#else
+            xTaskCreatePinnedToCore(function, name, STACK_SIZE / sizeof(StackType_t),
+                                    param, priority, &handle, core);
+#endif
+            if (handle)
+                MemoryBudget::add(name, STACK_SIZE + sizeof(StaticTask_t),
+                                  MemoryBudget::Region::INTERNAL, MemoryBudget::ALLOCATION);
+            return handle;
+        }
+
+    private:
+#if SDK_STATIC_ALLOCATION
+        StaticTask_t tcb;
+        StackType_t stack[STACK_SIZE / sizeof(StackType_t)];
+#endif
+    };
+
+    /**
+     * Queue control block and item storage for a FreeRTOS queue of LENGTH items
+     */
+    template <typename T, uint32_t LENGTH>
+    class QueueStorage
+    {
+    public:
+        QueueHandle_t create(const char *name)
+        {
+#if SDK_STATIC_ALLOCATION
+            QueueHandle_t handle = xQueueCreateStatic(LENGTH, sizeof(T), items, &control);
+#else
+            QueueHandle_t handle = xQueueCreate(LENGTH, sizeof(T));
+#endif
+            if (handle)
+                MemoryBudget::add(name, LENGTH * sizeof(T) + sizeof(StaticQueue_t),
+                                  MemoryBudget::Region::INTERNAL, MemoryBudget::ALLOCATION);
+            return handle;
+        }
+
+    private:
+#if SDK_STATIC_ALLOCATION
+        StaticQueue_t control;
+        uint8_t items[LENGTH * sizeof(T)];
+#endif
+    };
+}
+
+#endif
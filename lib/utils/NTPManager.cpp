@@ -3,10 +3,16 @@
  *
  * Network Time Protocol client implementation with configurable timezone support.
  * Provides reliable time synchronization using multiple NTP server fallbacks.
+ * Synchronization is asynchronous (SNTP callback); queries read a cached epoch
+ * advanced by the esp_timer monotonic clock.
  */
 
 #include "./NTPManager.h"
 #include "Logger.h"
+#include "./BootProfiler.h"
+#include "../core/EventBus.h"
+#include <esp_sntp.h>
+#include <esp_timer.h>
 
 namespace CloudMouse::Utils
 {
@@ -18,6 +24,13 @@ namespace CloudMouse::Utils
     long NTPManager::gmtOffset_sec = 0;     // Default to UTC
     int NTPManager::daylightOffset_sec = 0; // Default no DST
 
+    // Clock cache
+    portMUX_TYPE NTPManager::clockLock = portMUX_INITIALIZER_UNLOCKED;
+    volatile bool NTPManager::clockValid = false;
+    int64_t NTPManager::syncEpochUs = 0;
+    int64_t NTPManager::syncMonotonicUs = 0;
+    volatile uint32_t NTPManager::syncCount = 0;
+
     // Default NTP servers (reliable global servers)
     const char *NTPManager::DEFAULT_NTP_SERVER1 = "pool.ntp.org";
     const char *NTPManager::DEFAULT_NTP_SERVER2 = "time.nist.gov";
@@ -28,6 +41,56 @@ namespace CloudMouse::Utils
     const char *NTPManager::ntpServer2 = DEFAULT_NTP_SERVER2;
     const char *NTPManager::ntpServer3 = DEFAULT_NTP_SERVER3;
 
+    // Placeholders while the time is not set (same as before the clock cache)
+    static const char *NTP_PLACEHOLDER_DATE_TIME = "1970-01-01 00:00:00";
+    static const char *NTP_PLACEHOLDER_DATE = "1970-01-01";
+    static const char *NTP_PLACEHOLDER_TIME = "00:00:00";
+
+    /**
+     * Write value as exactly digits decimal digits (zero padded)
+     */
+    static char *ntpWriteDigits(char *p, int value, int digits)
+    {
+        for (int i = digits - 1; i >= 0; i--)
+        {
+            p[i] = (char)('0' + value % 10);
+            value /= 10;
+        }
+        return p + digits;
+    }
+
+    static char *ntpWriteDate(char *p, const struct tm &timeinfo)
+    {
+        p = ntpWriteDigits(p, timeinfo.tm_year + 1900, 4);
+        *p++ = '-';
+        p = ntpWriteDigits(p, timeinfo.tm_mon + 1, 2);
+        *p++ = '-';
+        return ntpWriteDigits(p, timeinfo.tm_mday, 2);
+    }
+
+    static char *ntpWriteTime(char *p, const struct tm &timeinfo)
+    {
+        p = ntpWriteDigits(p, timeinfo.tm_hour, 2);
+        *p++ = ':';
+        p = ntpWriteDigits(p, timeinfo.tm_min, 2);
+        *p++ = ':';
+        return ntpWriteDigits(p, timeinfo.tm_sec, 2);
+    }
+
+    /**
+     * Copy a placeholder if it fits, otherwise leave an empty string
+     */
+    static void ntpWritePlaceholder(char *buffer, size_t size, const char *placeholder)
+    {
+        if (!buffer || size == 0)
+            return;
+        size_t length = strlen(placeholder);
+        if (length >= size)
+            length = 0;
+        memcpy(buffer, placeholder, length);
+        buffer[length] = '\0';
+    }
+
     // ============================================================================
     // INITIALIZATION
     // ============================================================================
@@ -52,27 +115,66 @@ namespace CloudMouse::Utils
         gmtOffset_sec = gmtOffsetSec;
         daylightOffset_sec = dstOffsetSec;
 
-        // Configure time with multiple NTP servers for reliability
+        // A clock kept across a software restart is usable until the first sync
+        seedFromSystemClock();
+
+        // Configure time with multiple NTP servers for reliability; SNTP runs
+        // in the background and reports through onTimeSync()
+        if (syncCount == 0)
+            BootProfiler::begin("ntp.sync");
+        sntp_set_time_sync_notification_cb(onTimeSync);
         configTime(gmtOffset_sec, daylightOffset_sec, ntpServer1, ntpServer2, ntpServer3);
 
-        // Wait for time synchronization (max 10 seconds)
-        int timeout = 0;
-        while (!isTimeSet() && timeout < 100)
-        {
-            delay(100);
-            timeout++;
-        }
+        timeInitialized = true;
+    }
+
+    void NTPManager::onTimeSync(struct timeval *tv)
+    {
+        (void)tv;
 
-        if (isTimeSet())
+        // The system clock was just set: cache it with the matching monotonic time
+        struct timeval now;
+        gettimeofday(&now, nullptr);
+        if (now.tv_sec < MIN_VALID_EPOCH)
+            return;
+
+        setClock((int64_t)now.tv_sec * 1000000 + now.tv_usec);
+        uint32_t count = ++syncCount;
+
+        if (count == 1)
         {
-            timeInitialized = true;
+            BootProfiler::end("ntp.sync");
             SDK_LOGGER("✅ NTP synchronized successfully");
             printCurrentTime();
         }
         else
         {
-            SDK_LOGGER("❌ NTP synchronization failed - check network connection");
+            SDK_LOGD(NETWORK, "⏰ NTP resync #%u", (unsigned)count);
         }
+
+        EventBus::instance().publish(Event(EventType::TIME_SYNCED, (int32_t)now.tv_sec));
+    }
+
+    void NTPManager::setClock(int64_t epochUs)
+    {
+        int64_t monotonicUs = esp_timer_get_time();
+
+        portENTER_CRITICAL(&clockLock);
+        syncEpochUs = epochUs;
+        syncMonotonicUs = monotonicUs;
+        clockValid = true;
+        portEXIT_CRITICAL(&clockLock);
+    }
+
+    bool NTPManager::seedFromSystemClock()
+    {
+        struct timeval now;
+        gettimeofday(&now, nullptr);
+        if (now.tv_sec < MIN_VALID_EPOCH)
+            return false;
+
+        setClock((int64_t)now.tv_sec * 1000000 + now.tv_usec);
+        return true;
     }
 
     // ============================================================================
@@ -81,13 +183,7 @@ namespace CloudMouse::Utils
 
     bool NTPManager::isTimeSet()
     {
-        struct tm timeinfo;
-        if (!getLocalTime(&timeinfo))
-        {
-            return false;
-        }
-        // Check if year is reasonable (2024+)
-        return (timeinfo.tm_year + 1900) >= 2024;
+        return clockValid || seedFromSystemClock();
     }
 
     bool NTPManager::isInitialized()
@@ -95,87 +191,134 @@ namespace CloudMouse::Utils
         return timeInitialized;
     }
 
+    uint32_t NTPManager::getSyncCount()
+    {
+        return syncCount;
+    }
+
+    uint32_t NTPManager::getLastSyncAgeMs()
+    {
+        if (syncCount == 0)
+            return 0;
+
+        portENTER_CRITICAL(&clockLock);
+        int64_t monotonicUs = syncMonotonicUs;
+        portEXIT_CRITICAL(&clockLock);
+        return (uint32_t)((esp_timer_get_time() - monotonicUs) / 1000);
+    }
+
     // ============================================================================
-    // LOCAL TIME FUNCTIONS
+    // CLOCK CACHE AND FORMATTING
     // ============================================================================
 
-    String NTPManager::getCurrentDateTime()
+    int64_t NTPManager::getEpochUs()
     {
-        if (!timeInitialized || !isTimeSet())
-        {
-            SDK_LOGGER("⚠️ NTP not initialized or time not synchronized");
-            return "1970-01-01 00:00:00"; // Unix epoch as fallback
-        }
+        if (!isTimeSet())
+            return 0;
 
-        struct tm timeinfo;
-        if (!getLocalTime(&timeinfo))
-        {
-            SDK_LOGGER("❌ Failed to obtain local time");
-            return "1970-01-01 00:00:00";
-        }
+        portENTER_CRITICAL(&clockLock);
+        int64_t epochUs = syncEpochUs;
+        int64_t monotonicUs = syncMonotonicUs;
+        portEXIT_CRITICAL(&clockLock);
 
-        char buffer[20];
-        strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M:%S", &timeinfo);
-        return String(buffer);
+        return epochUs + (esp_timer_get_time() - monotonicUs);
     }
 
-    String NTPManager::getCurrentDate()
+    bool NTPManager::getTime(struct tm &out, bool utc)
     {
-        if (!timeInitialized || !isTimeSet())
-        {
-            SDK_LOGGER("⚠️ NTP not initialized or time not synchronized");
-            return "1970-01-01";
-        }
+        int64_t epochUs = getEpochUs();
+        if (epochUs == 0)
+            return false;
 
+        // Fixed offsets as given to configTime(); gmtime_r does not touch TZ or the heap
+        time_t seconds = (time_t)(epochUs / 1000000);
+        if (!utc)
+            seconds += gmtOffset_sec + daylightOffset_sec;
+        return gmtime_r(&seconds, &out) != nullptr;
+    }
+
+    bool NTPManager::formatDateTime(char *buffer, size_t size, bool utc)
+    {
         struct tm timeinfo;
-        if (!getLocalTime(&timeinfo))
+        if (!buffer || size < DATE_TIME_BUFFER_SIZE || !getTime(timeinfo, utc))
         {
-            SDK_LOGGER("❌ Failed to obtain local time");
-            return "1970-01-01";
+            ntpWritePlaceholder(buffer, size, NTP_PLACEHOLDER_DATE_TIME);
+            return false;
         }
 
-        char buffer[11];
-        strftime(buffer, sizeof(buffer), "%Y-%m-%d", &timeinfo);
-        return String(buffer);
+        char *p = ntpWriteDate(buffer, timeinfo);
+        *p++ = ' ';
+        p = ntpWriteTime(p, timeinfo);
+        *p = '\0';
+        return true;
     }
 
-    String NTPManager::getCurrentTime()
+    bool NTPManager::formatDate(char *buffer, size_t size, bool utc)
     {
-        if (!timeInitialized || !isTimeSet())
+        struct tm timeinfo;
+        if (!buffer || size < DATE_BUFFER_SIZE || !getTime(timeinfo, utc))
         {
-            return "00:00:00";
+            ntpWritePlaceholder(buffer, size, NTP_PLACEHOLDER_DATE);
+            return false;
         }
 
+        *ntpWriteDate(buffer, timeinfo) = '\0';
+        return true;
+    }
+
+    bool NTPManager::formatTime(char *buffer, size_t size, bool utc)
+    {
         struct tm timeinfo;
-        if (!getLocalTime(&timeinfo))
+        if (!buffer || size < TIME_BUFFER_SIZE || !getTime(timeinfo, utc))
         {
-            return "00:00:00";
+            ntpWritePlaceholder(buffer, size, NTP_PLACEHOLDER_TIME);
+            return false;
         }
 
-        char buffer[9];
-        strftime(buffer, sizeof(buffer), "%H:%M:%S", &timeinfo);
+        *ntpWriteTime(buffer, timeinfo) = '\0';
+        return true;
+    }
+
+    // ============================================================================
+    // LOCAL TIME FUNCTIONS
+    // ============================================================================
+
+    String NTPManager::getCurrentDateTime()
+    {
+        char buffer[DATE_TIME_BUFFER_SIZE];
+        formatDateTime(buffer, sizeof(buffer));
+        return String(buffer);
+    }
+
+    String NTPManager::getCurrentDate()
+    {
+        char buffer[DATE_BUFFER_SIZE];
+        formatDate(buffer, sizeof(buffer));
+        return String(buffer);
+    }
+
+    String NTPManager::getCurrentTime()
+    {
+        char buffer[TIME_BUFFER_SIZE];
+        formatTime(buffer, sizeof(buffer));
         return String(buffer);
     }
 
     void NTPManager::printCurrentTime()
     {
-        if (!isTimeSet())
+        char dateTime[DATE_TIME_BUFFER_SIZE];
+        if (!formatDateTime(dateTime, sizeof(dateTime)))
         {
             SDK_LOGGER("⏰ Time not available");
             return;
         }
 
-        struct tm timeinfo;
-        if (getLocalTime(&timeinfo))
-        {
-            SDK_LOGGER("⏰ Current local time: %s\n", getCurrentDateTime().c_str());
-            SDK_LOGGER("⏰ Current date: %s\n", getCurrentDate().c_str());
+        SDK_LOGGER("⏰ Current local time: %s\n", dateTime);
 
-            // Show timezone info
-            int offsetHours = gmtOffset_sec / 3600;
-            int offsetMinutes = (abs(gmtOffset_sec) % 3600) / 60;
-            SDK_LOGGER("⏰ Timezone: UTC%+d:%02d\n", offsetHours, offsetMinutes);
-        }
+        // Show timezone info
+        int offsetHours = gmtOffset_sec / 3600;
+        int offsetMinutes = (abs(gmtOffset_sec) % 3600) / 60;
+        SDK_LOGGER("⏰ Timezone: UTC%+d:%02d\n", offsetHours, offsetMinutes);
     }
 
     // ============================================================================
@@ -184,90 +327,43 @@ namespace CloudMouse::Utils
 
     String NTPManager::getCurrentDateTimeUTC()
     {
-        if (!timeInitialized || !isTimeSet())
-        {
-            SDK_LOGGER("⚠️ NTP not initialized or time not synchronized");
-            return "1970-01-01T00:00:00Z";
-        }
-
-        // Get UTC timestamp
-        time_t now = time(nullptr);
-        struct tm *utcTime = gmtime(&now);
-
-        if (!utcTime)
-        {
-            SDK_LOGGER("❌ Failed to get UTC time");
-            return "1970-01-01T00:00:00Z";
-        }
-
-        char buffer[25];
-        strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M:%S", utcTime);
+        char buffer[DATE_TIME_BUFFER_SIZE];
+        formatDateTime(buffer, sizeof(buffer), true);
         return String(buffer);
     }
 
     String NTPManager::getCurrentDateUTC()
     {
-        if (!timeInitialized || !isTimeSet())
-        {
-            return "1970-01-01";
-        }
-
-        time_t now = time(nullptr);
-        struct tm *utcTime = gmtime(&now);
-
-        if (!utcTime)
-        {
-            return "1970-01-01";
-        }
-
-        char buffer[12];
-        strftime(buffer, sizeof(buffer), "%Y-%m-%d", utcTime);
+        char buffer[DATE_BUFFER_SIZE];
+        formatDate(buffer, sizeof(buffer), true);
         return String(buffer);
     }
 
     String NTPManager::getCurrentTimeUTC()
     {
-        if (!timeInitialized || !isTimeSet())
-        {
-            return "00:00:00";
-        }
-
-        time_t now = time(nullptr);
-        struct tm *utcTime = gmtime(&now);
-
-        if (!utcTime)
-        {
-            return "00:00:00";
-        }
-
-        char buffer[10];
-        strftime(buffer, sizeof(buffer), "%H:%M:%S", utcTime);
+        char buffer[TIME_BUFFER_SIZE];
+        formatTime(buffer, sizeof(buffer), true);
         return String(buffer);
     }
 
     void NTPManager::printCurrentTimeUTC()
     {
-        if (!isTimeSet())
+        char utcTime[DATE_TIME_BUFFER_SIZE];
+        char localTime[DATE_TIME_BUFFER_SIZE];
+        if (!formatDateTime(utcTime, sizeof(utcTime), true))
         {
             SDK_LOGGER("⏰ Time not available");
             return;
         }
+        formatDateTime(localTime, sizeof(localTime));
 
-        time_t now = time(nullptr);
-        struct tm *utcTime = gmtime(&now);
-        struct tm localTimeInfo;
-        getLocalTime(&localTimeInfo);
-
-        if (utcTime)
-        {
-            SDK_LOGGER("🌍 UTC time: %s\n", getCurrentDateTimeUTC().c_str());
-            SDK_LOGGER("📍 Local time: %s\n", getCurrentDateTime().c_str());
+        SDK_LOGGER("🌍 UTC time: %s\n", utcTime);
+        SDK_LOGGER("📍 Local time: %s\n", localTime);
 
-            // Show timezone offset
-            int offsetHours = gmtOffset_sec / 3600;
-            int offsetMinutes = (abs(gmtOffset_sec) % 3600) / 60;
-            SDK_LOGGER("⏰ Timezone offset: UTC%+d:%02d\n", offsetHours, offsetMinutes);
-        }
+        // Show timezone offset
+        int offsetHours = gmtOffset_sec / 3600;
+        int offsetMinutes = (abs(gmtOffset_sec) % 3600) / 60;
+        SDK_LOGGER("⏰ Timezone offset: UTC%+d:%02d\n", offsetHours, offsetMinutes);
     }
 
     // ============================================================================
@@ -276,12 +372,7 @@ namespace CloudMouse::Utils
 
     time_t NTPManager::getEpochTime()
     {
-        if (!timeInitialized || !isTimeSet())
-        {
-            SDK_LOGGER("⚠️ NTP not initialized or time not synchronized");
-            return 0;
-        }
-        return time(nullptr); // Unix timestamp in seconds
+        return (time_t)(getEpochUs() / 1000000); // Unix timestamp in seconds, 0 if not set
     }
 
     // ============================================================================
@@ -318,4 +409,4 @@ namespace CloudMouse::Utils
         }
     }
 
-} // namespace CloudMouse
\ No newline at end of file
+} // namespace CloudMouse
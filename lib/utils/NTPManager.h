@@ -1,49 +1,78 @@
 /**
  * CloudMouse SDK - NTP Time Manager
- * 
+ *
  * Network Time Protocol client for accurate time synchronization.
  * Provides both local time and UTC time utilities with configurable timezone support.
- * 
+ *
  * Features:
  * - Multiple NTP server fallback for reliability
  * - Configurable timezone and DST settings
  * - Local time and UTC time functions
  * - Time validation and synchronization status
  * - Epoch timestamp support for logging
+ *
+ * Non-blocking operation:
+ * - init() only starts SNTP; the sync completes in the background and the
+ *   SNTP callback publishes EventType::TIME_SYNCED (also on every resync)
+ * - Queries never call getLocalTime(): the time is the epoch cached at the
+ *   last sync plus the esp_timer monotonic time elapsed since then
+ * - format*() write into caller-provided buffers and do not allocate, so a
+ *   clock label can be refreshed every second from the UI task
+ * - The String getters remain for convenience (they allocate)
+ *
+ * Usage:
+ *   char clock[NTPManager::TIME_BUFFER_SIZE];
+ *   NTPManager::formatTime(clock, sizeof(clock));   // "HH:MM:SS", "00:00:00" until synced
+ *   lv_label_set_text(label, clock);
  */
 
 #pragma once
 #include <WiFi.h>
 #include <time.h>
+#include <sys/time.h>
 #include <Arduino.h>
 
 namespace CloudMouse::Utils {
 
 class NTPManager {
 public:
+    // Buffer sizes for the format*() functions (including the terminator)
+    static const size_t DATE_TIME_BUFFER_SIZE = 20;  // "YYYY-MM-DD HH:MM:SS"
+    static const size_t DATE_BUFFER_SIZE = 11;       // "YYYY-MM-DD"
+    static const size_t TIME_BUFFER_SIZE = 9;        // "HH:MM:SS"
+
     // System lifecycle
-    static void init();                         // Initialize NTP with default timezone (UTC)
-    static void init(long gmtOffsetSec, int dstOffsetSec = 0); // Initialize with custom timezone
-    
+    static void init();                         // Start NTP with default timezone (UTC)
+    static void init(long gmtOffsetSec, int dstOffsetSec = 0); // Start NTP with custom timezone
+
     // Time status
-    static bool isTimeSet();                    // Check if NTP time is synchronized
+    static bool isTimeSet();                    // Check if the clock holds a valid time (synced or kept across restart)
     static bool isInitialized();               // Check if NTP manager is initialized
-    
+    static uint32_t getSyncCount();            // Completed SNTP syncs since boot
+    static uint32_t getLastSyncAgeMs();        // Time since the last sync, 0 if never synced
+
+    // Allocation-free formatting: false (and a placeholder) if the time is not set or the buffer is too small
+    static bool formatDateTime(char* buffer, size_t size, bool utc = false); // "YYYY-MM-DD HH:MM:SS"
+    static bool formatDate(char* buffer, size_t size, bool utc = false);     // "YYYY-MM-DD"
+    static bool formatTime(char* buffer, size_t size, bool utc = false);     // "HH:MM:SS"
+    static bool getTime(struct tm& out, bool utc = false);                  // Broken-down local or UTC time
+
     // Local time functions
     static String getCurrentDateTime();         // Get formatted local date and time
     static String getCurrentDate();            // Get formatted local date (YYYY-MM-DD)
     static String getCurrentTime();            // Get formatted local time (HH:MM:SS)
     static void printCurrentTime();            // Print current local time to Serial
-    
+
     // UTC time functions
     static String getCurrentDateTimeUTC();     // Get formatted UTC date and time
     static String getCurrentDateUTC();         // Get formatted UTC date
     static String getCurrentTimeUTC();         // Get formatted UTC time
     static void printCurrentTimeUTC();         // Print UTC and local time comparison
-    
+
     // Timestamp functions
     static time_t getEpochTime();              // Get Unix timestamp (seconds since 1970)
-    
+    static int64_t getEpochUs();               // Unix time in microseconds, 0 if not set
+
     // Configuration
     static void setTimezone(long gmtOffsetSec, int dstOffsetSec = 0); // Update timezone settings
     static void setNTPServers(const char* server1, const char* server2 = nullptr, const char* server3 = nullptr);
@@ -52,16 +81,30 @@ private:
     static bool timeInitialized;
     static long gmtOffset_sec;                 // GMT offset in seconds
     static int daylightOffset_sec;             // Daylight saving time offset in seconds
-    
+
+    // Clock cache: Unix time at the last sync and esp_timer time at that moment
+    static portMUX_TYPE clockLock;
+    static volatile bool clockValid;
+    static int64_t syncEpochUs;
+    static int64_t syncMonotonicUs;
+    static volatile uint32_t syncCount;
+
+    // Times before this are an unset clock (2024-01-01 00:00:00 UTC)
+    static const time_t MIN_VALID_EPOCH = 1704067200;
+
     // Default NTP servers (configurable)
     static const char* ntpServer1;
-    static const char* ntpServer2;  
+    static const char* ntpServer2;
     static const char* ntpServer3;
-    
+
     // Default server addresses
     static const char* DEFAULT_NTP_SERVER1;
     static const char* DEFAULT_NTP_SERVER2;
     static const char* DEFAULT_NTP_SERVER3;
+
+    static void onTimeSync(struct timeval* tv); // SNTP callback (lwIP task)
+    static void setClock(int64_t epochUs);
+    static bool seedFromSystemClock();         // Time kept across a software restart
 };
 
-}  // namespace CloudMouse
\ No newline at end of file
+}  // namespace CloudMouse
@@ -6,14 +6,24 @@
  */
 
 #include "./QRCodeManager.h"
+#include "./Hash.h"
+#include <esp_heap_caps.h>
 
 namespace CloudMouse::Utils
 {
+    QRCodeManager::CacheEntry QRCodeManager::cache[QRCodeManager::CACHE_ENTRIES];
+    uint32_t QRCodeManager::cacheClock = 0;
 
     // ============================================================================
     // INITIALIZATION
     // ============================================================================
 
+    QRCodeManager::~QRCodeManager()
+    {
+        free(ownBits);
+        free(rowBlock);
+    }
+
     void QRCodeManager::init(LGFX_Sprite *sprite)
     {
         this->sprite = sprite;
@@ -46,8 +56,52 @@ namespace CloudMouse::Utils
             return;
         }
 
+        // The cache entry can be evicted by any other instance: keep a private copy
+        ModuleBitmap cached;
+        valid = getModuleBitmap(content, version, ecc, cached);
+        if (!valid)
+            return;
+
+        size_t bytes = (size_t)((cached.size + 7) / 8) * cached.size;
+        void *buffer = ownBits;
+        if (!reserve(buffer, ownBitsSize, bytes))
+        {
+            SDK_LOGGER("❌ QRCodeManager: Out of memory for QR bitmap");
+            valid = false;
+            return;
+        }
+        ownBits = (uint8_t *)buffer;
+        memcpy(ownBits, cached.bits, bytes);
+        bitmap = {cached.size, ownBits};
+
+        // Render to sprite
+        renderToSprite();
+    }
+
+    bool QRCodeManager::getModuleBitmap(const char *content, uint8_t version, uint8_t ecc, ModuleBitmap &bitmap)
+    {
+        uint32_t hash = fnv1aText(content);
+        hash = fnv1a(&version, 1, hash);
+        hash = fnv1a(&ecc, 1, hash);
+
+        // Cache hit: no encode at all
+        CacheEntry *victim = &cache[0];
+        for (int i = 0; i < CACHE_ENTRIES; i++)
+        {
+            CacheEntry &entry = cache[i];
+            if (entry.bits && entry.hash == hash && entry.version == version && entry.ecc == ecc && entry.content == content)
+            {
+                entry.lastUsed = ++cacheClock;
+                bitmap = {entry.size, entry.bits};
+                return true;
+            }
+            if (!entry.bits || (victim->bits && entry.lastUsed < victim->lastUsed))
+                victim = &entry;
+        }
+
         // Allocate buffer for QR code data
         uint8_t qrcodeData[qrcode_getBufferSize(version)];
+        QRCode qrcode;
 
         // Generate QR code
         int8_t result = qrcode_initText(&qrcode, qrcodeData, version, ecc, content);
@@ -55,17 +109,58 @@ namespace CloudMouse::Utils
         if (result != 0)
         {
             SDK_LOGGER("❌ QRCodeManager: Failed to generate QR code (error: %d)\n", result);
-            valid = false;
-            return;
+            return false;
         }
 
-        valid = true;
+        // Repack modules into byte-aligned rows for the blit
+        size_t rowBytes = (qrcode.size + 7) / 8;
+        uint8_t *bits = (uint8_t *)heap_caps_calloc(rowBytes * qrcode.size, 1, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (!bits)
+            bits = (uint8_t *)calloc(rowBytes * qrcode.size, 1);
+        if (!bits)
+        {
+            SDK_LOGGER("❌ QRCodeManager: Out of memory for QR bitmap");
+            return false;
+        }
+
+        for (uint8_t y = 0; y < qrcode.size; y++)
+        {
+            for (uint8_t x = 0; x < qrcode.size; x++)
+            {
+                if (qrcode_getModule(&qrcode, x, y))
+                    bits[y * rowBytes + (x >> 3)] |= 0x80 >> (x & 7);
+            }
+        }
+
+        free(victim->bits);
+        victim->hash = hash;
+        victim->content = content;
+        victim->version = version;
+        victim->ecc = ecc;
+        victim->size = qrcode.size;
+        victim->bits = bits;
+        victim->lastUsed = ++cacheClock;
 
         SDK_LOGGER("✅ QRCodeManager: Generated QR code %dx%d for content length %d\n",
                       qrcode.size, qrcode.size, strlen(content));
 
-        // Render to sprite
-        renderToSprite();
+        bitmap = {victim->size, victim->bits};
+        return true;
+    }
+
+    bool QRCodeManager::reserve(void *&buffer, size_t &capacity, size_t bytes)
+    {
+        if (bytes <= capacity && buffer)
+            return true;
+
+        void *grown = malloc(bytes);
+        if (!grown)
+            return false;
+
+        free(buffer);
+        buffer = grown;
+        capacity = bytes;
+        return true;
     }
 
     // ============================================================================
@@ -89,12 +184,12 @@ namespace CloudMouse::Utils
 
     uint8_t QRCodeManager::getSize() const
     {
-        return valid ? qrcode.size : 0;
+        return valid ? bitmap.size : 0;
     }
 
     int QRCodeManager::getPixelSize() const
     {
-        return valid ? (qrcode.size * pixelSide) : 0;
+        return valid ? (bitmap.size * pixelSide) : 0;
     }
 
     bool QRCodeManager::isValid() const
@@ -113,24 +208,37 @@ namespace CloudMouse::Utils
             return;
         }
 
-        // Render QR code modules to sprite
-        for (uint8_t y = 0; y < qrcode.size; y++)
+        // One module row expanded to RGB565 and replicated over pixelSide lines
+        int side = bitmap.size * pixelSide;
+        size_t rowBytes = (bitmap.size + 7) / 8;
+        void *buffer = rowBlock;
+        if (!reserve(buffer, rowBlockSize, (size_t)side * pixelSide * sizeof(lgfx::rgb565_t)))
         {
-            for (uint8_t x = 0; x < qrcode.size; x++)
-            {
-                // Get module state (true = black, false = white)
-                bool isBlack = qrcode_getModule(&qrcode, x, y);
+            SDK_LOGGER("❌ QRCodeManager: Out of memory for QR blit");
+            return;
+        }
+        rowBlock = (lgfx::rgb565_t *)buffer;
+        lgfx::rgb565_t *block = rowBlock;
 
-                // Calculate pixel position
-                int pixelX = offsetX + (x * pixelSide);
-                int pixelY = offsetY + (y * pixelSide);
+        for (uint8_t y = 0; y < bitmap.size; y++)
+        {
+            const uint8_t *row = bitmap.bits + y * rowBytes;
+            lgfx::rgb565_t *line = block;
 
-                // Choose color based on module state
+            for (uint8_t x = 0; x < bitmap.size; x++)
+            {
+                // Module state (1 = black, 0 = white)
+                bool isBlack = row[x >> 3] & (0x80 >> (x & 7));
                 uint16_t color = isBlack ? foregroundColor : backgroundColor;
 
-                // Render module as filled rectangle
-                sprite->fillRect(pixelX, pixelY, pixelSide, pixelSide, color);
+                for (int p = 0; p < pixelSide; p++)
+                    (line++)->raw = color;
             }
+
+            for (int l = 1; l < pixelSide; l++)
+                memcpy(block + l * side, block, side * sizeof(lgfx::rgb565_t));
+
+            sprite->pushImage(offsetX, offsetY + y * pixelSide, side, pixelSide, block);
         }
     }
 
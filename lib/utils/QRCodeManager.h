@@ -9,6 +9,12 @@
  * - Flexible display interface (works with any graphics library)
  * - Configurable positioning and scaling
  * - Memory efficient rendering
+ * - Shared cache of encoded 1-bpp module bitmaps keyed by content hash, so
+ *   repeated content skips the Reed-Solomon encode entirely; each instance
+ *   keeps its own copy of the modules it shows, so cache eviction never
+ *   pulls a bitmap from under another instance
+ * - Row-expanded blit: one pushImage per module row instead of one fillRect
+ *   per module, from a row buffer kept between renders
  */
 
 #ifndef QRCODEMANAGER_H
@@ -35,6 +41,9 @@ namespace CloudMouse::Utils
     class QRCodeManager
     {
     public:
+        QRCodeManager() = default;
+        ~QRCodeManager();
+
         /**
          * Initialize QR code manager with display sprite
          *
@@ -94,15 +103,63 @@ namespace CloudMouse::Utils
          */
         bool isValid() const;
 
+        /**
+         * Encoded QR module bitmap
+         * Rows are packed MSB first, (size + 7) / 8 bytes per row, 1 = dark module.
+         */
+        struct ModuleBitmap
+        {
+            uint8_t size;           // Modules per side
+            const uint8_t *bits;    // Packed rows (owned by the cache)
+        };
+
+        /**
+         * Get the module bitmap for a content, encoding it only on cache miss
+         * The returned bitmap stays valid until CACHE_ENTRIES other contents
+         * have been requested, so use it right away.
+         *
+         * @param content Text content to encode
+         * @param version QR code version (1-40)
+         * @param ecc Error correction level (0-3)
+         * @param bitmap Filled with the cached bitmap on success
+         * @return true if the content could be encoded
+         */
+        static bool getModuleBitmap(const char *content, uint8_t version, uint8_t ecc, ModuleBitmap &bitmap);
+
+        static const int CACHE_ENTRIES = 4;
+
         // Common QR code content generators
         static String generateWiFiQR(const String &ssid, const String &password, const String &security = "WPA");
         static String generateURLQR(const String &url);
         static String generateTextQR(const String &text);
 
     private:
-        QRCode qrcode;                 // QR code data structure
+        /**
+         * Cache slot: content is kept to rule out hash collisions
+         */
+        struct CacheEntry
+        {
+            uint32_t hash = 0;
+            String content;
+            uint8_t version = 0;
+            uint8_t ecc = 0;
+            uint8_t size = 0;
+            uint8_t *bits = nullptr;
+            uint32_t lastUsed = 0;
+        };
+
+        static CacheEntry cache[CACHE_ENTRIES];
+        static uint32_t cacheClock;
+
+        ModuleBitmap bitmap = {0, nullptr}; // Current QR code modules (points into ownBits)
         LGFX_Sprite *sprite = nullptr; // Display sprite for rendering
 
+        // Instance-owned buffers, grown on demand and reused
+        uint8_t *ownBits = nullptr;        // Copy of the cached module bitmap
+        size_t ownBitsSize = 0;
+        lgfx::rgb565_t *rowBlock = nullptr; // One module row expanded to RGB565
+        size_t rowBlockSize = 0;            // Bytes
+
         // Rendering configuration
         int offsetX = 0;    // X position offset
         int offsetY = 0;    // Y position offset
@@ -115,6 +172,15 @@ namespace CloudMouse::Utils
 
         // Internal rendering function
         void renderToSprite();
+
+        /**
+         * Grow a buffer to at least 'bytes' (contents not kept)
+         * @return false if out of memory (buffer unchanged)
+         */
+        static bool reserve(void *&buffer, size_t &capacity, size_t bytes);
+
+        QRCodeManager(const QRCodeManager &) = delete;
+        QRCodeManager &operator=(const QRCodeManager &) = delete;
     };
 };
 #endif
\ No newline at end of file
@@ -0,0 +1,111 @@
+/**
+ * CloudMouse SDK - Rolling Statistics Utility
+ *
+ * Fixed-size sample window with min/avg/max/percentile queries for runtime
+ * profiling (frame timing, latency tracing, benchmarks).
+ *
+ * Features:
+ * - Static storage, no heap allocation
+ * - O(1) sample insertion (ring buffer overwrites the oldest sample)
+ * - Percentiles computed on demand from a sorted copy of the window
+ *
+ * Thread Safety:
+ * - Not thread-safe: feed and query from the same task
+ */
+
+#ifndef ROLLING_STATS_H
+#define ROLLING_STATS_H
+
+#include <Arduino.h>
+#include <algorithm>
+
+namespace CloudMouse::Utils
+{
+    /**
+     * Rolling window of the last N samples
+     *
+     * @tparam N Window size in samples (percentile queries copy N * 4 bytes on the stack)
+     */
+    template <size_t N>
+    class RollingStats
+    {
+    public:
+        /**
+         * Add a sample, replacing the oldest one once the window is full
+         *
+         * @param value Sample value (e.g. microseconds, pixels)
+         */
+        void add(uint32_t value)
+        {
+            samples[head] = value;
+            head = (head + 1) % N;
+            if (count < N)
+                count++;
+        }
+
+        void reset()
+        {
+            head = 0;
+            count = 0;
+        }
+
+        size_t size() const { return count; }
+        bool empty() const { return count == 0; }
+
+        uint32_t min() const
+        {
+            if (count == 0)
+                return 0;
+            uint32_t result = samples[0];
+            for (size_t i = 1; i < count; i++)
+                result = std::min(result, samples[i]);
+            return result;
+        }
+
+        uint32_t max() const
+        {
+            uint32_t result = 0;
+            for (size_t i = 0; i < count; i++)
+                result = std::max(result, samples[i]);
+            return result;
+        }
+
+        uint32_t avg() const
+        {
+            if (count == 0)
+                return 0;
+            uint64_t sum = 0;
+            for (size_t i = 0; i < count; i++)
+                sum += samples[i];
+            return (uint32_t)(sum / count);
+        }
+
+        /**
+         * Get a percentile of the current window (nearest-rank method)
+         *
+         * @param percent Percentile in range 0-100 (e.g. 99 for p99)
+         * @return Sample value at the requested rank, 0 if the window is empty
+         */
+        uint32_t percentile(uint8_t percent) const
+        {
+            if (count == 0)
+                return 0;
+
+            uint32_t sorted[N];
+            std::copy(samples, samples + count, sorted);
+            std::sort(sorted, sorted + count);
+
+            size_t rank = (count * percent + 99) / 100;
+            if (rank == 0)
+                rank = 1;
+            return sorted[std::min(rank, count) - 1];
+        }
+
+    private:
+        uint32_t samples[N] = {};
+        size_t head = 0;
+        size_t count = 0;
+    };
+}
+
+#endif
@@ -0,0 +1,324 @@
+/**
+ * CloudMouse SDK - Task CPU and Stack Profiler Implementation
+ *
+ * Run-time counters are cumulative per task; loads are the difference to the
+ * previous sample, matched by task handle. The run-time clock is the same on
+ * both cores, so one window length applies to each core.
+ */
+
+#include "./TaskProfiler.h"
+#include "./Logger.h"
+#include <ArduinoJson.h>
+#include <esp_idf_version.h>
+#include <string.h>
+
+#if configUSE_TRACE_FACILITY && configGENERATE_RUN_TIME_STATS
+#define TASK_PROFILER_SUPPORTED 1
+#else
+#define TASK_PROFILER_SUPPORTED 0
+#endif
+
+namespace CloudMouse::Utils
+{
+    TaskProfiler::TaskLoad TaskProfiler::tasks[TASK_PROFILER_MAX_TASKS];
+    int TaskProfiler::taskCount = 0;
+    TaskProfiler::Sample TaskProfiler::history[TASK_PROFILER_HISTORY];
+    int TaskProfiler::historyHead = 0;
+    int TaskProfiler::historyCount = 0;
+    uint32_t TaskProfiler::lastTotalRunTime = 0;
+    bool TaskProfiler::hasBaseline = false;
+    portMUX_TYPE TaskProfiler::lock = portMUX_INITIALIZER_UNLOCKED;
+
+#if TASK_PROFILER_SUPPORTED
+    namespace
+    {
+        // Sampling scratch, not on the coordination task stack
+        TaskStatus_t profilerStatus[TASK_PROFILER_MAX_TASKS];
+        TaskProfiler::TaskLoad profilerNext[TASK_PROFILER_MAX_TASKS];
+
+        TaskHandle_t profilerIdleTask(int core)
+        {
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 1, 0)
+            return xTaskGetIdleTaskHandleForCore(core);
+#else
+            return xTaskGetIdleTaskHandleForCPU(core);
+#endif
+        }
+    }
+#endif
+
+    // ============================================================================
+    // SAMPLING
+    // ============================================================================
+
+    bool TaskProfiler::isSupported()
+    {
+        return TASK_PROFILER_SUPPORTED;
+    }
+
+    uint16_t TaskProfiler::permille(uint32_t part, uint32_t whole)
+    {
+        if (whole == 0)
+            return 0;
+        uint64_t value = ((uint64_t)part * 1000 + whole / 2) / whole;
+        return value > 1000 ? 1000 : (uint16_t)value;
+    }
+
+    bool TaskProfiler::sample()
+    {
+#if TASK_PROFILER_SUPPORTED
+        uint32_t totalRunTime = 0;
+        UBaseType_t count = uxTaskGetSystemState(profilerStatus, TASK_PROFILER_MAX_TASKS, &totalRunTime);
+        if (count == 0)
+        {
+            SDK_LOGW(CORE, "⚠️ TaskProfiler: more than %d tasks, raise TASK_PROFILER_MAX_TASKS",
+                     TASK_PROFILER_MAX_TASKS);
+            return false;
+        }
+
+        uint32_t window = totalRunTime - lastTotalRunTime;
+
+        TaskHandle_t idle[CORE_COUNT];
+        for (int c = 0; c < CORE_COUNT; c++)
+            idle[c] = profilerIdleTask(c);
+
+        uint32_t taskTime[CORE_COUNT] = {0, 0};
+        uint32_t idleTime[CORE_COUNT] = {0, 0};
+        uint32_t unpinnedTime = 0;
+
+        for (UBaseType_t i = 0; i < count; i++)
+        {
+            const TaskStatus_t &status = profilerStatus[i];
+            TaskLoad &load = profilerNext[i];
+
+            strncpy(load.name, status.pcTaskName, sizeof(load.name) - 1);
+            load.name[sizeof(load.name) - 1] = '\0';
+            load.handle = status.xHandle;
+#if configTASKLIST_INCLUDE_COREID
+            load.core = status.xCoreID < CORE_COUNT ? (int8_t)status.xCoreID : NO_AFFINITY;
+#else
+            load.core = NO_AFFINITY;
+#endif
+            load.priority = (uint8_t)status.uxCurrentPriority;
+            load.stackFree = (uint32_t)status.usStackHighWaterMark * sizeof(StackType_t);
+            load.runTime = status.ulRunTimeCounter;
+
+            // Tasks created since the last sample count from zero
+            uint32_t delta = load.runTime;
+            for (int p = 0; p < taskCount; p++)
+            {
+                if (tasks[p].handle == load.handle)
+                {
+                    delta = load.runTime - tasks[p].runTime;
+                    break;
+                }
+            }
+            if (delta > window)
+                delta = window;
+            load.cpuPermille = permille(delta, window);
+
+            if (load.handle == idle[0] || load.handle == idle[1])
+                idleTime[load.handle == idle[0] ? 0 : 1] += delta;
+            else if (load.core != NO_AFFINITY)
+                taskTime[load.core] += delta;
+            else
+                unpinnedTime += delta;
+        }
+
+        // Sorted by load (insertion sort, a few dozen entries)
+        for (UBaseType_t i = 1; i < count; i++)
+        {
+            TaskLoad key = profilerNext[i];
+            int j = (int)i - 1;
+            while (j >= 0 && profilerNext[j].cpuPermille < key.cpuPermille)
+            {
+                profilerNext[j + 1] = profilerNext[j];
+                j--;
+            }
+            profilerNext[j + 1] = key;
+        }
+
+        lastTotalRunTime = totalRunTime;
+
+        if (!hasBaseline)
+        {
+            portENTER_CRITICAL(&lock);
+            memcpy(tasks, profilerNext, sizeof(TaskLoad) * count);
+            taskCount = (int)count;
+            portEXIT_CRITICAL(&lock);
+
+            hasBaseline = true;
+            return false;
+        }
+
+        Sample entry;
+        entry.timestampMs = millis();
+        entry.windowUs = window;
+        entry.unpinnedPermille = permille(unpinnedTime, window);
+        entry.taskCount = (uint16_t)count;
+        for (int c = 0; c < CORE_COUNT; c++)
+        {
+            uint32_t accounted = taskTime[c] + idleTime[c];
+            entry.cores[c].taskPermille = permille(taskTime[c], window);
+            entry.cores[c].idlePermille = permille(idleTime[c], window);
+            entry.cores[c].otherPermille = permille(accounted < window ? window - accounted : 0, window);
+        }
+
+        // Table and history change together for getJson()
+        portENTER_CRITICAL(&lock);
+        memcpy(tasks, profilerNext, sizeof(TaskLoad) * count);
+        taskCount = (int)count;
+        history[historyHead] = entry;
+        historyHead = (historyHead + 1) % TASK_PROFILER_HISTORY;
+        if (historyCount < TASK_PROFILER_HISTORY)
+            historyCount++;
+        portEXIT_CRITICAL(&lock);
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    // ============================================================================
+    // ACCESS
+    // ============================================================================
+
+    const TaskProfiler::Sample *TaskProfiler::getSample(int age)
+    {
+        if (age < 0 || age >= historyCount)
+            return nullptr;
+        int index = (historyHead - 1 - age + TASK_PROFILER_HISTORY) % TASK_PROFILER_HISTORY;
+        return &history[index];
+    }
+
+    const TaskProfiler::TaskLoad *TaskProfiler::getTask(int index)
+    {
+        if (index < 0 || index >= taskCount)
+            return nullptr;
+        return &tasks[index];
+    }
+
+    // ============================================================================
+    // REPORTING
+    // ============================================================================
+
+    void TaskProfiler::printReport()
+    {
+        if (!isSupported())
+        {
+            SDK_LOGGER("⚠️ TaskProfiler: FreeRTOS run-time stats are not enabled in this build");
+            return;
+        }
+
+        const Sample *latest = getSample(0);
+        if (!latest)
+        {
+            SDK_LOGGER("📊 TaskProfiler: collecting baseline, try again after the next health check");
+            return;
+        }
+
+        SDK_LOGGER("\n📊 Task CPU load (window %lu ms, %d tasks)", (unsigned long)(latest->windowUs / 1000), latest->taskCount);
+        SDK_LOGGER("  %-16s %4s %4s %7s %8s", "task", "core", "prio", "cpu %", "stack");
+        for (int i = 0; i < taskCount; i++)
+        {
+            const TaskLoad &load = tasks[i];
+            char core[4];
+            if (load.core == NO_AFFINITY)
+                strcpy(core, "-");
+            else
+                snprintf(core, sizeof(core), "%d", load.core);
+
+            SDK_LOGGER("  %-16s %4s %4d %7.1f %8lu", load.name, core, load.priority,
+                       load.cpuPermille / 10.0f, (unsigned long)load.stackFree);
+        }
+
+        SDK_LOGGER("\n📊 Core load history (newest first, %% of window)");
+        SDK_LOGGER("  %8s | %6s %6s %6s | %6s %6s %6s | %8s", "age s",
+                   "c0 task", "idle", "other", "c1 task", "idle", "other", "unpinned");
+        for (int age = 0; age < historyCount; age++)
+        {
+            const Sample *entry = getSample(age);
+            SDK_LOGGER("  %8lu | %6.1f %6.1f %6.1f | %6.1f %6.1f %6.1f | %8.1f",
+                       (unsigned long)((millis() - entry->timestampMs) / 1000),
+                       entry->cores[0].taskPermille / 10.0f, entry->cores[0].idlePermille / 10.0f,
+                       entry->cores[0].otherPermille / 10.0f,
+                       entry->cores[1].taskPermille / 10.0f, entry->cores[1].idlePermille / 10.0f,
+                       entry->cores[1].otherPermille / 10.0f,
+                       entry->unpinnedPermille / 10.0f);
+        }
+        SDK_LOGGER("  'other' = ISRs, scheduler and unpinned tasks (FreeRTOS has no ISR accounting)\n");
+    }
+
+    String TaskProfiler::getJson()
+    {
+        // Runs on the web server task: format a copy, not the live table
+        struct Snapshot
+        {
+            TaskLoad tasks[TASK_PROFILER_MAX_TASKS];
+            Sample history[TASK_PROFILER_HISTORY]; // Newest first
+            int taskCount;
+            int historyCount;
+        };
+
+        Snapshot *copy = (Snapshot *)malloc(sizeof(Snapshot));
+        if (!copy)
+            return "{\"error\":\"out of memory\"}";
+
+        portENTER_CRITICAL(&lock);
+        copy->taskCount = taskCount;
+        memcpy(copy->tasks, tasks, sizeof(TaskLoad) * taskCount);
+        copy->historyCount = historyCount;
+        for (int age = 0; age < historyCount; age++)
+            copy->history[age] = *getSample(age);
+        portEXIT_CRITICAL(&lock);
+
+        uint32_t now = millis();
+
+        JsonDocument doc;
+        doc["supported"] = isSupported();
+        doc["uptime_ms"] = now;
+
+        if (copy->historyCount > 0)
+            doc["window_ms"] = copy->history[0].windowUs / 1000;
+
+        JsonArray taskArray = doc["tasks"].to<JsonArray>();
+        for (int i = 0; i < copy->taskCount; i++)
+        {
+            const TaskLoad &load = copy->tasks[i];
+            JsonObject task = taskArray.add<JsonObject>();
+            task["name"] = load.name;
+            if (load.core == NO_AFFINITY)
+                task["core"] = nullptr;
+            else
+                task["core"] = load.core;
+            task["priority"] = load.priority;
+            task["cpu_pct"] = load.cpuPermille / 10.0f;
+            task["stack_free"] = load.stackFree;
+        }
+
+        JsonArray historyArray = doc["history"].to<JsonArray>();
+        for (int age = 0; age < copy->historyCount; age++)
+        {
+            const Sample *entry = &copy->history[age];
+            JsonObject item = historyArray.add<JsonObject>();
+            item["age_ms"] = now - entry->timestampMs;
+            item["window_ms"] = entry->windowUs / 1000;
+            item["unpinned_pct"] = entry->unpinnedPermille / 10.0f;
+
+            JsonArray cores = item["cores"].to<JsonArray>();
+            for (int c = 0; c < CORE_COUNT; c++)
+            {
+                JsonObject core = cores.add<JsonObject>();
+                core["task_pct"] = entry->cores[c].taskPermille / 10.0f;
+                core["idle_pct"] = entry->cores[c].idlePermille / 10.0f;
+                core["other_pct"] = entry->cores[c].otherPermille / 10.0f;
+            }
+        }
+
+        free(copy);
+
+        String json;
+        serializeJson(doc, json);
+        return json;
+    }
+}
@@ -0,0 +1,135 @@
+/**
+ * CloudMouse SDK - Task CPU and Stack Profiler
+ *
+ * Samples FreeRTOS run-time statistics (uxTaskGetSystemState) and turns the
+ * counter deltas between two samples into CPU load per task and per core.
+ * Core::checkHealth() takes a sample every CORE_HEALTH_CHECK_MS.
+ *
+ * Reported per sample:
+ * - Per task: CPU load (100% = one core fully busy), core affinity, priority,
+ *   remaining stack
+ * - Per core: time spent in tasks pinned to it, idle time, and the remainder
+ *   ("other") that no pinned task accounts for
+ *
+ * Limitations:
+ * - FreeRTOS does not account interrupt time separately: ISR time, context
+ *   switches and tasks without core affinity (reported on their own as
+ *   "unpinned") all end up in "other"
+ * - Requires configUSE_TRACE_FACILITY and configGENERATE_RUN_TIME_STATS in the
+ *   FreeRTOS configuration; without them isSupported() is false and sample()
+ *   does nothing
+ *
+ * History:
+ * - The last TASK_PROFILER_HISTORY per-core summaries are kept in a ring; the
+ *   per-task table reflects the latest sample only
+ *
+ * Thread Safety:
+ * - sample(), printReport(), getSample() and getTask() run in the Core
+ *   coordination task (health check, serial "tasks" command)
+ * - getJson() is called from the web server task (GET /api/metrics/tasks):
+ *   it copies the table and history under a spinlock, which sample() also
+ *   holds while it publishes a new sample, and formats the copy
+ */
+
+#ifndef TASK_PROFILER_H
+#define TASK_PROFILER_H
+
+#include <Arduino.h>
+#include "../config/DeviceConfig.h"
+
+namespace CloudMouse::Utils
+{
+    class TaskProfiler
+    {
+    public:
+        static const int CORE_COUNT = 2;
+        static const int8_t NO_AFFINITY = -1;
+
+        /**
+         * Load of one task over the last sample window
+         */
+        struct TaskLoad
+        {
+            char name[16];
+            TaskHandle_t handle;
+            int8_t core;            // Pinned core, NO_AFFINITY if it may run on both
+            uint8_t priority;
+            uint16_t cpuPermille;   // Of one core
+            uint32_t stackFree;     // Bytes, lowest since the task started
+            uint32_t runTime;       // Run-time counter at the sample (for the next delta)
+        };
+
+        /**
+         * Core load split, permille of the window
+         */
+        struct CoreLoad
+        {
+            uint16_t taskPermille;  // Tasks pinned to this core (idle task excluded)
+            uint16_t idlePermille;  // Idle task of this core
+            uint16_t otherPermille; // ISRs, scheduler and unpinned tasks
+        };
+
+        /**
+         * One history entry
+         */
+        struct Sample
+        {
+            uint32_t timestampMs;
+            uint32_t windowUs;
+            CoreLoad cores[CORE_COUNT];
+            uint16_t unpinnedPermille;  // Unpinned tasks, of one core
+            uint16_t taskCount;
+        };
+
+        /**
+         * Whether the FreeRTOS build provides run-time statistics
+         */
+        static bool isSupported();
+
+        /**
+         * Take a sample and update the history
+         * The first call only records the baseline counters.
+         *
+         * @return true if a new history entry was produced
+         */
+        static bool sample();
+
+        /**
+         * History access
+         * @param age 0 = latest sample, 1 = the one before, ...
+         * @return nullptr if there is no such entry
+         */
+        static const Sample *getSample(int age = 0);
+        static int getHistoryCount() { return historyCount; }
+
+        /**
+         * Per-task table of the latest sample, sorted by CPU load
+         */
+        static int getTaskCount() { return taskCount; }
+        static const TaskLoad *getTask(int index);
+
+        /**
+         * Serial report: latest per-task table and the per-core history
+         */
+        static void printReport();
+
+        /**
+         * Same report as a JSON object (any task)
+         */
+        static String getJson();
+
+    private:
+        static TaskLoad tasks[TASK_PROFILER_MAX_TASKS];
+        static int taskCount;
+        static Sample history[TASK_PROFILER_HISTORY];
+        static int historyHead;
+        static int historyCount;
+        static uint32_t lastTotalRunTime;
+        static bool hasBaseline;
+        static portMUX_TYPE lock;   // Guards tasks/history against getJson()
+
+        static uint16_t permille(uint32_t part, uint32_t whole);
+    };
+}
+
+#endif
@@ -0,0 +1,397 @@
+/**
+ * CloudMouse SDK - On-Device Benchmark Firmware
+ *
+ * Built by the [env:bench] PlatformIO environment (pio run -e bench -t upload)
+ * instead of the demo. Runs every microbenchmark once after boot and prints
+ * one JSON object per line, so results can be collected with a serial capture
+ * and compared between SDK versions:
+ *
+ *   BENCH_BEGIN {"firmware":"3.0.0-alpha","chip":"ESP32-S3",...}
+ *   BENCH {"name":"eventbus.send_receive","unit":"ns","n":256,"min":...,"p50":...,"p95":...,"max":...,"avg":...}
+ *   BENCH {"name":"display.full_refresh.bandwidth","unit":"MB/s","value":...}
+ *   BENCH_END {"duration_ms":...}
+ *
+ * Covered:
+ * - EventBus: same-task send/receive, with payload, cross-core round trip, burst throughput
+ * - DisplayManager: full-screen and partial refresh time and SPI bandwidth
+ * - LEDManager: strip.show() cost (RMT frame encode and start)
+ * - PreferencesManager: cached write and read latency, commit (flush) latency
+ * - JsonHelper: parse time of a representative API response (one-shot,
+ *   reusable JsonParser, filtered, streamed array) and heap churn per parse
+ * - NTPManager: cached-clock time formatting vs getLocalTime() + strftime()
+ *
+ * SDK logging is muted while measuring so the logger task does not compete.
+ * Press reset to run the suite again.
+ */
+
+#if defined(CLOUDMOUSE_BENCH)
+
+#include <Arduino.h>
+#include <algorithm>
+#include <esp_system.h>
+#include "../../lib/utils/Logger.h"
+#include "../../lib/core/EventBus.h"
+#include "../../lib/hardware/DisplayManager.h"
+#include "../../lib/hardware/LEDManager.h"
+#include "../../lib/prefs/PreferencesManager.h"
+#include "../../lib/utils/JsonHelper.h"
+#include "../../lib/utils/NTPManager.h"
+
+using namespace CloudMouse;
+using namespace CloudMouse::Hardware;
+using namespace CloudMouse::Prefs;
+using namespace CloudMouse::Utils;
+
+DisplayManager display;
+LEDManager ledManager;
+PreferencesManager prefs;
+
+namespace
+{
+    // ============================================================================
+    // SAMPLE COLLECTION AND REPORTING
+    // ============================================================================
+
+    const int BENCH_MAX_SAMPLES = 256;
+    uint32_t samples[BENCH_MAX_SAMPLES];
+
+    // ILI9488 over SPI always receives 18-bit pixels (3 bytes)
+    const uint32_t BENCH_WIRE_BYTES_PER_PIXEL = 3;
+
+    inline uint32_t cyclesToNs(uint32_t cycles)
+    {
+        return (uint32_t)(((uint64_t)cycles * 1000) / getCpuFrequencyMhz());
+    }
+
+    /**
+     * Print distribution statistics of samples[0..count)
+     * @return Median, for derived figures
+     */
+    uint32_t reportSamples(const char *name, const char *unit, int count)
+    {
+        if (count <= 0)
+            return 0;
+
+        uint64_t sum = 0;
+        for (int i = 0; i < count; i++)
+            sum += samples[i];
+        std::sort(samples, samples + count);
+
+        uint32_t p50 = samples[count / 2];
+        uint32_t p95 = samples[(count * 95) / 100 < count ? (count * 95) / 100 : count - 1];
+
+        Serial.printf("BENCH {\"name\":\"%s\",\"unit\":\"%s\",\"n\":%d,\"min\":%lu,\"p50\":%lu,\"p95\":%lu,\"max\":%lu,\"avg\":%.1f}\n",
+                      name, unit, count, (unsigned long)samples[0], (unsigned long)p50, (unsigned long)p95,
+                      (unsigned long)samples[count - 1], (double)sum / count);
+        return p50;
+    }
+
+    void reportValue(const char *name, const char *unit, double value)
+    {
+        Serial.printf("BENCH {\"name\":\"%s\",\"unit\":\"%s\",\"value\":%.2f}\n", name, unit, value);
+    }
+
+    void reportSkipped(const char *name, const char *reason)
+    {
+        Serial.printf("BENCH {\"name\":\"%s\",\"skipped\":\"%s\"}\n", name, reason);
+    }
+
+    // ============================================================================
+    // EVENTBUS
+    // ============================================================================
+
+    void benchEchoTask(void *param)
+    {
+        (void)param;
+        Event event;
+        while (true)
+        {
+            if (EventBus::instance().receiveFromMain(event, portMAX_DELAY))
+                EventBus::instance().sendToMain(event);
+        }
+    }
+
+    void benchEventBus()
+    {
+        EventBus &bus = EventBus::instance();
+        Event received;
+
+        // Same task: queue + metrics cost without any context switch
+        for (int i = 0; i < BENCH_MAX_SAMPLES; i++)
+        {
+            Event event(EventType::DISPLAY_CLEAR, i);
+            uint32_t start = ESP.getCycleCount();
+            bus.sendToMain(event);
+            bus.receiveFromUI(received);
+            samples[i] = cyclesToNs(ESP.getCycleCount() - start);
+        }
+        reportSamples("eventbus.send_receive", "ns", BENCH_MAX_SAMPLES);
+
+        // Same, with a 64-byte pooled string payload
+        for (int i = 0; i < BENCH_MAX_SAMPLES; i++)
+        {
+            Event event(EventType::DISPLAY_UPDATE, i);
+            event.setStringData("0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef");
+            uint32_t start = ESP.getCycleCount();
+            bus.sendToMain(event);
+            bus.receiveFromUI(received);
+            samples[i] = cyclesToNs(ESP.getCycleCount() - start);
+        }
+        reportSamples("eventbus.send_receive_payload", "ns", BENCH_MAX_SAMPLES);
+
+        // Cross-core round trip: Core 0 -> echo task on Core 1 -> Core 0
+        TaskHandle_t echo = nullptr;
+        xTaskCreatePinnedToCore(benchEchoTask, "Bench_Echo", 4096, nullptr, 2, &echo, 1);
+        if (!echo)
+        {
+            reportSkipped("eventbus.roundtrip_cross_core", "task creation failed");
+        }
+        else
+        {
+            bus.setUITaskHandle(nullptr);
+            int count = 0;
+            for (int i = 0; i < BENCH_MAX_SAMPLES; i++)
+            {
+                uint32_t start = micros();
+                bus.sendToUI(Event(EventType::DISPLAY_CLEAR, i));
+                if (!bus.receiveFromUI(received, pdMS_TO_TICKS(100)))
+                    continue;
+                samples[count++] = micros() - start;
+            }
+            reportSamples("eventbus.roundtrip_cross_core", "us", count);
+            vTaskDelete(echo);
+        }
+
+        // Burst throughput: fill the normal lane, then drain it
+        const int rounds = 200;
+        uint32_t events = 0;
+        uint32_t start = micros();
+        for (int r = 0; r < rounds; r++)
+        {
+            for (int i = 0; i < EVENT_LANE_NORMAL_SIZE; i++)
+                bus.sendToMain(Event(EventType::DISPLAY_CLEAR, i));
+            while (bus.receiveFromUI(received))
+                events++;
+        }
+        uint32_t elapsed = micros() - start;
+        reportValue("eventbus.throughput", "events/s", elapsed ? events * 1000000.0 / elapsed : 0.0);
+    }
+
+    // ============================================================================
+    // DISPLAY
+    // ============================================================================
+
+    void benchDisplay()
+    {
+        if (!display.isReady())
+        {
+            reportSkipped("display", "not initialized");
+            return;
+        }
+
+        const int fullRuns = 20;
+        for (int i = 0; i < fullRuns; i++)
+            samples[i] = display.measureFullRefresh();
+        uint32_t p50 = reportSamples("display.full_refresh", "us", fullRuns);
+        if (p50)
+        {
+            uint32_t bytes = display.getWidth() * display.getHeight() * BENCH_WIRE_BYTES_PER_PIXEL;
+            reportValue("display.full_refresh.bandwidth", "MB/s", (double)bytes / p50);
+        }
+
+        const int stripeHeight = 40;
+        const int partialRuns = 50;
+        for (int i = 0; i < partialRuns; i++)
+        {
+            int y = (i * stripeHeight) % display.getHeight();
+            samples[i] = display.measureAreaRefresh(0, y, display.getWidth(), stripeHeight);
+        }
+        p50 = reportSamples("display.partial_refresh_480x40", "us", partialRuns);
+        if (p50)
+        {
+            uint32_t bytes = display.getWidth() * stripeHeight * BENCH_WIRE_BYTES_PER_PIXEL;
+            reportValue("display.partial_refresh_480x40.bandwidth", "MB/s", (double)bytes / p50);
+        }
+    }
+
+    // ============================================================================
+    // LEDS, NVS, JSON
+    // ============================================================================
+
+    void benchLEDs()
+    {
+        // Animation task is not started in this firmware: the strip is ours
+        const int runs = 100;
+        for (int i = 0; i < runs; i++)
+            samples[i] = ledManager.measureShow();
+        reportSamples("led.show", "us", runs);
+    }
+
+    void benchPreferences()
+    {
+        const int writes = 20;
+        for (int i = 0; i < writes; i++)
+        {
+            uint32_t start = micros();
+            prefs.save("bench.value", String(i));
+            samples[i] = micros() - start;
+        }
+        reportSamples("prefs.write", "us", writes);
+
+        const int reads = 100;
+        for (int i = 0; i < reads; i++)
+        {
+            uint32_t start = micros();
+            String value = prefs.get("bench.value");
+            samples[i] = micros() - start;
+        }
+        reportSamples("prefs.read", "us", reads);
+
+        // The writes above only reached the RAM mirror: one commit for all of them
+        uint32_t start = micros();
+        prefs.flush();
+        reportValue("prefs.flush", "us", micros() - start);
+        reportValue("prefs.commits", "count", prefs.getCommitCount());
+    }
+
+    void benchJson()
+    {
+        // Shape of a typical backend response: metadata plus a list of items
+        String payload = "{\"status\":\"ok\",\"device\":\"cloudmouse\",\"ts\":1700000000,\"items\":[";
+        for (int i = 0; i < 12; i++)
+        {
+            if (i)
+                payload += ",";
+            payload += "{\"id\":" + String(i) + ",\"name\":\"item-" + String(i) +
+                       "\",\"value\":" + String(i * 3.5f, 1) + ",\"enabled\":true}";
+        }
+        payload += "]}";
+
+        const int runs = 50;
+        const char *data = payload.c_str();
+        size_t length = payload.length();
+
+        // One-shot: new document per message
+        for (int i = 0; i < runs; i++)
+        {
+            uint32_t start = micros();
+            JsonDocument doc = JsonHelper::parseJson(data, length);
+            samples[i] = micros() - start;
+        }
+        reportSamples("json.parse_1k", "us", runs);
+
+        // Reused parser: document and arena survive between messages
+        JsonParser parser;
+        for (int i = 0; i < runs; i++)
+        {
+            uint32_t start = micros();
+            parser.parse(data, length);
+            samples[i] = micros() - start;
+        }
+        reportSamples("json.parse_1k.reuse", "us", runs);
+
+        // Filtered: only status and the item ids are stored
+        JsonDocument filter;
+        filter["status"] = true;
+        filter["items"][0]["id"] = true;
+        for (int i = 0; i < runs; i++)
+        {
+            uint32_t start = micros();
+            parser.parse(data, length, filter);
+            samples[i] = micros() - start;
+        }
+        reportSamples("json.parse_1k.filtered", "us", runs);
+
+        // Streamed: one item at a time
+        for (int i = 0; i < runs; i++)
+        {
+            int sum = 0;
+            uint32_t start = micros();
+            parser.forEach(data, length, "items", [&sum](JsonVariantConst item, size_t)
+                           {
+                sum += item["id"].as<int>();
+                return true; });
+            samples[i] = micros() - start;
+        }
+        reportSamples("json.parse_1k.stream", "us", runs);
+
+        // Heap churn of the reused parser: zero fallbacks means no heap allocation per message
+        reportValue("json.arena.high_water", "B", parser.getArena().getHighWater());
+        reportValue("json.arena.fallbacks", "count", parser.getArena().getFallbackCount());
+        reportValue("json.parse_1k.bytes", "B", payload.length());
+    }
+
+    void benchTime()
+    {
+        // No WiFi here: set a plausible clock, NTPManager picks it up like after a restart
+        struct timeval now = {1735689600, 0}; // 2025-01-01 00:00:00 UTC
+        settimeofday(&now, nullptr);
+
+        const int runs = 200;
+        char text[NTPManager::TIME_BUFFER_SIZE];
+        for (int i = 0; i < runs; i++)
+        {
+            uint32_t start = ESP.getCycleCount();
+            NTPManager::formatTime(text, sizeof(text));
+            samples[i] = cyclesToNs(ESP.getCycleCount() - start);
+        }
+        reportSamples("time.format_time", "ns", runs);
+
+        // What a clock label did before: getLocalTime() + strftime() into a String
+        for (int i = 0; i < runs; i++)
+        {
+            uint32_t start = ESP.getCycleCount();
+            struct tm timeinfo;
+            getLocalTime(&timeinfo);
+            strftime(text, sizeof(text), "%H:%M:%S", &timeinfo);
+            String label(text);
+            samples[i] = cyclesToNs(ESP.getCycleCount() - start);
+        }
+        reportSamples("time.localtime_strftime", "ns", runs);
+    }
+}
+
+// ============================================================================
+// ARDUINO ENTRY POINTS
+// ============================================================================
+
+void setup()
+{
+    Serial.begin(115200);
+    AsyncLogger::begin();
+    delay(2000); // USB CDC enumeration
+
+    EventBus::instance().initialize();
+    prefs.init();
+    display.init();
+    ledManager.init();
+    AsyncLogger::flush(1000);
+
+    // Mute SDK logging during the measurements
+    AsyncLogger::setModuleMask(0);
+
+    uint32_t suiteStart = millis();
+    Serial.printf("BENCH_BEGIN {\"firmware\":\"%s\",\"chip\":\"%s\",\"cpu_mhz\":%lu,\"psram\":%lu,\"idf\":\"%s\"}\n",
+                  FIRMWARE_VERSION, ESP.getChipModel(), (unsigned long)getCpuFrequencyMhz(),
+                  (unsigned long)ESP.getPsramSize(), esp_get_idf_version());
+
+    benchEventBus();
+    benchDisplay();
+    benchLEDs();
+    benchPreferences();
+    benchJson();
+    benchTime();
+
+    Serial.printf("BENCH_END {\"duration_ms\":%lu}\n", (unsigned long)(millis() - suiteStart));
+    Serial.flush();
+
+    AsyncLogger::setModuleMask(LOG_MODULE_MASK);
+}
+
+void loop()
+{
+    // Single run per boot
+    vTaskDelete(NULL);
+}
+
+#endif // CLOUDMOUSE_BENCH
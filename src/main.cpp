@@ -20,6 +20,7 @@
 // #include "../lib/network/WebServerManager.h"
 // #include "../lib/hardware/LEDManager.h"
 // #include "../lib/utils/Logger.h"
+// #include "../lib/utils/BootProfiler.h"
 
 // using namespace CloudMouse;
 
@@ -32,6 +33,7 @@
 
 // void setup() {
 //     Serial.begin(115200);
+//     Utils::AsyncLogger::begin();   // Deferred log formatting on Core 0
 //     delay(1000);
 
 //     // Welcome message
@@ -39,11 +41,14 @@
 //     SDK_LOGGER("🚀 CloudMouse SDK Boilerplate v1.0");
 //     SDK_LOGGER("   Ready to build something amazing! 🎯");
     
-//     // Initialize hardware components
+//     // Initialize the fast hardware components
 //     SimpleBuzzer::init();
+//     Utils::BootProfiler::begin("encoder.init");
 //     encoder.init();
-//     display.init();
+//     Utils::BootProfiler::end("encoder.init");
+//     Utils::BootProfiler::begin("led.init");
 //     ledManager.init();
+//     Utils::BootProfiler::end("led.init");
 
 //     // Register components with the Core event system
 //     Core::instance().setEncoder(&encoder);
@@ -52,16 +57,17 @@
 //     Core::instance().setWebServer(&webServer);
 //     Core::instance().setLEDManager(&ledManager);
 
-//     // Start dual-core operation
-//     Core::instance().startUITask();     // UI rendering on Core 1
-//     Core::instance().initialize();      // Event system on Core 0
-    
+//     // Start dual-core operation: WiFi associates on Core 0 while the display
+//     // and LVGL come up here on Core 1
+//     Core::instance().initialize();      // Event system and settings
+//     Core::instance().startCoordinationTask(); // Event-driven coordination on Core 0, starts WiFi
+//     display.init();                     // LGFX, LVGL buffers, UI
+//     Core::instance().startUITask();     // UI rendering on Core 1, ends the boot screen
+
 //     SDK_LOGGER("✅ System ready!");
 // }
 
 // void loop() {
-//     // Main coordination loop (20Hz on Core 0)
-//     // Core 1 handles UI independently for smooth performance
-//     Core::instance().coordinationLoop();
-//     delay(50);
+//     // Core and UI work runs in their own FreeRTOS tasks: free the loop task
+//     vTaskDelete(NULL);
 // }
\ No newline at end of file
@@ -0,0 +1,342 @@
+/**
+ * CloudMouse SDK - Host Simulator Input Implementation
+ */
+
+#if defined(CLOUDMOUSE_SIM)
+
+#include "./SimInput.h"
+#include "../../lib/core/EventBus.h"
+#include "../../lib/core/EventMetrics.h"
+#include "../../lib/hardware/EncoderManager.h"
+#include "../../lib/utils/Logger.h"
+#include <algorithm>
+#include <stdarg.h>
+
+#if __has_include(<SDL2/SDL.h>)
+#include <SDL2/SDL.h>
+#else
+#include <SDL.h>
+#endif
+
+namespace CloudMouse::Sim
+{
+    // Scripted click: release after this long (well under CLICK_TIMEOUT)
+    static const uint32_t SIM_CLICK_HOLD_MS = 80;
+    // Scripted long press: held past EncoderManager's 1000 ms threshold, released before ultra-long (3000 ms)
+    static const uint32_t SIM_LONG_PRESS_HOLD_MS = 1100;
+
+    // Arrow key auto-repeat
+    static const uint32_t SIM_REPEAT_DELAY_MS = 300;
+    static const uint32_t SIM_REPEAT_PERIOD_MS = 40;
+
+    // Detents of one Up/Down spin
+    static const int SIM_SPIN_DETENTS = 5;
+
+    enum SimKey
+    {
+        KEY_LEFT,
+        KEY_RIGHT,
+        KEY_DOWN,
+        KEY_UP,
+        KEY_BUTTON,
+        KEY_PROFILER,
+        KEY_METRICS,
+        KEY_RESET,
+        KEY_COUNT
+    };
+
+    static const SDL_Scancode simKeyCodes[KEY_COUNT] = {
+        SDL_SCANCODE_LEFT, SDL_SCANCODE_RIGHT, SDL_SCANCODE_DOWN, SDL_SCANCODE_UP,
+        SDL_SCANCODE_SPACE, SDL_SCANCODE_P, SDL_SCANCODE_M, SDL_SCANCODE_R};
+
+    static_assert(KEY_COUNT <= 8, "SimInput::keyDown holds one flag per key");
+
+    SimInput::~SimInput()
+    {
+        if (recordFile)
+            fclose(recordFile);
+    }
+
+    // ============================================================================
+    // TRACE FILES
+    // ============================================================================
+
+    bool SimInput::openTrace(const char *path)
+    {
+        FILE *file = fopen(path, "r");
+        if (!file)
+        {
+            SDK_LOGGER("❌ Cannot open input trace %s", path);
+            return false;
+        }
+
+        actions.clear();
+        char line[160];
+        int lineNumber = 0;
+        while (fgets(line, sizeof(line), file))
+        {
+            lineNumber++;
+            parseLine(line, lineNumber);
+        }
+        fclose(file);
+
+        // click / long expand into two actions: keep replay order by time
+        std::stable_sort(actions.begin(), actions.end(),
+                         [](const Action &a, const Action &b) { return a.timeMs < b.timeMs; });
+
+        if (actions.empty())
+        {
+            SDK_LOGGER("❌ Input trace %s has no actions", path);
+            return false;
+        }
+
+        nextAction = 0;
+        replaying = true;
+        SDK_LOGGER("🎬 Replaying %u input actions from %s (%lu ms)", (unsigned)actions.size(), path,
+                   (unsigned long)actions.back().timeMs);
+        return true;
+    }
+
+    bool SimInput::openRecord(const char *path)
+    {
+        recordFile = fopen(path, "w");
+        if (!recordFile)
+        {
+            SDK_LOGGER("❌ Cannot create input trace %s", path);
+            return false;
+        }
+
+        fprintf(recordFile, "# CloudMouse simulator input trace: t_ms action [value]\n");
+        SDK_LOGGER("⏺️ Recording input to %s", path);
+        return true;
+    }
+
+    bool SimInput::parseLine(const char *line, int lineNumber)
+    {
+        char text[160];
+        strncpy(text, line, sizeof(text) - 1);
+        text[sizeof(text) - 1] = '\0';
+
+        char *comment = strchr(text, '#');
+        if (comment)
+            *comment = '\0';
+
+        unsigned long timeMs = 0;
+        char verb[32] = {0};
+        char name[48] = {0};
+        long value = 0;
+        unsigned long count = 1;
+
+        int fields = sscanf(text, "%lu %31s", &timeMs, verb);
+        if (fields <= 0)
+            return false; // Blank or comment-only line
+
+        Action action = {(uint32_t)timeMs, ActionKind::PRESS, EventType::COUNT, 0, 1};
+        bool valid = fields == 2;
+
+        if (valid && strcmp(verb, "rotate") == 0)
+        {
+            valid = sscanf(text, "%lu %31s %ld", &timeMs, verb, &value) == 3 && value != 0;
+            action.kind = ActionKind::ROTATE;
+            action.value = (int32_t)value;
+            if (valid)
+                actions.push_back(action);
+        }
+        else if (valid && strcmp(verb, "press") == 0)
+        {
+            actions.push_back(action);
+        }
+        else if (valid && strcmp(verb, "release") == 0)
+        {
+            action.kind = ActionKind::RELEASE;
+            actions.push_back(action);
+        }
+        else if (valid && (strcmp(verb, "click") == 0 || strcmp(verb, "long") == 0))
+        {
+            uint32_t holdMs = verb[0] == 'c' ? SIM_CLICK_HOLD_MS : SIM_LONG_PRESS_HOLD_MS;
+            actions.push_back(action);
+            action.kind = ActionKind::RELEASE;
+            action.timeMs += holdMs;
+            actions.push_back(action);
+        }
+        else if (valid && strcmp(verb, "event") == 0)
+        {
+            int eventFields = sscanf(text, "%lu %31s %47s %ld %lu", &timeMs, verb, name, &value, &count);
+            valid = eventFields >= 3 && findEventType(name, action.eventType) && count > 0;
+            action.kind = ActionKind::EVENT;
+            action.value = (int32_t)value;
+            action.count = (uint32_t)count;
+            if (valid)
+                actions.push_back(action);
+        }
+        else
+        {
+            valid = false;
+        }
+
+        if (!valid)
+            SDK_LOGGER("⚠️ Input trace line %d ignored: %s", lineNumber, line);
+        return valid;
+    }
+
+    bool SimInput::findEventType(const char *name, EventType &type)
+    {
+        for (int i = 0; i < EventMetrics::TYPE_COUNT; i++)
+        {
+            if (strcmp(EventMetrics::typeName((EventType)i), name) == 0)
+            {
+                type = (EventType)i;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void SimInput::record(const char *format, ...)
+    {
+        if (!recordFile)
+            return;
+
+        fprintf(recordFile, "%lu ", (unsigned long)(millis() - startMs));
+        va_list args;
+        va_start(args, format);
+        vfprintf(recordFile, format, args);
+        va_end(args);
+        fputc('\n', recordFile);
+        fflush(recordFile);
+    }
+
+    // ============================================================================
+    // INPUT
+    // ============================================================================
+
+    void SimInput::poll()
+    {
+        uint32_t now = millis();
+        if (!started)
+        {
+            startMs = now;
+            started = true;
+        }
+
+        if (!replaying)
+        {
+            pollKeyboard(now);
+            return;
+        }
+
+        while (nextAction < actions.size() && actions[nextAction].timeMs <= now - startMs)
+        {
+            apply(actions[nextAction]);
+            nextAction++;
+        }
+    }
+
+    uint32_t SimInput::getNextDeadlineMs() const
+    {
+        if (!replaying || nextAction >= actions.size())
+            return UINT32_MAX;
+        if (!started)
+            return 0;
+
+        uint32_t elapsed = millis() - startMs;
+        uint32_t due = actions[nextAction].timeMs;
+        return due > elapsed ? due - elapsed : 0;
+    }
+
+    void SimInput::apply(const Action &action)
+    {
+        switch (action.kind)
+        {
+        case ActionKind::ROTATE:
+            rotate(action.value);
+            break;
+
+        case ActionKind::PRESS:
+            setButton(true);
+            break;
+
+        case ActionKind::RELEASE:
+            setButton(false);
+            break;
+
+        case ActionKind::EVENT:
+        {
+            // Storms go through sendToUI() like any producer: a full queue drops, and the metrics show it
+            uint32_t sent = 0;
+            for (uint32_t i = 0; i < action.count; i++)
+            {
+                if (EventBus::instance().sendToUI(Event(action.eventType, action.value)))
+                    sent++;
+            }
+            SDK_LOGD(EVENTBUS, "🎬 %s x%lu (%lu queued)", EventMetrics::typeName(action.eventType),
+                     (unsigned long)action.count, (unsigned long)sent);
+            break;
+        }
+        }
+    }
+
+    void SimInput::pollKeyboard(uint32_t now)
+    {
+        const Uint8 *keys = SDL_GetKeyboardState(nullptr);
+        if (!keys)
+            return;
+
+        bool down[KEY_COUNT];
+        bool pressed[KEY_COUNT];
+        for (int i = 0; i < KEY_COUNT; i++)
+        {
+            down[i] = keys[simKeyCodes[i]] != 0;
+            pressed[i] = down[i] && !keyDown[i];
+        }
+
+        if (pressed[KEY_LEFT] || pressed[KEY_RIGHT])
+        {
+            rotate(pressed[KEY_LEFT] ? -1 : 1);
+            repeatAtMs = now + SIM_REPEAT_DELAY_MS;
+        }
+        else if ((down[KEY_LEFT] || down[KEY_RIGHT]) && (int32_t)(now - repeatAtMs) >= 0)
+        {
+            rotate(down[KEY_LEFT] ? -1 : 1);
+            repeatAtMs = now + SIM_REPEAT_PERIOD_MS;
+        }
+
+        if (pressed[KEY_DOWN])
+            rotate(-SIM_SPIN_DETENTS);
+        if (pressed[KEY_UP])
+            rotate(SIM_SPIN_DETENTS);
+
+        if (down[KEY_BUTTON] != keyDown[KEY_BUTTON])
+            setButton(down[KEY_BUTTON]);
+
+        if (pressed[KEY_PROFILER])
+            EventBus::instance().sendToUI(Event(EventType::DISPLAY_PROFILER_REPORT));
+        if (pressed[KEY_METRICS])
+            EventBus::instance().logMetrics();
+        if (pressed[KEY_RESET])
+        {
+            EventBus::instance().resetMetrics();
+            SDK_LOGGER("🔄 EventBus metrics reset");
+        }
+
+        for (int i = 0; i < KEY_COUNT; i++)
+            keyDown[i] = down[i];
+    }
+
+    void SimInput::rotate(int detents)
+    {
+        int8_t direction = detents < 0 ? -1 : 1;
+        for (int i = 0; i < detents * direction; i++)
+            RotaryEncoderPCNT::simDetent(direction);
+        record("rotate %d", detents);
+    }
+
+    void SimInput::setButton(bool pressed)
+    {
+        // Active low, like the encoder switch
+        simSetPinLevel(ENCODER_SW_PIN, pressed ? LOW : HIGH);
+        record(pressed ? "press" : "release");
+    }
+}
+
+#endif // CLOUDMOUSE_SIM
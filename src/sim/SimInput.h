@@ -0,0 +1,106 @@
+/**
+ * CloudMouse SDK - Host Simulator Input
+ *
+ * Drives the real EncoderManager from the keyboard or from a scripted input
+ * trace: detents go through the simulated RotaryEncoderPCNT detent callback
+ * and the button through the simulated SW pin, so click, double click, long
+ * press, press-and-rotate and acceleration come out of the same state machine
+ * as on the device.
+ *
+ * Keyboard (SDL window focused):
+ * - Left / Right: one detent (held: auto-repeat)
+ * - Down / Up: a fast 5-detent spin (exercises the acceleration curve)
+ * - Space: encoder button (hold for long press, rotate while held)
+ * - P: frame profiler report, M: EventBus metrics, R: reset EventBus metrics
+ *
+ * Trace format (one action per line, '#' starts a comment):
+ *   <t_ms> rotate <detents>                 signed, all at t_ms
+ *   <t_ms> press | release                  button edges
+ *   <t_ms> click                            press, release 80 ms later
+ *   <t_ms> long                             press held 1100 ms (long press)
+ *   <t_ms> event <TYPE> [value] [count]     sendToUI() count copies (event storms)
+ * TYPE is the EventMetrics name, e.g. DISPLAY_UPDATE. Times are relative to
+ * the start of the replay. --record writes keyboard input in the same format,
+ * so a session can be replayed exactly.
+ */
+
+#ifndef CLOUDMOUSE_SIM_INPUT_H
+#define CLOUDMOUSE_SIM_INPUT_H
+
+#include <Arduino.h>
+#include <vector>
+#include "../../lib/core/Events.h"
+
+namespace CloudMouse::Sim
+{
+    class SimInput
+    {
+    public:
+        ~SimInput();
+
+        /**
+         * Replay a trace instead of reading the keyboard
+         * @return false if the file cannot be read or has no valid action
+         */
+        bool openTrace(const char *path);
+
+        /**
+         * Write keyboard input to a trace file
+         */
+        bool openRecord(const char *path);
+
+        /**
+         * Apply every input due by now (UI loop, once per cycle)
+         */
+        void poll();
+
+        bool isReplaying() const { return replaying; }
+        bool isTraceFinished() const { return replaying && nextAction >= actions.size(); }
+
+        /**
+         * Milliseconds until the next trace action, UINT32_MAX if none is pending
+         */
+        uint32_t getNextDeadlineMs() const;
+
+    private:
+        enum class ActionKind : uint8_t
+        {
+            ROTATE,
+            PRESS,
+            RELEASE,
+            EVENT
+        };
+
+        struct Action
+        {
+            uint32_t timeMs;
+            ActionKind kind;
+            EventType eventType;
+            int32_t value;
+            uint32_t count;
+        };
+
+        std::vector<Action> actions;
+        size_t nextAction = 0;
+        bool replaying = false;
+        bool started = false;
+        uint32_t startMs = 0; // millis() of the first poll: trace time 0
+
+        FILE *recordFile = nullptr;
+
+        // Keyboard state of the previous poll and auto-repeat timing
+        bool keyDown[8] = {false};
+        uint32_t repeatAtMs = 0;
+
+        bool parseLine(const char *line, int lineNumber);
+        void apply(const Action &action);
+        void pollKeyboard(uint32_t now);
+        void rotate(int detents);
+        void setButton(bool pressed);
+        void record(const char *format, ...) __attribute__((format(printf, 2, 3)));
+
+        static bool findEventType(const char *name, EventType &type);
+    };
+}
+
+#endif
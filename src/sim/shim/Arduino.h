@@ -0,0 +1,195 @@
+/**
+ * CloudMouse SDK - Host Simulator Arduino Shim
+ *
+ * The subset of the Arduino-ESP32 core the simulated SDK modules use, backed
+ * by the C++ standard library: time base, String, Serial (stdout), ESP chip
+ * queries and GPIO. Only on the include path of [env:native].
+ *
+ * GPIO:
+ * - Pin levels live in a table; simSetPinLevel() changes one and runs the
+ *   interrupt handler attached with attachInterruptArg(), which is how the
+ *   simulated encoder button reaches EncoderManager
+ */
+
+#ifndef CLOUDMOUSE_SIM_ARDUINO_H
+#define CLOUDMOUSE_SIM_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+#include <string>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_attr.h"
+
+// ============================================================================
+// TIME BASE
+// ============================================================================
+
+// Milliseconds / microseconds since simulator start (steady clock)
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+
+// ============================================================================
+// GPIO
+// ============================================================================
+
+#define LOW 0
+#define HIGH 1
+
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t level);
+int digitalRead(uint8_t pin);
+void attachInterruptArg(uint8_t pin, void (*handler)(void *), void *arg, int mode);
+void detachInterrupt(uint8_t pin);
+
+// Drive an input pin from the simulator; fires its interrupt on a level change
+void simSetPinLevel(uint8_t pin, int level);
+
+// ============================================================================
+// STRING
+// ============================================================================
+
+class String
+{
+public:
+    String() {}
+    String(const char *str) : data(str ? str : "") {}
+    String(const std::string &str) : data(str) {}
+    String(char c) : data(1, c) {}
+    String(int value) : data(std::to_string(value)) {}
+    String(unsigned int value) : data(std::to_string(value)) {}
+    String(long value) : data(std::to_string(value)) {}
+    String(unsigned long value) : data(std::to_string(value)) {}
+
+    const char *c_str() const { return data.c_str(); }
+    unsigned int length() const { return (unsigned int)data.length(); }
+    bool isEmpty() const { return data.empty(); }
+    void reserve(unsigned int size) { data.reserve(size); }
+
+    int indexOf(char c, unsigned int from = 0) const
+    {
+        size_t index = data.find(c, from);
+        return index == std::string::npos ? -1 : (int)index;
+    }
+
+    int indexOf(const char *str, unsigned int from = 0) const
+    {
+        size_t index = data.find(str, from);
+        return index == std::string::npos ? -1 : (int)index;
+    }
+
+    String substring(unsigned int from) const { return from < data.length() ? String(data.substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const
+    {
+        if (from >= data.length() || to <= from)
+            return String();
+        return String(data.substr(from, to - from));
+    }
+
+    bool startsWith(const char *prefix) const { return data.compare(0, strlen(prefix), prefix) == 0; }
+    bool equals(const char *str) const { return data == str; }
+    int toInt() const { return atoi(data.c_str()); }
+    char operator[](unsigned int index) const { return index < data.length() ? data[index] : '\0'; }
+
+    bool concat(const char *str) { data += str ? str : ""; return true; }
+    bool concat(char c) { data += c; return true; }
+    String &operator+=(const String &other) { data += other.data; return *this; }
+    String &operator+=(const char *str) { concat(str); return *this; }
+    String &operator+=(char c) { data += c; return *this; }
+
+    bool operator==(const String &other) const { return data == other.data; }
+    bool operator==(const char *str) const { return data == (str ? str : ""); }
+    bool operator!=(const String &other) const { return data != other.data; }
+    bool operator!=(const char *str) const { return !(*this == str); }
+
+    // Print-style writer interface (ArduinoJson serializeJson(doc, string))
+    size_t write(uint8_t c) { data += (char)c; return 1; }
+    size_t write(const uint8_t *buffer, size_t size) { data.append((const char *)buffer, size); return size; }
+
+private:
+    std::string data;
+};
+
+inline String operator+(const String &a, const String &b) { String out(a); out += b; return out; }
+inline String operator+(const String &a, const char *b) { String out(a); out += b; return out; }
+inline String operator+(const char *a, const String &b) { String out(a); out += b; return out; }
+inline String operator+(const String &a, char b) { String out(a); out += b; return out; }
+
+// ============================================================================
+// SERIAL (stdout)
+// ============================================================================
+
+class HostSerial
+{
+public:
+    void begin(unsigned long) {}
+    void end() {}
+    operator bool() const { return true; }
+    int available() { return 0; }
+    int read() { return -1; }
+    void flush() { fflush(stdout); }
+
+    size_t write(uint8_t c) { return fwrite(&c, 1, 1, stdout); }
+    size_t write(const uint8_t *buffer, size_t size) { return fwrite(buffer, 1, size, stdout); }
+
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)))
+    {
+        va_list args;
+        va_start(args, format);
+        int written = vprintf(format, args);
+        va_end(args);
+        return written > 0 ? (size_t)written : 0;
+    }
+
+    size_t print(const char *str) { return fputs(str, stdout) >= 0 ? strlen(str) : 0; }
+    size_t print(const String &str) { return print(str.c_str()); }
+    size_t print(int value) { return printf("%d", value); }
+    size_t print(unsigned long value) { return printf("%lu", value); }
+    size_t println() { return print("\n"); }
+    size_t println(const char *str) { return print(str) + println(); }
+    size_t println(const String &str) { return println(str.c_str()); }
+    size_t println(int value) { return print(value) + println(); }
+    size_t println(unsigned long value) { return print(value) + println(); }
+};
+
+extern HostSerial Serial;
+
+// ============================================================================
+// CHIP QUERIES
+// ============================================================================
+
+class HostESP
+{
+public:
+    uint64_t getEfuseMac();
+    uint32_t getFreeHeap() { return 0; }
+    uint32_t getMinFreeHeap() { return 0; }
+    uint32_t getHeapSize() { return 0; }
+    uint32_t getFreePsram() { return 0; }
+    uint32_t getPsramSize() { return 0; }
+    const char *getChipModel() { return "host"; }
+    uint8_t getChipRevision() { return 0; }
+    uint32_t getCpuFreqMHz() { return 0; }
+    uint32_t getFlashChipSize() { return 0; }
+    void restart();
+};
+
+extern HostESP ESP;
+
+#endif
@@ -0,0 +1,92 @@
+/**
+ * CloudMouse SDK - Host Simulator Display
+ *
+ * SDL window with the LGFX_ILI9488 interface, included by LGFX_ILI9488.h
+ * when CLOUDMOUSE_SIM is set, so DisplayManager builds and flushes unchanged:
+ * - 480x320 lgfx::Panel_sdl, shown at 2x (CLOUDMOUSE_SIM_SCALE)
+ * - writeNativeRGB666() takes the same LVGL RGB888 (B,G,R bytes) buffers as
+ *   the panel does in native RGB666 mode
+ * - Backlight fades complete instantly but report their duration, so the
+ *   dimmer state machine times out as on the device
+ *
+ * Flush times measure SDL texture updates, not SPI transfers: compare them
+ * with each other, not with device numbers.
+ */
+
+#ifndef LGFX_SIM_H
+#define LGFX_SIM_H
+
+#include <LovyanGFX.hpp>
+#include "../../../lib/utils/Logger.h"
+
+#ifndef CLOUDMOUSE_SIM_SCALE
+#define CLOUDMOUSE_SIM_SCALE 2
+#endif
+
+class LGFX_ILI9488 : public lgfx::LGFX_Device {
+    lgfx::Panel_sdl _panel_instance;
+
+    bool _native_rgb666 = false;
+    unsigned long _fade_end_ms = 0;
+
+public:
+    LGFX_ILI9488(void) {
+        auto panel_cfg = _panel_instance.config();
+        panel_cfg.memory_width = 480;
+        panel_cfg.memory_height = 320;
+        panel_cfg.panel_width = 480;
+        panel_cfg.panel_height = 320;
+        panel_cfg.offset_x = 0;
+        panel_cfg.offset_y = 0;
+        panel_cfg.offset_rotation = 0;
+        _panel_instance.config(panel_cfg);
+
+        _panel_instance.setWindowTitle("CloudMouse simulator");
+        _panel_instance.setScaling(CLOUDMOUSE_SIM_SCALE, CLOUDMOUSE_SIM_SCALE);
+        setPanel(&_panel_instance);
+    }
+
+    void setMyRotation(uint8_t rot = 0) { setRotation(rot & 3); }
+
+    void setNativeRGB666(bool enabled) { _native_rgb666 = enabled; }
+
+    /**
+     * Push an LVGL RGB888 buffer (B,G,R bytes per pixel) to the window
+     * Same contract as the device: caller holds the bus, use_dma is ignored.
+     */
+    void writeNativeRGB666(int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t* data, bool use_dma, int32_t stride = 0) {
+        (void)use_dma;
+        if (stride == 0) {
+            stride = w;
+        }
+        for (int32_t row = 0; row < h; row++) {
+            pushImage(x, y + row, w, 1, (const lgfx::rgb888_t*)(data + row * stride * 3));
+        }
+    }
+
+    bool fadeBrightness(uint8_t brightness, uint32_t duration_ms) {
+        setBrightness(brightness);
+        _fade_end_ms = millis() + duration_ms;
+        return true;
+    }
+
+    uint32_t fadeRemainingMs() const {
+        long remaining = (long)(_fade_end_ms - millis());
+        return remaining > 0 ? (uint32_t)remaining : 0;
+    }
+
+    bool isFading() const { return fadeRemainingMs() > 0; }
+
+    void init() {
+        begin();
+        setMyRotation();
+        fillScreen(TFT_BLACK);
+        setBrightness(100);
+
+        SDK_LOGGER("✅ Simulated display initialized (SDL, %dx scale)", CLOUDMOUSE_SIM_SCALE);
+        SDK_LOGGER("   Resolution: 480x320 pixels\n");
+        SDK_LOGGER("   Color depth: %s\n", _native_rgb666 ? "24-bit RGB888 (native path)" : "16-bit RGB565");
+    }
+};
+
+#endif
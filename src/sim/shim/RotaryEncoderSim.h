@@ -0,0 +1,80 @@
+/**
+ * CloudMouse SDK - Host Simulator Rotary Encoder
+ *
+ * Stands in for RotaryEncoderPCNT when EncoderManager is built for the host
+ * simulator: instead of a PCNT unit, detents are injected by the simulator
+ * input layer (SimInput) and reach EncoderManager through the same detent
+ * callback the PCNT limit interrupt would call. Button edges go through the
+ * simulated GPIO table (simSetPinLevel), so the whole gesture state machine
+ * runs unchanged.
+ */
+
+#ifndef ROTARY_ENCODER_SIM_H
+#define ROTARY_ENCODER_SIM_H
+
+#include <Arduino.h>
+
+class RotaryEncoderPCNT
+{
+public:
+    typedef void (*DetentCallback)(int8_t direction, void *arg);
+
+    RotaryEncoderPCNT(int a, int b, int start_pos = 0, uint16_t glitch_ns = 1000)
+        : offset(start_pos)
+    {
+        (void)a;
+        (void)b;
+        (void)glitch_ns;
+    }
+
+    ~RotaryEncoderPCNT() { deinit(); }
+
+    void init() { active() = this; }
+
+    void deinit()
+    {
+        if (active() == this)
+            active() = nullptr;
+    }
+
+    int position() const { return offset + count; }
+    void setPosition(int pos) { offset = pos - count; }
+    void zero() { offset = -count; }
+
+    void setDetentCallback(DetentCallback callback, void *arg, int16_t countsPerDetent = 4)
+    {
+        detentCallback = callback;
+        detentArg = arg;
+        detentCounts = countsPerDetent;
+    }
+
+    /**
+     * Turn the initialized encoder by one detent (+1 clockwise, -1 counter-clockwise)
+     * Called from the simulator input layer in place of the PCNT interrupt.
+     */
+    static void simDetent(int8_t direction)
+    {
+        RotaryEncoderPCNT *encoder = active();
+        if (!encoder)
+            return;
+
+        encoder->count += direction * encoder->detentCounts;
+        if (encoder->detentCallback)
+            encoder->detentCallback(direction, encoder->detentArg);
+    }
+
+private:
+    int offset = 0;
+    int count = 0;
+    DetentCallback detentCallback = nullptr;
+    void *detentArg = nullptr;
+    int16_t detentCounts = 4;
+
+    static RotaryEncoderPCNT *&active()
+    {
+        static RotaryEncoderPCNT *instance = nullptr;
+        return instance;
+    }
+};
+
+#endif
@@ -0,0 +1,403 @@
+/**
+ * CloudMouse SDK - Host Simulator Platform Implementation
+ *
+ * Backing for the shim headers in this directory: time base, GPIO table,
+ * FreeRTOS tasks, notifications, queues and semaphores on the C++ standard
+ * library.
+ */
+
+#if defined(CLOUDMOUSE_SIM)
+
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <esp_system.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <pthread.h>
+
+HostSerial Serial;
+HostESP ESP;
+
+namespace
+{
+    const std::chrono::steady_clock::time_point simStart = std::chrono::steady_clock::now();
+
+    // Fake factory MAC: stable device ID, AP SSID and UUID between runs
+    const uint64_t SIM_EFUSE_MAC = 0x0000E2F4A31224ULL;
+
+    // Waits with a FreeRTOS tick count (1 tick = 1 ms, portMAX_DELAY = forever)
+    template <typename Lock, typename Predicate>
+    bool waitTicks(std::condition_variable &signal, Lock &lock, TickType_t ticks, Predicate ready)
+    {
+        if (ticks == portMAX_DELAY)
+        {
+            signal.wait(lock, ready);
+            return true;
+        }
+        return signal.wait_for(lock, std::chrono::milliseconds(ticks), ready);
+    }
+}
+
+// ============================================================================
+// TIME BASE
+// ============================================================================
+
+int64_t esp_timer_get_time()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - simStart)
+        .count();
+}
+
+uint32_t millis() { return (uint32_t)(esp_timer_get_time() / 1000); }
+uint32_t micros() { return (uint32_t)esp_timer_get_time(); }
+void delay(uint32_t ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+void delayMicroseconds(uint32_t us) { std::this_thread::sleep_for(std::chrono::microseconds(us)); }
+
+// ============================================================================
+// CHIP
+// ============================================================================
+
+uint64_t HostESP::getEfuseMac() { return SIM_EFUSE_MAC; }
+
+void HostESP::restart() { esp_restart(); }
+
+void esp_restart()
+{
+    fflush(stdout);
+    exit(0);
+}
+
+// ============================================================================
+// GPIO
+// ============================================================================
+
+namespace
+{
+    const int SIM_PIN_COUNT = 64;
+
+    struct SimPin
+    {
+        int level = HIGH; // Idle high: inputs are pulled up like the encoder button
+        int interruptMode = 0;
+        void (*handler)(void *) = nullptr;
+        void *arg = nullptr;
+    };
+
+    SimPin simPins[SIM_PIN_COUNT];
+    std::mutex simPinLock;
+}
+
+void pinMode(uint8_t, uint8_t) {}
+
+void digitalWrite(uint8_t pin, uint8_t level)
+{
+    if (pin < SIM_PIN_COUNT)
+        simPins[pin].level = level ? HIGH : LOW;
+}
+
+int digitalRead(uint8_t pin)
+{
+    return pin < SIM_PIN_COUNT ? simPins[pin].level : LOW;
+}
+
+void attachInterruptArg(uint8_t pin, void (*handler)(void *), void *arg, int mode)
+{
+    if (pin >= SIM_PIN_COUNT)
+        return;
+
+    std::lock_guard<std::mutex> guard(simPinLock);
+    simPins[pin].handler = handler;
+    simPins[pin].arg = arg;
+    simPins[pin].interruptMode = mode;
+}
+
+void detachInterrupt(uint8_t pin)
+{
+    attachInterruptArg(pin, nullptr, nullptr, 0);
+}
+
+void simSetPinLevel(uint8_t pin, int level)
+{
+    if (pin >= SIM_PIN_COUNT)
+        return;
+
+    void (*handler)(void *) = nullptr;
+    void *arg = nullptr;
+    {
+        std::lock_guard<std::mutex> guard(simPinLock);
+        SimPin &simPin = simPins[pin];
+        level = level ? HIGH : LOW;
+        if (simPin.level == level)
+            return;
+        simPin.level = level;
+
+        bool rising = level == HIGH;
+        if (simPin.interruptMode == CHANGE ||
+            (simPin.interruptMode == RISING && rising) ||
+            (simPin.interruptMode == FALLING && !rising))
+        {
+            handler = simPin.handler;
+            arg = simPin.arg;
+        }
+    }
+
+    // "Interrupt" runs on the calling thread, after the level is visible
+    if (handler)
+        handler(arg);
+}
+
+// ============================================================================
+// TASKS AND NOTIFICATIONS
+// ============================================================================
+
+struct SimTask
+{
+    std::string name;
+    BaseType_t core = 1;
+    TaskFunction_t function = nullptr;
+    void *param = nullptr;
+
+    std::mutex lock;
+    std::condition_variable signal;
+    uint32_t notifications = 0;
+};
+
+namespace
+{
+    thread_local SimTask *currentTask = nullptr;
+    std::atomic<UBaseType_t> simTaskCount(0);
+
+    TaskHandle_t startTask(TaskFunction_t function, const char *name, void *param, BaseType_t core)
+    {
+        SimTask *task = new SimTask();
+        task->name = name ? name : "task";
+        task->core = core;
+        task->function = function;
+        task->param = param;
+        simTaskCount++;
+
+        std::thread([task]() {
+            currentTask = task;
+            task->function(task->param);
+            simTaskCount--;
+        }).detach();
+        return task;
+    }
+}
+
+BaseType_t xPortGetCoreID()
+{
+    return xTaskGetCurrentTaskHandle()->core;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char *name, uint32_t,
+                                   void *param, UBaseType_t, TaskHandle_t *handle, BaseType_t core)
+{
+    TaskHandle_t task = startTask(function, name, param, core);
+    if (handle)
+        *handle = task;
+    return pdPASS;
+}
+
+TaskHandle_t xTaskCreateStaticPinnedToCore(TaskFunction_t function, const char *name, uint32_t,
+                                           void *param, UBaseType_t, StackType_t *,
+                                           StaticTask_t *, BaseType_t core)
+{
+    return startTask(function, name, param, core);
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+    if (task == nullptr || task == currentTask)
+    {
+        simTaskCount--;
+        pthread_exit(nullptr);
+    }
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle()
+{
+    // Threads not started by xTaskCreate*() (main, SDL loop) get a handle on first use
+    if (!currentTask)
+    {
+        currentTask = new SimTask();
+        currentTask->name = "host";
+    }
+    return currentTask;
+}
+
+const char *pcTaskGetName(TaskHandle_t task)
+{
+    return (task ? task : xTaskGetCurrentTaskHandle())->name.c_str();
+}
+
+void vTaskDelay(TickType_t ticks) { delay(ticks); }
+TickType_t xTaskGetTickCount() { return millis(); }
+UBaseType_t uxTaskGetNumberOfTasks() { return simTaskCount.load(); }
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t) { return 0; }
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    if (!task)
+        return pdFAIL;
+
+    {
+        std::lock_guard<std::mutex> guard(task->lock);
+        task->notifications++;
+    }
+    task->signal.notify_one();
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higherPriorityTaskWoken)
+{
+    xTaskNotifyGive(task);
+    if (higherPriorityTaskWoken)
+        *higherPriorityTaskWoken = pdFALSE;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks)
+{
+    SimTask *task = xTaskGetCurrentTaskHandle();
+    std::unique_lock<std::mutex> lock(task->lock);
+    waitTicks(task->signal, lock, ticks, [task]() { return task->notifications > 0; });
+
+    uint32_t count = task->notifications;
+    if (count > 0)
+        task->notifications = clearOnExit ? 0 : count - 1;
+    return count;
+}
+
+// ============================================================================
+// QUEUES
+// ============================================================================
+
+struct SimQueue
+{
+    std::mutex lock;
+    std::condition_variable itemSignal;
+    std::condition_variable spaceSignal;
+    std::vector<uint8_t> storage;
+    UBaseType_t length = 0;
+    UBaseType_t itemSize = 0;
+    UBaseType_t head = 0;
+    UBaseType_t count = 0;
+};
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize)
+{
+    SimQueue *queue = new SimQueue();
+    queue->length = length;
+    queue->itemSize = itemSize;
+    queue->storage.resize((size_t)length * itemSize);
+    return queue;
+}
+
+QueueHandle_t xQueueCreateStatic(UBaseType_t length, UBaseType_t itemSize, uint8_t *, StaticQueue_t *)
+{
+    return xQueueCreate(length, itemSize);
+}
+
+void vQueueDelete(QueueHandle_t queue) { delete queue; }
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks)
+{
+    std::unique_lock<std::mutex> lock(queue->lock);
+    if (!waitTicks(queue->spaceSignal, lock, ticks, [queue]() { return queue->count < queue->length; }))
+        return errQUEUE_FULL;
+
+    UBaseType_t slot = (queue->head + queue->count) % queue->length;
+    memcpy(&queue->storage[(size_t)slot * queue->itemSize], item, queue->itemSize);
+    queue->count++;
+    lock.unlock();
+    queue->itemSignal.notify_one();
+    return pdPASS;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks)
+{
+    std::unique_lock<std::mutex> lock(queue->lock);
+    if (!waitTicks(queue->itemSignal, lock, ticks, [queue]() { return queue->count > 0; }))
+        return pdFALSE;
+
+    memcpy(item, &queue->storage[(size_t)queue->head * queue->itemSize], queue->itemSize);
+    queue->head = (queue->head + 1) % queue->length;
+    queue->count--;
+    lock.unlock();
+    queue->spaceSignal.notify_one();
+    return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue)
+{
+    std::lock_guard<std::mutex> guard(queue->lock);
+    return queue->count;
+}
+
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t queue)
+{
+    std::lock_guard<std::mutex> guard(queue->lock);
+    return queue->length - queue->count;
+}
+
+// ============================================================================
+// SEMAPHORES
+// ============================================================================
+
+struct SimSemaphore
+{
+    std::mutex lock;
+    std::condition_variable signal;
+    UBaseType_t count = 0;
+};
+
+namespace
+{
+    SemaphoreHandle_t createSemaphore(UBaseType_t initial)
+    {
+        SimSemaphore *semaphore = new SimSemaphore();
+        semaphore->count = initial;
+        return semaphore;
+    }
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary() { return createSemaphore(0); }
+SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t *) { return createSemaphore(0); }
+SemaphoreHandle_t xSemaphoreCreateMutex() { return createSemaphore(1); }
+SemaphoreHandle_t xSemaphoreCreateMutexStatic(StaticSemaphore_t *) { return createSemaphore(1); }
+void vSemaphoreDelete(SemaphoreHandle_t semaphore) { delete semaphore; }
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks)
+{
+    std::unique_lock<std::mutex> lock(semaphore->lock);
+    if (!waitTicks(semaphore->signal, lock, ticks, [semaphore]() { return semaphore->count > 0; }))
+        return pdFALSE;
+
+    semaphore->count--;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+    {
+        std::lock_guard<std::mutex> guard(semaphore->lock);
+        if (semaphore->count > 0)
+            return pdFALSE; // Binary: already given
+        semaphore->count = 1;
+    }
+    semaphore->signal.notify_one();
+    return pdTRUE;
+}
+
+#endif // CLOUDMOUSE_SIM
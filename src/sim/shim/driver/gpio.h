@@ -0,0 +1,16 @@
+/**
+ * CloudMouse SDK - Host Simulator GPIO Driver Shim
+ *
+ * Reads the simulated pin table (see simSetPinLevel() in Arduino.h).
+ */
+
+#ifndef CLOUDMOUSE_SIM_DRIVER_GPIO_H
+#define CLOUDMOUSE_SIM_DRIVER_GPIO_H
+
+#include <Arduino.h>
+
+typedef int gpio_num_t;
+
+inline int gpio_get_level(gpio_num_t pin) { return digitalRead((uint8_t)pin); }
+
+#endif
@@ -0,0 +1,15 @@
+/**
+ * CloudMouse SDK - Host Simulator LEDC Driver Shim
+ *
+ * Channel and timer identifiers only: nothing drives a PWM output on the host.
+ */
+
+#ifndef CLOUDMOUSE_SIM_DRIVER_LEDC_H
+#define CLOUDMOUSE_SIM_DRIVER_LEDC_H
+
+typedef enum { LEDC_LOW_SPEED_MODE = 0 } ledc_mode_t;
+typedef enum { LEDC_TIMER_0 = 0, LEDC_TIMER_1, LEDC_TIMER_2, LEDC_TIMER_3 } ledc_timer_t;
+typedef enum { LEDC_CHANNEL_0 = 0, LEDC_CHANNEL_1, LEDC_CHANNEL_2, LEDC_CHANNEL_3,
+               LEDC_CHANNEL_4, LEDC_CHANNEL_5, LEDC_CHANNEL_6, LEDC_CHANNEL_7 } ledc_channel_t;
+
+#endif
@@ -0,0 +1,15 @@
+/**
+ * CloudMouse SDK - Host Simulator esp_attr Shim
+ *
+ * Placement attributes have no meaning on the host: all empty.
+ */
+
+#ifndef CLOUDMOUSE_SIM_ESP_ATTR_H
+#define CLOUDMOUSE_SIM_ESP_ATTR_H
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define DMA_ATTR
+#define EXT_RAM_BSS_ATTR
+
+#endif
@@ -0,0 +1,10 @@
+/**
+ * CloudMouse SDK - Host Simulator esp_err Shim
+ */
+
+#ifndef CLOUDMOUSE_SIM_ESP_ERR_H
+#define CLOUDMOUSE_SIM_ESP_ERR_H
+
+#include "esp_system.h"
+
+#endif
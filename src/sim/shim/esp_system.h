@@ -0,0 +1,17 @@
+/**
+ * CloudMouse SDK - Host Simulator esp_system Shim
+ */
+
+#ifndef CLOUDMOUSE_SIM_ESP_SYSTEM_H
+#define CLOUDMOUSE_SIM_ESP_SYSTEM_H
+
+#include <stdint.h>
+
+typedef int esp_err_t;
+
+#define ESP_OK 0
+#define ESP_FAIL -1
+
+void esp_restart();
+
+#endif
@@ -0,0 +1,17 @@
+/**
+ * CloudMouse SDK - Host Simulator esp_timer Shim
+ *
+ * Microsecond time base only (same clock as micros()); one-shot and
+ * periodic timers are not simulated.
+ */
+
+#ifndef CLOUDMOUSE_SIM_ESP_TIMER_H
+#define CLOUDMOUSE_SIM_ESP_TIMER_H
+
+#include <stdint.h>
+
+typedef struct esp_timer *esp_timer_handle_t;
+
+int64_t esp_timer_get_time();
+
+#endif
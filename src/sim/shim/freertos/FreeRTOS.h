@@ -0,0 +1,65 @@
+/**
+ * CloudMouse SDK - Host Simulator FreeRTOS Shim
+ *
+ * Just enough of the ESP-IDF FreeRTOS API for the simulated SDK modules:
+ * tasks are std::threads, spinlocks are recursive mutexes, one tick is one
+ * millisecond. Scheduling (priorities, core pinning) is left to the host OS,
+ * so timings are only meaningful relative to each other.
+ *
+ * Static creation functions accept the caller's storage but allocate on the
+ * host heap; the Static* types only keep their device sizes for the memory
+ * budget report.
+ */
+
+#ifndef CLOUDMOUSE_SIM_FREERTOS_H
+#define CLOUDMOUSE_SIM_FREERTOS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <mutex>
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+typedef uint8_t StackType_t;
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define pdFAIL 0
+#define errQUEUE_FULL 0
+
+#define portMAX_DELAY ((TickType_t)0xffffffffUL)
+#define portTICK_PERIOD_MS 1
+#define configTICK_RATE_HZ 1000
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+// Device sizes of the static control blocks (ESP32-S3, IDF 4.4)
+struct StaticTask_t { uint8_t reserved[344]; };
+struct StaticQueue_t { uint8_t reserved[80]; };
+typedef StaticQueue_t StaticSemaphore_t;
+
+// ============================================================================
+// CRITICAL SECTIONS
+// ============================================================================
+
+struct portMUX_TYPE
+{
+    std::recursive_mutex mutex;
+};
+
+#define portMUX_INITIALIZER_UNLOCKED {}
+
+#define portENTER_CRITICAL(mux) ((mux)->mutex.lock())
+#define portEXIT_CRITICAL(mux) ((mux)->mutex.unlock())
+#define portENTER_CRITICAL_ISR(mux) portENTER_CRITICAL(mux)
+#define portEXIT_CRITICAL_ISR(mux) portEXIT_CRITICAL(mux)
+#define taskENTER_CRITICAL(mux) portENTER_CRITICAL(mux)
+#define taskEXIT_CRITICAL(mux) portEXIT_CRITICAL(mux)
+
+#define portYIELD_FROM_ISR() ((void)0)
+
+// Simulated tasks all report the core they would be pinned to on device
+BaseType_t xPortGetCoreID();
+
+#endif
@@ -0,0 +1,26 @@
+/**
+ * CloudMouse SDK - Host Simulator FreeRTOS Queue Shim
+ *
+ * Fixed-size item copies into a bounded FIFO, blocking with a timeout.
+ */
+
+#ifndef CLOUDMOUSE_SIM_FREERTOS_QUEUE_H
+#define CLOUDMOUSE_SIM_FREERTOS_QUEUE_H
+
+#include "FreeRTOS.h"
+
+struct SimQueue;
+typedef SimQueue *QueueHandle_t;
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize);
+QueueHandle_t xQueueCreateStatic(UBaseType_t length, UBaseType_t itemSize, uint8_t *storage, StaticQueue_t *control);
+void vQueueDelete(QueueHandle_t queue);
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks);
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue);
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t queue);
+
+#define xQueueSendToBack(queue, item, ticks) xQueueSend(queue, item, ticks)
+
+#endif
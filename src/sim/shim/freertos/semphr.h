@@ -0,0 +1,25 @@
+/**
+ * CloudMouse SDK - Host Simulator FreeRTOS Semaphore Shim
+ *
+ * Binary semaphores and (recursive) mutexes over a counter and a condition
+ * variable.
+ */
+
+#ifndef CLOUDMOUSE_SIM_FREERTOS_SEMPHR_H
+#define CLOUDMOUSE_SIM_FREERTOS_SEMPHR_H
+
+#include "FreeRTOS.h"
+
+struct SimSemaphore;
+typedef SimSemaphore *SemaphoreHandle_t;
+
+SemaphoreHandle_t xSemaphoreCreateBinary();
+SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t *buffer);
+SemaphoreHandle_t xSemaphoreCreateMutex();
+SemaphoreHandle_t xSemaphoreCreateMutexStatic(StaticSemaphore_t *buffer);
+void vSemaphoreDelete(SemaphoreHandle_t semaphore);
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore);
+
+#endif
@@ -0,0 +1,44 @@
+/**
+ * CloudMouse SDK - Host Simulator FreeRTOS Task Shim
+ *
+ * Tasks run on std::threads. Threads not created here (main, the SDL loop)
+ * get a task handle on first use, so task notifications work the same from
+ * any thread.
+ */
+
+#ifndef CLOUDMOUSE_SIM_FREERTOS_TASK_H
+#define CLOUDMOUSE_SIM_FREERTOS_TASK_H
+
+#include "FreeRTOS.h"
+
+struct SimTask;
+typedef SimTask *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char *name, uint32_t stackDepth,
+                                   void *param, UBaseType_t priority, TaskHandle_t *handle, BaseType_t core);
+TaskHandle_t xTaskCreateStaticPinnedToCore(TaskFunction_t function, const char *name, uint32_t stackDepth,
+                                           void *param, UBaseType_t priority, StackType_t *stack,
+                                           StaticTask_t *tcb, BaseType_t core);
+
+// Deleting the calling task ends its thread; other tasks are only detached
+void vTaskDelete(TaskHandle_t task);
+
+TaskHandle_t xTaskGetCurrentTaskHandle();
+const char *pcTaskGetName(TaskHandle_t task);
+
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount();
+
+UBaseType_t uxTaskGetNumberOfTasks();
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task);
+
+// ============================================================================
+// TASK NOTIFICATIONS (counting semantics, as used by the SDK)
+// ============================================================================
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higherPriorityTaskWoken);
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks);
+
+#endif
@@ -0,0 +1,82 @@
+/**
+ * CloudMouse SDK - Host Simulator SHA-1 Shim
+ *
+ * One-shot mbedtls_sha1() (FIPS 180-1) so DeviceID derives the same UUID
+ * from the simulated MAC as the device would from its eFuse MAC.
+ */
+
+#ifndef CLOUDMOUSE_SIM_MBEDTLS_SHA1_H
+#define CLOUDMOUSE_SIM_MBEDTLS_SHA1_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+inline int mbedtls_sha1(const unsigned char *input, size_t length, unsigned char output[20])
+{
+    uint32_t h[5] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+    uint64_t bitLength = (uint64_t)length * 8;
+
+    // Message + 0x80 + zero padding + 64-bit length, in 64-byte blocks
+    size_t total = ((length + 8) / 64 + 1) * 64;
+    for (size_t offset = 0; offset < total; offset += 64)
+    {
+        uint8_t block[64];
+        for (size_t i = 0; i < 64; i++)
+        {
+            size_t index = offset + i;
+            if (index < length)
+                block[i] = input[index];
+            else if (index == length)
+                block[i] = 0x80;
+            else if (index >= total - 8)
+                block[i] = (uint8_t)(bitLength >> (8 * (total - 1 - index)));
+            else
+                block[i] = 0;
+        }
+
+        uint32_t w[80];
+        for (int i = 0; i < 16; i++)
+            w[i] = (uint32_t)block[i * 4] << 24 | (uint32_t)block[i * 4 + 1] << 16 |
+                   (uint32_t)block[i * 4 + 2] << 8 | block[i * 4 + 3];
+        for (int i = 16; i < 80; i++)
+        {
+            uint32_t x = w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16];
+            w[i] = x << 1 | x >> 31;
+        }
+
+        uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+        for (int i = 0; i < 80; i++)
+        {
+            uint32_t f, k;
+            if (i < 20) { f = (b & c) | (~b & d); k = 0x5A827999; }
+            else if (i < 40) { f = b ^ c ^ d; k = 0x6ED9EBA1; }
+            else if (i < 60) { f = (b & c) | (b & d) | (c & d); k = 0x8F1BBCDC; }
+            else { f = b ^ c ^ d; k = 0xCA62C1D6; }
+
+            uint32_t temp = (a << 5 | a >> 27) + f + e + k + w[i];
+            e = d;
+            d = c;
+            c = b << 30 | b >> 2;
+            b = a;
+            a = temp;
+        }
+
+        h[0] += a;
+        h[1] += b;
+        h[2] += c;
+        h[3] += d;
+        h[4] += e;
+    }
+
+    for (int i = 0; i < 5; i++)
+    {
+        output[i * 4] = (uint8_t)(h[i] >> 24);
+        output[i * 4 + 1] = (uint8_t)(h[i] >> 16);
+        output[i * 4 + 2] = (uint8_t)(h[i] >> 8);
+        output[i * 4 + 3] = (uint8_t)h[i];
+    }
+    return 0;
+}
+
+#endif
@@ -0,0 +1,292 @@
+/**
+ * CloudMouse SDK - Host Simulator
+ *
+ * Built by the [env:native] PlatformIO environment (pio run -e native, then
+ * .pio/build/native/program). Runs DisplayManager, EventBus, EncoderManager
+ * and an optional app orchestrator on the desktop, in an SDL window, so
+ * screen layouts and event storms can be profiled without flashing:
+ *
+ *   program                                    keyboard input (see SimInput.h)
+ *   program --record session.trace             keyboard input, saved as a trace
+ *   program --trace session.trace --exit       replay, report, quit
+ *   program --trace storm.trace --frames frames.csv
+ *
+ * The two SDK tasks are reproduced as on the device: the SDL thread is the UI
+ * task (encoder, EventBus publish, DisplayManager::update()), a second task
+ * is the coordination task (receiveFromUI() drain to the app, app update()).
+ * Core itself is not built: WiFi, web server, NVS, LEDs and buzzer have no
+ * host counterpart, so there is no boot sequence and no LED/buzzer feedback.
+ * The hello screen is shown at start; other screens are reached with trace
+ * events (e.g. "0 event DISPLAY_WIFI_AP_MODE").
+ *
+ * Reports:
+ * - --frames writes one CSV row per rendered frame:
+ *   t_ms,frame_us,render_us,flush_us,pixels,areas
+ * - On exit (and with P) the DisplayManager frame profiler report; on exit
+ *   (and with M) the EventBus metrics; on exit the input latency stages when
+ *   INPUT_LATENCY_TRACE is enabled
+ * Host times are only comparable with each other: rendering runs on a
+ * desktop CPU and flushes go to an SDL texture, not over SPI.
+ *
+ * App layer:
+ * - Define CloudMouse::IAppOrchestrator *simCreateApp() in any file under
+ *   src/sim/ to run an app orchestrator; it receives the SDK events it
+ *   subscribes to exactly as Core would forward them
+ *
+ * Headless runs (CI): SDL_VIDEODRIVER=dummy program --trace ... --exit
+ */
+
+#if defined(CLOUDMOUSE_SIM)
+
+#include <Arduino.h>
+#include "../../lib/core/AppOrchestrator.h"
+#include "../../lib/core/EventBus.h"
+#include "../../lib/hardware/DisplayManager.h"
+#include "../../lib/hardware/EncoderManager.h"
+#include "../../lib/utils/AsyncLogger.h"
+#include "../../lib/utils/LatencyTracer.h"
+#include "../../lib/utils/Logger.h"
+#include "./SimInput.h"
+
+using namespace CloudMouse;
+using namespace CloudMouse::Hardware;
+using namespace CloudMouse::Sim;
+
+/**
+ * App orchestrator of the simulation (weak default: none)
+ */
+__attribute__((weak)) IAppOrchestrator *simCreateApp()
+{
+    return nullptr;
+}
+
+namespace
+{
+    // Time left for the last replayed frames to render before --exit quits
+    const uint32_t SIM_EXIT_SETTLE_MS = 1000;
+
+    struct SimOptions
+    {
+        const char *tracePath = nullptr;
+        const char *recordPath = nullptr;
+        const char *framesPath = nullptr;
+        bool exitAtTraceEnd = false;
+    };
+
+    SimOptions options;
+
+    EncoderManager encoder;
+    DisplayManager display;
+    SimInput input;
+
+    IAppOrchestrator *app = nullptr;
+    EventMask appEventMask = EVENT_MASK_NONE;
+    FILE *framesFile = nullptr;
+
+    // Core's own subscription (Core::CORE_EVENT_MASK): encoder input for the feedback handlers
+    const EventMask SIM_CORE_EVENT_MASK = (1u << (uint8_t)EventType::ENCODER_INPUT);
+
+    // ============================================================================
+    // COORDINATION TASK (stands in for Core::runCoordinationTask)
+    // ============================================================================
+
+    void notifyApp(const Event &event)
+    {
+        if (app && (appEventMask & eventBit(event.type)))
+            app->processSDKEvent(event);
+    }
+
+    void coordinationTask(void *)
+    {
+        EventBus::instance().setMainTaskHandle(xTaskGetCurrentTaskHandle());
+        uint32_t lastAppUpdateMs = millis();
+
+        while (true)
+        {
+            // Same forwarding as Core::processEvents() / handleEncoderInput()
+            Event event;
+            while (EventBus::instance().receiveFromUI(event, 0))
+            {
+                notifyApp(event);
+
+                if (event.type == EventType::ENCODER_INPUT)
+                {
+                    Event expanded[INPUT_SNAPSHOT_MAX_EVENTS];
+                    int count = expandInputSnapshot(event, expanded);
+                    for (int i = 0; i < count; i++)
+                        notifyApp(expanded[i]);
+                }
+            }
+
+            uint32_t sleepMs = CORE_HEALTH_CHECK_MS;
+            if (app)
+            {
+                uint32_t elapsed = millis() - lastAppUpdateMs;
+                if (elapsed >= CORE_APP_UPDATE_MS)
+                {
+                    app->update();
+                    lastAppUpdateMs = millis();
+                    elapsed = 0;
+                }
+                sleepMs = CORE_APP_UPDATE_MS - elapsed;
+            }
+
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(sleepMs));
+        }
+    }
+
+    // ============================================================================
+    // FRAME TRACE
+    // ============================================================================
+
+    void onFrame(uint32_t frameUs, uint32_t flushUs, uint32_t pixels, uint32_t areas)
+    {
+        if (!framesFile)
+            return;
+
+        fprintf(framesFile, "%lu,%lu,%lu,%lu,%lu,%lu\n",
+                (unsigned long)millis(), (unsigned long)frameUs,
+                (unsigned long)(frameUs > flushUs ? frameUs - flushUs : 0),
+                (unsigned long)flushUs, (unsigned long)pixels, (unsigned long)areas);
+    }
+
+    // ============================================================================
+    // UI TASK (stands in for Core::runUITask, on the SDL user thread)
+    // ============================================================================
+
+    int simLoop(bool *running)
+    {
+        Serial.begin(115200);
+        Utils::AsyncLogger::begin();
+
+        SDK_LOGGER("");
+        SDK_LOGGER("🖥️ CloudMouse host simulator");
+
+        if (options.framesPath)
+        {
+            framesFile = fopen(options.framesPath, "w");
+            if (framesFile)
+                fprintf(framesFile, "t_ms,frame_us,render_us,flush_us,pixels,areas\n");
+            else
+                SDK_LOGGER("❌ Cannot create frame trace %s", options.framesPath);
+        }
+
+        if (options.tracePath && !input.openTrace(options.tracePath))
+            return 1;
+        if (options.recordPath)
+            input.openRecord(options.recordPath);
+
+        // Same subscriptions as Core::initialize() / updateSubscriptions()
+        EventBus::instance().initialize();
+        app = simCreateApp();
+        if (app)
+        {
+            app->initialize();
+            appEventMask = app->getSubscribedEvents();
+        }
+        EventBus::instance().subscribeUI(EVENT_MASK_ENCODER);
+        EventBus::instance().subscribeMain(SIM_CORE_EVENT_MASK | appEventMask);
+
+        TaskHandle_t self = xTaskGetCurrentTaskHandle();
+        EventBus::instance().setUITaskHandle(self);
+        xTaskCreatePinnedToCore(coordinationTask, "Coordination", 4096, nullptr, 2, nullptr, CORE_TASK_CORE);
+
+        encoder.init();
+        encoder.setWakeTask(self);
+        display.registerFrameCallback(onFrame);
+        display.init();
+
+        // No boot sequence without Core: go straight to the main interface
+        EventBus::instance().sendToUI(Event(EventType::DISPLAY_WAKE_UP));
+
+        uint32_t exitAtMs = 0;
+        while (*running)
+        {
+            input.poll();
+
+            encoder.update();
+            InputSnapshot snapshot;
+            if (encoder.takeSnapshot(snapshot))
+            {
+                Event inputEvent(EventType::ENCODER_INPUT);
+                inputEvent.setInputSnapshot(snapshot);
+                EventBus::instance().publish(inputEvent);
+            }
+
+            uint32_t sleepMs = display.update();
+            if (sleepMs > UI_TASK_MAX_SLEEP_MS)
+                sleepMs = UI_TASK_MAX_SLEEP_MS;
+
+            // The keyboard has no interrupt: poll it like a held button
+            if ((!input.isReplaying() || encoder.needsPolling()) && sleepMs > UI_TASK_INPUT_POLL_MS)
+                sleepMs = UI_TASK_INPUT_POLL_MS;
+            uint32_t nextActionMs = input.getNextDeadlineMs();
+            if (nextActionMs < sleepMs)
+                sleepMs = nextActionMs;
+
+            if (options.exitAtTraceEnd && input.isTraceFinished())
+            {
+                if (exitAtMs == 0)
+                    exitAtMs = millis() + SIM_EXIT_SETTLE_MS;
+                else if ((int32_t)(millis() - exitAtMs) >= 0)
+                    break;
+            }
+
+            if (sleepMs > 0)
+                ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(sleepMs));
+        }
+
+        // UI task context: the report reads LVGL state
+        display.processEvent(Event(EventType::DISPLAY_PROFILER_REPORT));
+        EventBus::instance().logMetrics();
+#if INPUT_LATENCY_TRACE
+        Utils::LatencyTracer::print();
+#endif
+        Utils::AsyncLogger::flush(1000);
+
+        if (framesFile)
+            fclose(framesFile);
+        return 0;
+    }
+
+    void printUsage(const char *program)
+    {
+        printf("Usage: %s [--trace file] [--record file] [--frames file.csv] [--exit]\n"
+               "  --trace   replay an input trace instead of reading the keyboard\n"
+               "  --record  write keyboard input to a trace file\n"
+               "  --frames  write per-frame render cost as CSV\n"
+               "  --exit    quit once the trace has been replayed\n",
+               program);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        bool hasValue = i + 1 < argc;
+        if (strcmp(argv[i], "--trace") == 0 && hasValue)
+            options.tracePath = argv[++i];
+        else if (strcmp(argv[i], "--record") == 0 && hasValue)
+            options.recordPath = argv[++i];
+        else if (strcmp(argv[i], "--frames") == 0 && hasValue)
+            options.framesPath = argv[++i];
+        else if (strcmp(argv[i], "--exit") == 0)
+            options.exitAtTraceEnd = true;
+        else
+        {
+            printUsage(argv[0]);
+            return strcmp(argv[i], "--help") == 0 ? 0 : 2;
+        }
+    }
+
+    if (options.exitAtTraceEnd && !options.tracePath)
+    {
+        printf("--exit needs --trace\n");
+        return 2;
+    }
+
+    return lgfx::Panel_sdl::main(simLoop);
+}
+
+#endif // CLOUDMOUSE_SIM
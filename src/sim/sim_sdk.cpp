@@ -0,0 +1,25 @@
+/**
+ * CloudMouse SDK - Host Simulator SDK Sources
+ *
+ * [env:native] ignores the lib/ folders as libraries (most of them need
+ * WiFi, NVS, RMT or LEDC and cannot build on the host); the SDK modules the
+ * simulator runs are compiled here instead, the same way bridge.cpp does it
+ * for the Arduino IDE.
+ */
+
+#if defined(CLOUDMOUSE_SIM)
+
+#include "../../lib/core/EventBus.cpp"
+#include "../../lib/core/EventChannel.cpp"
+#include "../../lib/core/EventMetrics.cpp"
+#include "../../lib/core/EventPayloadPool.cpp"
+#include "../../lib/core/EventQueue.cpp"
+#include "../../lib/hardware/DisplayManager.cpp"
+#include "../../lib/hardware/EncoderManager.cpp"
+#include "../../lib/hardware/UiStateStore.cpp"
+#include "../../lib/utils/AsyncLogger.cpp"
+#include "../../lib/utils/BootProfiler.cpp"
+#include "../../lib/utils/LatencyTracer.cpp"
+#include "../../lib/utils/MemoryBudget.cpp"
+
+#endif // CLOUDMOUSE_SIM
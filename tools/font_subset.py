@@ -0,0 +1,257 @@
+"""
+CloudMouse SDK - Build-time font subsetting (PlatformIO pre-script)
+
+Scans the UI sources for the Montserrat sizes and characters actually used and
+generates subset fonts with lv_font_conv into src/fonts_generated/.
+
+Generated fonts:
+- cm_font_montserrat_NN      one per size referenced as CM_FONT_NN (plus the
+                             LV_FONT_DEFAULT size), 4 bpp like the LVGL built-ins.
+                             Charset: printable ASCII (runtime text such as SSIDs
+                             and IPs), non-ASCII characters found in string
+                             literals and the LV_SYMBOL_* icons referenced.
+- cm_font_montserrat_NN_num  "pre-rasterized" numeric fonts for the sizes listed
+                             in custom_font_numeric_sizes: digits and separators
+                             only, 8 bpp, uncompressed, so glyphs are copied as A8
+                             masks without per-glyph unpacking on every redraw.
+
+On success CM_USE_SUBSET_FONTS is defined and lib/config/FontConfig.h maps the
+CM_FONT_* macros to the generated fonts; built-in Montserrat fonts are then
+disabled in lv_conf.h. If lv_font_conv is not available the build falls back to
+the built-in fonts (and the Arduino IDE build always does).
+
+platformio.ini options ([env] section):
+    custom_font_numeric_sizes = 36 48
+    custom_font_numeric_chars = 0123456789.,:-+%/
+
+Requires Node.js with lv_font_conv (npm install -g lv_font_conv).
+"""
+
+import hashlib
+import json
+import os
+import re
+import shutil
+import subprocess
+
+Import("env")  # noqa: F821 (provided by PlatformIO/SCons)
+
+PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+LIBDEPS_DIR = env.subst("$PROJECT_LIBDEPS_DIR/$PIOENV")  # noqa: F821
+OUTPUT_DIR = os.path.join(PROJECT_DIR, "src", "fonts_generated")
+STAMP_FILE = os.path.join(OUTPUT_DIR, ".stamp")
+SCRIPT_FILE = os.path.join(PROJECT_DIR, "tools", "font_subset.py")
+
+SCAN_DIRS = ["lib", "src"]
+SCAN_EXTENSIONS = (".cpp", ".h", ".c", ".ino")
+SKIP_DIRS = ("vendor", "fonts_generated")
+SKIP_FILES = ("FontConfig.h", "lv_conf.h")  # font tables, not font usages
+
+DEFAULT_SIZE = 14  # LV_FONT_DEFAULT in lv_conf.h
+BPP = 4
+NUMERIC_BPP = 8
+
+FONT_USAGE_RE = re.compile(r"\b(?:CM_FONT_|lv_font_montserrat_)(\d+)(_NUM)?\b")
+SYMBOL_USAGE_RE = re.compile(r"\bLV_SYMBOL_([A-Z0-9_]+)\b")
+STRING_RE = re.compile(r'"((?:[^"\\\n]|\\.)*)"')
+SYMBOL_DEF_RE = re.compile(r'#define\s+LV_SYMBOL_([A-Z0-9_]+)\s+"((?:\\x[0-9A-Fa-f]{2})+)"')
+
+
+def log(message):
+    print("[font_subset] " + message)
+
+
+def option(name, default):
+    return env.GetProjectOption(name, default)  # noqa: F821
+
+
+def source_files():
+    for base in SCAN_DIRS:
+        root_dir = os.path.join(PROJECT_DIR, base)
+        for root, dirs, files in os.walk(root_dir):
+            dirs[:] = [d for d in dirs if d not in SKIP_DIRS]
+            for name in files:
+                if name.endswith(SCAN_EXTENSIONS) and name not in SKIP_FILES:
+                    yield os.path.join(root, name)
+    for name in os.listdir(PROJECT_DIR):
+        if name.endswith(".ino"):
+            yield os.path.join(PROJECT_DIR, name)
+
+
+def find_lvgl_file(*parts):
+    if not os.path.isdir(LIBDEPS_DIR):
+        return None
+    for name in os.listdir(LIBDEPS_DIR):
+        if name.lower().startswith("lvgl"):
+            path = os.path.join(LIBDEPS_DIR, name, *parts)
+            if os.path.isfile(path):
+                return path
+    return None
+
+
+def load_symbol_codepoints():
+    path = find_lvgl_file("src", "font", "lv_symbol_def.h")
+    symbols = {}
+    if not path:
+        return symbols
+    with open(path, encoding="utf-8", errors="ignore") as handle:
+        for name, escaped in SYMBOL_DEF_RE.findall(handle.read()):
+            raw = bytes(int(h, 16) for h in re.findall(r"\\x([0-9A-Fa-f]{2})", escaped))
+            symbols[name] = ord(raw.decode("utf-8"))
+    return symbols
+
+
+def scan_sources():
+    sizes = {DEFAULT_SIZE}
+    numeric = set()
+    symbols = set()
+    characters = set()
+
+    for path in source_files():
+        with open(path, encoding="utf-8", errors="ignore") as handle:
+            text = handle.read()
+        for size, is_numeric in FONT_USAGE_RE.findall(text):
+            (numeric if is_numeric else sizes).add(int(size))
+        symbols.update(SYMBOL_USAGE_RE.findall(text))
+        for literal in STRING_RE.findall(text):
+            characters.update(ch for ch in literal if ord(ch) > 0x7E)
+
+    return sizes, numeric, symbols, characters
+
+
+def ranges_argument(codepoints):
+    return ",".join("0x%X" % cp for cp in sorted(codepoints))
+
+
+def font_converter():
+    tool = shutil.which("lv_font_conv")
+    if tool:
+        return [tool]
+    npx = shutil.which("npx")
+    if npx:
+        return [npx, "--no-install", "lv_font_conv"]
+    return None
+
+
+def generate(converter, name, size, bpp, compress, sources):
+    output = os.path.join(OUTPUT_DIR, name + ".c")
+    command = converter + [
+        "--size", str(size),
+        "--bpp", str(bpp),
+        "--format", "lvgl",
+        "--lv-include", "lvgl.h",
+        "--lv-font-name", name,
+        "-o", output,
+    ]
+    if not compress:
+        command.append("--no-compress")
+    for font_file, ranges in sources:
+        command += ["--font", font_file, "-r", ranges]
+
+    result = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+    if result.returncode != 0:
+        log("lv_font_conv failed for %s:\n%s" % (name, result.stdout))
+        return False
+    return True
+
+
+def write_header(fonts):
+    lines = [
+        "// Generated by tools/font_subset.py - do not edit",
+        "#pragma once",
+        "",
+        '#include "lvgl.h"',
+        "",
+    ]
+    for name, macro in fonts:
+        lines.append("LV_FONT_DECLARE(%s)" % name)
+    lines.append("")
+    for name, macro in fonts:
+        lines.append("#define %s (&%s)" % (macro, name))
+    lines.append("")
+    with open(os.path.join(OUTPUT_DIR, "cm_fonts_generated.h"), "w") as handle:
+        handle.write("\n".join(lines))
+
+
+def clean_output():
+    if os.path.isdir(OUTPUT_DIR):
+        shutil.rmtree(OUTPUT_DIR)
+
+
+def enable_subset_fonts():
+    env.Append(CPPDEFINES=["CM_USE_SUBSET_FONTS"])  # noqa: F821
+    env.Append(CPPPATH=[OUTPUT_DIR])  # noqa: F821
+
+
+def main():
+    montserrat = find_lvgl_file("scripts", "built_in_font", "Montserrat-Medium.ttf")
+    awesome = find_lvgl_file("scripts", "built_in_font", "FontAwesome5-Solid+Brands+Regular.woff")
+    if not montserrat:
+        log("Montserrat-Medium.ttf not found in LVGL package, using built-in fonts")
+        clean_output()
+        return
+
+    sizes, numeric_used, used_symbols, characters = scan_sources()
+    numeric_sizes = sorted(int(s) for s in option("custom_font_numeric_sizes", "36 48").split())
+
+    # CM_FONT_NN_NUM without a numeric variant falls back to the full font (FontConfig.h)
+    sizes |= numeric_used - set(numeric_sizes)
+    numeric_chars = option("custom_font_numeric_chars", "0123456789.,:-+%/") + " "
+
+    # Montserrat covers Latin-1 and Latin Extended-A; other literals (emoji) are dropped
+    text_codepoints = set(range(0x20, 0x7F)) | {ord(ch) for ch in characters if ord(ch) < 0x180}
+    symbol_table = load_symbol_codepoints()
+    symbol_codepoints = {symbol_table[s] for s in used_symbols if s in symbol_table}
+
+    config = {
+        "sizes": sorted(sizes),
+        "numeric_sizes": numeric_sizes,
+        "numeric_chars": numeric_chars,
+        "text": sorted(text_codepoints),
+        "symbols": sorted(symbol_codepoints),
+        "script": hashlib.sha1(open(SCRIPT_FILE, "rb").read()).hexdigest(),
+    }
+    digest = hashlib.sha1(json.dumps(config, sort_keys=True).encode("utf-8")).hexdigest()
+
+    if os.path.isfile(STAMP_FILE) and open(STAMP_FILE).read().strip() == digest:
+        log("subset fonts up to date (%s)" % ", ".join(str(s) for s in sorted(sizes)))
+        enable_subset_fonts()
+        return
+
+    converter = font_converter()
+    if not converter:
+        log("lv_font_conv not found (npm install -g lv_font_conv), using built-in fonts")
+        clean_output()
+        return
+
+    clean_output()
+    os.makedirs(OUTPUT_DIR)
+
+    fonts = []
+    for size in sorted(sizes):
+        name = "cm_font_montserrat_%d" % size
+        sources = [(montserrat, ranges_argument(text_codepoints))]
+        if symbol_codepoints and awesome:
+            sources.append((awesome, ranges_argument(symbol_codepoints)))
+        if not generate(converter, name, size, BPP, False, sources):
+            clean_output()
+            return
+        fonts.append((name, "CM_FONT_%d" % size))
+
+    for size in numeric_sizes:
+        name = "cm_font_montserrat_%d_num" % size
+        sources = [(montserrat, ranges_argument({ord(ch) for ch in numeric_chars}))]
+        if not generate(converter, name, size, NUMERIC_BPP, False, sources):
+            clean_output()
+            return
+        fonts.append((name, "CM_FONT_%d_NUM" % size))
+
+    write_header(fonts)
+    with open(STAMP_FILE, "w") as handle:
+        handle.write(digest)
+
+    log("generated %d subset fonts (%d text glyphs, %d symbols)" % (len(fonts), len(text_codepoints), len(symbol_codepoints)))
+    enable_subset_fonts()
+
+
+main()
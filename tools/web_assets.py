@@ -0,0 +1,103 @@
+"""
+CloudMouse SDK - Build-time web asset compression (PlatformIO pre-script)
+
+Compresses the provisioning pages in web/ with gzip and writes them as PROGMEM
+byte arrays to lib/network/WebAssets.h, which WebServerManager serves with
+Content-Encoding: gzip straight from flash.
+
+- Every web/<name>.<ext> becomes WEB_<NAME>_<EXT>_GZ / WEB_<NAME>_<EXT>_GZ_LEN
+- Output is deterministic (no gzip timestamp) and only rewritten when it
+  changes, so unchanged pages do not trigger a rebuild
+- The generated header is committed: the Arduino IDE build does not run
+  pre-scripts. After editing a page without PlatformIO, regenerate it with
+      python3 tools/web_assets.py
+"""
+
+import gzip
+import os
+import re
+
+try:
+    Import("env")  # noqa: F821 (provided by PlatformIO/SCons)
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+WEB_DIR = os.path.join(PROJECT_DIR, "web")
+OUTPUT_FILE = os.path.join(PROJECT_DIR, "lib", "network", "WebAssets.h")
+
+EXTENSIONS = (".html", ".css", ".js", ".json", ".svg")
+BYTES_PER_LINE = 16
+
+
+def log(message):
+    print("[web_assets] " + message)
+
+
+def symbol(name):
+    return "WEB_" + re.sub(r"[^A-Za-z0-9]", "_", name).upper() + "_GZ"
+
+
+def compress(path):
+    with open(path, "rb") as source:
+        data = source.read()
+    # mtime=0 keeps the output identical between builds
+    return data, gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def render(assets):
+    lines = [
+        "/**",
+        " * CloudMouse SDK - Compressed Web Assets",
+        " *",
+        " * GENERATED by tools/web_assets.py from web/ - do not edit.",
+        " * Serve with Content-Encoding: gzip.",
+        " */",
+        "",
+        "#pragma once",
+        "#include <Arduino.h>",
+        "",
+        "namespace CloudMouse::Network",
+        "{",
+    ]
+
+    for name, raw, packed in assets:
+        sym = symbol(name)
+        lines.append("    // %s: %d bytes, %d compressed" % (name, len(raw), len(packed)))
+        lines.append("    static const uint8_t %s[] PROGMEM = {" % sym)
+        for offset in range(0, len(packed), BYTES_PER_LINE):
+            chunk = packed[offset:offset + BYTES_PER_LINE]
+            lines.append("        " + ", ".join("0x%02x" % b for b in chunk) + ",")
+        lines.append("    };")
+        lines.append("    static const size_t %s_LEN = sizeof(%s);" % (sym, sym))
+        lines.append("")
+
+    lines.append("} // namespace CloudMouse::Network")
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    if not os.path.isdir(WEB_DIR):
+        log("no web/ directory, nothing to do")
+        return
+
+    assets = []
+    for name in sorted(os.listdir(WEB_DIR)):
+        if name.endswith(EXTENSIONS):
+            raw, packed = compress(os.path.join(WEB_DIR, name))
+            assets.append((name, raw, packed))
+
+    content = render(assets)
+    if os.path.isfile(OUTPUT_FILE):
+        with open(OUTPUT_FILE, "r", encoding="utf-8") as current:
+            if current.read() == content:
+                return
+
+    with open(OUTPUT_FILE, "w", encoding="utf-8") as output:
+        output.write(content)
+
+    for name, raw, packed in assets:
+        log("%s: %d -> %d bytes" % (name, len(raw), len(packed)))
+
+
+main()